@@ -123,7 +123,8 @@ archival_policy::lookup_result archival_policy::find_segment(
         return {};
     }
     // Invariant: it != set.end()
-    bool closed = !(*it)->has_appender();
+    // an idle active segment gets its appender back on the next append
+    bool closed = !(*it)->has_appender() && !(*it)->has_idle_appender();
     bool force_upload = upload_deadline_reached();
     if (!closed && !force_upload) {
         std::string_view reason = _upload_limit.has_value()
@@ -19,6 +19,7 @@
 #include "likely.h"
 #include "oncore.h"
 #include "seastarx.h"
+#include "utils/allocation_sampler.h"
 #include "utils/intrusive_list_helpers.h"
 #include "vassert.h"
 
@@ -236,6 +237,7 @@ inline void iobuf::create_new_fragment(size_t sz) {
     oncore_debug_verify(_verify_shard);
     auto chunk_max = std::max(sz, last_allocation_size());
     auto asz = details::io_allocation_size::next_allocation_size(chunk_max);
+    allocation_sampler::on_allocation(asz);
     auto f = new fragment(ss::temporary_buffer<char>(asz), fragment::empty{});
     append_take_ownership(f);
 }
@@ -20,6 +20,7 @@
 #include <seastar/core/sstring.hh>
 
 #include <memory>
+#include <string_view>
 
 /**
  * iobuf parser interface suitable for an iobuf passed by const-ref. also
@@ -46,6 +47,17 @@ public:
     size_t bytes_consumed() const { return _in.bytes_consumed(); }
 
     std::pair<int64_t, uint8_t> read_varlong() {
+        if (likely(_in.segment_bytes_left() >= vint::max_length)) {
+            // the varint can't cross the end of the fragment
+            auto [val, length_size] = vint::deserialize(
+              // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+              reinterpret_cast<const uint8_t*>(_in.segment_data()),
+              _in.segment_bytes_left());
+            if (likely(length_size != 0)) {
+                _in.skip(length_size);
+                return {val, length_size};
+            }
+        }
         auto [val, length_size] = vint::deserialize(_in);
         _in.skip(length_size);
         return {val, length_size};
@@ -84,6 +96,12 @@ public:
 
     void skip(size_t n) { _in.skip(n); }
 
+    /// Bytes following the current position up to the end of the current
+    /// fragment, for decoders working on contiguous memory
+    std::string_view peek_contiguous() const {
+        return {_in.segment_data(), _in.segment_bytes_left()};
+    }
+
     template<typename Consumer>
     requires requires(Consumer c, const char* src, size_t max) {
         { c(src, max) } -> std::same_as<ss::stop_iteration>;
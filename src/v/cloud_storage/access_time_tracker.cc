@@ -17,8 +17,11 @@
 #include <seastar/core/smp.hh>
 
 #include <absl/container/btree_map.h>
+#include <absl/container/flat_hash_set.h>
 
+#include <algorithm>
 #include <exception>
+#include <stdexcept>
 #include <variant>
 
 namespace absl {
@@ -54,20 +57,55 @@ void read_nested(
 
 namespace cloud_storage {
 
+static uint32_t to_seconds(std::chrono::system_clock::time_point ts) {
+    return std::chrono::time_point_cast<std::chrono::seconds>(ts)
+      .time_since_epoch()
+      .count();
+}
+
 void access_time_tracker::add_timestamp(
   std::string_view key, std::chrono::system_clock::time_point ts) {
-    uint32_t seconds = std::chrono::time_point_cast<std::chrono::seconds>(ts)
-                         .time_since_epoch()
-                         .count();
+    uint32_t seconds = to_seconds(ts);
+    uint32_t hash = xxhash_32(key.data(), key.size());
+    _table.data[hash] = seconds;
+    if (auto it = _files.find(key); it != _files.end()) {
+        touch(it->second, seconds);
+    }
+    _dirty = true;
+}
+
+void access_time_tracker::add_file(
+  std::string_view key,
+  std::chrono::system_clock::time_point ts,
+  uint64_t size) {
+    uint32_t seconds = to_seconds(ts);
     uint32_t hash = xxhash_32(key.data(), key.size());
     _table.data[hash] = seconds;
+    auto [it, inserted] = _files.try_emplace(
+      std::string(key), file_entry{.access_time = seconds, .size = 0});
+    if (inserted) {
+        it->second.path = &it->first;
+    }
+    _total_size = _total_size - it->second.size + size;
+    it->second.size = size;
+    touch(it->second, seconds);
     _dirty = true;
 }
 
+void access_time_tracker::touch(file_entry& e, timestamp_t seconds) {
+    e.access_time = std::max(e.access_time, seconds);
+    e._hook.unlink();
+    _lru.push_back(e);
+}
+
 void access_time_tracker::remove_timestamp(std::string_view key) noexcept {
     try {
         uint32_t hash = xxhash_32(key.data(), key.size());
         _table.data.erase(hash);
+        if (auto it = _files.find(key); it != _files.end()) {
+            _total_size -= it->second.size;
+            _files.erase(it);
+        }
         _dirty = true;
     } catch (...) {
         vassert(
@@ -78,14 +116,71 @@ void access_time_tracker::remove_timestamp(std::string_view key) noexcept {
     }
 }
 
-void access_time_tracker::remove_others(const access_time_tracker& t) {
-    table_t tmp;
-    for (auto it : _table.data) {
-        if (t._table.data.contains(it.first)) {
-            tmp.data.insert(it);
+std::vector<file_list_item>
+access_time_tracker::eviction_candidates(uint64_t size) const {
+    std::vector<file_list_item> candidates;
+    uint64_t candidates_size = 0;
+    for (auto it = _lru.begin();
+         it != _lru.end() && candidates_size < size;
+         ++it) {
+        candidates.push_back(file_list_item{
+          .access_time = std::chrono::system_clock::time_point(
+            std::chrono::seconds(it->access_time)),
+          .path = ss::sstring(*it->path),
+          .size = it->size});
+        candidates_size += it->size;
+    }
+    return candidates;
+}
+
+void access_time_tracker::reconcile(
+  const std::vector<file_list_item>& files,
+  std::chrono::system_clock::time_point walk_started) {
+    absl::flat_hash_set<std::string_view> present;
+    present.reserve(files.size());
+    for (const auto& f : files) {
+        present.insert(std::string_view(f.path));
+        auto seconds = to_seconds(f.access_time);
+        auto [it, inserted] = _files.try_emplace(
+          std::string(f.path),
+          file_entry{.access_time = seconds, .size = f.size});
+        if (inserted) {
+            it->second.path = &it->first;
+            _table.data[xxhash_32(f.path.data(), f.path.size())] = seconds;
+        } else {
+            it->second.size = f.size;
         }
     }
-    _table = std::move(tmp);
+
+    auto started = to_seconds(walk_started);
+    absl::erase_if(_files, [&present, started, this](const auto& kv) {
+        if (kv.second.access_time >= started || present.contains(kv.first)) {
+            return false;
+        }
+        _table.data.erase(xxhash_32(kv.first.data(), kv.first.size()));
+        return true;
+    });
+
+    rebuild_lru();
+    _dirty = true;
+}
+
+void access_time_tracker::rebuild_lru() {
+    std::vector<file_entry*> entries;
+    entries.reserve(_files.size());
+    _total_size = 0;
+    for (auto& [_, e] : _files) {
+        entries.push_back(&e);
+        _total_size += e.size;
+    }
+    std::stable_sort(
+      entries.begin(), entries.end(), [](const auto* a, const auto* b) {
+          return a->access_time < b->access_time;
+      });
+    _lru.clear();
+    for (auto* e : entries) {
+        _lru.push_back(*e);
+    }
 }
 
 std::optional<std::chrono::system_clock::time_point>
@@ -102,12 +197,49 @@ access_time_tracker::estimate_timestamp(std::string_view key) const {
 
 iobuf access_time_tracker::to_iobuf() {
     _dirty = false;
-    return serde::to_iobuf(_table);
+    table_t table;
+    table.data = _table.data;
+    table.paths.reserve(_files.size());
+    table.access_times.reserve(_files.size());
+    table.sizes.reserve(_files.size());
+    for (const auto& e : _lru) {
+        table.paths.emplace_back(*e.path);
+        table.access_times.push_back(e.access_time);
+        table.sizes.push_back(e.size);
+    }
+    return serde::to_iobuf(std::move(table));
 }
 
 void access_time_tracker::from_iobuf(iobuf b) {
     iobuf_parser parser(std::move(b));
-    _table = serde::read<table_t>(parser);
+    auto table = serde::read<table_t>(parser);
+    if (
+      table.paths.size() != table.access_times.size()
+      || table.paths.size() != table.sizes.size()) {
+        throw std::runtime_error(fmt::format(
+          "Inconsistent access time tracker index: {} paths, {} access times, "
+          "{} sizes",
+          table.paths.size(),
+          table.access_times.size(),
+          table.sizes.size()));
+    }
+    _lru.clear();
+    _files.clear();
+    _total_size = 0;
+    // Files are serialized from the least recently used one
+    for (size_t i = 0; i < table.paths.size(); i++) {
+        auto [it, inserted] = _files.try_emplace(
+          std::string(table.paths[i]),
+          file_entry{
+            .access_time = table.access_times[i], .size = table.sizes[i]});
+        if (!inserted) {
+            continue;
+        }
+        it->second.path = &it->first;
+        _total_size += it->second.size;
+        _lru.push_back(it->second);
+    }
+    _table.data = std::move(table.data);
     _dirty = false;
 }
 
@@ -14,16 +14,27 @@
 #include "hashing/xx.h"
 #include "seastarx.h"
 #include "serde/envelope.h"
+#include "utils/intrusive_list_helpers.h"
 
 #include <seastar/core/future.hh>
+#include <seastar/core/sstring.hh>
 
 #include <absl/container/btree_map.h>
+#include <absl/container/node_hash_map.h>
 
 #include <chrono>
+#include <string>
 #include <string_view>
+#include <vector>
 
 namespace cloud_storage {
 
+struct file_list_item {
+    std::chrono::system_clock::time_point access_time;
+    ss::sstring path;
+    uint64_t size;
+};
+
 /// Access time tracker maintains map from filename hash to
 /// the timestamp that represents the time when the file was
 /// accessed last.
@@ -34,18 +45,52 @@ namespace cloud_storage {
 /// conflicted entries will be deleted another will be deleted
 /// as well. This is OK because the code in the
 /// 'cloud_storage/cache_service' is ready for that.
+///
+/// The tracker also indexes the files of the cache by their full path.
+/// Every file added with 'add_file' is kept together with its size in a
+/// list ordered from the least to the most recently used one, so the
+/// cache can account its size and pick the files to evict without
+/// walking the cache directory. The index is persisted together with
+/// the access times.
 class access_time_tracker {
     using timestamp_t = uint32_t;
     struct table_t
-      : serde::envelope<table_t, serde::version<0>, serde::compat_version<0>> {
+      : serde::envelope<table_t, serde::version<1>, serde::compat_version<0>> {
         absl::btree_map<uint32_t, timestamp_t> data;
+        // Indexed files from the least recently used one, added in
+        // version 1.
+        std::vector<ss::sstring> paths;
+        std::vector<timestamp_t> access_times;
+        std::vector<uint64_t> sizes;
+    };
+
+    struct file_entry {
+        timestamp_t access_time;
+        uint64_t size;
+        // key of the entry in '_files'
+        const std::string* path{nullptr};
+        intrusive_list_hook _hook;
     };
 
 public:
-    /// Add access time to the container.
+    access_time_tracker() = default;
+    access_time_tracker(const access_time_tracker&) = delete;
+    access_time_tracker& operator=(const access_time_tracker&) = delete;
+    access_time_tracker(access_time_tracker&&) = delete;
+    access_time_tracker& operator=(access_time_tracker&&) = delete;
+    ~access_time_tracker() = default;
+
+    /// Add access time to the container. If the key is an indexed file
+    /// it becomes the most recently used one.
     void add_timestamp(
       std::string_view key, std::chrono::system_clock::time_point ts);
 
+    /// Add access time of the file and index it with its size.
+    void add_file(
+      std::string_view key,
+      std::chrono::system_clock::time_point ts,
+      uint64_t size);
+
     /// Remove key from the container.
     void remove_timestamp(std::string_view) noexcept;
 
@@ -61,11 +106,37 @@ public:
     /// to disk.
     bool is_dirty() const;
 
-    /// Remove every key which isn't present in 't'
-    void remove_others(const access_time_tracker& t);
+    /// Total size of the indexed files.
+    uint64_t total_size() const { return _total_size; }
+
+    /// Number of indexed files.
+    size_t file_count() const { return _files.size(); }
+
+    /// Returns the least recently used files, oldest first, whose total
+    /// size is at least 'size' bytes, or every file if there is not enough
+    /// of them.
+    std::vector<file_list_item> eviction_candidates(uint64_t size) const;
+
+    /// Reconcile the index with the actual content of the cache directory
+    /// listed by the directory walker. Files which are not indexed are
+    /// added and indexed files which are missing are removed, unless they
+    /// were accessed after 'walk_started' since the walker could have
+    /// missed them.
+    void reconcile(
+      const std::vector<file_list_item>& files,
+      std::chrono::system_clock::time_point walk_started);
 
 private:
+    using lru_list = intrusive_list<file_entry, &file_entry::_hook>;
+
+    void touch(file_entry&, timestamp_t);
+    void rebuild_lru();
+
     table_t _table;
+    // std::string keys for heterogeneous lookups by std::string_view
+    absl::node_hash_map<std::string, file_entry> _files;
+    lru_list _lru;
+    uint64_t _total_size{0};
     bool _dirty{false};
 };
 
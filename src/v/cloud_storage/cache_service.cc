@@ -103,10 +103,21 @@ cache::recursive_delete_empty_directory(const std::string_view& key) {
 
 uint64_t cache::get_total_cleaned() { return _total_cleaned; }
 
-ss::future<> cache::consume_cache_space(size_t sz) {
+void cache::update_probe() {
+    probe.set_size(_access_time_tracker.total_size());
+    probe.set_num_files(_access_time_tracker.file_count());
+}
+
+ss::future<> cache::consume_cache_space(ss::sstring path, size_t sz) {
+    vassert(ss::this_shard_id() == 0, "This method can only run on shard 0");
+    _access_time_tracker.add_file(path, std::chrono::system_clock::now(), sz);
+    update_probe();
+    co_await maybe_clean_up_cache();
+}
+
+ss::future<> cache::maybe_clean_up_cache() {
     vassert(ss::this_shard_id() == 0, "This method can only run on shard 0");
-    _current_cache_size += sz;
-    if (_current_cache_size > _max_cache_size) {
+    if (_access_time_tracker.total_size() > _max_cache_size) {
         auto units = ss::try_get_units(_cleanup_sm, 1);
         if (units) {
             co_await clean_up_cache();
@@ -117,102 +128,120 @@ ss::future<> cache::consume_cache_space(size_t sz) {
 
 ss::future<> cache::clean_up_at_start() {
     gate_guard guard{_gate};
-    auto [cache_size, candidates_for_deletion] = co_await _walker.walk(
-      _cache_dir.native(), _access_time_tracker);
-    probe.set_size(cache_size);
-    probe.set_num_files(candidates_for_deletion.size());
-
-    // The state of the _access_time_tracker and the actual content of the
-    // cache directory might diverge over time (if the user removes segment
-    // files manually). We need to take this into account.
-    access_time_tracker tmp;
-    for (const auto& it : candidates_for_deletion) {
-        tmp.add_timestamp(
-          it.path, std::chrono::system_clock::time_point::min());
-    }
-    _access_time_tracker.remove_others(tmp);
-    _current_cache_size = cache_size;
+    auto walk_started = std::chrono::system_clock::now();
+    auto [cache_size, files] = co_await _walker.walk(
+      _cache_dir.lexically_normal().native(), _access_time_tracker);
 
-    for (auto& file_item : candidates_for_deletion) {
+    std::vector<file_list_item> cached_files;
+    cached_files.reserve(files.size());
+    uint64_t deleted_size = 0;
+    for (auto& file_item : files) {
         auto filepath_to_remove = file_item.path;
+        if (!std::string_view(filepath_to_remove).ends_with(tmp_extension)) {
+            cached_files.push_back(std::move(file_item));
+            continue;
+        }
 
-        // delete only tmp files that are left from previous RedPanda run
-        if (std::string_view(filepath_to_remove).ends_with(tmp_extension)) {
-            try {
-                co_await recursive_delete_empty_directory(filepath_to_remove);
-                _total_cleaned += file_item.size;
-            } catch (std::exception& e) {
-                vlog(
-                  cst_log.error,
-                  "Cache eviction couldn't delete {}: {}.",
-                  filepath_to_remove,
-                  e.what());
+        // delete only tmp files that are left from previous RedPanda run,
+        // the walk runs concurrently with puts of this one
+        try {
+            auto stat = co_await ss::file_stat(filepath_to_remove);
+            if (stat.time_modified >= _started) {
+                continue;
             }
+            co_await recursive_delete_empty_directory(filepath_to_remove);
+            deleted_size += file_item.size;
+        } catch (std::exception& e) {
+            vlog(
+              cst_log.error,
+              "Cache eviction couldn't delete {}: {}.",
+              filepath_to_remove,
+              e.what());
         }
     }
+    _total_cleaned += deleted_size;
+
+    // The state of the _access_time_tracker and the actual content of the
+    // cache directory might diverge over time (if the user removes segment
+    // files manually or if the index wasn't saved). We need to take this into
+    // account.
+    auto indexed_size = _access_time_tracker.total_size();
+    _access_time_tracker.reconcile(cached_files, walk_started);
+    update_probe();
     vlog(
       cst_log.debug,
-      "Clean up at start deleted files of total size {}.",
-      _total_cleaned);
+      "Clean up at start deleted files of total size {}, cache size {} ({} "
+      "before reconciliation), {} files",
+      deleted_size,
+      _access_time_tracker.total_size(),
+      indexed_size,
+      _access_time_tracker.file_count());
+
+    co_await maybe_clean_up_cache();
 }
 
 ss::future<> cache::clean_up_cache() {
     vassert(ss::this_shard_id() == 0, "Method can only be invoked on shard 0");
     gate_guard guard{_gate};
-    auto [_current_cache_size, candidates_for_deletion] = co_await _walker.walk(
-      _cache_dir.native(), _access_time_tracker);
-    probe.set_size(_current_cache_size);
-    probe.set_num_files(candidates_for_deletion.size());
-
-    // Updating the access time tracker in case if some files were removed
-    // from cache directory by the user manually.
-    access_time_tracker tmp;
-    for (const auto& it : candidates_for_deletion) {
-        tmp.add_timestamp(
-          it.path, std::chrono::system_clock::time_point::min());
+    auto current_cache_size = _access_time_tracker.total_size();
+    if (current_cache_size < _max_cache_size) {
+        co_return;
     }
-    _access_time_tracker.remove_others(tmp);
+
+    uint64_t size_to_delete
+      = current_cache_size
+        - (_max_cache_size * (long double)_cache_size_low_watermark);
+    auto candidates_for_deletion = _access_time_tracker.eviction_candidates(
+      size_to_delete);
 
     uint64_t deleted_size = 0;
-    if (_current_cache_size >= _max_cache_size) {
-        auto size_to_delete
-          = _current_cache_size
-            - (_max_cache_size * (long double)_cache_size_low_watermark);
-
-        size_t i_to_delete = 0;
-        while (i_to_delete < candidates_for_deletion.size()
-               && deleted_size < size_to_delete) {
-            auto filename_to_remove = candidates_for_deletion[i_to_delete].path;
-
-            // skip tmp files since someone may be writing to it
-            if (!std::string_view(filename_to_remove)
-                   .ends_with(tmp_extension)) {
-                try {
-                    co_await recursive_delete_empty_directory(
-                      filename_to_remove);
-                    deleted_size += candidates_for_deletion[i_to_delete].size;
-                    // Remove key if possible to make sure there is no resource
-                    // leak
-                    _access_time_tracker.remove_timestamp(
-                      std::string_view(filename_to_remove));
-                } catch (std::exception& e) {
-                    vlog(
-                      cst_log.error,
-                      "Cache eviction couldn't delete {}: {}.",
-                      filename_to_remove,
-                      e.what());
-                }
+    size_t deleted_count = 0;
+    for (const auto& file_item : candidates_for_deletion) {
+        const auto& filename_to_remove = file_item.path;
+        try {
+            co_await recursive_delete_empty_directory(filename_to_remove);
+            deleted_size += file_item.size;
+            ++deleted_count;
+            _access_time_tracker.remove_timestamp(
+              std::string_view(filename_to_remove));
+        } catch (std::filesystem::filesystem_error& e) {
+            if (e.code() == std::errc::no_such_file_or_directory) {
+                // The file was removed from cache directory by the user
+                // manually, the index has to forget about it.
+                vlog(
+                  cst_log.debug,
+                  "Cache eviction couldn't find {}: {}.",
+                  filename_to_remove,
+                  e.what());
+                _access_time_tracker.remove_timestamp(
+                  std::string_view(filename_to_remove));
+            } else {
+                vlog(
+                  cst_log.error,
+                  "Cache eviction couldn't delete {}: {}.",
+                  filename_to_remove,
+                  e.what());
+                // Don't let the file block eviction of the next ones
+                _access_time_tracker.add_timestamp(
+                  filename_to_remove, std::chrono::system_clock::now());
             }
-            i_to_delete++;
+        } catch (std::exception& e) {
+            vlog(
+              cst_log.error,
+              "Cache eviction couldn't delete {}: {}.",
+              filename_to_remove,
+              e.what());
+            _access_time_tracker.add_timestamp(
+              filename_to_remove, std::chrono::system_clock::now());
         }
-        _total_cleaned += deleted_size;
-        _current_cache_size -= deleted_size;
-        vlog(
-          cst_log.debug,
-          "Cache eviction deleted {} files of total size {}.",
-          i_to_delete,
-          deleted_size);
     }
+    _total_cleaned += deleted_size;
+    update_probe();
+    vlog(
+      cst_log.debug,
+      "Cache eviction deleted {} files of total size {}.",
+      deleted_count,
+      deleted_size);
 }
 
 ss::future<> cache::load_access_time_tracker() {
@@ -280,10 +309,19 @@ ss::future<> cache::start() {
       _cache_dir);
 
     if (ss::this_shard_id() == 0) {
+        _started = std::chrono::system_clock::now();
         // access time tracker has to be initialized before
         // cleanup
         co_await load_access_time_tracker();
-        co_await clean_up_at_start();
+        update_probe();
+        // The index is usable right away, the directory walk only
+        // reconciles it with the content of the cache directory.
+        ssx::background
+          = ssx::spawn_with_gate_then(
+              _gate, [this] { return clean_up_at_start(); })
+              .handle_exception([](std::exception_ptr e) {
+                  vlog(cst_log.error, "Cache clean up at start failed: {}", e);
+              });
 
         _tracker_timer.set_callback([this] {
             ssx::spawn_with_gate(
@@ -309,7 +347,7 @@ ss::future<std::optional<cache_item>> cache::get(std::filesystem::path key) {
     probe.get();
     ss::file cache_file;
     try {
-        auto source = (_cache_dir / key).native();
+        auto source = (_cache_dir / key).lexically_normal().native();
         cache_file = co_await ss::open_file_dma(source, ss::open_flags::ro);
 
         // Bump access time of the file
@@ -431,19 +469,15 @@ ss::future<> cache::put(
 
     auto put_size = co_await ss::file_size(dest);
 
-    // Bump access time of the file
+    // Index the file and bump its access time
     if (ss::this_shard_id() == 0) {
-        _access_time_tracker.add_timestamp(
-          dest, std::chrono::system_clock::now());
         ssx::spawn_with_gate(_gate, [this, dest, put_size] {
-            return consume_cache_space(put_size);
+            return consume_cache_space(dest, put_size);
         });
     } else {
         ssx::spawn_with_gate(_gate, [this, dest, put_size] {
             return container().invoke_on(0, [dest, put_size](cache& c) {
-                c._access_time_tracker.add_timestamp(
-                  dest, std::chrono::system_clock::now());
-                return c.consume_cache_space(put_size);
+                return c.consume_cache_space(dest, put_size);
             });
         });
     }
@@ -471,9 +505,20 @@ ss::future<> cache::invalidate(const std::filesystem::path& key) {
       cst_log.debug,
       "Trying to invalidate {} from archival cache.",
       key.native());
+    auto source = (_cache_dir / key).lexically_normal().native();
+    if (ss::this_shard_id() == 0) {
+        _access_time_tracker.remove_timestamp(source);
+        update_probe();
+    } else {
+        ssx::spawn_with_gate(_gate, [this, source] {
+            return container().invoke_on(0, [source](cache& c) {
+                c._access_time_tracker.remove_timestamp(source);
+                c.update_probe();
+            });
+        });
+    }
     try {
-        _access_time_tracker.remove_timestamp(key.native());
-        co_await recursive_delete_empty_directory((_cache_dir / key).native());
+        co_await recursive_delete_empty_directory(source);
     } catch (std::filesystem::filesystem_error& e) {
         if (e.code() == std::errc::no_such_file_or_directory) {
             vlog(
@@ -22,6 +22,7 @@
 #include <seastar/core/io_priority_class.hh>
 #include <seastar/core/iostream.hh>
 
+#include <chrono>
 #include <filesystem>
 #include <set>
 #include <string_view>
@@ -96,12 +97,13 @@ private:
     /// Save access time tracker state to the file if needed
     ss::future<> maybe_save_access_time_tracker();
 
-    /// Triggers directory walker, creates a list of files to delete and deletes
-    /// them until cache size <= _cache_size_low_watermark * max_cache_size
+    /// Deletes the least recently used files of the access time tracker index
+    /// until cache size <= _cache_size_low_watermark * max_cache_size
     ss::future<> clean_up_cache();
 
-    /// Triggers directory walker, creates a list of files to delete and deletes
-    /// only tmp files that are left from previous Red Panda run
+    /// Triggers directory walker in the background, deletes tmp files that
+    /// are left from previous Red Panda run and reconciles the access time
+    /// tracker index with the content of the cache directory
     ss::future<> clean_up_at_start();
 
     /// Deletes a file and then recursively goes up and deletes a directory
@@ -111,8 +113,15 @@ private:
     ss::future<> recursive_delete_empty_directory(const std::string_view& key);
 
     /// This method is called on shard 0 by other shards to report disk
-    /// space changes.
-    ss::future<> consume_cache_space(size_t);
+    /// space changes. The file is indexed by the access time tracker.
+    ss::future<> consume_cache_space(ss::sstring path, size_t);
+
+    /// Starts cache eviction if the cache is too big and no eviction is
+    /// already running (only used on shard 0)
+    ss::future<> maybe_clean_up_cache();
+
+    /// Publishes size of the cache from the access time tracker index
+    void update_probe();
 
     std::filesystem::path _cache_dir;
     size_t _max_cache_size;
@@ -122,8 +131,8 @@ private:
     static constexpr double _cache_size_low_watermark{0.8};
     cloud_storage::recursive_directory_walker _walker;
     uint64_t _total_cleaned;
-    /// Current size of the cache directory (only used on shard 0)
-    uint64_t _current_cache_size{0};
+    /// Files older than this are left from the previous run
+    std::chrono::system_clock::time_point _started;
     ss::semaphore _cleanup_sm{1};
     std::set<std::filesystem::path> _files_in_progress;
     cache_probe probe;
@@ -101,21 +101,53 @@ partition_recovery_manager::download_log(const storage::ntp_config& ntp_cfg) {
         co_return log_recovery_result{};
     }
     partition_downloader downloader(
-      ntp_cfg, &_remote.local(), _bucket, _gate, _root);
+      ntp_cfg, &_remote.local(), _bucket, _gate, _root, download_timeout);
     co_return co_await downloader.download_log();
 }
 
+ss::future<log_recovery_result>
+partition_recovery_manager::download_replica_log(
+  const storage::ntp_config& ntp_cfg,
+  ss::lowres_clock::duration timeout,
+  ss::abort_source& as) {
+    // abort sources are only taken from the root of a retry chain
+    retry_chain_node root(as, timeout, initial_backoff);
+    partition_downloader downloader(
+      ntp_cfg, &_remote.local(), _bucket, _gate, root, timeout);
+    co_return co_await downloader.download_replica_log();
+}
+
+std::optional<replica_log_start> find_replica_log_start(
+  const partition_manifest& manifest, model::offset base_offset) {
+    auto first = manifest.find(base_offset);
+    if (
+      first == manifest.end()
+      || first->second.delta_offset == model::offset()) {
+        return std::nullopt;
+    }
+    auto prev_term = first->first.term;
+    if (first != manifest.begin()) {
+        prev_term = std::prev(first)->first.term;
+    }
+    return replica_log_start{
+      .base_offset = base_offset,
+      .prev_term = prev_term,
+      .delta = first->second.delta_offset,
+    };
+}
+
 partition_downloader::partition_downloader(
   const storage::ntp_config& ntpc,
   remote* remote,
   s3::bucket_name bucket,
   ss::gate& gate_root,
-  retry_chain_node& parent)
+  retry_chain_node& parent,
+  ss::lowres_clock::duration timeout)
   : _ntpc(ntpc)
   , _bucket(std::move(bucket))
   , _remote(remote)
   , _gate(gate_root)
-  , _rtcnode(download_timeout, initial_backoff, &parent)
+  , _rtcnode(timeout, initial_backoff, &parent)
   , _ctxlog(
       cst_log,
       _rtcnode,
@@ -164,6 +196,80 @@ ss::future<log_recovery_result> partition_downloader::download_log() {
     co_return log_recovery_result{};
 }
 
+ss::future<log_recovery_result> partition_downloader::download_replica_log() {
+    if (co_await ss::file_exists(_ntpc.work_directory())) {
+        // the replica already has a log
+        co_return log_recovery_result{};
+    }
+    _keep_raft_offsets = true;
+    auto prefix = std::filesystem::path(_ntpc.work_directory());
+    auto part_prefix = std::filesystem::path(prefix.string() + "_part");
+    try {
+        // leftovers of an interrupted download may belong to an older
+        // version of the manifest
+        if (co_await ss::file_exists(part_prefix.string())) {
+            co_await ss::recursive_remove_directory(part_prefix);
+        }
+        partition_manifest path_manifest(
+          _ntpc.ntp(), _ntpc.get_initial_revision());
+        auto manifest = co_await download_manifest(
+          path_manifest.get_manifest_path());
+        if (manifest.size() == 0) {
+            vlog(_ctxlog.info, "No segments uploaded, nothing to download");
+            co_return log_recovery_result{};
+        }
+        offset_map_t offset_map;
+        for (const auto& segm : manifest) {
+            offset_map.insert_or_assign(
+              segm.second.base_offset,
+              segment{.manifest_key = segm.first, .meta = segm.second});
+        }
+        auto part = co_await download_log_with_retention(
+          offset_map, manifest, prefix);
+        auto downloaded = co_await ss::file_exists(part_prefix.string());
+        if (
+          part.num_files == 0 || part.has_gaps
+          || part.range.max_offset != manifest.get_last_offset()) {
+            // a missing segment or a gap: the segments can't be used as the
+            // log of the replica
+            vlog(
+              _ctxlog.warn,
+              "Downloaded segments do not form a complete log tail, range: "
+              "{}-{}, last uploaded offset: {}",
+              part.range.min_offset,
+              part.range.max_offset,
+              manifest.get_last_offset());
+            if (downloaded) {
+                co_await ss::recursive_remove_directory(part_prefix);
+            }
+            co_return log_recovery_result{};
+        }
+        co_await move_parts(part);
+        vlog(
+          _ctxlog.info,
+          "Downloaded {} segments of the log, offsets {}-{}",
+          part.num_files,
+          part.range.min_offset,
+          part.range.max_offset);
+        co_return log_recovery_result{
+          .completed = true,
+          .min_kafka_offset = part.range.min_offset,
+          .max_kafka_offset = part.range.max_offset,
+          .manifest = std::move(manifest),
+        };
+    } catch (...) {
+        vlog(
+          _ctxlog.warn,
+          "Error downloading replica log: {}",
+          std::current_exception());
+    }
+    // the replica recovers the whole log from the leader instead
+    if (co_await ss::file_exists(part_prefix.string())) {
+        co_await ss::recursive_remove_directory(part_prefix);
+    }
+    co_return log_recovery_result{};
+}
+
 // Parameters used to exclude data based on total size.
 struct size_bound_deletion_parameters {
     size_t retention_bytes;
@@ -261,32 +367,8 @@ partition_downloader::download_log(const remote_manifest_path& manifest_key) {
           "No segments found. Empty partition manifest generated.");
         throw missing_partition_exception(_ntpc);
     }
-    download_part part;
-    if (std::holds_alternative<std::monostate>(retention)) {
-        static constexpr std::chrono::seconds one_day = 86400s;
-        static constexpr auto one_week = one_day * 7;
-        vlog(_ctxlog.info, "Default retention parameters are used.");
-        part = co_await download_log_with_capped_time(
-          offset_map, target, prefix, one_week);
-    } else if (std::holds_alternative<size_bound_deletion_parameters>(
-                 retention)) {
-        auto r = std::get<size_bound_deletion_parameters>(retention);
-        vlog(
-          _ctxlog.info,
-          "Size bound retention is used. Size limit: {} bytes.",
-          r.retention_bytes);
-        part = co_await download_log_with_capped_size(
-          offset_map, target, prefix, r.retention_bytes);
-    } else if (std::holds_alternative<time_bound_deletion_parameters>(
-                 retention)) {
-        auto r = std::get<time_bound_deletion_parameters>(retention);
-        vlog(
-          _ctxlog.info,
-          "Time bound retention is used. Time limit: {}ms.",
-          r.retention_duration.count());
-        part = co_await download_log_with_capped_time(
-          offset_map, target, prefix, r.retention_duration);
-    }
+    auto part = co_await download_log_with_retention(
+      offset_map, target, prefix);
     // Move parts to final destinations
     co_await move_parts(part);
 
@@ -331,6 +413,41 @@ partition_downloader::download_log(const remote_manifest_path& manifest_key) {
     co_return result;
 }
 
+ss::future<partition_downloader::download_part>
+partition_downloader::download_log_with_retention(
+  const offset_map_t& offset_map,
+  const partition_manifest& manifest,
+  const std::filesystem::path& prefix) {
+    auto retention = get_retention_policy(_ntpc.get_overrides());
+    download_part part;
+    if (std::holds_alternative<std::monostate>(retention)) {
+        static constexpr std::chrono::seconds one_day = 86400s;
+        static constexpr auto one_week = one_day * 7;
+        vlog(_ctxlog.info, "Default retention parameters are used.");
+        part = co_await download_log_with_capped_time(
+          offset_map, manifest, prefix, one_week);
+    } else if (std::holds_alternative<size_bound_deletion_parameters>(
+                 retention)) {
+        auto r = std::get<size_bound_deletion_parameters>(retention);
+        vlog(
+          _ctxlog.info,
+          "Size bound retention is used. Size limit: {} bytes.",
+          r.retention_bytes);
+        part = co_await download_log_with_capped_size(
+          offset_map, manifest, prefix, r.retention_bytes);
+    } else if (std::holds_alternative<time_bound_deletion_parameters>(
+                 retention)) {
+        auto r = std::get<time_bound_deletion_parameters>(retention);
+        vlog(
+          _ctxlog.info,
+          "Time bound retention is used. Time limit: {}ms.",
+          r.retention_duration.count());
+        part = co_await download_log_with_capped_time(
+          offset_map, manifest, prefix, r.retention_duration);
+    }
+    co_return part;
+}
+
 void partition_downloader::update_downloaded_offsets(
   std::vector<partition_downloader::offset_range> dloffsets,
   partition_downloader::download_part& dlpart) {
@@ -347,6 +464,7 @@ void partition_downloader::update_downloaded_offsets(
                   expected,
                   dlpart.range.min_offset,
                   dlpart.range.max_offset);
+                dlpart.has_gaps = true;
                 break;
             }
         }
@@ -417,6 +535,8 @@ partition_downloader::download_log_with_capped_size(
           auto& dloffsets{*_dloffsets};
           auto& dlpart{*_dlpart};
           retry_chain_node fib(&_rtcnode);
+          // don't start downloads once aborted
+          fib.check_abort();
           retry_chain_logger dllog(cst_log, fib);
           vlog(
             dllog.debug,
@@ -582,9 +702,11 @@ partition_downloader::download_segment_file(
 
     offset_translator otl{segm.meta.delta_offset};
 
-    auto localpath = part.part_prefix
-                     / std::string{otl.get_adjusted_segment_name(
-                       segm.manifest_key, _rtcnode)()};
+    auto localpath = _keep_raft_offsets
+                       ? part.part_prefix / std::string{name()}
+                       : part.part_prefix
+                           / std::string{otl.get_adjusted_segment_name(
+                             segm.manifest_key, _rtcnode)()};
 
     if (co_await ss::file_exists(localpath.string())) {
         vlog(
@@ -598,6 +720,7 @@ partition_downloader::download_segment_file(
     model::offset min_offset;
     model::offset max_offset;
     auto stream = [this,
+                   &segm,
                    _part{part},
                    _remote_path{remote_path},
                    _localpath{localpath},
@@ -619,6 +742,14 @@ partition_downloader::download_segment_file(
           localpath.string());
         co_await ss::recursive_touch_directory(part.part_prefix.string());
         auto fs = co_await open_output_file_stream(localpath);
+        if (_keep_raft_offsets) {
+            co_await ss::copy(in, fs);
+            co_await fs.close();
+            co_await in.close();
+            min_offset = segm.meta.base_offset;
+            max_offset = segm.meta.committed_offset;
+            co_return len;
+        }
         auto stream_stats = co_await otl.copy_stream(
           std::move(in), std::move(fs), _rtcnode);
 
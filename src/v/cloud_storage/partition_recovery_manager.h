@@ -28,6 +28,7 @@
 
 #include <compare>
 #include <iterator>
+#include <optional>
 #include <vector>
 
 namespace cloud_storage {
@@ -36,7 +37,8 @@ namespace cloud_storage {
 ///
 /// The struct contains information about the
 /// download completion status and the offset of the
-/// last record batch being downloaded.
+/// last record batch being downloaded. When a replica log is downloaded
+/// the offsets are raft offsets, not kafka ones.
 struct log_recovery_result {
     bool completed{false};
     model::offset min_kafka_offset;
@@ -44,6 +46,24 @@ struct log_recovery_result {
     cloud_storage::partition_manifest manifest;
 };
 
+/// Raft state preceding a replica log downloaded with its raft offsets
+struct replica_log_start {
+    /// base offset of the first downloaded segment
+    model::offset base_offset;
+    /// term of the entry right before the first downloaded one, the term of
+    /// the first segment when no older segment is left in the manifest
+    model::term_id prev_term;
+    /// offset translator delta at the first downloaded segment
+    model::offset delta;
+};
+
+/// Finds the raft state a replica starts with when its log starts with the
+/// segment of 'manifest' at 'base_offset'. Returns nullopt if there is no
+/// such segment or if it was uploaded without its offset translator delta,
+/// as older versions do.
+std::optional<replica_log_start>
+find_replica_log_start(const partition_manifest&, model::offset base_offset);
+
 /// Data recovery provider is used to download topic segments from S3 (or
 /// compatible storage) during topic re-creation process
 class partition_recovery_manager {
@@ -74,6 +94,21 @@ public:
     ss::future<log_recovery_result>
     download_log(const storage::ntp_config& ntp_cfg);
 
+    /// Download the tail of the log of an existing partition, as uploaded by
+    /// its leaders, into the directory of a new replica of the partition.
+    /// Unlike topic recovery, segments are stored as they were uploaded, with
+    /// their raft offsets and configuration batches, and no manifest is
+    /// uploaded: the replica then only has to recover the rest of the log
+    /// from the leader.
+    /// The download is abandoned once 'timeout' elapses or when 'as' is
+    /// aborted.
+    /// \return download result struct with 'completed=true' if the
+    ///         downloaded segments form a contiguous log
+    ss::future<log_recovery_result> download_replica_log(
+      const storage::ntp_config& ntp_cfg,
+      ss::lowres_clock::duration timeout,
+      ss::abort_source& as);
+
 private:
     s3::bucket_name _bucket;
     ss::sharded<remote>& _remote;
@@ -92,7 +127,8 @@ public:
       remote* remote,
       s3::bucket_name bucket,
       ss::gate& gate_root,
-      retry_chain_node& parent);
+      retry_chain_node& parent,
+      ss::lowres_clock::duration timeout);
 
     partition_downloader(const partition_downloader&) = delete;
     partition_downloader(partition_downloader&&) = delete;
@@ -109,6 +145,9 @@ public:
     ///         be set to max offset of the downloaded log.
     ss::future<log_recovery_result> download_log();
 
+    /// Download the tail of the partition log keeping the raft offsets.
+    ss::future<log_recovery_result> download_replica_log();
+
 private:
     /// Download full log based on manifest data
     ss::future<log_recovery_result>
@@ -145,6 +184,8 @@ private:
         std::filesystem::path dest_prefix;
         size_t num_files;
         offset_range range;
+        // some of the downloaded files are not part of the range
+        bool has_gaps{false};
     };
 
     /// Sort offsets and find out the useful offset range
@@ -182,6 +223,12 @@ private:
       const std::filesystem::path& prefix,
       model::timestamp_clock::duration retention_time);
 
+    /// Download the segments within the retention limits of the topic
+    ss::future<download_part> download_log_with_retention(
+      const offset_map_t& offset_map,
+      const partition_manifest& manifest,
+      const std::filesystem::path& prefix);
+
     /// Rename files in the list
     ss::future<> move_parts(download_part dls);
 
@@ -194,6 +241,8 @@ private:
     ss::gate& _gate;
     retry_chain_node _rtcnode;
     retry_chain_logger _ctxlog;
+    // store segments as uploaded instead of translating their offsets
+    bool _keep_raft_offsets{false};
 };
 
 } // namespace cloud_storage
@@ -55,9 +55,9 @@ recursive_directory_walker::walk(
                &current_cache_size,
                &dirlist,
                _target{target},
-               _tracker{tracker}](ss::directory_entry entry) -> ss::future<> {
+               _tracker{&tracker}](ss::directory_entry entry) -> ss::future<> {
                   auto target{_target};
-                  auto tracker{_tracker};
+                  const auto* tracker{_tracker};
                   vlog(cst_log.debug, "Looking at directory {}", target);
 
                   auto entry_path = std::filesystem::path(target)
@@ -71,7 +71,7 @@ recursive_directory_walker::walk(
                         entry_path.string());
 
                       auto last_access_timepoint
-                        = tracker.estimate_timestamp(entry_path.native())
+                        = tracker->estimate_timestamp(entry_path.native())
                             .value_or(file_stats.time_accessed);
 
                       current_cache_size += static_cast<uint64_t>(
@@ -19,11 +19,6 @@
 #include <chrono>
 
 namespace cloud_storage {
-struct file_list_item {
-    std::chrono::system_clock::time_point access_time;
-    ss::sstring path;
-    uint64_t size;
-};
 class recursive_directory_walker {
 public:
     ss::future<> stop();
@@ -15,6 +15,7 @@
 #include "cloud_storage/remote_segment.h"
 #include "cloud_storage/types.h"
 #include "storage/parser_errc.h"
+#include "storage/parser_utils.h"
 #include "storage/types.h"
 #include "utils/retry_chain_node.h"
 #include "utils/stream_utils.h"
@@ -27,6 +28,7 @@
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/temporary_buffer.hh>
 
+#include <algorithm>
 #include <chrono>
 #include <exception>
 #include <iterator>
@@ -674,6 +676,44 @@ ss::future<storage::translating_reader> remote_partition::make_reader(
       model::record_batch_reader(std::move(impl)), std::move(ot_state)};
 }
 
+ss::future<std::optional<storage::timequery_result>>
+remote_partition::timequery(storage::timequery_config cfg) {
+    // skip segments whose records are all older than the needle, segments
+    // uploaded without timestamps can't be ruled out
+    auto it = std::find_if(
+      _manifest.begin(), _manifest.end(), [&cfg](const auto& kv) {
+          const auto& meta = kv.second;
+          return meta.max_timestamp == model::timestamp::missing()
+                 || meta.max_timestamp >= cfg.time;
+      });
+    if (it == _manifest.end()) {
+        co_return std::nullopt;
+    }
+    const auto start_offset = get_kafka_base_offset(it->second);
+    if (start_offset > cfg.max_offset) {
+        co_return std::nullopt;
+    }
+    storage::log_reader_config config(
+      start_offset,
+      cfg.max_offset,
+      0,
+      2048, // We just need one record batch
+      cfg.prio,
+      cfg.type_filter,
+      cfg.time,
+      cfg.abort_source);
+    auto translating_reader = co_await make_reader(config);
+    auto st = co_await model::consume_reader_to_memory(
+      std::move(translating_reader.reader), model::no_timeout);
+    auto& batches = std::get<model::record_batch_reader::data_t>(st);
+    if (batches.empty()) {
+        co_return std::nullopt;
+    }
+    // the reader skipped batches without any record >= cfg.time
+    co_return co_await storage::internal::batch_timequery(
+      std::move(batches.front()), cfg.time);
+}
+
 remote_partition::offloaded_segment_state::offloaded_segment_state(
   model::offset base_offset)
   : base_rp_offset(base_offset) {}
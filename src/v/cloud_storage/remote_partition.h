@@ -184,6 +184,14 @@ public:
       storage::log_reader_config config,
       std::optional<model::timeout_clock::time_point> deadline = std::nullopt);
 
+    /// Find the first record with timestamp >= config.time
+    ///
+    /// Like make_reader, config.max_offset and the returned offset are kafka
+    /// offsets. Segments are selected using the max timestamps from the
+    /// manifest and the time index of the segments.
+    ss::future<std::optional<storage::timequery_result>>
+    timequery(storage::timequery_config config);
+
     /// Return first uploaded kafka offset
     model::offset first_uploaded_offset();
 
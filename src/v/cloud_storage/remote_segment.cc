@@ -189,7 +189,9 @@ remote_segment::data_stream(size_t pos, ss::io_priority_class io_priority) {
 
 ss::future<remote_segment::input_stream_with_offsets>
 remote_segment::offset_data_stream(
-  model::offset kafka_offset, ss::io_priority_class io_priority) {
+  model::offset kafka_offset,
+  ss::io_priority_class io_priority,
+  std::optional<model::timestamp> first_timestamp) {
     vlog(
       _ctxlog.debug,
       "remote segment file input stream at offset {}",
@@ -202,6 +204,20 @@ remote_segment::offset_data_stream(
                    .kaf_offset = _base_rp_offset - _base_offset_delta,
                    .file_pos = 0,
                  });
+    if (first_timestamp && _index) {
+        auto tpos = _index->find_timestamp(*first_timestamp);
+        if (tpos && tpos->kaf_offset > pos.kaf_offset) {
+            vlog(
+              _ctxlog.debug,
+              "Using time index to locate {}, the result is rp-offset: {}, "
+              "kafka-offset: {}, file-pos: {}",
+              *first_timestamp,
+              tpos->rp_offset,
+              tpos->kaf_offset,
+              tpos->file_pos);
+            pos = *tpos;
+        }
+    }
     ss::file_input_stream_options options{};
     options.buffer_size = config::shard_local_cfg().storage_read_buffer_size();
     options.read_ahead
@@ -771,13 +787,15 @@ public:
             return batch_consumer::consume_result::stop_parser;
         }
 
-        if (_config.first_timestamp > header.first_timestamp) {
+        if (
+          _config.first_timestamp
+          > std::max(header.first_timestamp, header.max_timestamp)) {
             // kakfa needs to guarantee that the returned record is >=
             // first_timestamp
             vlog(
               _ctxlog.debug,
-              "accept_batch_start skip because header timestamp is {}",
-              header.first_timestamp);
+              "accept_batch_start skip because header max timestamp is {}",
+              std::max(header.first_timestamp, header.max_timestamp));
             return batch_consumer::consume_result::skip_batch;
         }
         // we want to consume the batch
@@ -939,7 +957,8 @@ remote_segment_batch_reader::init_parser() {
       _config.start_offset);
     auto stream_off = co_await _seg->offset_data_stream(
       _config.start_offset,
-      priority_manager::local().shadow_indexing_priority());
+      priority_manager::local().shadow_indexing_priority(),
+      _config.first_timestamp);
     auto parser = std::make_unique<storage::continuous_batch_parser>(
       std::make_unique<remote_segment_batch_consumer>(
         _config, *this, _seg->get_term(), _seg->get_ntp(), _rtc),
@@ -108,9 +108,13 @@ public:
         model::offset kafka_offset;
     };
     /// create an input stream _sharing_ the underlying file handle
-    /// starting at position @pos
-    ss::future<input_stream_with_offsets>
-    offset_data_stream(model::offset kafka_offset, ss::io_priority_class);
+    /// starting at position @pos. When @first_timestamp is set the stream
+    /// may start past @kafka_offset, skipping batches which the index shows
+    /// have no record with a timestamp >= @first_timestamp.
+    ss::future<input_stream_with_offsets> offset_data_stream(
+      model::offset kafka_offset,
+      ss::io_priority_class,
+      std::optional<model::timestamp> first_timestamp = std::nullopt);
 
     /// Hydrate the segment
     ss::future<> hydrate();
@@ -15,6 +15,8 @@
 #include "serde/serde.h"
 #include "vlog.h"
 
+#include <algorithm>
+
 namespace cloud_storage {
 
 offset_index::offset_index(
@@ -25,6 +27,7 @@ offset_index::offset_index(
   : _rp_offsets{}
   , _kaf_offsets{}
   , _file_offsets{}
+  , _max_timestamps{}
   , _pos{}
   , _initial_rp(initial_rp)
   , _initial_kaf(initial_kaf)
@@ -32,19 +35,25 @@ offset_index::offset_index(
   , _rp_index(initial_rp)
   , _kaf_index(initial_kaf)
   , _file_index(initial_file_pos, delta_delta_t(file_pos_step))
+  , _ts_index(0)
   , _min_file_pos_step(file_pos_step) {}
 
 void offset_index::add(
-  model::offset rp_offset, model::offset kaf_offset, int64_t file_offset) {
+  model::offset rp_offset,
+  model::offset kaf_offset,
+  int64_t file_offset,
+  model::timestamp max_timestamp) {
     auto ix = index_mask & _pos++;
     _rp_offsets.at(ix) = rp_offset();
     _kaf_offsets.at(ix) = kaf_offset();
     _file_offsets.at(ix) = file_offset;
+    _max_timestamps.at(ix) = max_timestamp();
     try {
         if ((_pos & index_mask) == 0) {
-            _rp_index.add(_rp_offsets);
-            _kaf_index.add(_kaf_offsets);
-            _file_index.add(_file_offsets);
+            _add_row(_rp_index, _rp_rows, _rp_offsets);
+            _add_row(_kaf_index, _kaf_rows, _kaf_offsets);
+            _add_row(_file_index, _file_rows, _file_offsets);
+            _add_row(_ts_index, _ts_rows, _max_timestamps);
         }
     } catch (...) {
         // Get rid of the corrupted state in the encoders.
@@ -54,10 +63,16 @@ void offset_index::add(
         _rp_offsets = {};
         _kaf_offsets = {};
         _file_offsets = {};
+        _max_timestamps = {};
         _rp_index = encoder_t(_initial_rp);
         _kaf_index = encoder_t(_initial_kaf);
         _file_index = foffset_encoder_t(
           _initial_file_pos, delta_delta_t(_min_file_pos_step));
+        _ts_index = encoder_t(0);
+        _rp_rows.clear();
+        _kaf_rows.clear();
+        _file_rows.clear();
+        _ts_rows.clear();
         throw;
     }
 }
@@ -65,13 +80,12 @@ void offset_index::add(
 std::
   variant<std::monostate, offset_index::index_value, offset_index::find_result>
   offset_index::maybe_find_offset(
-    model::offset upper_bound,
+    int64_t upper_bound,
     deltafor_encoder<int64_t>& encoder,
-    const std::array<int64_t, buffer_depth>& write_buffer) {
-    deltafor_decoder<int64_t> decoder(
-      encoder.get_initial_value(), encoder.get_row_count(), encoder.share());
+    const column_rows& rows,
+    const row_t& write_buffer) {
     auto max_index = encoder.get_row_count() * details::FOR_buffer_depth - 1;
-    auto maybe_ix = _find_under(std::move(decoder), upper_bound());
+    auto maybe_ix = _find_under(encoder, rows, upper_bound);
     if (!maybe_ix || maybe_ix->ix == max_index) {
         auto ixend = _pos & index_mask;
         std::optional<find_result> candidate;
@@ -107,7 +121,8 @@ offset_index::find_rp_offset(model::offset upper_bound) {
     size_t ix = 0;
     find_result res{};
 
-    auto search_result = maybe_find_offset(upper_bound, _rp_index, _rp_offsets);
+    auto search_result = maybe_find_offset(
+      upper_bound(), _rp_index, _rp_rows, _rp_offsets);
 
     if (std::holds_alternative<std::monostate>(search_result)) {
         return std::nullopt;
@@ -120,20 +135,10 @@ offset_index::find_rp_offset(model::offset upper_bound) {
     ix = maybe_ix.ix;
     res.rp_offset = model::offset(maybe_ix.value);
 
-    decoder_t kaf_dec(
-      _kaf_index.get_initial_value(),
-      _kaf_index.get_row_count(),
-      _kaf_index.copy());
-    auto kaf_offset = _fetch_ix(std::move(kaf_dec), ix);
-    vassert(kaf_offset.has_value(), "Inconsistent index state");
-    res.kaf_offset = model::offset(*kaf_offset);
-    foffset_decoder_t file_dec(
-      _file_index.get_initial_value(),
-      _file_index.get_row_count(),
-      _file_index.copy(),
-      delta_delta_t(_min_file_pos_step));
-    auto file_pos = _fetch_ix(std::move(file_dec), ix);
-    res.file_pos = *file_pos;
+    res.kaf_offset = model::offset(
+      _fetch_ix<decoder_t>(_kaf_index, _kaf_rows, ix));
+    res.file_pos = _fetch_ix<foffset_decoder_t>(
+      _file_index, _file_rows, ix, delta_delta_t(_min_file_pos_step));
     return res;
 }
 
@@ -143,7 +148,7 @@ offset_index::find_kaf_offset(model::offset upper_bound) {
     find_result res{};
 
     auto search_result = maybe_find_offset(
-      upper_bound, _kaf_index, _kaf_offsets);
+      upper_bound(), _kaf_index, _kaf_rows, _kaf_offsets);
 
     if (std::holds_alternative<std::monostate>(search_result)) {
         return std::nullopt;
@@ -156,27 +161,42 @@ offset_index::find_kaf_offset(model::offset upper_bound) {
     ix = maybe_ix.ix;
     res.kaf_offset = model::offset(maybe_ix.value);
 
-    decoder_t rp_dec(
-      _rp_index.get_initial_value(),
-      _rp_index.get_row_count(),
-      _rp_index.copy());
-    auto rp_offset = _fetch_ix(std::move(rp_dec), ix);
-    vassert(rp_offset.has_value(), "Inconsistent index state");
-    res.rp_offset = model::offset(*rp_offset);
-    foffset_decoder_t file_dec(
-      _file_index.get_initial_value(),
-      _file_index.get_row_count(),
-      _file_index.copy(),
-      delta_delta_t(_min_file_pos_step));
-    auto file_pos = _fetch_ix(std::move(file_dec), ix);
-    res.file_pos = *file_pos;
+    res.rp_offset = model::offset(
+      _fetch_ix<decoder_t>(_rp_index, _rp_rows, ix));
+    res.file_pos = _fetch_ix<foffset_decoder_t>(
+      _file_index, _file_rows, ix, delta_delta_t(_min_file_pos_step));
+    return res;
+}
+
+std::optional<offset_index::find_result>
+offset_index::find_timestamp(model::timestamp upper_bound) {
+    if (!_has_timestamps) {
+        return std::nullopt;
+    }
+    auto search_result = maybe_find_offset(
+      upper_bound(), _ts_index, _ts_rows, _max_timestamps);
+
+    if (std::holds_alternative<std::monostate>(search_result)) {
+        return std::nullopt;
+    } else if (std::holds_alternative<find_result>(search_result)) {
+        return std::get<find_result>(search_result);
+    }
+    auto ix = std::get<index_value>(search_result).ix;
+
+    find_result res{};
+    res.rp_offset = model::offset(
+      _fetch_ix<decoder_t>(_rp_index, _rp_rows, ix));
+    res.kaf_offset = model::offset(
+      _fetch_ix<decoder_t>(_kaf_index, _kaf_rows, ix));
+    res.file_pos = _fetch_ix<foffset_decoder_t>(
+      _file_index, _file_rows, ix, delta_delta_t(_min_file_pos_step));
     return res;
 }
 
 struct offset_index_header
   : serde::envelope<
       offset_index_header,
-      serde::version<1>,
+      serde::version<2>,
       serde::compat_version<1>> {
     int64_t min_file_pos_step;
     uint64_t num_elements;
@@ -192,6 +212,10 @@ struct offset_index_header
     iobuf rp_index;
     iobuf kaf_index;
     iobuf file_index;
+    // since version 2, empty if the index was built by older versions
+    int64_t last_ts;
+    std::vector<int64_t> ts_write_buf;
+    iobuf ts_index;
 };
 
 iobuf offset_index::to_iobuf() {
@@ -213,6 +237,10 @@ iobuf offset_index::to_iobuf() {
       .rp_index = _rp_index.copy(),
       .kaf_index = _kaf_index.copy(),
       .file_index = _file_index.copy(),
+      .last_ts = _ts_index.get_last_value(),
+      .ts_write_buf = std::vector<int64_t>(
+        _max_timestamps.begin(), _max_timestamps.end()),
+      .ts_index = _ts_index.copy(),
     };
     return serde::to_iobuf(std::move(hdr));
 }
@@ -244,24 +272,49 @@ void offset_index::from_iobuf(iobuf b) {
       std::move(hdr.file_index),
       delta_delta_t(_min_file_pos_step));
     _min_file_pos_step = hdr.min_file_pos_step;
+    _has_timestamps = !hdr.ts_write_buf.empty();
+    if (_has_timestamps) {
+        std::copy(
+          hdr.ts_write_buf.begin(),
+          hdr.ts_write_buf.end(),
+          _max_timestamps.begin());
+        _ts_index = encoder_t(0, num_rows, hdr.last_ts, std::move(hdr.ts_index));
+    }
+    _rp_rows = _index_rows<decoder_t>(_rp_index);
+    _kaf_rows = _index_rows<decoder_t>(_kaf_index);
+    _file_rows = _index_rows<foffset_decoder_t>(
+      _file_index, delta_delta_t(_min_file_pos_step));
+    _ts_rows = _has_timestamps ? _index_rows<decoder_t>(_ts_index)
+                               : column_rows{};
 }
 
-std::optional<offset_index::index_value>
-offset_index::_find_under(deltafor_decoder<int64_t> decoder, int64_t offset) {
-    size_t ix = 0;
-    std::array<int64_t, buffer_depth> rp_buf{};
-    std::optional<index_value> candidate;
-    while (decoder.read(rp_buf)) {
-        for (auto o : rp_buf) {
-            if (o >= offset) {
-                return candidate;
-            }
-            candidate = {.ix = size_t(ix), .value = o};
-            ix++;
+std::optional<offset_index::index_value> offset_index::_find_under(
+  deltafor_encoder<int64_t>& encoder,
+  const column_rows& rows,
+  int64_t offset) {
+    // the rows before this one are entirely below offset
+    const auto row = static_cast<size_t>(std::distance(
+      rows.last.begin(),
+      std::lower_bound(rows.last.begin(), rows.last.end(), offset)));
+    // the last element of the previous row
+    const auto previous_row = [&]() -> std::optional<index_value> {
+        if (row == 0) {
+            return std::nullopt;
         }
-        rp_buf = {};
+        return index_value{
+          .ix = row * buffer_depth - 1, .value = rows.last[row - 1]};
+    };
+    if (row == rows.last.size()) {
+        return previous_row();
+    }
+    const auto values = _decode_row<decoder_t>(encoder, rows, row);
+    const auto below = static_cast<size_t>(std::distance(
+      values.begin(), std::lower_bound(values.begin(), values.end(), offset)));
+    if (below == 0) {
+        return previous_row();
     }
-    return candidate;
+    return index_value{
+      .ix = row * buffer_depth + below - 1, .value = values.at(below - 1)};
 }
 
 remote_segment_index_builder::remote_segment_index_builder(
@@ -280,6 +333,9 @@ void remote_segment_index_builder::consume_batch_start(
   model::record_batch_header hdr,
   size_t physical_base_offset,
   size_t size_on_disk) {
+    // some clients leave the max timestamp of single record batches unset
+    _max_timestamp = std::max(
+      {_max_timestamp, hdr.first_timestamp, hdr.max_timestamp});
     if (
       hdr.type == model::record_batch_type::raft_configuration
       || hdr.type == model::record_batch_type::archival_metadata) {
@@ -289,7 +345,8 @@ void remote_segment_index_builder::consume_batch_start(
             _ix.add(
               hdr.base_offset,
               hdr.base_offset - _running_delta,
-              static_cast<int64_t>(physical_base_offset));
+              static_cast<int64_t>(physical_base_offset),
+              _max_timestamp);
             _window = 0;
         }
     }
@@ -13,30 +13,37 @@
 #include "bytes/iobuf.h"
 #include "bytes/iobuf_parser.h"
 #include "model/fundamental.h"
+#include "model/timestamp.h"
 #include "seastarx.h"
 #include "storage/parser.h"
 #include "units.h"
 #include "utils/delta_for.h"
+#include "vassert.h"
 
 #include <seastar/util/log.hh>
 
 #include <variant>
+#include <vector>
 
 namespace cloud_storage {
 
 /// Offset index for remote_segment
 ///
-/// The object indexes tuples that contain three elements:
+/// The object indexes tuples that contain four elements:
 /// - redpanda offset
 /// - kafka offset
 /// - file offset
+/// - max timestamp of the batches up to and including the indexed one
 ///
-/// The search is linear. The underlying data structure is a
-/// fragmented buffer (iobuf). It is possible to search by redpanda
-/// and kafka offsets, but not by file offset.
+/// The underlying data structure is a fragmented buffer (iobuf). It is
+/// possible to search by redpanda and kafka offsets and by timestamp, but
+/// not by file offset. The last value and the position of every encoded
+/// row are kept decoded, so a search is a binary search over the rows
+/// followed by the decoding of the single row that holds the result, in
+/// each of the columns it's returned from.
 ///
-/// The invariant of the offset_index is that all three encoders
-/// have the same number of elements. All three buffers should also
+/// The invariant of the offset_index is that all four encoders
+/// have the same number of elements. All four buffers should also
 /// have the same number of elements.
 class offset_index {
     static constexpr uint32_t buffer_depth = details::FOR_buffer_depth;
@@ -53,8 +60,11 @@ public:
       int64_t file_pos_step);
 
     /// Add new tuple to the index.
-    void
-    add(model::offset rp_offset, model::offset kaf_offset, int64_t file_offset);
+    void add(
+      model::offset rp_offset,
+      model::offset kaf_offset,
+      int64_t file_offset,
+      model::timestamp max_timestamp);
 
     struct find_result {
         model::offset rp_offset;
@@ -78,6 +88,14 @@ public:
     /// returned.
     std::optional<find_result> find_kaf_offset(model::offset upper_bound);
 
+    /// Find the last index entry such that all batches up to and including
+    /// the indexed one have timestamps strictly lower than the timestamp
+    ///
+    /// Scanning from the returned position finds the first batch holding a
+    /// record with timestamp >= 'upper_bound'. Returns nullopt if there is
+    /// no such entry or if the index was built without timestamps.
+    std::optional<find_result> find_timestamp(model::timestamp upper_bound);
+
     /// Serialize offset_index
     iobuf to_iobuf();
 
@@ -90,47 +108,111 @@ private:
         int64_t value;
     };
 
+    using row_t = std::array<int64_t, buffer_depth>;
+
+    /// Rows of an encoded column. The last value of a row is the base the
+    /// following row is delta encoded against, the values of the searched
+    /// columns being sorted it's also what the rows are searched by.
+    struct column_rows {
+        std::vector<int64_t> last;
+        std::vector<size_t> pos;
+
+        void clear() {
+            last.clear();
+            pos.clear();
+        }
+    };
+
     /// Find index entry which is strictly lower than the provided value
     ///
-    /// The encoder and the write buffer have to be provided via parameters.
-    /// The returned value is a variant which contains a monostate if no
-    /// value can be found; index_value if the value is found in the
-    /// encoder; find_result if the value is found in the write buffer (in
-    /// this case no further search is needed).
+    /// The encoder, its rows and the write buffer have to be provided via
+    /// parameters. The returned value is a variant which contains a
+    /// monostate if no value can be found; index_value if the value is
+    /// found in the encoder; find_result if the value is found in the write
+    /// buffer (in this case no further search is needed).
     std::variant<std::monostate, index_value, find_result> maybe_find_offset(
-      model::offset upper_bound,
+      int64_t upper_bound,
       deltafor_encoder<int64_t>& encoder,
-      const std::array<int64_t, buffer_depth>& write_buffer);
+      const column_rows& rows,
+      const row_t& write_buffer);
 
-    /// Find element inside the offset range stored in the decoder which is
-    /// less than offset. Return last element if no such element can be
-    /// found. Return nullopt if all emlements are larger or equal than
+    /// Find the last element of a sorted column which is less than
+    /// offset. Return nullopt if all elements are larger or equal than
     /// offset.
-    static std::optional<index_value>
-    _find_under(deltafor_decoder<int64_t> decoder, int64_t offset);
+    static std::optional<index_value> _find_under(
+      deltafor_encoder<int64_t>& encoder,
+      const column_rows& rows,
+      int64_t offset);
+
+    /// Decode the single row `row` of an encoded column
+    template<class DecoderT, class EncoderT, class... DeltaT>
+    static row_t _decode_row(
+      EncoderT& encoder, const column_rows& rows, size_t row, DeltaT... d) {
+        const auto base = row == 0 ? encoder.get_initial_value()
+                                   : rows.last[row - 1];
+        const auto end = row + 1 < rows.pos.size() ? rows.pos[row + 1]
+                                                   : encoder.size_bytes();
+        DecoderT decoder(
+          base,
+          1,
+          encoder.share(rows.pos[row], end - rows.pos[row]),
+          std::move(d)...);
+        row_t values{};
+        decoder.read(values);
+        return values;
+    }
 
     /// Return element by index.
-    template<class DecoderT>
-    static std::optional<int64_t>
-    _fetch_ix(DecoderT decoder, size_t target_ix) {
-        size_t ix = 0;
-        std::array<int64_t, buffer_depth> buffer{};
-        while (decoder.read(buffer)) {
-            for (auto o : buffer) {
-                if (ix == target_ix) {
-                    return o;
-                }
-                ix++;
-            }
-            buffer = {};
+    template<class DecoderT, class EncoderT, class... DeltaT>
+    static int64_t _fetch_ix(
+      EncoderT& encoder,
+      const column_rows& rows,
+      size_t target_ix,
+      DeltaT... d) {
+        vassert(
+          target_ix / buffer_depth < rows.pos.size(),
+          "Inconsistent index state");
+        return _decode_row<DecoderT>(
+          encoder, rows, target_ix / buffer_depth, std::move(d)...)
+          .at(target_ix & index_mask);
+    }
+
+    /// Encode a row and record its position and last value
+    template<class EncoderT>
+    static void
+    _add_row(EncoderT& encoder, column_rows& rows, const row_t& row) {
+        const auto pos = encoder.size_bytes();
+        encoder.add(row);
+        rows.pos.push_back(pos);
+        rows.last.push_back(row.back());
+    }
+
+    /// Rebuild the rows of a deserialized column
+    template<class DecoderT, class EncoderT, class... DeltaT>
+    static column_rows _index_rows(const EncoderT& encoder, DeltaT... d) {
+        DecoderT decoder(
+          encoder.get_initial_value(),
+          encoder.get_row_count(),
+          encoder.copy(),
+          std::move(d)...);
+        column_rows rows;
+        rows.last.reserve(encoder.get_row_count());
+        rows.pos.reserve(encoder.get_row_count());
+        row_t values{};
+        for (auto pos = decoder.bytes_consumed(); decoder.read(values);
+             pos = decoder.bytes_consumed()) {
+            rows.pos.push_back(pos);
+            rows.last.push_back(values.back());
+            values = {};
         }
-        return std::nullopt;
+        return rows;
     }
 
 private:
     std::array<int64_t, buffer_depth> _rp_offsets;
     std::array<int64_t, buffer_depth> _kaf_offsets;
     std::array<int64_t, buffer_depth> _file_offsets;
+    std::array<int64_t, buffer_depth> _max_timestamps;
     uint64_t _pos;
     model::offset _initial_rp;
     model::offset _initial_kaf;
@@ -145,7 +227,14 @@ private:
     encoder_t _rp_index;
     encoder_t _kaf_index;
     foffset_encoder_t _file_index;
+    encoder_t _ts_index;
+    column_rows _rp_rows;
+    column_rows _kaf_rows;
+    column_rows _file_rows;
+    column_rows _ts_rows;
     int64_t _min_file_pos_step;
+    // false if deserialized from an index built without timestamps
+    bool _has_timestamps{true};
 };
 
 class remote_segment_index_builder : public storage::batch_consumer {
@@ -176,6 +265,7 @@ public:
 private:
     offset_index& _ix;
     model::offset _running_delta;
+    model::timestamp _max_timestamp{model::timestamp::missing()};
     size_t _window{0};
     size_t _sampling_step;
 };
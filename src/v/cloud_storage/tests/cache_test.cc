@@ -369,3 +369,61 @@ SEASTAR_THREAD_TEST_CASE(test_access_time_tracker_serializer) {
         BOOST_REQUIRE(ts.value() >= timestamps[i]);
     }
 }
+
+SEASTAR_THREAD_TEST_CASE(test_access_time_tracker_index) {
+    access_time_tracker in;
+
+    in.add_file("key0", make_ts(1653000000), 100);
+    in.add_file("key1", make_ts(1653000001), 200);
+    in.add_file("key2", make_ts(1653000002), 300);
+    BOOST_REQUIRE_EQUAL(in.total_size(), 600);
+    BOOST_REQUIRE_EQUAL(in.file_count(), 3);
+
+    // access makes key0 the most recently used file
+    in.add_timestamp("key0", make_ts(1653000003));
+    auto candidates = in.eviction_candidates(250);
+    BOOST_REQUIRE_EQUAL(candidates.size(), 2);
+    BOOST_REQUIRE_EQUAL(candidates[0].path, "key1");
+    BOOST_REQUIRE_EQUAL(candidates[1].path, "key2");
+
+    // overwriting a file replaces its size
+    in.add_file("key1", make_ts(1653000004), 50);
+    BOOST_REQUIRE_EQUAL(in.total_size(), 450);
+
+    in.remove_timestamp("key2");
+    BOOST_REQUIRE_EQUAL(in.total_size(), 150);
+    BOOST_REQUIRE(!in.estimate_timestamp("key2").has_value());
+
+    access_time_tracker out;
+    out.from_iobuf(in.to_iobuf());
+    BOOST_REQUIRE_EQUAL(out.total_size(), 150);
+    candidates = out.eviction_candidates(1000);
+    BOOST_REQUIRE_EQUAL(candidates.size(), 2);
+    BOOST_REQUIRE_EQUAL(candidates[0].path, "key0");
+    BOOST_REQUIRE_EQUAL(candidates[0].size, 100);
+    BOOST_REQUIRE_EQUAL(candidates[1].path, "key1");
+    BOOST_REQUIRE_EQUAL(candidates[1].size, 50);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_access_time_tracker_reconcile) {
+    access_time_tracker tracker;
+    tracker.add_file("removed", make_ts(1653000000), 100);
+    tracker.add_file("resized", make_ts(1653000001), 100);
+    tracker.add_file("recent", make_ts(1653000010), 100);
+
+    std::vector<file_list_item> files = {
+      {make_ts(1653000001), "resized", 200},
+      {make_ts(1653000002), "untracked", 300},
+    };
+    tracker.reconcile(files, make_ts(1653000005));
+
+    // "recent" could have been added after the walker listed its directory
+    BOOST_REQUIRE_EQUAL(tracker.file_count(), 3);
+    BOOST_REQUIRE_EQUAL(tracker.total_size(), 600);
+    BOOST_REQUIRE(!tracker.estimate_timestamp("removed").has_value());
+    auto candidates = tracker.eviction_candidates(1000);
+    BOOST_REQUIRE_EQUAL(candidates.size(), 3);
+    BOOST_REQUIRE_EQUAL(candidates[0].path, "resized");
+    BOOST_REQUIRE_EQUAL(candidates[1].path, "untracked");
+    BOOST_REQUIRE_EQUAL(candidates[2].path, "recent");
+}
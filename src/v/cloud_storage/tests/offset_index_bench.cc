@@ -0,0 +1,133 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/remote_segment_index.h"
+#include "random/generators.h"
+#include "utils/delta_for.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+#include <array>
+#include <vector>
+
+/*
+ * Lookup latency of the remote segment offset index against its size. The
+ * sequential scan of the searched column, which is what a lookup used to
+ * cost before the other columns were even decoded, is measured alongside.
+ */
+
+namespace {
+
+constexpr size_t lookups_per_op = 100;
+
+struct index_data {
+    explicit index_data(size_t entries)
+      : index(model::offset(0), model::offset(0), 0, 1)
+      , rp_column(0) {
+        std::array<int64_t, details::FOR_buffer_depth> row{};
+        int64_t rp = 0;
+        int64_t file_pos = 0;
+        for (size_t i = 0; i < entries; ++i) {
+            rp += random_generators::get_int(1, 100);
+            file_pos += random_generators::get_int(1, 16384);
+            index.add(
+              model::offset(rp),
+              model::offset(rp / 2),
+              file_pos,
+              model::timestamp(rp));
+            rp_offsets.push_back(rp);
+            row.at(i % row.size()) = rp;
+            if ((i + 1) % row.size() == 0) {
+                rp_column.add(row);
+            }
+        }
+        for (size_t i = 0; i < lookups_per_op; ++i) {
+            keys.push_back(model::offset(random_generators::get_int(
+              int64_t(0), rp_offsets.back())));
+        }
+    }
+
+    offset_index index;
+    deltafor_encoder<int64_t> rp_column;
+    std::vector<int64_t> rp_offsets;
+    std::vector<model::offset> keys;
+};
+
+size_t find_rp_offset(size_t entries) {
+    index_data data(entries);
+    perf_tests::start_measuring_time();
+    for (auto key : data.keys) {
+        perf_tests::do_not_optimize(data.index.find_rp_offset(key));
+    }
+    perf_tests::stop_measuring_time();
+    return lookups_per_op;
+}
+
+size_t find_kaf_offset(size_t entries) {
+    index_data data(entries);
+    perf_tests::start_measuring_time();
+    for (auto key : data.keys) {
+        perf_tests::do_not_optimize(
+          data.index.find_kaf_offset(model::offset(key() / 2)));
+    }
+    perf_tests::stop_measuring_time();
+    return lookups_per_op;
+}
+
+size_t sequential_scan(size_t entries) {
+    index_data data(entries);
+    perf_tests::start_measuring_time();
+    for (auto key : data.keys) {
+        deltafor_decoder<int64_t> decoder(
+          data.rp_column.get_initial_value(),
+          data.rp_column.get_row_count(),
+          data.rp_column.share());
+        std::array<int64_t, details::FOR_buffer_depth> row{};
+        size_t ix = 0;
+        bool found = false;
+        while (!found && decoder.read(row)) {
+            for (auto o : row) {
+                if (o >= key()) {
+                    found = true;
+                    break;
+                }
+                ++ix;
+            }
+            row = {};
+        }
+        perf_tests::do_not_optimize(ix);
+    }
+    perf_tests::stop_measuring_time();
+    return lookups_per_op;
+}
+
+} // namespace
+
+PERF_TEST(offset_index, find_rp_offset_1k) { return find_rp_offset(1'000); }
+PERF_TEST(offset_index, find_rp_offset_10k) { return find_rp_offset(10'000); }
+PERF_TEST(offset_index, find_rp_offset_100k) {
+    return find_rp_offset(100'000);
+}
+
+PERF_TEST(offset_index, find_kaf_offset_1k) { return find_kaf_offset(1'000); }
+PERF_TEST(offset_index, find_kaf_offset_10k) {
+    return find_kaf_offset(10'000);
+}
+PERF_TEST(offset_index, find_kaf_offset_100k) {
+    return find_kaf_offset(100'000);
+}
+
+PERF_TEST(offset_index, sequential_scan_1k) { return sequential_scan(1'000); }
+PERF_TEST(offset_index, sequential_scan_10k) {
+    return sequential_scan(10'000);
+}
+PERF_TEST(offset_index, sequential_scan_100k) {
+    return sequential_scan(100'000);
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Licensed as a Redpanda Enterprise file under the Redpanda Community
+ * License (the "License"); you may not use this file except in compliance with
+ * the License. You may obtain a copy of the License at
+ *
+ * https://github.com/redpanda-data/redpanda/blob/master/licenses/rcl.md
+ */
+
+#include "cloud_storage/partition_manifest.h"
+#include "cloud_storage/partition_recovery_manager.h"
+#include "cloud_storage/types.h"
+#include "model/fundamental.h"
+#include "model/metadata.h"
+#include "seastarx.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace cloud_storage;
+
+static const model::ntp manifest_ntp(
+  model::ns("test-ns"), model::topic("test-topic"), model::partition_id(42));
+
+static partition_manifest::segment_meta
+make_segment(int64_t base, int64_t last, int64_t term, int64_t delta) {
+    return {
+      .is_compacted = false,
+      .size_bytes = 1024,
+      .base_offset = model::offset(base),
+      .committed_offset = model::offset(last),
+      .delta_offset = model::offset(delta),
+      .ntp_revision = model::initial_revision_id(0),
+      .archiver_term = model::term_id(term),
+    };
+}
+
+static partition_manifest make_manifest() {
+    partition_manifest m(manifest_ntp, model::initial_revision_id(0));
+    m.add(segment_name("10-1-v1.log"), make_segment(10, 19, 1, 2));
+    m.add(segment_name("20-3-v1.log"), make_segment(20, 29, 3, 4));
+    m.add(segment_name("30-4-v1.log"), make_segment(30, 39, 4, 5));
+    return m;
+}
+
+SEASTAR_THREAD_TEST_CASE(test_replica_log_start_prev_term) {
+    auto m = make_manifest();
+    auto start = find_replica_log_start(m, model::offset(20));
+    BOOST_REQUIRE(start.has_value());
+    BOOST_REQUIRE_EQUAL(start->base_offset, model::offset(20));
+    // term of the segment preceding the first downloaded one
+    BOOST_REQUIRE_EQUAL(start->prev_term, model::term_id(1));
+    BOOST_REQUIRE_EQUAL(start->delta, model::offset(4));
+}
+
+SEASTAR_THREAD_TEST_CASE(test_replica_log_start_first_segment) {
+    auto m = make_manifest();
+    auto start = find_replica_log_start(m, model::offset(10));
+    BOOST_REQUIRE(start.has_value());
+    BOOST_REQUIRE_EQUAL(start->base_offset, model::offset(10));
+    // nothing precedes the first segment of the manifest, its own term is
+    // used
+    BOOST_REQUIRE_EQUAL(start->prev_term, model::term_id(1));
+    BOOST_REQUIRE_EQUAL(start->delta, model::offset(2));
+}
+
+SEASTAR_THREAD_TEST_CASE(test_replica_log_start_unknown_segment) {
+    auto m = make_manifest();
+    BOOST_REQUIRE(!find_replica_log_start(m, model::offset(25)).has_value());
+    BOOST_REQUIRE(!find_replica_log_start(m, model::offset(40)).has_value());
+}
+
+SEASTAR_THREAD_TEST_CASE(test_replica_log_start_without_delta) {
+    partition_manifest m(manifest_ntp, model::initial_revision_id(0));
+    // uploaded by a version which didn't record the offset delta
+    auto meta = make_segment(10, 19, 1, 0);
+    meta.delta_offset = model::offset();
+    m.add(segment_name("10-1-v1.log"), meta);
+    BOOST_REQUIRE(!find_replica_log_start(m, model::offset(10)).has_value());
+}
@@ -38,6 +38,7 @@ BOOST_AUTO_TEST_CASE(remote_segment_index_search_test) {
     std::vector<model::offset> rp_offsets;
     std::vector<model::offset> kaf_offsets;
     std::vector<size_t> file_offsets;
+    std::vector<model::timestamp> timestamps;
     int64_t rp = segment_base_rp_offset();
     int64_t kaf = segment_base_kaf_offset();
     size_t fpos = random_generators::get_int(1000, 2000);
@@ -47,6 +48,7 @@ BOOST_AUTO_TEST_CASE(remote_segment_index_search_test) {
             rp_offsets.push_back(model::offset(rp));
             kaf_offsets.push_back(model::offset(kaf));
             file_offsets.push_back(fpos);
+            timestamps.push_back(model::timestamp(1000 + rp));
         }
         // The test queries every element using the key that matches the element
         // exactly and then it queries the element using the key which is
@@ -66,7 +68,11 @@ BOOST_AUTO_TEST_CASE(remote_segment_index_search_test) {
     model::offset klast;
     size_t flast;
     for (size_t i = 0; i < rp_offsets.size(); i++) {
-        tmp_index.add(rp_offsets.at(i), kaf_offsets.at(i), file_offsets.at(i));
+        tmp_index.add(
+          rp_offsets.at(i),
+          kaf_offsets.at(i),
+          file_offsets.at(i),
+          timestamps.at(i));
         last = rp_offsets.at(i);
         klast = kaf_offsets.at(i);
         flast = file_offsets.at(i);
@@ -86,6 +92,9 @@ BOOST_AUTO_TEST_CASE(remote_segment_index_search_test) {
       segment_base_kaf_offset - model::offset(1));
     BOOST_REQUIRE(!kopt_first.has_value());
 
+    auto topt_first = index.find_timestamp(timestamps.front());
+    BOOST_REQUIRE(!topt_first.has_value());
+
     for (unsigned ix = 0; ix < rp_offsets.size(); ix++) {
         auto opt = index.find_rp_offset(rp_offsets[ix] + model::offset(1));
         auto [rp, kaf, fpos] = *opt;
@@ -97,6 +106,12 @@ BOOST_AUTO_TEST_CASE(remote_segment_index_search_test) {
         BOOST_REQUIRE_EQUAL(kopt->rp_offset, rp_offsets[ix]);
         BOOST_REQUIRE_EQUAL(kopt->kaf_offset, kaf_offsets[ix]);
         BOOST_REQUIRE_EQUAL(kopt->file_pos, file_offsets[ix]);
+
+        auto topt = index.find_timestamp(
+          model::timestamp(timestamps[ix]() + 1));
+        BOOST_REQUIRE_EQUAL(topt->rp_offset, rp_offsets[ix]);
+        BOOST_REQUIRE_EQUAL(topt->kaf_offset, kaf_offsets[ix]);
+        BOOST_REQUIRE_EQUAL(topt->file_pos, file_offsets[ix]);
     }
 
     // Query after the last element
@@ -148,3 +163,43 @@ SEASTAR_THREAD_TEST_CASE(test_remote_segment_index_builder) {
         offset += batch.num_records;
     }
 }
+
+BOOST_AUTO_TEST_CASE(remote_segment_index_search_between_entries) {
+    // complete rows only, then a partial write buffer
+    for (size_t num_entries : {0, 1, 16, 64, 100}) {
+        offset_index index(model::offset(0), model::offset(0), 0U, 10);
+        for (size_t i = 0; i < num_entries; i++) {
+            auto o = static_cast<int64_t>(10 * (i + 1));
+            index.add(
+              model::offset(o),
+              model::offset(o / 2),
+              100 * o,
+              model::timestamp(o));
+        }
+        offset_index deserialized(
+          model::offset(0), model::offset(0), 0U, 10);
+        deserialized.from_iobuf(index.to_iobuf());
+
+        for (auto* ix : {&index, &deserialized}) {
+            BOOST_REQUIRE(!ix->find_rp_offset(model::offset(10)));
+            for (size_t i = 0; i < num_entries; i++) {
+                auto o = static_cast<int64_t>(10 * (i + 1));
+                // any key up to the next entry returns this one
+                for (auto key : {o + 1, o + 5, o + 10}) {
+                    auto res = ix->find_rp_offset(model::offset(key));
+                    BOOST_REQUIRE(res.has_value());
+                    BOOST_REQUIRE_EQUAL(res->rp_offset, model::offset(o));
+                    BOOST_REQUIRE_EQUAL(res->kaf_offset, model::offset(o / 2));
+                    BOOST_REQUIRE_EQUAL(res->file_pos, 100 * o);
+
+                    auto ts = ix->find_timestamp(model::timestamp(key));
+                    BOOST_REQUIRE(ts.has_value());
+                    BOOST_REQUIRE_EQUAL(ts->rp_offset, model::offset(o));
+                }
+                auto kres = ix->find_kaf_offset(model::offset(o / 2 + 1));
+                BOOST_REQUIRE(kres.has_value());
+                BOOST_REQUIRE_EQUAL(kres->rp_offset, model::offset(o));
+            }
+        }
+    }
+}
@@ -13,6 +13,7 @@
 
 #include "cluster/config_frontend.h"
 #include "cluster/controller_service.h"
+#include "cluster/controller_snapshot.h"
 #include "cluster/errc.h"
 #include "cluster/feature_table.h"
 #include "cluster/logger.h"
@@ -21,11 +22,14 @@
 #include "config/node_config.h"
 #include "resource_mgmt/io_priority.h"
 #include "rpc/connection_cache.h"
+#include "serde/serde.h"
 #include "utils/file_io.h"
 #include "vlog.h"
 
 #include <seastar/core/coroutine.hh>
 
+#include <set>
+
 namespace cluster {
 
 // After failure to send status to leader, how long to
@@ -861,4 +865,64 @@ config_manager::apply_update(model::record_batch b) {
       });
 }
 
+ss::future<iobuf> config_manager::take_snapshot(model::offset) {
+    controller_snapshot_parts::config_part snapshot;
+    snapshot.version = _seen_version;
+    snapshot.values.reserve(_raw_values.size());
+    for (const auto& [key, value] : _raw_values) {
+        snapshot.values.emplace_back(key, value);
+    }
+    snapshot.nodes_status.reserve(status.size());
+    for (const auto& [node_id, node_status] : status) {
+        snapshot.nodes_status.push_back(node_status);
+    }
+    snapshot.cluster = _cluster_info;
+    co_return serde::to_iobuf(std::move(snapshot));
+}
+
+ss::future<> config_manager::apply_snapshot(model::offset, iobuf&& buf) {
+    auto snapshot = serde::from_iobuf<controller_snapshot_parts::config_part>(
+      std::move(buf));
+
+    status.clear();
+    for (auto& node_status : snapshot.nodes_status) {
+        auto node_id = node_status.node;
+        status.emplace(node_id, std::move(node_status));
+    }
+    if (snapshot.cluster) {
+        _cluster_info = std::move(snapshot.cluster);
+    }
+
+    if (snapshot.version <= _seen_version) {
+        co_return;
+    }
+
+    /**
+     * Apply the difference with the current values as a single delta, the
+     * snapshot carries the values of all the deltas it replaces.
+     */
+    cluster_config_delta_cmd_data data;
+    std::set<ss::sstring> keys;
+    for (auto& kv : snapshot.values) {
+        keys.insert(kv.key);
+        auto it = _raw_values.find(kv.key);
+        if (it == _raw_values.end() || it->second != kv.value) {
+            data.upsert.push_back(std::move(kv));
+        }
+    }
+    for (const auto& [key, value] : _raw_values) {
+        if (!keys.contains(key)) {
+            data.remove.push_back(key);
+        }
+    }
+    vlog(
+      clusterlog.debug,
+      "apply_snapshot: version {}, {} upserts, {} removes",
+      snapshot.version,
+      data.upsert.size(),
+      data.remove.size());
+    co_await apply_delta(
+      cluster_config_delta_cmd(snapshot.version, std::move(data)));
+}
+
 } // namespace cluster
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "cluster/commands.h"
+#include "cluster/controller_snapshot.h"
 #include "model/record.h"
 #include "rpc/fwd.h"
 
@@ -59,6 +60,8 @@ public:
     // mux_state_machine interface
     bool is_batch_applicable(const model::record_batch& b);
     ss::future<std::error_code> apply_update(model::record_batch);
+    ss::future<iobuf> take_snapshot(model::offset);
+    ss::future<> apply_snapshot(model::offset, iobuf&&);
 
     // Result of trying to apply a delta to a configuration
     struct apply_result {
@@ -71,6 +74,17 @@ public:
 
     config_version get_version() const noexcept { return _seen_version; }
 
+    /// The cluster identity is kept in the controller snapshot, the
+    /// controller sets it before its log head is first truncated
+    const std::optional<controller_snapshot_parts::cluster_info>&
+    get_cluster_info() const {
+        return _cluster_info;
+    }
+
+    void set_cluster_info(controller_snapshot_parts::cluster_info info) {
+        _cluster_info = std::move(info);
+    }
+
     bool needs_update(const config_status& new_status) {
         if (auto s = status.find(new_status.node); s != status.end()) {
             return s->second != new_status;
@@ -110,6 +124,7 @@ private:
     model::node_id _self;
     config_version _seen_version{config_version_unset};
     std::map<ss::sstring, ss::sstring> _raw_values;
+    std::optional<controller_snapshot_parts::cluster_info> _cluster_info;
 
     ss::sharded<config_frontend>& _frontend;
     ss::sharded<rpc::connection_cache>& _connection_cache;
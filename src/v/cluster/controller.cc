@@ -48,6 +48,8 @@
 #include "security/acl.h"
 #include "ssx/future-util.h"
 
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/sleep.hh>
 #include <seastar/core/thread.hh>
 #include <seastar/util/later.hh>
 
@@ -351,6 +353,7 @@ ss::future<> controller::start() {
             std::ref(_tp_state),
             std::ref(_hm_frontend),
             std::ref(_config_frontend),
+            std::ref(_config_manager),
             std::ref(_as));
       })
       .then([this] {
@@ -378,9 +381,67 @@ ss::future<> controller::start() {
           return _partition_balancer.invoke_on(
             partition_balancer_backend::shard,
             &partition_balancer_backend::start);
+      })
+      .then([this] {
+          ssx::spawn_with_gate(_gate, [this] { return snapshot_loop(); });
       });
 }
 
+/**
+ * Every node periodically snapshots its controller state machine at its own
+ * last applied offset, which lets it truncate the controller log. Nodes
+ * which are behind the leader log start receive the leader snapshot with
+ * raft install_snapshot.
+ */
+ss::future<> controller::snapshot_loop() {
+    while (!_as.local().abort_requested()) {
+        try {
+            co_await ss::sleep_abortable(
+              config::shard_local_cfg().controller_snapshot_max_age_sec(),
+              _as.local());
+            // older nodes can not load a snapshot
+            if (!_feature_table.local().is_active(
+                  feature::controller_snapshots)) {
+                continue;
+            }
+            if (!co_await persist_cluster_info()) {
+                continue;
+            }
+            co_await _stm.invoke_on(
+              controller_stm_shard, &controller_stm::write_snapshot);
+        } catch (const ss::sleep_aborted&) {
+        } catch (const ss::gate_closed_exception&) {
+        } catch (...) {
+            vlog(
+              clusterlog.warn,
+              "Error writing controller snapshot - {}",
+              std::current_exception());
+        }
+    }
+}
+
+/**
+ * The cluster identity is derived from the head of the controller log. It is
+ * handed to the config manager, whose snapshot part carries it, before the
+ * first snapshot truncates the head.
+ */
+ss::future<bool> controller::persist_cluster_info() {
+    auto& cfg = _config_manager.local();
+    if (cfg.get_cluster_info()) {
+        co_return true;
+    }
+    auto info = co_await details::read_cluster_info(*_raft0);
+    if (!info) {
+        vlog(
+          clusterlog.warn,
+          "Unable to read the cluster identity from the controller log, not "
+          "taking a snapshot");
+        co_return false;
+    }
+    cfg.set_cluster_info(std::move(*info));
+    co_return true;
+}
+
 ss::future<> controller::shutdown_input() {
     _raft0->shutdown_input();
     return _as.invoke_on_all(&ss::abort_source::request_abort);
@@ -123,6 +123,8 @@ private:
     friend controller_probe;
 
     ss::future<> cluster_creation_hook();
+    ss::future<> snapshot_loop();
+    ss::future<bool> persist_cluster_info();
     config_manager::preload_result _config_preload;
 
     ss::sharded<ss::abort_source> _as;                     // instance per core
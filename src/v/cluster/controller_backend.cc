@@ -54,6 +54,9 @@
 namespace cluster {
 namespace {
 
+// number of new partitions created by a single partition manager call
+constexpr size_t max_new_partitions_batch = 1024;
+
 inline bool contains_node(
   model::node_id id, const std::vector<model::broker_shard>& replicas) {
     return std::any_of(
@@ -705,13 +708,16 @@ ss::future<> controller_backend::reconcile_topics() {
         if (_topic_deltas.empty()) {
             return ss::now();
         }
-        // reconcile NTPs in parallel
-        return ss::parallel_for_each(
-                 _topic_deltas.begin(),
-                 _topic_deltas.end(),
-                 [this](underlying_t::value_type& ntp_deltas) {
-                     return reconcile_ntp(ntp_deltas.second);
-                 })
+        return create_new_partitions()
+          .then([this] {
+              // reconcile NTPs in parallel
+              return ss::parallel_for_each(
+                _topic_deltas.begin(),
+                _topic_deltas.end(),
+                [this](underlying_t::value_type& ntp_deltas) {
+                    return reconcile_ntp(ntp_deltas.second);
+                });
+          })
           .then([this] {
               // cleanup empty NTP keys
               for (auto it = _topic_deltas.cbegin();
@@ -726,6 +732,118 @@ ss::future<> controller_backend::reconcile_topics() {
     });
 }
 
+/**
+ * Partitions of a newly created topic are created in batches, this way the
+ * raft groups of a large topic are registered at once and the shard table is
+ * updated with a single broadcast instead of one per partition.
+ *
+ * Only partitions whose next operation is their creation, on a clean slate,
+ * are batched. Partitions which could not be created are left for the
+ * reconciliation of their ntp which will retry and report errors.
+ */
+ss::future<> controller_backend::create_new_partitions() {
+    struct new_partition {
+        model::ntp ntp;
+        raft::group_id group;
+        model::revision_id revision;
+    };
+
+    auto it = _topic_deltas.begin();
+    while (it != _topic_deltas.end()) {
+        std::vector<new_partition> batch;
+        std::vector<partition_manager::manage_request> requests;
+        for (; it != _topic_deltas.end()
+               && requests.size() < max_new_partitions_batch;
+             ++it) {
+            const auto& [ntp, deltas] = *it;
+            if (
+              deltas.empty()
+              || deltas.front().type != topic_table::delta::op_type::add) {
+                continue;
+            }
+            const auto& delta = deltas.front();
+            if (
+              !has_local_replicas(_self, delta.new_assignment.replicas)
+              || _partition_manager.local().get(ntp)) {
+                continue;
+            }
+            auto cfg = _topics.local().get_topic_cfg(
+              model::topic_namespace_view(ntp));
+            auto initial_rev = _topics.local().get_initial_revision(ntp);
+            if (!cfg || !initial_rev) {
+                continue;
+            }
+            const auto rev = new_replica_revision(delta);
+            requests.push_back(partition_manager::manage_request{
+              .cfg = cfg->make_ntp_config(
+                _data_directory, ntp.tp.partition, rev, initial_rev.value()),
+              .group = delta.new_assignment.group,
+              .initial_nodes = create_brokers_set(
+                delta.new_assignment.replicas, _members_table.local()),
+            });
+            batch.push_back(new_partition{
+              .ntp = ntp,
+              .group = delta.new_assignment.group,
+              .revision = rev,
+            });
+        }
+        if (batch.empty()) {
+            continue;
+        }
+
+        vlog(clusterlog.trace, "creating {} new partitions", batch.size());
+        try {
+            co_await _partition_manager.local().manage_batch(
+              std::move(requests));
+        } catch (...) {
+            vlog(
+              clusterlog.warn,
+              "error creating batch of {} partitions, partitions which were "
+              "not created will be retried - {}",
+              batch.size(),
+              std::current_exception());
+        }
+
+        std::erase_if(batch, [this](const new_partition& p) {
+            auto partition = _partition_manager.local().get(p.ntp);
+            return !partition || partition->get_revision_id() != p.revision;
+        });
+
+        // we create only partitions that belong to current shard
+        co_await _shard_table.invoke_on_all(
+          [&batch, shard = ss::this_shard_id()](shard_table& s) {
+              for (const auto& p : batch) {
+                  s.update(p.ntp, p.group, shard, p.revision);
+              }
+          });
+
+        for (const auto& p : batch) {
+            auto& deltas = _topic_deltas.find(p.ntp)->second;
+            vlog(
+              clusterlog.debug,
+              "partition operation {} finished",
+              deltas.front());
+            deltas.erase(deltas.begin());
+        }
+    }
+}
+
+model::revision_id controller_backend::new_replica_revision(
+  const topic_table::delta& delta) const {
+    /**
+     * Partitions added from a controller snapshot may have had their
+     * local replica moved in after they were created, the replica
+     * revision is the one of the move.
+     */
+    if (delta.replica_revisions) {
+        if (auto it = delta.replica_revisions->find(_self);
+            it != delta.replica_revisions->end()) {
+            return it->second;
+        }
+    }
+    return model::revision_id(delta.offset());
+}
+
 ss::future<std::error_code>
 controller_backend::execute_partition_op(const topic_table::delta& delta) {
     using op_t = topic_table::delta::op_type;
@@ -749,7 +867,7 @@ controller_backend::execute_partition_op(const topic_table::delta& delta) {
         return create_partition(
           delta.ntp,
           delta.new_assignment.group,
-          rev,
+          new_replica_revision(delta),
           create_brokers_set(
             delta.new_assignment.replicas, _members_table.local()));
     case op_t::add_non_replicable:
@@ -1419,10 +1537,9 @@ ss::future<std::error_code> controller_backend::create_partition(
 
     if (!cfg) {
         // partition was already removed, do nothing
-        return ss::make_ready_future<std::error_code>(errc::success);
+        co_return errc::success;
     }
 
-    auto f = ss::now();
     // handle partially created topic
     auto partition = _partition_manager.local().get(ntp);
 
@@ -1432,34 +1549,38 @@ ss::future<std::error_code> controller_backend::create_partition(
     // used
     auto initial_rev = _topics.local().get_initial_revision(ntp);
     if (!initial_rev) {
-        return ss::make_ready_future<std::error_code>(errc::topic_not_exists);
+        co_return errc::topic_not_exists;
     }
     // no partition exists, create one
     if (likely(!partition)) {
         // we use offset as an rev as it is always increasing and it
         // increases while ntp is being created again
-        f = _partition_manager.local()
-              .manage(
-                cfg->make_ntp_config(
-                  _data_directory, ntp.tp.partition, rev, initial_rev.value()),
-                group_id,
-                std::move(members))
-              .discard_result();
+        auto ntp_cfg = cfg->make_ntp_config(
+          _data_directory, ntp.tp.partition, rev, initial_rev.value());
+        if (members.empty()) {
+            // new replica of an existing group, e.g. a partition move target,
+            // its log may first be downloaded from the cloud storage. The
+            // download doesn't hold up the reconciliation, the replica is
+            // created by one of its next passes.
+            auto bootstrapping = co_await _partition_manager.local()
+                                   .bootstrap_replica_from_cloud(ntp_cfg);
+            if (bootstrapping) {
+                co_return errc::waiting_for_recovery;
+            }
+        }
+        co_await _partition_manager.local().manage(
+          std::move(ntp_cfg), group_id, std::move(members));
     } else {
         // old partition still exists, wait for it to be removed
         if (partition->get_revision_id() < rev) {
-            return ss::make_ready_future<std::error_code>(
-              errc::partition_already_exists);
+            co_return errc::partition_already_exists;
         }
     }
 
-    return f
-      .then([this, ntp = std::move(ntp), group_id, rev]() mutable {
-          // we create only partitions that belongs to current shard
-          return add_to_shard_table(
-            std::move(ntp), group_id, ss::this_shard_id(), rev);
-      })
-      .then([] { return make_error_code(errc::success); });
+    // we create only partitions that belongs to current shard
+    co_await add_to_shard_table(
+      std::move(ntp), group_id, ss::this_shard_id(), rev);
+    co_return errc::success;
 }
 controller_backend::cross_shard_move_request::cross_shard_move_request(
   model::revision_id rev, raft::group_configuration cfg)
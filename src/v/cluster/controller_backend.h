@@ -262,6 +262,9 @@ private:
 
     ss::future<> reconcile_topics();
     ss::future<> reconcile_ntp(deltas_t&);
+    // creates partitions waiting only for their creation in batches
+    ss::future<> create_new_partitions();
+    model::revision_id new_replica_revision(const topic_table::delta&) const;
 
     ss::future<std::error_code> execute_partition_op(const topic_table::delta&);
     ss::future<std::error_code> process_partition_reconfiguration(
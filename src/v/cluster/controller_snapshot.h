@@ -0,0 +1,186 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "cluster/feature_table.h"
+#include "cluster/topic_table.h"
+#include "cluster/types.h"
+#include "model/fundamental.h"
+#include "model/metadata.h"
+#include "model/timestamp.h"
+#include "raft/types.h"
+#include "security/acl.h"
+#include "security/license.h"
+#include "security/scram_credential.h"
+#include "serde/envelope.h"
+#include "v8_engine/data_policy.h"
+
+#include <seastar/core/sstring.hh>
+
+#include <optional>
+#include <vector>
+
+/**
+ * Controller snapshot
+ * ===================
+ *
+ * Each state applied by the controller state machine contributes one part to
+ * the raft0 snapshot. The parts capture the state as of the last applied
+ * offset of the controller log, so that the log prefix they cover can be
+ * truncated: a restarting node loads them instead of replaying the full
+ * controller history, and lagging or joining nodes receive them with a raft
+ * install_snapshot.
+ *
+ * All the types below are serde envelopes, new fields must be appended and
+ * the envelope version bumped.
+ */
+namespace cluster::controller_snapshot_parts {
+
+/// An in progress reconfiguration of a partition
+struct partition_update
+  : serde::envelope<partition_update, serde::version<0>> {
+    std::vector<model::broker_shard> previous_replicas;
+    std::vector<model::broker_shard> target_replicas;
+    topic_table::in_progress_state state;
+    model::revision_id update_revision;
+    model::revision_id cancel_revision;
+    topic_table::replicas_revision_map replicas_revisions;
+
+    auto serde_fields() {
+        return std::tie(
+          previous_replicas,
+          target_replicas,
+          state,
+          update_revision,
+          cancel_revision,
+          replicas_revisions);
+    }
+};
+
+struct partition : serde::envelope<partition, serde::version<0>> {
+    partition_assignment assignment;
+    topic_table::replicas_revision_map replicas_revisions;
+    std::optional<partition_update> update;
+
+    auto serde_fields() {
+        return std::tie(assignment, replicas_revisions, update);
+    }
+};
+
+struct topic : serde::envelope<topic, serde::version<0>> {
+    topic_configuration configuration;
+    model::revision_id revision;
+    std::optional<model::initial_revision_id> remote_revision;
+    /// set for non replicable topics only
+    std::optional<model::topic> source_topic;
+    std::vector<partition> partitions;
+
+    auto serde_fields() {
+        return std::tie(
+          configuration, revision, remote_revision, source_topic, partitions);
+    }
+};
+
+struct topics_part : serde::envelope<topics_part, serde::version<0>> {
+    std::vector<topic> topics;
+    /// highest raft group id ever allocated, group ids of deleted topics
+    /// are not reused
+    raft::group_id highest_group_id;
+
+    auto serde_fields() { return std::tie(topics, highest_group_id); }
+};
+
+struct broker : serde::envelope<broker, serde::version<0>> {
+    model::broker node;
+    model::membership_state membership_state;
+    model::maintenance_state maintenance_state;
+
+    auto serde_fields() {
+        return std::tie(node, membership_state, maintenance_state);
+    }
+};
+
+struct members_part : serde::envelope<members_part, serde::version<0>> {
+    /// brokers which were removed from the cluster are kept, as in the
+    /// members table
+    std::vector<broker> brokers;
+
+    auto serde_fields() { return std::tie(brokers); }
+};
+
+struct user : serde::envelope<user, serde::version<0>> {
+    ss::sstring name;
+    ::security::scram_credential credential;
+
+    auto serde_fields() { return std::tie(name, credential); }
+};
+
+struct security_part : serde::envelope<security_part, serde::version<0>> {
+    std::vector<user> users;
+    std::vector<::security::acl_binding> acls;
+
+    auto serde_fields() { return std::tie(users, acls); }
+};
+
+struct data_policy_entry
+  : serde::envelope<data_policy_entry, serde::version<0>> {
+    model::topic_namespace tp_ns;
+    v8_engine::data_policy policy;
+
+    auto serde_fields() { return std::tie(tp_ns, policy); }
+};
+
+struct data_policies_part
+  : serde::envelope<data_policies_part, serde::version<0>> {
+    std::vector<data_policy_entry> policies;
+
+    auto serde_fields() { return std::tie(policies); }
+};
+
+/// Identity of the cluster, derived from the head of the controller log
+/// which snapshots truncate
+struct cluster_info : serde::envelope<cluster_info, serde::version<0>> {
+    ss::sstring uuid;
+    model::timestamp creation_timestamp;
+
+    auto serde_fields() { return std::tie(uuid, creation_timestamp); }
+};
+
+struct config_part : serde::envelope<config_part, serde::version<1>> {
+    config_version version{config_version_unset};
+    std::vector<cluster_property_kv> values;
+    std::vector<config_status> nodes_status;
+    /// the cluster id is a part of the cluster configuration
+    std::optional<cluster_info> cluster;
+
+    auto serde_fields() {
+        return std::tie(version, values, nodes_status, cluster);
+    }
+};
+
+struct feature_entry : serde::envelope<feature_entry, serde::version<0>> {
+    /// features are identified by name, their bits are a runtime detail
+    ss::sstring name;
+    feature_state::state state;
+
+    auto serde_fields() { return std::tie(name, state); }
+};
+
+struct features_part : serde::envelope<features_part, serde::version<0>> {
+    cluster_version active_version{invalid_version};
+    std::vector<feature_entry> states;
+    std::optional<::security::license> license;
+
+    auto serde_fields() { return std::tie(active_version, states, license); }
+};
+
+} // namespace cluster::controller_snapshot_parts
@@ -12,7 +12,9 @@
 #include "cluster/data_policy_manager.h"
 
 #include "cluster/cluster_utils.h"
+#include "cluster/controller_snapshot.h"
 #include "cluster/errc.h"
+#include "serde/serde.h"
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/future.hh>
@@ -73,4 +75,29 @@ data_policy_manager::apply_update(model::record_batch batch) {
     });
 }
 
+ss::future<iobuf> data_policy_manager::take_snapshot(model::offset) {
+    controller_snapshot_parts::data_policies_part snapshot;
+    snapshot.policies.reserve(_dps.local().size());
+    for (const auto& [tp_ns, dp] : _dps.local()) {
+        controller_snapshot_parts::data_policy_entry entry;
+        entry.tp_ns = tp_ns;
+        entry.policy = dp;
+        snapshot.policies.push_back(std::move(entry));
+    }
+    co_return serde::to_iobuf(std::move(snapshot));
+}
+
+ss::future<> data_policy_manager::apply_snapshot(model::offset, iobuf&& buf) {
+    auto snapshot
+      = serde::from_iobuf<controller_snapshot_parts::data_policies_part>(
+        std::move(buf));
+    co_await _dps.invoke_on_all(
+      [&snapshot](v8_engine::data_policy_table& local_db) {
+          local_db.clear();
+          for (const auto& entry : snapshot.policies) {
+              local_db.insert(entry.tp_ns, entry.policy);
+          }
+      });
+}
+
 } // namespace cluster
@@ -35,6 +35,10 @@ public:
                == model::record_batch_type::data_policy_management_cmd;
     }
 
+    // controller snapshot
+    ss::future<iobuf> take_snapshot(model::offset);
+    ss::future<> apply_snapshot(model::offset, iobuf&&);
+
 private:
     ss::sharded<v8_engine::data_policy_table>& _dps;
 };
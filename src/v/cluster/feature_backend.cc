@@ -11,7 +11,10 @@
 
 #include "feature_backend.h"
 
-#include "seastar/core/coroutine.hh"
+#include "cluster/controller_snapshot.h"
+#include "serde/serde.h"
+
+#include <seastar/core/coroutine.hh>
 
 namespace cluster {
 
@@ -41,4 +44,16 @@ feature_backend::apply_update(model::record_batch b) {
     co_return errc::success;
 }
 
+ss::future<iobuf> feature_backend::take_snapshot(model::offset) {
+    co_return serde::to_iobuf(_feature_table.local().make_snapshot());
+}
+
+ss::future<> feature_backend::apply_snapshot(model::offset, iobuf&& buf) {
+    auto snapshot = serde::from_iobuf<controller_snapshot_parts::features_part>(
+      std::move(buf));
+
+    co_await _feature_table.invoke_on_all(
+      [&snapshot](feature_table& t) { t.apply_snapshot(snapshot); });
+}
+
 } // namespace cluster
@@ -35,6 +35,9 @@ public:
         return b.header().type == model::record_batch_type::feature_update;
     }
 
+    ss::future<iobuf> take_snapshot(model::offset);
+    ss::future<> apply_snapshot(model::offset, iobuf&&);
+
 private:
     static constexpr auto accepted_commands = make_commands_list<
       feature_update_cmd,
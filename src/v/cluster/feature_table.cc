@@ -11,6 +11,7 @@
 
 #include "feature_table.h"
 
+#include "cluster/controller_snapshot.h"
 #include "cluster/logger.h"
 #include "cluster/types.h"
 
@@ -34,6 +35,8 @@ std::string_view to_string_view(feature f) {
         return "license";
     case feature::raft_improved_configuration:
         return "raft_improved_configuration";
+    case feature::controller_snapshots:
+        return "controller_snapshots";
     case feature::test_alpha:
         return "__test_alpha";
     }
@@ -62,7 +65,7 @@ std::string_view to_string_view(feature_state::state s) {
 
 // The version that this redpanda node will report: increment this
 // on protocol changes to raft0 structures, like adding new services.
-static constexpr cluster_version latest_version = cluster_version{5};
+static constexpr cluster_version latest_version = cluster_version{6};
 
 feature_table::feature_table() {
     // Intentionally undocumented environment variable, only for use
@@ -166,6 +169,76 @@ void feature_table::on_update() {
     }
 }
 
+controller_snapshot_parts::features_part feature_table::make_snapshot() const {
+    controller_snapshot_parts::features_part snapshot;
+    snapshot.active_version = _active_version;
+    snapshot.states.reserve(_feature_state.size());
+    for (const auto& fs : _feature_state) {
+        snapshot.states.push_back(controller_snapshot_parts::feature_entry{
+          .name = ss::sstring(fs.spec.name), .state = fs.get_state()});
+    }
+    snapshot.license = _license;
+    return snapshot;
+}
+
+/**
+ * Replace the whole table content with the state captured in a controller
+ * snapshot.  Features unknown to this node are ignored, features unknown to
+ * the snapshot are treated as if the active version was just set.
+ */
+void feature_table::apply_snapshot(
+  const controller_snapshot_parts::features_part& snapshot) {
+    _active_version = snapshot.active_version;
+
+    for (auto& fs : _feature_state) {
+        fs.transition_unavailable();
+    }
+
+    for (const auto& entry : snapshot.states) {
+        auto feature_id_opt = resolve_name(entry.name);
+        if (!feature_id_opt.has_value()) {
+            vlog(
+              clusterlog.warn,
+              "Ignoring snapshot state of unknown feature {}",
+              entry.name);
+            continue;
+        }
+
+        auto& fstate = get_state(feature_id_opt.value());
+        switch (entry.state) {
+        case feature_state::state::unavailable:
+            fstate.transition_unavailable();
+            break;
+        case feature_state::state::available:
+            fstate.transition_available();
+            break;
+        case feature_state::state::preparing:
+            fstate.transition_preparing();
+            break;
+        case feature_state::state::active:
+            fstate.transition_active();
+            break;
+        case feature_state::state::disabled_active:
+            fstate.transition_disabled_active();
+            break;
+        case feature_state::state::disabled_preparing:
+            fstate.transition_disabled_preparing();
+            break;
+        case feature_state::state::disabled_clean:
+            fstate.transition_disabled_clean();
+            break;
+        }
+    }
+
+    for (auto& fs : _feature_state) {
+        fs.notify_version(_active_version);
+    }
+
+    _license = snapshot.license;
+
+    on_update();
+}
+
 void feature_table::apply_action(const feature_update_action& fua) {
     auto feature_id_opt = resolve_name(fua.feature_name);
     if (!feature_id_opt.has_value()) {
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "cluster/fwd.h"
 #include "cluster/types.h"
 #include "security/license.h"
 #include "utils/waiter_queue.h"
@@ -29,6 +30,7 @@ enum class feature : std::uint64_t {
     serde_raft_0 = 0x20,
     license = 0x40,
     raft_improved_configuration = 0x80,
+    controller_snapshots = 0x100,
 
     // Dummy features for testing only
     test_alpha = uint64_t(1) << 63,
@@ -129,6 +131,12 @@ constexpr static std::array feature_schema{
     feature::raft_improved_configuration,
     feature_spec::available_policy::always,
     feature_spec::prepare_policy::always},
+  feature_spec{
+    cluster_version{6},
+    "controller_snapshots",
+    feature::controller_snapshots,
+    feature_spec::available_policy::explicit_only,
+    feature_spec::prepare_policy::always},
   feature_spec{
     cluster_version{2001},
     "__test_alpha",
@@ -311,10 +319,13 @@ public:
 
     const std::optional<security::license>& get_license() const;
 
+    controller_snapshot_parts::features_part make_snapshot() const;
+
 private:
     // Only for use by our friends feature backend & manager
     void set_active_version(cluster_version);
     void apply_action(const feature_update_action& fua);
+    void apply_snapshot(const controller_snapshot_parts::features_part&);
 
     void on_update();
 
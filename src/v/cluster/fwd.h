@@ -50,4 +50,15 @@ class feature_table;
 class drain_manager;
 class partition_balancer_backend;
 
+namespace controller_snapshot_parts {
+struct topic;
+struct partition;
+struct topics_part;
+struct members_part;
+struct security_part;
+struct data_policies_part;
+struct config_part;
+struct features_part;
+} // namespace controller_snapshot_parts
+
 } // namespace cluster
@@ -32,6 +32,7 @@
 #include "version.h"
 
 #include <seastar/core/coroutine.hh>
+#include <seastar/core/loop.hh>
 #include <seastar/core/lowres_clock.hh>
 #include <seastar/core/reactor.hh>
 #include <seastar/core/shared_ptr.hh>
@@ -376,6 +377,8 @@ health_monitor_backend::dispatch_refresh_cluster_health_request(
     storage::disk_space_alert cluster_disk_health
       = storage::disk_space_alert::ok;
     _reports.clear();
+    // reports are not collected by this node anymore
+    _report_indices.clear();
     for (auto& n_report : reply.value().report->node_reports) {
         const auto id = n_report.id;
 
@@ -518,8 +521,22 @@ ss::future<> health_monitor_backend::tick_cluster_health() {
     });
 }
 
-ss::future<result<node_health_report>>
+ss::future<result<health_monitor_backend::collected_report>>
 health_monitor_backend::collect_remote_node_health(model::node_id id) {
+    auto it = _report_indices.find(id);
+    return collect_remote_node_health(
+      id,
+      it == _report_indices.end() ? invalid_health_report_version
+                                  : it->second.version());
+}
+
+/**
+ * Requests the changes of a node report since the `base` version, the full
+ * report when `base` is invalid_health_report_version.
+ */
+ss::future<result<health_monitor_backend::collected_report>>
+health_monitor_backend::collect_remote_node_health(
+  model::node_id id, health_report_version base) {
     const auto timeout = model::timeout_clock::now() + max_metadata_age();
     return _connections.local()
       .with_node_client<controller_client_protocol>(
@@ -527,9 +544,10 @@ health_monitor_backend::collect_remote_node_health(model::node_id id) {
         ss::this_shard_id(),
         id,
         max_metadata_age(),
-        [timeout](controller_client_protocol client) mutable {
+        [timeout, base](controller_client_protocol client) mutable {
             return client.collect_node_health_report(
-              get_node_health_request{.filter = node_report_filter{}},
+              get_node_health_request{
+                .filter = node_report_filter{}, .base_version = base},
               rpc::client_opts(timeout));
         })
       .then(&rpc::get_ctx_data<get_node_health_reply>)
@@ -539,7 +557,7 @@ health_monitor_backend::collect_remote_node_health(model::node_id id) {
 }
 
 result<node_health_report>
-map_reply_result(result<get_node_health_reply> reply) {
+map_reply_result(result<get_node_health_reply>& reply) {
     if (!reply) {
         return result<node_health_report>(reply.error());
     }
@@ -549,7 +567,8 @@ map_reply_result(result<get_node_health_reply> reply) {
     return result<node_health_report>(std::move(*reply.value().report));
 }
 
-result<node_health_report> health_monitor_backend::process_node_reply(
+result<health_monitor_backend::collected_report>
+health_monitor_backend::process_node_reply(
   model::node_id id, result<get_node_health_reply> reply) {
     auto it = _last_replies.find(id);
     if (it == _last_replies.end()) {
@@ -575,7 +594,7 @@ result<node_health_report> health_monitor_backend::process_node_reply(
               id,
               res.error().message());
         }
-        return result<node_health_report>(reply.error());
+        return res.error();
     }
 
     // TODO serialize storage_space_alert, instead of recomputing here.
@@ -591,7 +610,73 @@ result<node_health_report> health_monitor_backend::process_node_reply(
         it->second.is_alive = alive::yes;
     }
 
-    return res;
+    return collected_report{
+      .report = std::move(res.value()),
+      .version = reply.value().version,
+      .delta = std::move(reply.value().delta),
+    };
+}
+
+ss::future<result<health_monitor_backend::collected_report>>
+health_monitor_backend::collect_local_node_health() {
+    auto res = co_await collect_current_node_health(node_report_filter{});
+    if (!res) {
+        co_return res.error();
+    }
+    co_return collected_report{.report = std::move(res.value())};
+}
+
+bool health_monitor_backend::can_merge_node_report(
+  const collected_report& collected, const report_cache_t& old_reports) const {
+    if (!collected.delta) {
+        return true;
+    }
+    auto idx_it = _report_indices.find(collected.report.id);
+    return old_reports.contains(collected.report.id)
+           && idx_it != _report_indices.end() && collected.version
+           && idx_it->second.version() == collected.delta->base_version;
+}
+
+/**
+ * Returns the full report of a node, merging delta encoded partition
+ * statuses into the previous report of the node. Partition statuses of the
+ * previous report are moved to the merged one. Returns nullopt when the
+ * changes do not apply to the previous report.
+ */
+std::optional<node_health_report> health_monitor_backend::merge_node_report(
+  collected_report collected, report_cache_t& old_reports) {
+    const auto id = collected.report.id;
+    if (!collected.delta) {
+        if (collected.version) {
+            _report_indices.insert_or_assign(
+              id,
+              node_report_index(collected.report.topics, *collected.version));
+        } else {
+            // node does not support delta encoded reports
+            _report_indices.erase(id);
+        }
+        return std::move(collected.report);
+    }
+
+    if (!can_merge_node_report(collected, old_reports)) {
+        vlog(
+          clusterlog.warn,
+          "unable to merge node {} health report changes since version {}, "
+          "dropping the report",
+          id,
+          collected.delta->base_version);
+        _report_indices.erase(id);
+        return std::nullopt;
+    }
+    auto old_it = old_reports.find(id);
+    auto idx_it = _report_indices.find(id);
+
+    collected.report.topics = std::move(old_it->second.topics);
+    idx_it->second.merge(
+      collected.report.topics,
+      std::move(*collected.delta),
+      *collected.version);
+    return std::move(collected.report);
 }
 
 ss::future<> health_monitor_backend::collect_cluster_health() {
@@ -604,17 +689,45 @@ ss::future<> health_monitor_backend::collect_cluster_health() {
     auto reports = co_await ssx::async_transform(
       ids.begin(), ids.end(), [this](model::node_id id) {
           if (id == _raft0->self().id()) {
-              return collect_current_node_health(node_report_filter{});
+              return collect_local_node_health();
           }
           return collect_remote_node_health(id);
       });
 
+    // changes which do not apply to the previous report of a node can't be
+    // used, request the full report right away rather than missing the node
+    // for a whole tick
+    co_await ss::parallel_for_each(
+      reports, [this](result<collected_report>& collected) {
+          if (
+            !collected
+            || can_merge_node_report(collected.value(), _reports)) {
+              return ss::now();
+          }
+          const auto id = collected.value().report.id;
+          vlog(
+            clusterlog.info,
+            "unable to merge node {} health report changes since version {}, "
+            "requesting a full report",
+            id,
+            collected.value().delta->base_version);
+          _report_indices.erase(id);
+          return collect_remote_node_health(id, invalid_health_report_version)
+            .then([&collected](result<collected_report> full) {
+                collected = std::move(full);
+            });
+      });
+
     auto old_reports = std::exchange(_reports, {});
 
     // update nodes reports and cache cluster-level disk health
     storage::disk_space_alert cluster_disk_health
       = storage::disk_space_alert::ok;
-    for (auto& r : reports) {
+    for (auto& collected : reports) {
+        if (!collected) {
+            continue;
+        }
+        auto r = merge_node_report(std::move(collected.value()), old_reports);
         if (r) {
             const auto id = r.value().id;
             vlog(
@@ -645,6 +758,10 @@ ss::future<> health_monitor_backend::collect_cluster_health() {
             _reports.emplace(id, std::move(r.value()));
         }
     }
+    // indices are only valid together with the reports they describe
+    absl::erase_if(_report_indices, [this](const auto& e) {
+        return !_reports.contains(e.first);
+    });
     _reports_disk_health = cluster_disk_health;
 }
 
@@ -670,6 +787,23 @@ health_monitor_backend::collect_current_node_health(node_report_filter filter) {
 
     co_return ret;
 }
+ss::future<result<get_node_health_reply>>
+health_monitor_backend::collect_node_health_changes(
+  health_report_version base) {
+    auto res = co_await collect_current_node_health(node_report_filter{});
+    if (!res) {
+        co_return res.error();
+    }
+    auto report = std::move(res.value());
+    auto encoded = _report_baseline.update(report.topics, base);
+    co_return get_node_health_reply{
+      .error = errc::success,
+      .report = std::move(report),
+      .version = encoded.version,
+      .delta = std::move(encoded.delta),
+    };
+}
+
 namespace {
 
 struct ntp_leader {
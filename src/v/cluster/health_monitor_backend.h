@@ -12,6 +12,7 @@
 #pragma once
 #include "cluster/fwd.h"
 #include "cluster/health_monitor_types.h"
+#include "cluster/health_report_delta.h"
 #include "cluster/node/local_monitor.h"
 #include "model/metadata.h"
 #include "raft/consensus.h"
@@ -28,6 +29,7 @@
 #include <vector>
 namespace cluster {
 
+// the previous report of a node may be passed without its partition statuses
 using health_node_cb_t = ss::noncopyable_function<void(
   node_health_report const&,
   std::optional<std::reference_wrapper<const node_health_report>>)>;
@@ -74,6 +76,14 @@ public:
     ss::future<result<node_health_report>>
       collect_current_node_health(node_report_filter);
 
+    /**
+     * Collects the full node report requested by the controller leader,
+     * partition statuses are encoded as changes since the base version when
+     * the leader holds the last report this node sent.
+     */
+    ss::future<result<get_node_health_reply>>
+      collect_node_health_changes(health_report_version);
+
     cluster::notification_id_type register_node_callback(health_node_cb_t cb);
     void unregister_node_callback(cluster::notification_id_type id);
 
@@ -103,6 +113,16 @@ private:
         ss::promise<std::error_code> done;
     };
 
+    /**
+     * Node report as received by the collector, when delta is set the report
+     * carries no partition statuses
+     */
+    struct collected_report {
+        node_health_report report;
+        std::optional<health_report_version> version;
+        std::optional<node_health_report_delta> delta;
+    };
+
     struct reply_status {
         ss::lowres_clock::time_point last_reply_timestamp
           = ss::lowres_clock::time_point::min();
@@ -119,8 +139,11 @@ private:
     void tick();
     ss::future<> tick_cluster_health();
     ss::future<> collect_cluster_health();
-    ss::future<result<node_health_report>>
+    ss::future<result<collected_report>>
       collect_remote_node_health(model::node_id);
+    ss::future<result<collected_report>>
+      collect_remote_node_health(model::node_id, health_report_version);
+    ss::future<result<collected_report>> collect_local_node_health();
     ss::future<std::error_code> maybe_refresh_cluster_health(
       force_refresh, model::timeout_clock::time_point);
     ss::future<std::error_code> refresh_cluster_health_cache(force_refresh);
@@ -137,8 +160,12 @@ private:
 
     void refresh_nodes_status();
 
-    result<node_health_report>
+    result<collected_report>
       process_node_reply(model::node_id, result<get_node_health_reply>);
+    bool can_merge_node_report(
+      const collected_report&, const report_cache_t&) const;
+    std::optional<node_health_report>
+    merge_node_report(collected_report, report_cache_t&);
 
     std::chrono::milliseconds tick_interval();
     std::chrono::milliseconds max_metadata_age();
@@ -162,6 +189,11 @@ private:
 
     status_cache_t _status;
     report_cache_t _reports;
+    // partition indices of the reports collected by this node as a
+    // controller leader, used to merge delta encoded reports
+    absl::node_hash_map<model::node_id, node_report_index> _report_indices;
+    // partition statuses of the last report this node sent to the leader
+    partition_status_baseline _report_baseline;
     storage::disk_space_alert _reports_disk_health
       = storage::disk_space_alert::ok;
     last_reply_cache_t _last_replies;
@@ -71,6 +71,14 @@ health_monitor_frontend::collect_node_health(node_report_filter f) {
       });
 }
 
+ss::future<result<get_node_health_reply>>
+health_monitor_frontend::collect_node_health_changes(
+  health_report_version base) {
+    return dispatch_to_backend([base](health_monitor_backend& be) {
+        return be.collect_node_health_changes(base);
+    });
+}
+
 // Return status of single node
 ss::future<result<std::vector<node_state>>>
 health_monitor_frontend::get_nodes_status(
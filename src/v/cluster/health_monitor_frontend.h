@@ -62,6 +62,12 @@ public:
     ss::future<result<node_health_report>>
       collect_node_health(node_report_filter);
 
+    // Collects current node health report for the controller leader holding
+    // the report of given version, partition statuses are sent as changes
+    // since that version when possible
+    ss::future<result<get_node_health_reply>>
+      collect_node_health_changes(health_report_version);
+
     // Return status of all nodes
     ss::future<result<std::vector<node_state>>>
       get_nodes_status(model::timeout_clock::time_point);
@@ -73,6 +73,16 @@ std::ostream& operator<<(std::ostream& o, const node_health_report& r) {
     return o;
 }
 
+std::ostream& operator<<(std::ostream& o, const node_health_report_delta& d) {
+    fmt::print(
+      o,
+      "{{base_version: {}, updated: {}, removed: {}}}",
+      d.base_version,
+      d.updated,
+      d.removed);
+    return o;
+}
+
 std::ostream& operator<<(std::ostream& o, const cluster_health_report& r) {
     fmt::print(
       o,
@@ -154,6 +154,38 @@ struct node_health_report
     }
 };
 
+/**
+ * Version of the partition statuses in a node health report, assigned by the
+ * reporting node. A collector which holds a report of given version may ask
+ * only for the partitions which changed since that version.
+ */
+using health_report_version
+  = named_type<int64_t, struct health_report_version_tag>;
+
+// version used by collectors which hold no report of the node yet
+static constexpr health_report_version invalid_health_report_version{-1};
+
+/**
+ * Changes of node partition statuses since the base version of the report
+ */
+struct node_health_report_delta
+  : serde::envelope<node_health_report_delta, serde::version<0>> {
+    health_report_version base_version;
+    // statuses of partitions which were added or changed since base version
+    std::vector<topic_status> updated;
+    // partitions which are not hosted by the node anymore
+    std::vector<model::ntp> removed;
+
+    friend std::ostream&
+    operator<<(std::ostream&, const node_health_report_delta&);
+
+    friend bool
+    operator==(const node_health_report_delta&, const node_health_report_delta&)
+      = default;
+
+    auto serde_fields() { return std::tie(base_version, updated, removed); }
+};
+
 struct cluster_health_report
   : serde::envelope<cluster_health_report, serde::version<0>> {
     static constexpr int8_t current_version = 0;
@@ -257,7 +289,10 @@ using force_refresh = ss::bool_class<struct hm_force_refresh_tag>;
  */
 
 struct get_node_health_request
-  : serde::envelope<get_node_health_request, serde::version<0>> {
+  : serde::envelope<
+      get_node_health_request,
+      serde::version<1>,
+      serde::compat_version<0>> {
     static constexpr int8_t initial_version = 0;
     // version -1: included revision id in partition status
     static constexpr int8_t revision_id_version = -1;
@@ -269,26 +304,37 @@ struct get_node_health_request
     node_report_filter filter;
     // this field is not serialized
     int8_t decoded_version = current_version;
+    // set by collectors accepting delta encoded partition statuses, version
+    // of the node report held by the collector. Serde only (version 1).
+    std::optional<health_report_version> base_version;
 
     friend bool
     operator==(const get_node_health_request&, const get_node_health_request&)
       = default;
 
-    auto serde_fields() { return std::tie(filter); }
+    auto serde_fields() { return std::tie(filter, base_version); }
 };
 
 struct get_node_health_reply
-  : serde::envelope<get_node_health_reply, serde::version<0>> {
+  : serde::envelope<
+      get_node_health_reply,
+      serde::version<1>,
+      serde::compat_version<0>> {
     static constexpr int8_t current_version = 0;
 
     errc error = cluster::errc::success;
     std::optional<node_health_report> report;
+    // version of the partition statuses of the report. Serde only (version 1).
+    std::optional<health_report_version> version;
+    // when set the report carries no partition statuses, they are encoded as
+    // changes against the version the collector requested
+    std::optional<node_health_report_delta> delta;
 
     friend bool
     operator==(const get_node_health_reply&, const get_node_health_reply&)
       = default;
 
-    auto serde_fields() { return std::tie(error, report); }
+    auto serde_fields() { return std::tie(error, report, version, delta); }
 };
 
 struct get_cluster_health_request
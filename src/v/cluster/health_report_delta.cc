@@ -0,0 +1,167 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "cluster/health_report_delta.h"
+
+#include "random/generators.h"
+#include "vassert.h"
+
+#include <absl/container/flat_hash_map.h>
+
+#include <limits>
+
+namespace cluster {
+
+partition_status_baseline::partition_status_baseline()
+  // start from a random version so that a collector holding a report of the
+  // previous incarnation of this node never matches the current one
+  : _version(random_generators::get_int<int64_t>(
+    0, std::numeric_limits<int64_t>::max() / 2)) {}
+
+partition_status_baseline::encoded partition_status_baseline::update(
+  std::vector<topic_status>& topics, health_report_version base) {
+    const bool as_delta = base != invalid_health_report_version
+                          && base == _version;
+    ++_round;
+
+    node_health_report_delta delta{.base_version = _version};
+    for (const auto& topic : topics) {
+        auto& partitions = _statuses[topic.tp_ns];
+        topic_status changed{.tp_ns = topic.tp_ns};
+        for (const auto& p : topic.partitions) {
+            auto [it, inserted] = partitions.try_emplace(
+              p.id, entry{.status = p, .round = _round});
+            if (!inserted) {
+                it->second.round = _round;
+                if (it->second.status == p) {
+                    continue;
+                }
+                it->second.status = p;
+            }
+            if (as_delta) {
+                changed.partitions.push_back(p);
+            }
+        }
+        if (!changed.partitions.empty()) {
+            delta.updated.push_back(std::move(changed));
+        }
+    }
+
+    // partitions missing from the current statuses were removed
+    for (auto t_it = _statuses.begin(); t_it != _statuses.end();) {
+        auto& [tp_ns, partitions] = *t_it;
+        absl::erase_if(partitions, [&, this](const auto& p) {
+            if (p.second.round == _round) {
+                return false;
+            }
+            if (as_delta) {
+                delta.removed.emplace_back(tp_ns.ns, tp_ns.tp, p.first);
+            }
+            return true;
+        });
+        if (partitions.empty()) {
+            _statuses.erase(t_it++);
+        } else {
+            ++t_it;
+        }
+    }
+
+    _version = health_report_version(_version() + 1);
+    if (!as_delta) {
+        return encoded{.version = _version};
+    }
+
+    topics.clear();
+    return encoded{.version = _version, .delta = std::move(delta)};
+}
+
+node_report_index::node_report_index(
+  const std::vector<topic_status>& topics, health_report_version version)
+  : _version(version) {
+    _topics.reserve(topics.size());
+    for (size_t t_pos = 0; t_pos < topics.size(); ++t_pos) {
+        auto& idx = _topics[topics[t_pos].tp_ns];
+        idx.position = t_pos;
+        const auto& partitions = topics[t_pos].partitions;
+        idx.partitions.reserve(partitions.size());
+        for (size_t p_pos = 0; p_pos < partitions.size(); ++p_pos) {
+            idx.partitions.emplace(partitions[p_pos].id, p_pos);
+        }
+    }
+}
+
+void node_report_index::remove(
+  std::vector<topic_status>& topics, const model::ntp& ntp) {
+    auto t_it = _topics.find(model::topic_namespace_view(ntp));
+    if (t_it == _topics.end()) {
+        return;
+    }
+    auto p_it = t_it->second.partitions.find(ntp.tp.partition);
+    if (p_it == t_it->second.partitions.end()) {
+        return;
+    }
+
+    // swap the removed entry with the last one to keep removals O(1)
+    auto& partitions = topics[t_it->second.position].partitions;
+    const auto p_pos = p_it->second;
+    t_it->second.partitions.erase(p_it);
+    if (p_pos != partitions.size() - 1) {
+        partitions[p_pos] = std::move(partitions.back());
+        t_it->second.partitions[partitions[p_pos].id] = p_pos;
+    }
+    partitions.pop_back();
+
+    if (!partitions.empty()) {
+        return;
+    }
+    const auto t_pos = t_it->second.position;
+    _topics.erase(t_it);
+    if (t_pos != topics.size() - 1) {
+        topics[t_pos] = std::move(topics.back());
+        _topics[topics[t_pos].tp_ns].position = t_pos;
+    }
+    topics.pop_back();
+}
+
+void node_report_index::merge(
+  std::vector<topic_status>& topics,
+  node_health_report_delta&& delta,
+  health_report_version version) {
+    vassert(
+      delta.base_version == _version,
+      "delta base version {} does not match report version {}",
+      delta.base_version,
+      _version);
+
+    for (const auto& ntp : delta.removed) {
+        remove(topics, ntp);
+    }
+
+    for (auto& topic : delta.updated) {
+        auto [t_it, inserted] = _topics.try_emplace(
+          topic.tp_ns, topic_index{.position = topics.size()});
+        if (inserted) {
+            topics.push_back(topic_status{.tp_ns = topic.tp_ns});
+        }
+        auto& partitions = topics[t_it->second.position].partitions;
+        for (auto& p : topic.partitions) {
+            auto [p_it, p_inserted] = t_it->second.partitions.try_emplace(
+              p.id, partitions.size());
+            if (p_inserted) {
+                partitions.push_back(p);
+            } else {
+                partitions[p_it->second] = p;
+            }
+        }
+    }
+
+    _version = version;
+}
+
+} // namespace cluster
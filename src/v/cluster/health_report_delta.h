@@ -0,0 +1,114 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+#include "cluster/health_monitor_types.h"
+#include "model/metadata.h"
+
+#include <absl/container/flat_hash_map.h>
+
+#include <optional>
+#include <vector>
+
+namespace cluster {
+
+/**
+ * Delta encoded health reports
+ * ============================
+ *
+ * The controller leader collects the health report of every node each health
+ * monitor tick. Most of the partition statuses do not change between two
+ * ticks, so a node remembers the statuses of the last report it sent and the
+ * version it assigned to it. A collector holding that version receives only
+ * the statuses which changed since then and merges them into its copy of the
+ * report. Any version mismatch (collector restart, leadership change, lost
+ * reply) falls back to a full report.
+ */
+
+/**
+ * Reporting node side: the partition statuses of the last sent report
+ */
+class partition_status_baseline {
+public:
+    partition_status_baseline();
+
+    struct encoded {
+        health_report_version version;
+        std::optional<node_health_report_delta> delta;
+    };
+
+    /**
+     * Makes the statuses the new baseline and assigns it a new version. When
+     * the collector holds the previous baseline the statuses are returned as
+     * a delta against it and `topics` is cleared, otherwise `topics` is left
+     * intact to be sent in full.
+     */
+    encoded update(std::vector<topic_status>& topics, health_report_version);
+
+    health_report_version version() const { return _version; }
+
+private:
+    struct entry {
+        partition_status status;
+        uint64_t round;
+    };
+    using partitions_t = absl::flat_hash_map<model::partition_id, entry>;
+    using topics_t = absl::flat_hash_map<
+      model::topic_namespace,
+      partitions_t,
+      model::topic_namespace_hash,
+      model::topic_namespace_eq>;
+
+    topics_t _statuses;
+    health_report_version _version;
+    // updates seen in the current round are marked with it, entries with an
+    // older round are removed when the update finishes
+    uint64_t _round{0};
+};
+
+/**
+ * Collector side: index of the partition statuses of a node report, used to
+ * merge deltas into the report in place
+ */
+class node_report_index {
+public:
+    node_report_index(const std::vector<topic_status>&, health_report_version);
+
+    health_report_version version() const { return _version; }
+
+    /**
+     * Merges the delta into the topics of the report this index describes,
+     * the delta base version must be equal to the index version.
+     */
+    void merge(
+      std::vector<topic_status>&,
+      node_health_report_delta&&,
+      health_report_version);
+
+private:
+    struct topic_index {
+        // position of the topic in the report
+        size_t position;
+        // positions of partitions in topic status
+        absl::flat_hash_map<model::partition_id, size_t> partitions;
+    };
+
+    void remove(std::vector<topic_status>&, const model::ntp&);
+
+    absl::flat_hash_map<
+      model::topic_namespace,
+      topic_index,
+      model::topic_namespace_hash,
+      model::topic_namespace_eq>
+      _topics;
+    health_report_version _version;
+};
+
+} // namespace cluster
@@ -12,6 +12,7 @@
 #include "cluster/cluster_utils.h"
 #include "cluster/commands.h"
 #include "cluster/controller_service.h"
+#include "cluster/controller_snapshot.h"
 #include "cluster/drain_manager.h"
 #include "cluster/fwd.h"
 #include "cluster/logger.h"
@@ -25,6 +26,7 @@
 #include "random/generators.h"
 #include "redpanda/application.h"
 #include "reflection/adl.h"
+#include "serde/serde.h"
 #include "storage/api.h"
 
 #include <seastar/core/coroutine.hh>
@@ -283,6 +285,100 @@ members_manager::apply_update(model::record_batch b) {
             });
       });
 }
+ss::future<iobuf> members_manager::take_snapshot(model::offset) {
+    co_return serde::to_iobuf(_members_table.local().make_snapshot());
+}
+
+ss::future<>
+members_manager::apply_snapshot(model::offset offset, iobuf&& buf) {
+    auto snapshot = serde::from_iobuf<controller_snapshot_parts::members_part>(
+      std::move(buf));
+    vlog(
+      clusterlog.debug,
+      "applying members snapshot at offset {} with {} brokers",
+      offset,
+      snapshot.brokers.size());
+
+    std::vector<model::broker> brokers;
+    std::vector<broker_ptr> new_list;
+    for (const auto& b : snapshot.brokers) {
+        if (b.membership_state != model::membership_state::removed) {
+            brokers.push_back(b.node);
+            new_list.push_back(ss::make_lw_shared<model::broker>(b.node));
+        }
+    }
+    auto diff = calculate_changed_brokers(
+      new_list, _members_table.local().all_brokers());
+
+    // collect the updates the members backend would have been notified of
+    std::vector<node_update> updates;
+    for (const auto& added : diff.additions) {
+        updates.push_back(node_update{
+          .id = added->id(),
+          .type = node_update_type::added,
+          .offset = offset,
+        });
+    }
+    auto& allocator = _allocator.local();
+    allocator.update_allocation_nodes(brokers);
+    std::optional<model::maintenance_state> self_maintenance;
+    for (const auto& b : snapshot.brokers) {
+        if (b.membership_state == model::membership_state::removed) {
+            continue;
+        }
+        const auto& node = allocator.state().allocation_nodes().at(b.node.id());
+        const bool draining = b.membership_state
+                              == model::membership_state::draining;
+        if (draining && !node->is_decommissioned()) {
+            allocator.decommission_node(b.node.id());
+            updates.push_back(node_update{
+              .id = b.node.id(),
+              .type = node_update_type::decommissioned,
+              .offset = offset,
+            });
+        } else if (!draining && node->is_decommissioned()) {
+            allocator.recommission_node(b.node.id());
+            updates.push_back(node_update{
+              .id = b.node.id(),
+              .type = node_update_type::recommissioned,
+              .offset = offset,
+            });
+        }
+
+        if (b.node.id() == _self.id()) {
+            auto current = _members_table.local().get_broker(_self.id());
+            if (
+              !current
+              || (*current)->get_maintenance_state() != b.maintenance_state) {
+                self_maintenance = b.maintenance_state;
+            }
+        }
+    }
+
+    co_await _members_table.invoke_on_all(
+      [&snapshot, offset](members_table& m) {
+          m.apply_snapshot(offset, snapshot);
+      });
+
+    if (offset > _last_connection_update_offset) {
+        co_await update_connections(std::move(diff));
+        _last_connection_update_offset = offset;
+    }
+
+    for (auto& update : updates) {
+        co_await _update_queue.push_eventually(std::move(update));
+    }
+
+    if (self_maintenance) {
+        const bool enabled = *self_maintenance
+                             == model::maintenance_state::active;
+        co_await _drain_manager.invoke_on_all(
+          [enabled](cluster::drain_manager& dm) {
+              return enabled ? dm.drain() : dm.restore();
+          });
+    }
+}
+
 ss::future<std::error_code>
 members_manager::apply_raft_configuration_batch(model::record_batch b) {
     vassert(
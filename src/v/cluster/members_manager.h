@@ -86,6 +86,10 @@ public:
                || b.header().type
                     == model::record_batch_type::raft_configuration;
     }
+
+    // controller snapshot
+    ss::future<iobuf> take_snapshot(model::offset);
+    ss::future<> apply_snapshot(model::offset, iobuf&&);
     /**
      * This API is backed by the seastar::queue. It can not be called
      * concurrently from multiple fibers.
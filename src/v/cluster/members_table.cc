@@ -9,6 +9,7 @@
 
 #include "cluster/members_table.h"
 
+#include "cluster/controller_snapshot.h"
 #include "cluster/errc.h"
 #include "cluster/logger.h"
 #include "cluster/types.h"
@@ -223,6 +224,54 @@ members_table::apply(model::offset version, maintenance_mode_cmd cmd) {
     return errc::success;
 }
 
+controller_snapshot_parts::members_part members_table::make_snapshot() const {
+    controller_snapshot_parts::members_part snapshot;
+    snapshot.brokers.reserve(_brokers.size());
+    for (const auto& [id, broker] : _brokers) {
+        controller_snapshot_parts::broker b;
+        b.node = *broker;
+        b.membership_state = broker->get_membership_state();
+        b.maintenance_state = broker->get_maintenance_state();
+        snapshot.brokers.push_back(std::move(b));
+    }
+    return snapshot;
+}
+
+void members_table::apply_snapshot(
+  model::offset version,
+  const controller_snapshot_parts::members_part& snapshot) {
+    _version = model::revision_id(version());
+
+    broker_cache_t brokers;
+    std::vector<std::pair<model::node_id, model::maintenance_state>>
+      maintenance_changes;
+    for (const auto& b : snapshot.brokers) {
+        auto broker = ss::make_lw_shared<model::broker>(b.node);
+        broker->set_membership_state(b.membership_state);
+        broker->set_maintenance_state(b.maintenance_state);
+
+        auto it = _brokers.find(b.node.id());
+        const auto previous = it == _brokers.end()
+                                ? model::maintenance_state::inactive
+                                : it->second->get_maintenance_state();
+        if (previous != b.maintenance_state) {
+            maintenance_changes.emplace_back(b.node.id(), b.maintenance_state);
+        }
+        brokers.emplace(b.node.id(), std::move(broker));
+    }
+    _brokers = std::move(brokers);
+
+    for (const auto& [id, broker] : _brokers) {
+        if (
+          broker->get_membership_state() != model::membership_state::removed) {
+            _waiters.notify(id);
+        }
+    }
+    for (const auto& [id, state] : maintenance_changes) {
+        notify_maintenance_state_change(id, state);
+    }
+}
+
 bool members_table::contains(model::node_id id) const {
     return _brokers.contains(id)
            && _brokers.find(id)->second->get_membership_state()
@@ -46,6 +46,11 @@ public:
     std::error_code apply(model::offset, recommission_node_cmd);
     std::error_code apply(model::offset, maintenance_mode_cmd);
 
+    /// Controller snapshot API
+    controller_snapshot_parts::members_part make_snapshot() const;
+    void apply_snapshot(
+      model::offset, const controller_snapshot_parts::members_part&);
+
     model::revision_id version() const { return _version; }
 
     ss::future<> await_membership(model::node_id id, ss::abort_source& as) {
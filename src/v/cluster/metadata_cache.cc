@@ -107,6 +107,16 @@ const topic_table::underlying_t& metadata_cache::all_topics_metadata() const {
     return _topics_state.local().all_topics_metadata();
 }
 
+notification_id_type metadata_cache::register_topic_delta_notification(
+  topic_table::delta_cb_t cb) {
+    return _topics_state.local().register_delta_notification(std::move(cb));
+}
+
+void metadata_cache::unregister_topic_delta_notification(
+  notification_id_type id) {
+    _topics_state.local().unregister_delta_notification(id);
+}
+
 std::optional<broker_ptr> metadata_cache::get_broker(model::node_id nid) const {
     return _members_table.local().get_broker(nid);
 }
@@ -195,6 +205,11 @@ std::optional<model::node_id> metadata_cache::get_previous_leader_id(
     return _leaders.local().get_previous_leader(tp_ns, p_id);
 }
 
+uint64_t metadata_cache::get_leaders_topic_version(
+  model::topic_namespace_view tp_ns) const {
+    return _leaders.local().topic_version(tp_ns);
+}
+
 /// If present returns a leader of raft0 group
 std::optional<model::node_id> metadata_cache::get_controller_leader_id() {
     return _leaders.local().get_leader(model::controller_ntp);
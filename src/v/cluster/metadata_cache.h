@@ -104,6 +104,12 @@ public:
 
     const topic_table::underlying_t& all_topics_metadata() const;
 
+    /// Registers a callback invoked with the deltas applied to the topic
+    /// table of this shard
+    notification_id_type
+      register_topic_delta_notification(topic_table::delta_cb_t);
+    void unregister_topic_delta_notification(notification_id_type);
+
     /// Returns all brokers, returns copy as the content of broker can change
     std::vector<broker_ptr> all_brokers() const;
 
@@ -135,6 +141,10 @@ public:
 
     std::optional<model::node_id> get_previous_leader_id(
       model::topic_namespace_view, model::partition_id) const;
+
+    /// Version of the leadership information of all the topic partitions,
+    /// see partition_leaders_table::topic_version
+    uint64_t get_leaders_topic_version(model::topic_namespace_view) const;
     /// Returns metadata of all topics in cache internal format
     // const cache_t& all_metadata() const { return _cache; }
 
@@ -13,6 +13,7 @@
 
 #include "bytes/iobuf.h"
 #include "cluster/config_frontend.h"
+#include "cluster/config_manager.h"
 #include "cluster/fwd.h"
 #include "cluster/health_monitor_frontend.h"
 #include "cluster/health_monitor_types.h"
@@ -92,6 +93,51 @@ address parse_url(const ss::sstring& url) {
     }
     return ret;
 }
+
+ss::future<std::optional<controller_snapshot_parts::cluster_info>>
+read_cluster_info(raft::consensus& raft0) {
+    if (raft0.start_offset() > model::offset(0)) {
+        co_return std::nullopt;
+    }
+
+    storage::log_reader_config reader_cfg(
+      model::offset(0), model::offset(2), ss::default_priority_class());
+    auto reader = co_await raft0.make_reader(reader_cfg);
+
+    auto batches = co_await model::consume_reader_to_memory(
+      std::move(reader), model::no_timeout);
+    /**
+     * In order to seed the UUID generator we use a hash over first two batches
+     * timestamps and initial raft-0 configuration
+     */
+    if (batches.size() < 2) {
+        co_return std::nullopt;
+    }
+
+    auto& first_cfg = batches.front();
+
+    auto data_bytes = iobuf_to_bytes(first_cfg.data());
+    hash_sha256 sha256;
+    sha256.update(data_bytes);
+    controller_snapshot_parts::cluster_info info;
+    info.creation_timestamp = first_cfg.header().first_timestamp;
+    // use timestamps of first two batches in raft-0 log.
+    for (int i = 0; i < 2; ++i) {
+        sha256.update(iobuf_to_bytes(
+          reflection::to_iobuf(batches[i].header().first_timestamp())));
+    }
+    auto hash = sha256.reset();
+    // seed prng with data and timestamps hash
+    boost::random::mt19937 mersenne_twister;
+    boost::random::seed_seq seed(hash.begin(), hash.end());
+    mersenne_twister.seed(seed);
+
+    boost::uuids::random_generator_mt19937 uuid_gen(mersenne_twister);
+
+    info.uuid = fmt::format("{}", uuid_gen());
+    co_return info;
+}
+
 } // namespace details
 
 static ss::logger logger("metrics-reporter");
@@ -102,12 +148,14 @@ metrics_reporter::metrics_reporter(
   ss::sharded<topic_table>& topic_table,
   ss::sharded<health_monitor_frontend>& health_monitor,
   ss::sharded<config_frontend>& config_frontend,
+  ss::sharded<config_manager>& config_manager,
   ss::sharded<ss::abort_source>& as)
   : _raft0(std::move(raft0))
   , _members_table(members_table)
   , _topics(topic_table)
   , _health_monitor(health_monitor)
   , _config_frontend(config_frontend)
+  , _config_manager(config_manager)
   , _as(as)
   , _logger(logger, "metrics-reporter") {}
 
@@ -248,40 +296,18 @@ ss::future<> metrics_reporter::try_initialize_cluster_info() {
         co_return;
     }
 
-    storage::log_reader_config reader_cfg(
-      model::offset(0), model::offset(2), ss::default_priority_class());
-    auto reader = co_await _raft0->make_reader(reader_cfg);
-
-    auto batches = co_await model::consume_reader_to_memory(
-      std::move(reader), model::no_timeout);
-    /**
-     * In order to seed the UUID generator we use a hash over first two batches
-     * timestamps and initial raft-0 configuration
-     */
-    if (batches.size() < 2) {
-        co_return;
+    // the controller log head is truncated by controller snapshots, which
+    // carry the identity instead
+    auto info = _config_manager.local().get_cluster_info();
+    if (!info) {
+        info = co_await details::read_cluster_info(*_raft0);
     }
-
-    auto& first_cfg = batches.front();
-
-    auto data_bytes = iobuf_to_bytes(first_cfg.data());
-    hash_sha256 sha256;
-    sha256.update(data_bytes);
-    _creation_timestamp = first_cfg.header().first_timestamp;
-    // use timestamps of first two batches in raft-0 log.
-    for (int i = 0; i < 2; ++i) {
-        sha256.update(iobuf_to_bytes(
-          reflection::to_iobuf(batches[i].header().first_timestamp())));
+    if (!info) {
+        co_return;
     }
-    auto hash = sha256.reset();
-    // seed prng with data and timestamps hash
-    boost::random::mt19937 mersenne_twister;
-    boost::random::seed_seq seed(hash.begin(), hash.end());
-    mersenne_twister.seed(seed);
-
-    boost::uuids::random_generator_mt19937 uuid_gen(mersenne_twister);
 
-    _cluster_uuid = fmt::format("{}", uuid_gen());
+    _creation_timestamp = info->creation_timestamp;
+    _cluster_uuid = std::move(info->uuid);
 }
 
 /**
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "cluster/controller_snapshot.h"
 #include "cluster/fwd.h"
 #include "cluster/health_monitor_types.h"
 #include "cluster/members_table.h"
@@ -42,6 +43,11 @@ struct address {
 
 address parse_url(const ss::sstring&);
 
+/// Derives the cluster identity from the head of the controller log,
+/// nullopt when the head is not yet replicated or was truncated
+ss::future<std::optional<controller_snapshot_parts::cluster_info>>
+read_cluster_info(raft::consensus&);
+
 }; // namespace details
 
 class metrics_reporter {
@@ -78,6 +84,7 @@ public:
       ss::sharded<topic_table>&,
       ss::sharded<health_monitor_frontend>&,
       ss::sharded<config_frontend>&,
+      ss::sharded<config_manager>&,
       ss::sharded<ss::abort_source>&);
 
     ss::future<> start();
@@ -99,6 +106,7 @@ private:
     ss::sharded<topic_table>& _topics;
     ss::sharded<health_monitor_frontend>& _health_monitor;
     ss::sharded<config_frontend>& _config_frontend;
+    ss::sharded<config_manager>& _config_manager;
     ss::sharded<ss::abort_source>& _as;
     model::timestamp _creation_timestamp;
     prefix_logger _logger;
@@ -268,6 +268,16 @@ public:
         return _cloud_storage_partition->make_reader(config, deadline);
     }
 
+    /// Timequery over the uploaded data, takes and returns kafka offsets
+    ss::future<std::optional<storage::timequery_result>>
+    cloud_timequery(storage::timequery_config cfg) {
+        vassert(
+          cloud_data_available(),
+          "Method can only be called if cloud data is available, ntp: {}",
+          _raft->ntp());
+        return _cloud_storage_partition->timequery(cfg);
+    }
+
     ss::future<> remove_persistent_state() {
         if (_rm_stm) {
             co_await _rm_stm->remove_persistent_state();
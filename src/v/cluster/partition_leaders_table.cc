@@ -115,6 +115,7 @@ void partition_leaders_table::update_partition_leader(
             .update_term = term,
             .partition_revision = revision_id});
         it = new_it;
+        ++get_topic_leaders(model::topic_namespace_view(ntp)).partitions;
     } else {
         // Currently we have to check if revision id is valid since not all the
         // code paths devlivers revision information
@@ -147,6 +148,7 @@ void partition_leaders_table::update_partition_leader(
             it->second.partition_revision = revision_id;
         }
     }
+    bump_topic_version(model::topic_namespace_view(ntp));
     vlog(
       clusterlog.trace,
       "updated partition: {} leader: {{term: {}, current leader: {}, previous "
@@ -23,6 +23,7 @@
 #include <absl/container/flat_hash_map.h>
 #include <absl/container/node_hash_map.h>
 
+#include <algorithm>
 #include <optional>
 
 namespace cluster {
@@ -82,6 +83,7 @@ public:
         // ignore updates with old revision
         if (it != _leaders.end() && it->second.partition_revision <= revision) {
             _leaders.erase(it);
+            remove_topic_partition(model::topic_namespace_view(ntp));
         }
     }
 
@@ -94,7 +96,25 @@ public:
       model::term_id,
       std::optional<model::node_id>);
 
-    void reset() { _leaders.clear(); }
+    void reset() {
+        _leaders.clear();
+        _topic_versions.clear();
+        _reset_version = ++_version;
+    }
+
+    /**
+     * Version of leadership information of all partitions of a topic. It
+     * changes whenever a leader, a term or a previous leader of any of the
+     * topic partitions changes, which allows callers to cache what they
+     * derive from the leaders of a topic.
+     */
+    uint64_t topic_version(model::topic_namespace_view tp_ns) const {
+        auto it = _topic_versions.find(tp_ns);
+        if (it == _topic_versions.end()) {
+            return _reset_version;
+        }
+        return std::max(it->second.version, _reset_version);
+    }
 
     struct leader_info_t {
         model::topic_namespace tp_ns;
@@ -204,6 +224,40 @@ private:
     std::optional<leader_meta>
       find_leader_meta(model::topic_namespace_view, model::partition_id) const;
 
+    struct topic_leaders {
+        uint64_t version{0};
+        // number of partitions of the topic in _leaders
+        size_t partitions{0};
+    };
+
+    topic_leaders& get_topic_leaders(model::topic_namespace_view tp_ns) {
+        auto it = _topic_versions.find(tp_ns);
+        if (it == _topic_versions.end()) {
+            it = _topic_versions
+                   .emplace(model::topic_namespace(tp_ns), topic_leaders{})
+                   .first;
+        }
+        return it->second;
+    }
+
+    void bump_topic_version(model::topic_namespace_view tp_ns) {
+        get_topic_leaders(tp_ns).version = ++_version;
+    }
+
+    // the version of a topic goes away with the last of its partitions, a
+    // topic without leaders is at the reset version
+    void remove_topic_partition(model::topic_namespace_view tp_ns) {
+        auto it = _topic_versions.find(tp_ns);
+        if (it == _topic_versions.end()) {
+            return;
+        }
+        if (--it->second.partitions == 0) {
+            _topic_versions.erase(it);
+            return;
+        }
+        it->second.version = ++_version;
+    }
+
     absl::flat_hash_map<leader_key, leader_meta, leader_key_hash, leader_key_eq>
       _leaders;
 
@@ -222,6 +276,15 @@ private:
     ss::sharded<topic_table>& _topic_table;
 
     ntp_callbacks<leader_change_cb_t> _watchers;
+
+    uint64_t _version{0};
+    uint64_t _reset_version{0};
+    absl::flat_hash_map<
+      model::topic_namespace,
+      topic_leaders,
+      model::topic_namespace_hash,
+      model::topic_namespace_eq>
+      _topic_versions;
 };
 
 } // namespace cluster
@@ -24,6 +24,7 @@
 #include "raft/types.h"
 #include "resource_mgmt/io_priority.h"
 #include "ssx/async-clear.h"
+#include "ssx/future-util.h"
 #include "storage/offset_translator_state.h"
 #include "storage/segment_utils.h"
 #include "storage/snapshot.h"
@@ -32,16 +33,27 @@
 
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/io_priority_class.hh>
+#include <seastar/core/loop.hh>
 #include <seastar/core/reactor.hh>
+#include <seastar/core/seastar.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/smp.hh>
+#include <seastar/util/file.hh>
+
+#include <boost/range/irange.hpp>
 
 #include <algorithm>
 #include <exception>
 #include <iterator>
+#include <optional>
 
 namespace cluster {
 
+namespace {
+// bounds the number of logs opened at once by a batch of new partitions
+constexpr size_t max_concurrent_log_preparations = 128;
+} // namespace
+
 partition_manager::partition_manager(
   ss::sharded<storage::api>& storage,
   ss::sharded<raft::group_manager>& raft,
@@ -75,6 +87,84 @@ ss::future<consensus_ptr> partition_manager::manage(
   raft::group_id group,
   std::vector<model::broker> initial_nodes) {
     gate_guard guard(_gate);
+    storage::log log = co_await prepare_log(
+      std::move(ntp_cfg), group, initial_nodes);
+
+    ss::lw_shared_ptr<raft::consensus> c
+      = co_await _raft_manager.local().create_group(
+        group, std::move(initial_nodes), log);
+
+    auto p = add_partition(c);
+    co_await p->start();
+
+    co_return c;
+}
+
+ss::future<> partition_manager::manage_batch(
+  std::vector<manage_request> requests) {
+    gate_guard guard(_gate);
+    std::vector<std::optional<storage::log>> logs(requests.size());
+    std::exception_ptr error;
+    co_await ss::max_concurrent_for_each(
+      boost::irange<size_t>(0, requests.size()),
+      max_concurrent_log_preparations,
+      [this, &requests, &logs, &error](size_t i) {
+          auto& r = requests[i];
+          return prepare_log(std::move(r.cfg), r.group, r.initial_nodes)
+            .then_wrapped(
+              [&logs, &error, i](ss::future<storage::log> f) {
+                  if (f.failed()) {
+                      auto e = f.get_exception();
+                      if (!error) {
+                          error = e;
+                      }
+                      return;
+                  }
+                  logs[i] = f.get();
+              });
+      });
+
+    std::vector<raft::group_manager::create_group_request> groups;
+    groups.reserve(requests.size());
+    for (size_t i = 0; i < requests.size(); ++i) {
+        if (!logs[i]) {
+            continue;
+        }
+        groups.push_back(raft::group_manager::create_group_request{
+          .id = requests[i].group,
+          .nodes = std::move(requests[i].initial_nodes),
+          .log = std::move(*logs[i]),
+        });
+    }
+
+    auto consensus = co_await _raft_manager.local().create_groups(
+      std::move(groups));
+
+    std::vector<ss::lw_shared_ptr<partition>> partitions;
+    partitions.reserve(consensus.size());
+    for (auto& c : consensus) {
+        partitions.push_back(add_partition(c));
+    }
+    vlog(
+      clusterlog.debug,
+      "Created {} of {} requested partitions",
+      partitions.size(),
+      requests.size());
+
+    co_await ss::max_concurrent_for_each(
+      partitions,
+      max_concurrent_log_preparations,
+      [](ss::lw_shared_ptr<partition>& p) { return p->start(); });
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+ss::future<storage::log> partition_manager::prepare_log(
+  storage::ntp_config ntp_cfg,
+  raft::group_id group,
+  const std::vector<model::broker>& initial_nodes) {
     auto dl_result = co_await maybe_download_log(ntp_cfg);
     auto [logs_recovered, min_kafka_offset, max_kafka_offset, manifest]
       = dl_result;
@@ -117,10 +207,10 @@ ss::future<consensus_ptr> partition_manager::manage(
       log.segment_count(),
       log.size_bytes());
 
-    ss::lw_shared_ptr<raft::consensus> c
-      = co_await _raft_manager.local().create_group(
-        group, std::move(initial_nodes), log);
+    co_return log;
+}
 
+ss::lw_shared_ptr<partition> partition_manager::add_partition(consensus_ptr c) {
     auto p = ss::make_lw_shared<partition>(
       c,
       _tx_gateway_frontend,
@@ -128,8 +218,8 @@ ss::future<consensus_ptr> partition_manager::manage(
       _cloud_storage_cache,
       _feature_table);
 
-    _ntp_table.emplace(log.config().ntp(), p);
-    _raft_table.emplace(group, p);
+    _ntp_table.emplace(c->ntp(), p);
+    _raft_table.emplace(c->group(), p);
 
     /*
      * part of the node leadership draining infrastructure. when a node is in a
@@ -145,9 +235,7 @@ ss::future<consensus_ptr> partition_manager::manage(
 
     _manage_watchers.notify(p->ntp(), p);
 
-    co_await p->start();
-
-    co_return c;
+    return p;
 }
 
 ss::future<cloud_storage::log_recovery_result>
@@ -165,7 +253,139 @@ partition_manager::maybe_download_log(storage::ntp_config& ntp_cfg) {
     co_return cloud_storage::log_recovery_result{};
 }
 
+ss::future<bool> partition_manager::bootstrap_replica_from_cloud(
+  const storage::ntp_config& ntp_cfg) {
+    if (auto it = _replica_bootstraps.find(ntp_cfg.ntp());
+        it != _replica_bootstraps.end()) {
+        if (!it->second.done) {
+            if (it->second.revision != ntp_cfg.get_revision()) {
+                // the download removes what it wrote once aborted
+                it->second.as->request_abort();
+            }
+            co_return true;
+        }
+        auto bootstrap = std::move(it->second);
+        _replica_bootstraps.erase(it);
+        if (bootstrap.revision == ntp_cfg.get_revision()) {
+            // the replica starts with whatever was downloaded
+            co_return false;
+        }
+        // the log downloaded for a previous revision is never used
+        if (co_await ss::file_exists(bootstrap.work_directory)) {
+            co_await ss::recursive_remove_directory(
+              std::filesystem::path(bootstrap.work_directory));
+        }
+    }
+    if (
+      !config::shard_local_cfg().cloud_storage_enable_replica_bootstrap()
+      || !_partition_recovery_mgr.local_is_initialized()
+      || !ntp_cfg.is_archival_enabled() || !ntp_cfg.is_remote_fetch_enabled()
+      || ntp_cfg.is_read_replica_mode_enabled() || _gate.is_closed()) {
+        co_return false;
+    }
+    if (co_await ss::file_exists(ntp_cfg.work_directory())) {
+        // the replica already has a log
+        co_return false;
+    }
+    if (_replica_bootstraps.contains(ntp_cfg.ntp())) {
+        co_return true;
+    }
+
+    auto ntp = ntp_cfg.ntp();
+    auto revision = ntp_cfg.get_revision();
+    auto [it, _] = _replica_bootstraps.emplace(
+      ntp,
+      replica_bootstrap{
+        .revision = revision, .work_directory = ntp_cfg.work_directory()});
+    ssx::spawn_with_gate(
+      _gate,
+      [this,
+       ntp,
+       revision,
+       ntp_cfg = ntp_cfg.copy(),
+       as = it->second.as]() mutable {
+          return do_bootstrap_replica_from_cloud(std::move(ntp_cfg), as)
+            .finally([this, ntp, revision] {
+                auto it = _replica_bootstraps.find(ntp);
+                if (
+                  it != _replica_bootstraps.end()
+                  && it->second.revision == revision) {
+                    it->second.done = true;
+                }
+            });
+      });
+    co_return true;
+}
+
+ss::future<> partition_manager::do_bootstrap_replica_from_cloud(
+  storage::ntp_config ntp_cfg, ss::lw_shared_ptr<ss::abort_source> as) {
+    const auto work_dir = std::filesystem::path(ntp_cfg.work_directory());
+    bool failed = false;
+    try {
+        auto res = co_await _partition_recovery_mgr.local()
+                     .download_replica_log(
+                       ntp_cfg,
+                       config::shard_local_cfg()
+                         .cloud_storage_replica_bootstrap_timeout_ms(),
+                       *as);
+        // aborted while the download was finishing
+        as->check();
+        if (!res.completed) {
+            co_return;
+        }
+        auto start = cloud_storage::find_replica_log_start(
+          res.manifest, res.min_kafka_offset);
+        if (!start) {
+            // segments uploaded by older versions don't have the offset
+            // translator delta which the replica has to start with
+            vlog(
+              clusterlog.info,
+              "Can't bootstrap {} from the cloud storage, segment {} has no "
+              "offset delta, recovering it from the leader",
+              ntp_cfg.ntp(),
+              res.min_kafka_offset);
+            failed = true;
+        } else {
+            vlog(
+              clusterlog.info,
+              "Bootstrapping replica {} from the cloud storage, offsets: "
+              "{}-{}",
+              ntp_cfg.ntp(),
+              res.min_kafka_offset,
+              res.max_kafka_offset);
+            co_await raft::details::bootstrap_replica_from_log_suffix(
+              ntp_cfg,
+              start->base_offset,
+              start->prev_term,
+              raft::offset_translator_delta(start->delta()));
+            co_await archival_metadata_stm::make_snapshot(
+              ntp_cfg, res.manifest, res.max_kafka_offset);
+        }
+    } catch (...) {
+        if (as->abort_requested()) {
+            vlog(
+              clusterlog.debug,
+              "Bootstrap of {} from the cloud storage abandoned",
+              ntp_cfg.ntp());
+        } else {
+            vlog(
+              clusterlog.warn,
+              "Failed to bootstrap {} from the cloud storage, recovering it "
+              "from the leader: {}",
+              ntp_cfg.ntp(),
+              std::current_exception());
+        }
+        failed = true;
+    }
+    if (failed && co_await ss::file_exists(work_dir.string())) {
+        co_await ss::recursive_remove_directory(work_dir);
+    }
+}
+
 ss::future<> partition_manager::stop_partitions() {
+    for (auto& [_, bootstrap] : _replica_bootstraps) {
+        bootstrap.as->request_abort();
+    }
     co_await _gate.close();
     // prevent partitions from being accessed
     auto partitions = std::exchange(_ntp_table, {});
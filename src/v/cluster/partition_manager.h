@@ -24,6 +24,8 @@
 #include "storage/api.h"
 #include "utils/named_type.h"
 
+#include <seastar/core/abort_source.hh>
+
 #include <absl/container/flat_hash_map.h>
 
 namespace cluster {
@@ -77,6 +79,33 @@ public:
     ss::future<consensus_ptr>
       manage(storage::ntp_config, raft::group_id, std::vector<model::broker>);
 
+    /// Seeds a new replica of an existing partition with the segments
+    /// uploaded to the cloud storage, if enabled, so that it only has to
+    /// recover the tail of the log from the leader. The download runs in the
+    /// background, the replica is managed once it completes: returns true
+    /// while it is in progress.
+    /// A download for a previous revision of the replica is aborted and its
+    /// directory removed.
+    ss::future<bool>
+    bootstrap_replica_from_cloud(const storage::ntp_config&);
+
+    struct manage_request {
+        storage::ntp_config cfg;
+        raft::group_id group;
+        std::vector<model::broker> initial_nodes;
+    };
+
+    /*
+     * Manages many partitions at once. Logs are opened concurrently and the
+     * raft groups of all of them are created in a single step, which makes
+     * creating topics with many partitions much cheaper than calling manage
+     * for every partition.
+     *
+     * Partitions whose log could not be opened are skipped, the first such
+     * error is rethrown once all the other partitions are started.
+     */
+    ss::future<> manage_batch(std::vector<manage_request>);
+
     ss::future<> shutdown(const model::ntp& ntp);
     ss::future<> remove(const model::ntp& ntp);
 
@@ -175,6 +204,20 @@ private:
     ss::future<cloud_storage::log_recovery_result>
     maybe_download_log(storage::ntp_config& ntp_cfg);
 
+    /// Downloads the log of a new replica and writes the state it starts
+    /// with. The replica directory is removed if the uploaded segments can't
+    /// be used as is.
+    ss::future<> do_bootstrap_replica_from_cloud(
+      storage::ntp_config, ss::lw_shared_ptr<ss::abort_source>);
+
+    /// Recovers or bootstraps the log of a partition and opens it
+    ss::future<storage::log> prepare_log(
+      storage::ntp_config, raft::group_id, const std::vector<model::broker>&);
+
+    /// Creates a partition of the group and makes it visible to the
+    /// watchers, the partition is not started.
+    ss::lw_shared_ptr<partition> add_partition(consensus_ptr);
+
     ss::future<> do_shutdown(ss::lw_shared_ptr<partition>);
 
     storage::api& _storage;
@@ -193,6 +236,15 @@ private:
     ss::sharded<cloud_storage::remote>& _cloud_storage_api;
     ss::sharded<cloud_storage::cache>& _cloud_storage_cache;
     ss::sharded<feature_table>& _feature_table;
+    struct replica_bootstrap {
+        model::revision_id revision;
+        ss::sstring work_directory;
+        // stops the download once the replica is not wanted anymore
+        ss::lw_shared_ptr<ss::abort_source> as
+          = ss::make_lw_shared<ss::abort_source>();
+        bool done{false};
+    };
+    absl::flat_hash_map<model::ntp, replica_bootstrap> _replica_bootstraps;
     ss::gate _gate;
     bool _block_new_leadership{false};
 
@@ -133,6 +133,14 @@ void replicated_partition_probe::setup_internal_metrics(const model::ntp& ntp) {
           sm::description("Total number of bytes fetched"),
           labels)
           .aggregate(aggregate_labels),
+        sm::make_total_bytes(
+          "bytes_fetched_from_follower_total",
+          [this] { return _bytes_fetched_from_follower; },
+          sm::description(
+            "Total number of bytes fetched by consumers from this replica "
+            "while it was a follower"),
+          labels)
+          .aggregate(aggregate_labels),
       });
 }
 
@@ -228,6 +236,7 @@ partition_probe make_materialized_partition_probe() {
         void add_records_fetched(uint64_t) final {}
         void add_records_produced(uint64_t) final {}
         void add_bytes_fetched(uint64_t) final {}
+        void add_bytes_fetched_from_follower(uint64_t) final {}
         void add_bytes_produced(uint64_t) final {}
     };
     return partition_probe(std::make_unique<impl>());
@@ -28,6 +28,7 @@ public:
         virtual void add_records_fetched(uint64_t) = 0;
         virtual void add_bytes_produced(uint64_t) = 0;
         virtual void add_bytes_fetched(uint64_t) = 0;
+        virtual void add_bytes_fetched_from_follower(uint64_t) = 0;
         virtual void setup_metrics(const model::ntp&) = 0;
         virtual ~impl() noexcept = default;
     };
@@ -54,6 +55,10 @@ public:
         return _impl->add_bytes_fetched(bytes);
     }
 
+    void add_bytes_fetched_from_follower(uint64_t bytes) {
+        return _impl->add_bytes_fetched_from_follower(bytes);
+    }
+
 private:
     std::unique_ptr<impl> _impl;
 };
@@ -67,6 +72,9 @@ public:
     void add_records_produced(uint64_t cnt) final { _records_produced += cnt; }
     void add_bytes_fetched(uint64_t cnt) final { _bytes_fetched += cnt; }
     void add_bytes_produced(uint64_t cnt) final { _bytes_produced += cnt; }
+    void add_bytes_fetched_from_follower(uint64_t cnt) final {
+        _bytes_fetched_from_follower += cnt;
+    }
 
 private:
     void setup_public_metrics(const model::ntp&);
@@ -78,6 +86,7 @@ private:
     uint64_t _records_fetched{0};
     uint64_t _bytes_produced{0};
     uint64_t _bytes_fetched{0};
+    uint64_t _bytes_fetched_from_follower{0};
     ss::metrics::metric_groups _metrics;
     ss::metrics::metric_groups _public_metrics;
 };
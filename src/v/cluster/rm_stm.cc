@@ -1383,6 +1383,12 @@ model::offset rm_stm::last_stable_offset() {
     }
 
     auto last_visible_index = _c->last_visible_index();
+    if (_is_tx_enabled && !_c->is_leader()) {
+        // a follower learns about transactions from the batches it applied,
+        // nothing past them may be reported as decided to consumers reading
+        // from it
+        last_visible_index = std::min(last_visible_index, _insync_offset);
+    }
     if (first_tx_start <= last_visible_index) {
         return first_tx_start;
     }
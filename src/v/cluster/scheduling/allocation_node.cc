@@ -11,6 +11,8 @@
 
 #include "cluster/scheduling/allocation_node.h"
 
+#include <algorithm>
+
 namespace cluster {
 allocation_node::allocation_node(
   model::node_id id,
@@ -81,6 +83,12 @@ void allocation_node::allocate(ss::shard_id core) {
     _allocated_partitions++;
 }
 
+void allocation_node::reset_allocations() {
+    std::fill(_weights.begin(), _weights.end(), 0);
+    _weights[0] = _shard0_reserved;
+    _allocated_partitions = allocation_capacity{0};
+}
+
 const absl::node_hash_map<ss::sstring, ss::sstring>&
 allocation_node::machine_labels() const {
     return _machine_labels;
@@ -96,6 +96,8 @@ private:
 
     void deallocate(ss::shard_id core);
     void allocate(ss::shard_id core);
+    // drop all allocations, keeping the shard 0 reservation
+    void reset_allocations();
     const absl::node_hash_map<ss::sstring, ss::sstring>& machine_labels() const;
 
     model::node_id _id;
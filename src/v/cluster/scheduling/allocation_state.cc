@@ -79,6 +79,13 @@ void allocation_state::apply_update(
     }
 }
 
+void allocation_state::reset_allocations(raft::group_id highest_group) {
+    for (auto& [id, node] : _nodes) {
+        node->reset_allocations();
+    }
+    _highest_group = highest_group;
+}
+
 void allocation_state::register_node(allocation_state::node_ptr n) {
     const auto id = n->_id;
     _nodes.emplace(id, std::move(n));
@@ -44,6 +44,7 @@ public:
     // Operations on state
     void deallocate(const model::broker_shard&);
     void apply_update(std::vector<model::broker_shard>, raft::group_id);
+    void reset_allocations(raft::group_id highest_group);
     result<uint32_t> allocate(model::node_id id);
 
     void rollback(const std::vector<partition_assignment>& pa);
@@ -67,6 +67,13 @@ public:
     void update_allocation_state(
       const std::vector<model::broker_shard>&, raft::group_id);
 
+    /// drops all the allocations, the state is then rebuilt with
+    /// update_allocation_state when a controller snapshot is applied.
+    /// Group ids up to the given one are considered used.
+    void reset_allocation_state(raft::group_id highest_group) {
+        _state->reset_allocations(highest_group);
+    }
+
     void add_allocations(const std::vector<model::broker_shard>&);
     void remove_allocations(const std::vector<model::broker_shard>&);
 
@@ -11,8 +11,10 @@
 #include "cluster/security_manager.h"
 
 #include "cluster/commands.h"
+#include "cluster/controller_snapshot.h"
 #include "model/metadata.h"
 #include "raft/types.h"
+#include "serde/serde.h"
 
 #include <seastar/core/coroutine.hh>
 
@@ -51,6 +53,36 @@ security_manager::apply_update(model::record_batch batch) {
     });
 }
 
+ss::future<iobuf> security_manager::take_snapshot(model::offset) {
+    controller_snapshot_parts::security_part snapshot;
+    for (const auto& [name, credential] : _credentials.local()) {
+        controller_snapshot_parts::user user;
+        user.name = name;
+        user.credential = std::get<security::scram_credential>(credential);
+        snapshot.users.push_back(std::move(user));
+    }
+    snapshot.acls = _authorizer.local().acls(
+      security::acl_binding_filter::any());
+    co_return serde::to_iobuf(std::move(snapshot));
+}
+
+ss::future<> security_manager::apply_snapshot(model::offset, iobuf&& buf) {
+    auto snapshot = serde::from_iobuf<controller_snapshot_parts::security_part>(
+      std::move(buf));
+    co_await _credentials.invoke_on_all(
+      [&snapshot](security::credential_store& store) {
+          store.clear();
+          for (const auto& user : snapshot.users) {
+              store.put(security::credential_user(user.name), user.credential);
+          }
+      });
+    co_await _authorizer.invoke_on_all(
+      [&snapshot](security::authorizer& authorizer) {
+          authorizer.remove_bindings({security::acl_binding_filter::any()});
+          authorizer.add_bindings(snapshot.acls);
+      });
+}
+
 /*
  * handle: delete acls command
  */
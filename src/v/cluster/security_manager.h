@@ -41,6 +41,10 @@ public:
                     == model::record_batch_type::acl_management_cmd;
     }
 
+    // controller snapshot
+    ss::future<iobuf> take_snapshot(model::offset);
+    ss::future<> apply_snapshot(model::offset, iobuf&&);
+
 private:
     template<typename Cmd, typename T>
     ss::future<std::error_code> dispatch_updates_to_cores(Cmd, ss::sharded<T>&);
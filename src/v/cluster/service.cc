@@ -469,6 +469,18 @@ void clear_partition_sizes(node_health_report& report) {
 
 ss::future<get_node_health_reply>
 service::do_collect_node_health_report(get_node_health_request req) {
+    // only serde capable collectors set the base version, they decode
+    // revisions and sizes
+    if (req.base_version && req.filter == node_report_filter{}) {
+        auto res = co_await _hm_frontend.local().collect_node_health_changes(
+          *req.base_version);
+        if (res.has_error()) {
+            co_return get_node_health_reply{
+              .error = map_health_monitor_error_code(res.error())};
+        }
+        co_return std::move(res.value());
+    }
+
     auto res = co_await _hm_frontend.local().collect_node_health(
       std::move(req.filter));
     if (res.has_error()) {
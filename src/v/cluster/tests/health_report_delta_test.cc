@@ -0,0 +1,149 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#define BOOST_TEST_MODULE cluster
+#include "cluster/health_report_delta.h"
+#include "model/fundamental.h"
+#include "model/metadata.h"
+#include "model/namespace.h"
+#include "random/generators.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+cluster::partition_status make_status(int id) {
+    return cluster::partition_status{
+      .id = model::partition_id(id),
+      .term = model::term_id(1),
+      .leader_id = model::node_id(0),
+      .revision_id = model::revision_id(10),
+      .size_bytes = 1024,
+    };
+}
+
+std::vector<cluster::topic_status> make_topics(int topics, int partitions) {
+    std::vector<cluster::topic_status> ret;
+    for (int t = 0; t < topics; ++t) {
+        cluster::topic_status ts{
+          .tp_ns = model::topic_namespace(
+            model::kafka_namespace, model::topic(fmt::format("topic-{}", t)))};
+        for (int p = 0; p < partitions; ++p) {
+            ts.partitions.push_back(make_status(p));
+        }
+        ret.push_back(std::move(ts));
+    }
+    return ret;
+}
+
+// order of topics and partitions is not part of the report
+void normalize(std::vector<cluster::topic_status>& topics) {
+    for (auto& t : topics) {
+        std::sort(
+          t.partitions.begin(),
+          t.partitions.end(),
+          [](const auto& l, const auto& r) { return l.id < r.id; });
+    }
+    std::sort(topics.begin(), topics.end(), [](const auto& l, const auto& r) {
+        return l.tp_ns.tp < r.tp_ns.tp;
+    });
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_first_report_is_sent_in_full) {
+    cluster::partition_status_baseline baseline;
+    auto topics = make_topics(3, 10);
+    auto encoded = baseline.update(
+      topics, cluster::invalid_health_report_version);
+
+    BOOST_REQUIRE(!encoded.delta.has_value());
+    BOOST_REQUIRE_EQUAL(topics.size(), 3);
+    BOOST_REQUIRE_EQUAL(encoded.version, baseline.version());
+
+    // collector holding a report of another version gets a full report
+    auto next = make_topics(3, 10);
+    encoded = baseline.update(
+      next, cluster::health_report_version(encoded.version() - 1));
+    BOOST_REQUIRE(!encoded.delta.has_value());
+    BOOST_REQUIRE_EQUAL(next.size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(test_unchanged_report_has_empty_delta) {
+    cluster::partition_status_baseline baseline;
+    auto topics = make_topics(3, 10);
+    auto first = baseline.update(
+      topics, cluster::invalid_health_report_version);
+
+    auto next = make_topics(3, 10);
+    auto encoded = baseline.update(next, first.version);
+    BOOST_REQUIRE(encoded.delta.has_value());
+    BOOST_REQUIRE(next.empty());
+    BOOST_REQUIRE(encoded.delta->updated.empty());
+    BOOST_REQUIRE(encoded.delta->removed.empty());
+    BOOST_REQUIRE_EQUAL(encoded.delta->base_version, first.version);
+}
+
+BOOST_AUTO_TEST_CASE(test_merged_report_matches_node_report) {
+    cluster::partition_status_baseline baseline;
+    auto node_topics = make_topics(20, 50);
+    auto sent = node_topics;
+    auto encoded = baseline.update(
+      sent, cluster::invalid_health_report_version);
+
+    // collector state
+    auto collected = std::move(sent);
+    cluster::node_report_index index(collected, encoded.version);
+
+    for (int round = 0; round < 50; ++round) {
+        // mutate node statuses: change, remove and add partitions
+        for (auto& t : node_topics) {
+            for (auto& p : t.partitions) {
+                if (random_generators::get_int(10) == 0) {
+                    p.size_bytes += random_generators::get_int(1, 1000);
+                }
+                if (random_generators::get_int(50) == 0) {
+                    p.leader_id = std::nullopt;
+                    p.term = model::term_id(p.term() + 1);
+                }
+            }
+            std::erase_if(t.partitions, [](const auto&) {
+                return random_generators::get_int(100) == 0;
+            });
+        }
+        std::erase_if(node_topics, [](const auto& t) {
+            return t.partitions.empty() || random_generators::get_int(30) == 0;
+        });
+        if (random_generators::get_int(3) == 0) {
+            cluster::topic_status ts{
+              .tp_ns = model::topic_namespace(
+                model::kafka_namespace,
+                model::topic(fmt::format("new-topic-{}", round)))};
+            ts.partitions.push_back(make_status(0));
+            ts.partitions.push_back(make_status(1));
+            node_topics.push_back(std::move(ts));
+        }
+
+        sent = node_topics;
+        encoded = baseline.update(sent, index.version());
+        BOOST_REQUIRE(encoded.delta.has_value());
+        BOOST_REQUIRE(sent.empty());
+        index.merge(collected, std::move(*encoded.delta), encoded.version);
+        BOOST_REQUIRE_EQUAL(index.version(), encoded.version);
+
+        auto expected = node_topics;
+        auto merged = collected;
+        normalize(expected);
+        normalize(merged);
+        BOOST_REQUIRE(merged == expected);
+    }
+}
@@ -0,0 +1,117 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "cluster/health_monitor_types.h"
+#include "cluster/health_report_delta.h"
+#include "model/metadata.h"
+#include "model/namespace.h"
+#include "serde/serde.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+#include <vector>
+
+namespace {
+
+constexpr int partitions_per_topic = 100;
+// share of partitions whose status changes between two reports
+constexpr int changed_per_mille = 10;
+
+cluster::node_health_report make_report(int partitions) {
+    cluster::node_health_report report{.id = model::node_id(1)};
+    for (int t = 0; t < partitions / partitions_per_topic; ++t) {
+        cluster::topic_status ts{
+          .tp_ns = model::topic_namespace(
+            model::kafka_namespace, model::topic(fmt::format("topic-{}", t)))};
+        ts.partitions.reserve(partitions_per_topic);
+        for (int p = 0; p < partitions_per_topic; ++p) {
+            ts.partitions.push_back(cluster::partition_status{
+              .id = model::partition_id(p),
+              .term = model::term_id(1),
+              .leader_id = model::node_id(p % 3),
+              .revision_id = model::revision_id(t),
+              .size_bytes = 1024,
+            });
+        }
+        report.topics.push_back(std::move(ts));
+    }
+    return report;
+}
+
+void change_sizes(cluster::node_health_report& report) {
+    int i = 0;
+    for (auto& t : report.topics) {
+        for (auto& p : t.partitions) {
+            if (i++ % 1000 < changed_per_mille) {
+                p.size_bytes += 4096;
+            }
+        }
+    }
+}
+
+/// Cost of the collector receiving a full report: decoding it
+void full_report_merge(int partitions) {
+    auto report = make_report(partitions);
+    auto buf = serde::to_iobuf(std::move(report));
+
+    perf_tests::start_measuring_time();
+    auto decoded = serde::from_iobuf<cluster::node_health_report>(
+      std::move(buf));
+    perf_tests::do_not_optimize(decoded);
+    perf_tests::stop_measuring_time();
+}
+
+/// Cost of the collector receiving the changes: decoding and merging them
+void delta_report_merge(int partitions) {
+    auto node = make_report(partitions);
+    cluster::partition_status_baseline baseline;
+    auto collected = node.topics;
+    auto first = baseline.update(
+      collected, cluster::invalid_health_report_version);
+    cluster::node_report_index index(collected, first.version);
+
+    change_sizes(node);
+    auto encoded = baseline.update(node.topics, first.version);
+    auto buf = serde::to_iobuf(std::move(*encoded.delta));
+
+    perf_tests::start_measuring_time();
+    auto delta = serde::from_iobuf<cluster::node_health_report_delta>(
+      std::move(buf));
+    index.merge(collected, std::move(delta), encoded.version);
+    perf_tests::do_not_optimize(collected);
+    perf_tests::stop_measuring_time();
+}
+
+/// Cost of the reporting node computing the changes
+void delta_report_encode(int partitions) {
+    auto node = make_report(partitions);
+    cluster::partition_status_baseline baseline;
+    auto sent = node.topics;
+    auto first = baseline.update(sent, cluster::invalid_health_report_version);
+    change_sizes(node);
+
+    perf_tests::start_measuring_time();
+    auto encoded = baseline.update(node.topics, first.version);
+    perf_tests::do_not_optimize(encoded);
+    perf_tests::stop_measuring_time();
+}
+
+} // namespace
+
+PERF_TEST(health_report, full_merge_1k) { full_report_merge(1'000); }
+PERF_TEST(health_report, full_merge_10k) { full_report_merge(10'000); }
+PERF_TEST(health_report, full_merge_50k) { full_report_merge(50'000); }
+
+PERF_TEST(health_report, delta_merge_1k) { delta_report_merge(1'000); }
+PERF_TEST(health_report, delta_merge_10k) { delta_report_merge(10'000); }
+PERF_TEST(health_report, delta_merge_50k) { delta_report_merge(50'000); }
+
+PERF_TEST(health_report, delta_encode_1k) { delta_report_encode(1'000); }
+PERF_TEST(health_report, delta_encode_10k) { delta_report_encode(10'000); }
+PERF_TEST(health_report, delta_encode_50k) { delta_report_encode(50'000); }
@@ -0,0 +1,79 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "model/namespace.h"
+#include "redpanda/tests/fixture.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/smp.hh>
+#include <seastar/testing/perf_tests.hh>
+
+#include <fmt/core.h>
+
+#include <chrono>
+
+/*
+ * Time it takes a single node to create all the partitions of a new topic,
+ * from the topic creation request until every partition is created and
+ * present in the shard table. The creation rate is printed when a test
+ * finishes.
+ */
+
+namespace {
+
+template<int partitions>
+struct partition_creation_fixture : redpanda_thread_fixture {
+    partition_creation_fixture() { wait_for_controller_leadership().get(); }
+
+    partition_creation_fixture(const partition_creation_fixture&) = delete;
+    partition_creation_fixture& operator=(const partition_creation_fixture&)
+      = delete;
+    partition_creation_fixture(partition_creation_fixture&&) = delete;
+    partition_creation_fixture& operator=(partition_creation_fixture&&)
+      = delete;
+
+    ~partition_creation_fixture() {
+        if (topics == 0) {
+            return;
+        }
+        const auto per_core = double(topics * partitions) / elapsed.count()
+                              / ss::smp::count;
+        fmt::print(
+          "{} partitions per topic: {:.0f} partitions/s per core\n",
+          partitions,
+          per_core);
+    }
+
+    ss::future<size_t> run() {
+        model::topic_namespace tp_ns(
+          model::kafka_namespace,
+          model::topic(fmt::format("topic-{}", topics++)));
+
+        const auto started = std::chrono::steady_clock::now();
+        perf_tests::start_measuring_time();
+        co_await add_topic(tp_ns, partitions);
+        perf_tests::stop_measuring_time();
+        elapsed += std::chrono::steady_clock::now() - started;
+
+        co_return partitions;
+    }
+
+    size_t topics{0};
+    std::chrono::duration<double> elapsed{0};
+};
+
+using create_100_partitions = partition_creation_fixture<100>;
+using create_1000_partitions = partition_creation_fixture<1'000>;
+using create_5000_partitions = partition_creation_fixture<5'000>;
+
+} // namespace
+
+PERF_TEST_F(create_100_partitions, create_topic) { return run(); }
+PERF_TEST_F(create_1000_partitions, create_topic) { return run(); }
+PERF_TEST_F(create_5000_partitions, create_topic) { return run(); }
@@ -1758,6 +1758,17 @@ SEASTAR_THREAD_TEST_CASE(serde_reflection_roundtrip) {
         };
         roundtrip_test(data);
     }
+    {
+        // base version is not adl encoded
+        cluster::get_node_health_request data{
+          .filter = {
+            .ntp_filters = random_partitions_filter(),
+          },
+          .base_version
+          = tests::random_named_int<cluster::health_report_version>(),
+        };
+        serde_roundtrip_test(data);
+    }
     {
         storage::disk data{
           .path = random_generators::gen_alphanum_string(
@@ -1835,6 +1846,30 @@ SEASTAR_THREAD_TEST_CASE(serde_reflection_roundtrip) {
         data.error = cluster::errc::error_collecting_health_report;
         serde_roundtrip_test(data);
     }
+    {
+        cluster::node_health_report_delta delta{
+          .base_version
+          = tests::random_named_int<cluster::health_report_version>(),
+        };
+        for (auto i = 0, mi = random_generators::get_int(20); i < mi; ++i) {
+            delta.updated.push_back(random_topic_status());
+        }
+        for (auto i = 0, mi = random_generators::get_int(20); i < mi; ++i) {
+            delta.removed.push_back(model::random_ntp());
+        }
+        serde_roundtrip_test(delta);
+
+        // delta encoded reports are serde only
+        cluster::get_node_health_reply data{
+          .report = cluster::node_health_report{
+            .id = tests::random_named_int<model::node_id>(),
+            .local_state = random_local_state(),
+          },
+          .version = tests::random_named_int<cluster::health_report_version>(),
+          .delta = delta,
+        };
+        serde_roundtrip_test(data);
+    }
     {
         std::vector<model::node_id> nodes;
         for (auto i = 0, mi = random_generators::get_int(20); i < mi; ++i) {
@@ -0,0 +1,133 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "cluster/tm_stm.h"
+#include "model/record.h"
+#include "model/record_batch_reader.h"
+#include "raft/tests/mux_state_machine_fixture.h"
+#include "raft/types.h"
+#include "reflection/adl.h"
+#include "storage/record_batch_builder.h"
+#include "vassert.h"
+
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/testing/perf_tests.hh>
+#include <seastar/util/defer.hh>
+
+#include <fmt/core.h>
+
+#include <chrono>
+#include <vector>
+
+/*
+ * Time it takes the transaction coordinator to recover its state after a
+ * failover, when its log holds 1M updates of a fixed set of live
+ * transactional ids: once by replaying the whole log and once starting from
+ * a snapshot.
+ */
+
+namespace {
+
+using namespace std::chrono_literals;
+
+ss::logger bench_logger{"tm_stm-bench"};
+
+constexpr size_t history_updates = 1'000'000;
+constexpr size_t live_tx_ids = 1'000;
+constexpr size_t batches_per_replicate = 1'000;
+
+// same format as the coordinator uses
+model::record_batch make_update(size_t i) {
+    cluster::tm_transaction tx;
+    tx.id = kafka::transactional_id(fmt::format("tx-{}", i % live_tx_ids));
+    tx.pid = model::producer_identity{int64_t(i % live_tx_ids), 0};
+    tx.tx_seq = model::tx_seq(int64_t(i / live_tx_ids));
+    tx.etag = model::term_id(1);
+    tx.status = cluster::tm_transaction::tx_status::ready;
+    tx.timeout_ms = 60s;
+    tx.last_update_ts = ss::lowres_system_clock::now();
+
+    iobuf key;
+    reflection::serialize(key, model::record_batch_type::tm_update);
+    reflection::serialize(key, tx.pid.id, tx.id);
+
+    iobuf value;
+    reflection::serialize(value, cluster::tm_transaction::version);
+    reflection::serialize(value, std::move(tx));
+
+    storage::record_batch_builder b(
+      model::record_batch_type::tm_update, model::offset(0));
+    b.add_raw_kv(std::move(key), std::move(value));
+    return std::move(b).build();
+}
+
+struct tm_stm_recovery_fixture : mux_state_machine_fixture {
+    tm_stm_recovery_fixture() {
+        start_raft();
+        wait_for_confirmed_leader();
+        wait_for_meta_initialized();
+
+        for (size_t i = 0; i < history_updates; i += batches_per_replicate) {
+            ss::circular_buffer<model::record_batch> batches;
+            for (size_t j = i; j < i + batches_per_replicate; ++j) {
+                batches.push_back(make_update(j));
+            }
+            auto r = _raft
+                       ->replicate(
+                         model::make_memory_record_batch_reader(
+                           std::move(batches)),
+                         raft::replicate_options(
+                           raft::consistency_level::quorum_ack))
+                       .get0();
+            vassert(r.has_value(), "failed to replicate: {}", r.error());
+        }
+    }
+
+    /// Starts a new coordinator and waits until it catches up with the log
+    void recover() {
+        cluster::tm_stm stm(bench_logger, _raft.get());
+        perf_tests::start_measuring_time();
+        stm.start().get();
+        auto stop = ss::defer([&stm] { stm.stop().get(); });
+        auto caught_up
+          = stm.wait_no_throw(_raft->committed_offset(), 10min).get0();
+        perf_tests::stop_measuring_time();
+        vassert(caught_up, "coordinator didn't recover");
+        vassert(
+          stm.get_id_by_pid(model::producer_identity{0, 0}).has_value(),
+          "coordinator lost a transactional id");
+    }
+
+    /// Drops the snapshot so that the whole log is replayed
+    void remove_snapshot() {
+        cluster::tm_stm stm(bench_logger, _raft.get());
+        stm.remove_persistent_state().get();
+    }
+
+    /// Leaves a snapshot of the whole log behind
+    void make_snapshot() {
+        cluster::tm_stm stm(bench_logger, _raft.get());
+        stm.start().get();
+        auto stop = ss::defer([&stm] { stm.stop().get(); });
+        stm.wait_no_throw(_raft->committed_offset(), 10min).get();
+        stm.make_snapshot().get();
+    }
+};
+
+} // namespace
+
+PERF_TEST_F(tm_stm_recovery_fixture, replay_1m) {
+    remove_snapshot();
+    recover();
+}
+
+PERF_TEST_F(tm_stm_recovery_fixture, snapshot_1m) {
+    make_snapshot();
+    recover();
+}
@@ -12,18 +12,22 @@
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "model/record.h"
+#include "model/record_batch_reader.h"
 #include "model/timestamp.h"
 #include "raft/consensus_utils.h"
 #include "raft/tests/mux_state_machine_fixture.h"
 #include "raft/tests/raft_group_fixture.h"
 #include "raft/types.h"
 #include "random/generators.h"
+#include "reflection/adl.h"
 #include "storage/record_batch_builder.h"
 #include "storage/tests/utils/disk_log_builder.h"
 #include "test_utils/async.h"
 
+#include <seastar/core/seastar.hh>
 #include <seastar/util/defer.hh>
 
+#include <filesystem>
 #include <system_error>
 
 static ss::logger tm_logger{"tm_stm-test"};
@@ -185,3 +189,150 @@ FIXTURE_TEST(test_tm_stm_re_tx, mux_state_machine_fixture) {
     BOOST_REQUIRE_EQUAL(tx7.status, tx_status::ready);
     BOOST_REQUIRE_EQUAL(tx7.partitions.size(), 0);
 }
+
+FIXTURE_TEST(test_tm_stm_recovers_from_snapshot, mux_state_machine_fixture) {
+    start_raft();
+    auto c = _raft.get();
+
+    std::vector<kafka::transactional_id> tx_ids;
+    for (int i = 0; i < 10; ++i) {
+        tx_ids.emplace_back(fmt::format("app-id-{}", i));
+    }
+    auto pid = [](int i) { return model::producer_identity{i, 0}; };
+
+    {
+        cluster::tm_stm stm(tm_logger, c);
+        stm.start().get0();
+        auto stop = ss::defer([&stm] { stm.stop().get0(); });
+
+        wait_for_confirmed_leader();
+        wait_for_meta_initialized();
+
+        for (int i = 0; i < 9; ++i) {
+            auto op_code = stm
+                             .register_new_producer(
+                               c->term(),
+                               tx_ids[i],
+                               std::chrono::milliseconds(0),
+                               pid(i))
+                             .get0();
+            BOOST_REQUIRE_EQUAL(op_code, op_status::success);
+        }
+        stm.make_snapshot().get();
+
+        // updates following the snapshot are replayed from the log
+        auto op_code = stm
+                         .register_new_producer(
+                           c->term(),
+                           tx_ids[9],
+                           std::chrono::milliseconds(0),
+                           pid(9))
+                         .get0();
+        BOOST_REQUIRE_EQUAL(op_code, op_status::success);
+        expect_tx(stm.mark_tx_ongoing(tx_ids[0]));
+        expect_tx(stm.mark_tx_preparing(c->term(), tx_ids[0]).get());
+    }
+
+    cluster::tm_stm stm(tm_logger, c);
+    stm.start().get0();
+    auto stop = ss::defer([&stm] { stm.stop().get0(); });
+    BOOST_REQUIRE(
+      stm.wait_no_throw(c->committed_offset(), std::chrono::seconds(10))
+        .get0());
+
+    for (int i = 0; i < 10; ++i) {
+        auto tx = expect_tx(stm.get_tx(tx_ids[i]));
+        BOOST_REQUIRE_EQUAL(tx.pid, pid(i));
+        BOOST_REQUIRE_EQUAL(
+          tx.status, i == 0 ? tx_status::preparing : tx_status::ready);
+        BOOST_REQUIRE(stm.get_id_by_pid(pid(i)) == tx_ids[i]);
+    }
+}
+
+static model::record_batch make_tm_update(tm_transaction tx) {
+    iobuf key;
+    reflection::serialize(key, model::record_batch_type::tm_update);
+    reflection::serialize(key, tx.pid.id, tx.id);
+
+    iobuf value;
+    reflection::serialize(value, tm_transaction::version);
+    reflection::serialize(value, std::move(tx));
+
+    storage::record_batch_builder b(
+      model::record_batch_type::tm_update, model::offset(0));
+    b.add_raw_kv(std::move(key), std::move(value));
+    return std::move(b).build();
+}
+
+static tm_transaction make_ready_tx(ss::sstring id, int64_t pid) {
+    tm_transaction tx;
+    tx.id = kafka::transactional_id(std::move(id));
+    tx.pid = model::producer_identity{pid, 0};
+    tx.tx_seq = model::tx_seq(0);
+    tx.etag = model::term_id(1);
+    tx.status = tx_status::ready;
+    tx.timeout_ms = std::chrono::milliseconds(60000);
+    tx.last_update_ts = cluster::tm_stm::clock_type::now();
+    return tx;
+}
+
+FIXTURE_TEST(test_tm_stm_snapshots_after_updates, mux_state_machine_fixture) {
+    start_raft();
+    auto c = _raft.get();
+    const auto snapshot_path = std::filesystem::path(
+                                 c->log_config().work_directory())
+                               / "tx.coordinator.snapshot";
+
+    {
+        cluster::tm_stm stm(tm_logger, c);
+        stm.start().get0();
+        auto stop = ss::defer([&stm] { stm.stop().get0(); });
+
+        wait_for_confirmed_leader();
+        wait_for_meta_initialized();
+
+        // the update crossing the threshold is a new transactional id, it
+        // is only recovered if the snapshot it triggers includes it
+        const auto updates = cluster::tm_stm::snapshot_min_updates;
+        ss::circular_buffer<model::record_batch> batches;
+        for (size_t i = 0; i < updates; ++i) {
+            auto id = int64_t(i % 100);
+            auto tx = i + 1 == updates
+                        ? make_ready_tx("last", 1000)
+                        : make_ready_tx(fmt::format("app-id-{}", id), id);
+            batches.push_back(make_tm_update(std::move(tx)));
+        }
+        auto r = c->replicate(
+                    model::make_memory_record_batch_reader(
+                      std::move(batches)),
+                    raft::replicate_options(
+                      raft::consistency_level::quorum_ack))
+                   .get0();
+        BOOST_REQUIRE(r.has_value());
+        BOOST_REQUIRE(
+          stm.wait_no_throw(r.value().last_offset, std::chrono::seconds(10))
+            .get0());
+
+        tests::cooperative_spin_wait_with_timeout(
+          std::chrono::seconds(10),
+          [&snapshot_path] { return ss::file_exists(snapshot_path.string()); })
+          .get();
+    }
+
+    // everything is recovered from the snapshot, the log has no update
+    // past its offset
+    cluster::tm_stm stm(tm_logger, c);
+    stm.start().get0();
+    auto stop = ss::defer([&stm] { stm.stop().get0(); });
+    BOOST_REQUIRE(
+      stm.wait_no_throw(c->committed_offset(), std::chrono::seconds(10))
+        .get0());
+
+    auto last = expect_tx(stm.get_tx(kafka::transactional_id("last")));
+    BOOST_REQUIRE_EQUAL(last.pid, model::producer_identity(1000, 0));
+    for (int i = 0; i < 100; ++i) {
+        auto tx = expect_tx(
+          stm.get_tx(kafka::transactional_id(fmt::format("app-id-{}", i))));
+        BOOST_REQUIRE_EQUAL(tx.pid, model::producer_identity(i, 0));
+    }
+}
@@ -7,12 +7,15 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "cluster/controller_snapshot.h"
 #include "cluster/tests/topic_table_fixture.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "raft/types.h"
+#include "serde/serde.h"
 
 #include <seastar/testing/thread_test_case.hh>
+#include <seastar/util/defer.hh>
 
 #include <absl/container/flat_hash_map.h>
 
@@ -397,3 +400,45 @@ FIXTURE_TEST(test_tracking_broker_revisions, topic_table_fixture) {
         {n_4, model::revision_id(13)},
         {n_3, model::revision_id(11)}});
 }
+
+FIXTURE_TEST(test_snapshot_round_trip, topic_table_fixture) {
+    using cluster::controller_snapshot_parts::topics_part;
+    create_topics();
+    // discard create delta
+    table.local().wait_for_changes(as).get0();
+
+    auto snapshot = serde::from_iobuf<topics_part>(
+      serde::to_iobuf(table.local().make_snapshot()));
+    BOOST_REQUIRE_EQUAL(snapshot.topics.size(), 3);
+
+    // an empty table loading the snapshot publishes all the partitions
+    ss::sharded<cluster::topic_table> restored;
+    restored.start().get0();
+    auto stop = ss::defer([&restored] { restored.stop().get0(); });
+    restored.local().apply_snapshot(model::offset(10), snapshot);
+
+    auto d = restored.local().wait_for_changes(as).get0();
+    validate_delta(d, 21, 0);
+    auto md = restored.local().all_topics_metadata();
+    BOOST_REQUIRE_EQUAL(md.size(), 3);
+    BOOST_REQUIRE_EQUAL(
+      md.find(make_tp_ns("test_tp_2"))->second.get_assignments().size(), 12);
+    auto cfg = restored.local().get_topic_cfg(make_tp_ns("test_tp_1"));
+    BOOST_REQUIRE(cfg.has_value());
+    BOOST_REQUIRE_EQUAL(
+      cfg->properties.compression, model::compression::lz4);
+
+    // applying the same snapshot again is a no-op
+    restored.local().apply_snapshot(model::offset(10), snapshot);
+    BOOST_REQUIRE(!restored.local().has_pending_changes());
+
+    // topics missing from the snapshot are deleted
+    std::erase_if(snapshot.topics, [this](const auto& t) {
+        return t.configuration.tp_ns == make_tp_ns("test_tp_2");
+    });
+    table.local().apply_snapshot(model::offset(20), snapshot);
+    d = table.local().wait_for_changes(as).get0();
+    validate_delta(d, 0, 12);
+    BOOST_REQUIRE(
+      !table.local().all_topics_metadata().contains(make_tp_ns("test_tp_2")));
+}
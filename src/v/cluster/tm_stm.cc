@@ -19,6 +19,7 @@
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/future.hh>
 
+#include <algorithm>
 #include <filesystem>
 #include <optional>
 
@@ -382,12 +383,14 @@ tm_stm::apply_snapshot(stm_snapshot_header hdr, iobuf&& tm_ss_buf) {
 
     _mem_txes.clear();
     _log_txes.clear();
+    _pid_tx_id.clear();
     for (auto& entry : data.transactions) {
         _log_txes[entry.id] = entry;
         _pid_tx_id[entry.pid] = entry.id;
     }
     _last_snapshot_offset = data.offset;
     _insync_offset = data.offset;
+    _updates_since_snapshot = 0;
 
     return ss::now();
 }
@@ -395,9 +398,12 @@ tm_stm::apply_snapshot(stm_snapshot_header hdr, iobuf&& tm_ss_buf) {
 ss::future<stm_snapshot> tm_stm::take_snapshot() {
     tm_snapshot tm_ss;
     tm_ss.offset = _insync_offset;
+    tm_ss.transactions.reserve(_log_txes.size());
     for (auto& entry : _log_txes) {
         tm_ss.transactions.push_back(entry.second);
     }
+    _updates_since_snapshot = 0;
+    _snapshot_requested = false;
 
     iobuf tm_ss_buf;
     reflection::adl<tm_snapshot>{}.to(tm_ss_buf, tm_ss);
@@ -466,26 +472,43 @@ ss::future<> tm_stm::apply(model::record_batch b) {
         _mem_txes.erase(tx.id);
         _tx_locks.erase(tx.id);
         _pid_tx_id.erase(tx.pid);
-        return ss::now();
-    }
-
-    auto it = _mem_txes.find(tx.id);
-    if (it != _mem_txes.end()) {
-        if (it->second.etag < tx.etag) {
-            _mem_txes.erase(tx.id);
-        } else if (it->second.etag == tx.etag) {
-            if (it->second.tx_seq <= tx.tx_seq) {
+    } else {
+        auto it = _mem_txes.find(tx.id);
+        if (it != _mem_txes.end()) {
+            if (it->second.etag < tx.etag) {
                 _mem_txes.erase(tx.id);
+            } else if (it->second.etag == tx.etag) {
+                if (it->second.tx_seq <= tx.tx_seq) {
+                    _mem_txes.erase(tx.id);
+                }
             }
         }
+
+        _log_txes[tx.id] = tx;
+        _pid_tx_id[tx.pid] = tx.id;
     }
 
-    _log_txes[tx.id] = tx;
-    _pid_tx_id[tx.pid] = tx.id;
+    // the snapshot may be taken right away, it has to include this update
+    // as it covers the offsets up to _insync_offset
+    ++_updates_since_snapshot;
+    maybe_make_snapshot();
 
     return ss::now();
 }
 
+void tm_stm::maybe_make_snapshot() {
+    if (
+      _snapshot_requested
+      || _updates_since_snapshot
+           < std::max(snapshot_min_updates, _log_txes.size())) {
+        return;
+    }
+    // the snapshot may wait for the op lock, there is nothing to gain from
+    // requesting another one in the meantime
+    _snapshot_requested = true;
+    make_snapshot_in_background();
+}
+
 bool tm_stm::is_expired(const tm_transaction& tx) {
     auto now_ts = clock_type::now();
     return _transactional_id_expiration < now_ts - tx.last_update_ts;
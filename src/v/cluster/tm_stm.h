@@ -130,6 +130,15 @@ class tm_stm final : public persisted_stm {
 public:
     using clock_type = ss::lowres_system_clock;
     static constexpr const int8_t supported_version = 0;
+    /*
+     * The coordinator snapshots its state once it applied as many updates
+     * as there are live transactional ids, but not more often than every
+     * `snapshot_min_updates` updates. Taking a snapshot costs as much as
+     * replaying the updates it replaces, so recovering the state costs at
+     * most twice the number of live transactional ids, however long the
+     * history.
+     */
+    static constexpr size_t snapshot_min_updates = 10'000;
 
     enum op_status {
         success,
@@ -228,6 +237,7 @@ protected:
 private:
     ss::future<> apply_snapshot(stm_snapshot_header, iobuf&&) override;
     ss::future<stm_snapshot> take_snapshot() override;
+    void maybe_make_snapshot();
 
     ss::basic_rwlock<> _state_lock;
     std::chrono::milliseconds _sync_timeout;
@@ -239,6 +249,9 @@ private:
       _pid_tx_id;
     absl::flat_hash_map<kafka::transactional_id, ss::lw_shared_ptr<mutex>>
       _tx_locks;
+    // number of updates applied since the state of the last snapshot
+    size_t _updates_since_snapshot{0};
+    bool _snapshot_requested{false};
     ss::future<> apply(model::record_batch b) override;
 
     ss::future<checked<tm_transaction, tm_stm::op_status>>
@@ -11,6 +11,7 @@
 
 #include "cluster/cluster_utils.h"
 #include "cluster/commands.h"
+#include "cluster/controller_snapshot.h"
 #include "cluster/errc.h"
 #include "cluster/fwd.h"
 #include "cluster/logger.h"
@@ -72,6 +73,7 @@ topic_table::apply(create_topic_cmd cmd, model::offset offset) {
           md.replica_revisions[pas.id]);
     }
 
+    bump_version(md);
     _topics.insert({
       cmd.key,
       std::move(md),
@@ -157,6 +159,7 @@ topic_table::apply(create_partition_cmd cmd, model::offset offset) {
           std::nullopt,
           tp->second.replica_revisions[p_as.id]);
     }
+    bump_version(tp->second);
 
     notify_waiters();
     co_return errc::success;
@@ -201,6 +204,7 @@ topic_table::apply(move_partition_replicas_cmd cmd, model::offset o) {
       cmd.key,
       in_progress_update{
         .previous_replicas = current_assignment_it->replicas,
+        .target_replicas = cmd.value,
         .state = in_progress_state::update_requested,
         .update_revision = model::revision_id(o),
         // snapshot replicas revisions
@@ -209,6 +213,7 @@ topic_table::apply(move_partition_replicas_cmd cmd, model::offset o) {
     auto previous_assignment = *current_assignment_it;
     // replace partition replica set
     current_assignment_it->replicas = cmd.value;
+    bump_version(tp->second);
     /**
      * Update partition replica revisions. Assign new revision to added replicas
      * and erase replicas which are removed from replica set
@@ -261,6 +266,7 @@ topic_table::apply(move_partition_replicas_cmd cmd, model::offset o) {
             /// The new assignments of the non_replicable topic/partition must
             /// match the source topic
             assignment_it->replicas = cmd.value;
+            bump_version(sfound->second);
         }
     }
 
@@ -310,6 +316,7 @@ topic_table::apply(finish_moving_partition_replicas_cmd cmd, model::offset o) {
     }
 
     _updates_in_progress.erase(it);
+    bump_version(tp->second);
 
     partition_assignment delta_assignment{
       current_assignment_it->group,
@@ -395,10 +402,12 @@ topic_table::apply(cancel_moving_partition_replicas_cmd cmd, model::offset o) {
     in_progress_it->second.state = cmd.value.force
                                      ? in_progress_state::force_cancel_requested
                                      : in_progress_state::cancel_requested;
+    in_progress_it->second.cancel_revision = model::revision_id(o);
 
     auto replicas = current_assignment_it->replicas;
     // replace replica set with set from in progress operation
     current_assignment_it->replicas = in_progress_it->second.previous_replicas;
+    bump_version(tp->second);
     auto revisions_it = tp->second.replica_revisions.find(cmd.key.tp.partition);
     vassert(
       revisions_it != tp->second.replica_revisions.end(),
@@ -437,6 +446,7 @@ topic_table::apply(cancel_moving_partition_replicas_cmd cmd, model::offset o) {
             /// The new assignments of the non_replicable topic/partition must
             /// match the source topic
             assignment_it->replicas = in_progress_it->second.previous_replicas;
+            bump_version(sfound->second);
         }
     }
     /**
@@ -553,6 +563,7 @@ topic_table::apply(update_topic_properties_cmd cmd, model::offset o) {
     incremental_update(properties.timestamp_type, overrides.timestamp_type);
 
     incremental_update(properties.shadow_indexing, overrides.shadow_indexing);
+    bump_version(tp->second);
 
     // generate deltas for controller backend
     std::vector<topic_table_delta> deltas;
@@ -613,11 +624,9 @@ topic_table::apply(create_non_replicable_topic_cmd cmd, model::offset o) {
     auto md = topic_metadata(
       std::move(cfg), std::move(p_as), model::revision_id(o()), source.tp);
 
-    _topics.insert(
-      {new_non_rep_topic,
-       topic_metadata_item{
-         .metadata = std::move(md),
-       }});
+    topic_metadata_item item{.metadata = std::move(md)};
+    bump_version(item);
+    _topics.insert({new_non_rep_topic, std::move(item)});
     notify_waiters();
     co_return make_error_code(errc::success);
 }
@@ -632,21 +641,25 @@ void topic_table::notify_waiters() {
       _pending_deltas.end(),
       std::back_inserter(changes),
       [this](const delta& d) { return d.offset > _last_consumed_by_notifier; });
-    for (auto& cb : _notifications) {
-        cb.second(changes);
-    }
     if (!changes.empty()) {
         _last_consumed_by_notifier = changes.back().offset;
     }
+    notify(changes);
+}
+
+void topic_table::notify(const std::vector<delta>& changes) {
+    for (auto& cb : _notifications) {
+        cb.second(changes);
+    }
 
     /// Consume all pending deltas
     if (!_waiters.empty()) {
-        changes.clear();
-        changes.swap(_pending_deltas);
+        std::vector<delta> pending;
+        pending.swap(_pending_deltas);
         std::vector<std::unique_ptr<waiter>> active_waiters;
         active_waiters.swap(_waiters);
         for (auto& w : active_waiters) {
-            w->promise.set_value(changes);
+            w->promise.set_value(pending);
         }
     }
 }
@@ -860,6 +873,372 @@ std::vector<model::ntp> topic_table::all_updates_in_progress() const {
     return ret;
 }
 
+controller_snapshot_parts::topics_part topic_table::make_snapshot() const {
+    controller_snapshot_parts::topics_part snap;
+    snap.topics.reserve(_topics.size());
+    for (const auto& [tp_ns, md] : _topics) {
+        controller_snapshot_parts::topic topic;
+        topic.configuration = md.get_configuration();
+        topic.revision = md.get_revision();
+        topic.remote_revision = md.get_remote_revision();
+        if (!md.is_topic_replicable()) {
+            topic.source_topic = md.get_source_topic();
+        }
+        topic.partitions.reserve(md.get_assignments().size());
+        for (const auto& p_as : md.get_assignments()) {
+            controller_snapshot_parts::partition partition;
+            partition.assignment = p_as;
+            if (auto it = md.replica_revisions.find(p_as.id);
+                it != md.replica_revisions.end()) {
+                partition.replicas_revisions = it->second;
+            }
+            // updates of non replicable topics mirror the ones of their
+            // source topic, they are rebuilt from it
+            auto u_it = _updates_in_progress.find(
+              model::ntp(tp_ns.ns, tp_ns.tp, p_as.id));
+            if (
+              md.is_topic_replicable() && u_it != _updates_in_progress.end()) {
+                controller_snapshot_parts::partition_update update;
+                update.previous_replicas = u_it->second.previous_replicas;
+                update.target_replicas = u_it->second.target_replicas;
+                update.state = u_it->second.state;
+                update.update_revision = u_it->second.update_revision;
+                update.cancel_revision = u_it->second.cancel_revision;
+                update.replicas_revisions = u_it->second.replicas_revisions;
+                partition.update = std::move(update);
+            }
+            topic.partitions.push_back(std::move(partition));
+        }
+        snap.topics.push_back(std::move(topic));
+    }
+    return snap;
+}
+
+namespace {
+
+/// Revisions of the replicas of the target replica set of an update, as they
+/// were set when the update was requested
+topic_table::replicas_revision_map
+target_revisions(const controller_snapshot_parts::partition_update& update) {
+    auto revisions = update.replicas_revisions;
+    for (const auto& r : subtract_replica_sets_by_node_id(
+           update.target_replicas, update.previous_replicas)) {
+        revisions[r.node_id] = update.update_revision;
+    }
+    for (const auto& r : subtract_replica_sets_by_node_id(
+           update.previous_replicas, update.target_replicas)) {
+        revisions.erase(r.node_id);
+    }
+    return revisions;
+}
+
+/// Delta type of a cancelled update
+topic_table_delta::op_type cancel_type(topic_table::in_progress_state state) {
+    return state == topic_table::in_progress_state::force_cancel_requested
+             ? topic_table_delta::op_type::force_abort_update
+             : topic_table_delta::op_type::cancel_update;
+}
+
+} // namespace
+
+void topic_table::add_partition_from_snapshot(
+  const model::ntp& ntp,
+  model::offset created,
+  const controller_snapshot_parts::partition& p) {
+    const auto& p_as = p.assignment;
+    if (!p.update) {
+        _pending_deltas.emplace_back(
+          ntp,
+          p_as,
+          created,
+          delta::op_type::add,
+          std::nullopt,
+          p.replicas_revisions);
+        return;
+    }
+    /**
+     * Replay the partition history from the replica set it is being moved
+     * from, for the backend to reconcile it the same way it would have if
+     * it had seen the commands.
+     */
+    const auto& update = *p.update;
+    _pending_deltas.emplace_back(
+      ntp,
+      partition_assignment{p_as.group, p_as.id, update.previous_replicas},
+      created,
+      delta::op_type::add,
+      std::nullopt,
+      update.replicas_revisions);
+    _pending_deltas.emplace_back(
+      ntp,
+      partition_assignment{p_as.group, p_as.id, update.target_replicas},
+      model::offset(update.update_revision()),
+      delta::op_type::update,
+      update.previous_replicas,
+      target_revisions(update));
+    if (update.state != in_progress_state::update_requested) {
+        _pending_deltas.emplace_back(
+          ntp,
+          p_as,
+          model::offset(update.cancel_revision()),
+          cancel_type(update.state),
+          update.target_replicas,
+          p.replicas_revisions);
+    }
+}
+
+void topic_table::add_topic_from_snapshot(
+  const controller_snapshot_parts::topic& topic) {
+    const auto& tp_ns = topic.configuration.tp_ns;
+    const model::offset created(topic.revision());
+    for (const auto& p : topic.partitions) {
+        model::ntp ntp(tp_ns.ns, tp_ns.tp, p.assignment.id);
+        if (topic.source_topic) {
+            _pending_deltas.emplace_back(
+              std::move(ntp),
+              p.assignment,
+              created,
+              delta::op_type::add_non_replicable);
+        } else {
+            add_partition_from_snapshot(ntp, created, p);
+        }
+    }
+}
+
+void topic_table::update_partition_from_snapshot(
+  model::offset offset,
+  const model::ntp& ntp,
+  const partition_assignment& current,
+  const in_progress_update* current_update,
+  const controller_snapshot_parts::partition& p) {
+    const auto& p_as = p.assignment;
+    const auto& update = p.update;
+    const bool same_update = current_update && update
+                             && current_update->update_revision
+                                  == update->update_revision;
+    /**
+     * Updates which started and finished since the table was last updated
+     * are not known anymore, they are finished right before the update of
+     * the snapshot, or at the snapshot offset if there is none.
+     */
+    const auto finished_at = update
+                               ? model::offset(update->update_revision() - 1)
+                               : offset;
+    if (!same_update) {
+        if (current_update) {
+            _pending_deltas.emplace_back(
+              ntp, current, finished_at, delta::op_type::update_finished);
+        }
+        const auto& base = update ? update->previous_replicas
+                                  : p_as.replicas;
+        if (!are_replica_sets_equal(current.replicas, base)) {
+            partition_assignment base_as{p_as.group, p_as.id, base};
+            _pending_deltas.emplace_back(
+              ntp,
+              base_as,
+              finished_at,
+              delta::op_type::update,
+              current.replicas,
+              update ? update->replicas_revisions : p.replicas_revisions);
+            _pending_deltas.emplace_back(
+              ntp,
+              std::move(base_as),
+              finished_at,
+              delta::op_type::update_finished);
+        }
+        if (update) {
+            _pending_deltas.emplace_back(
+              ntp,
+              partition_assignment{
+                p_as.group, p_as.id, update->target_replicas},
+              model::offset(update->update_revision()),
+              delta::op_type::update,
+              update->previous_replicas,
+              target_revisions(*update));
+        }
+    }
+
+    if (
+      update && update->state != in_progress_state::update_requested
+      && (!same_update || current_update->state != update->state)) {
+        _pending_deltas.emplace_back(
+          ntp,
+          p_as,
+          model::offset(update->cancel_revision()),
+          cancel_type(update->state),
+          update->target_replicas,
+          p.replicas_revisions);
+    }
+}
+
+void topic_table::apply_snapshot(
+  model::offset offset, const controller_snapshot_parts::topics_part& snap) {
+    const auto first_delta = _pending_deltas.size();
+    absl::flat_hash_map<
+      model::topic_namespace,
+      const controller_snapshot_parts::topic*,
+      model::topic_namespace_hash,
+      model::topic_namespace_eq>
+      snap_topics;
+    snap_topics.reserve(snap.topics.size());
+    for (const auto& topic : snap.topics) {
+        snap_topics.emplace(topic.configuration.tp_ns, &topic);
+    }
+
+    /**
+     * Compute the deltas from the current content of the table. Topics which
+     * do not exist anymore, or which were deleted and created again, are
+     * deleted.
+     */
+    for (const auto& [tp_ns, md] : _topics) {
+        auto it = snap_topics.find(tp_ns);
+        if (
+          it != snap_topics.end()
+          && it->second->revision == md.get_revision()) {
+            continue;
+        }
+        const auto type = md.is_topic_replicable()
+                            ? delta::op_type::del
+                            : delta::op_type::del_non_replicable;
+        for (const auto& p_as : md.get_assignments()) {
+            _pending_deltas.emplace_back(
+              model::ntp(tp_ns.ns, tp_ns.tp, p_as.id), p_as, offset, type);
+        }
+    }
+
+    for (const auto& topic : snap.topics) {
+        const auto& tp_ns = topic.configuration.tp_ns;
+        auto it = _topics.find(tp_ns);
+        if (
+          it == _topics.end() || it->second.get_revision() != topic.revision) {
+            add_topic_from_snapshot(topic);
+            continue;
+        }
+        auto& md = it->second;
+        if (!md.is_topic_replicable()) {
+            // non replicable topics can not be updated
+            continue;
+        }
+        for (const auto& p : topic.partitions) {
+            model::ntp ntp(tp_ns.ns, tp_ns.tp, p.assignment.id);
+            auto current = md.get_assignments().find(p.assignment.id);
+            if (current == md.get_assignments().end()) {
+                // partition created since the table was last updated
+                auto revisions = p.update ? p.update->replicas_revisions
+                                          : p.replicas_revisions;
+                auto created = std::min_element(
+                  revisions.begin(),
+                  revisions.end(),
+                  [](const auto& l, const auto& r) {
+                      return l.second < r.second;
+                  });
+                add_partition_from_snapshot(
+                  ntp,
+                  model::offset(
+                    created == revisions.end() ? topic.revision()
+                                               : created->second()),
+                  p);
+                continue;
+            }
+            auto u_it = _updates_in_progress.find(ntp);
+            update_partition_from_snapshot(
+              offset,
+              ntp,
+              *current,
+              u_it == _updates_in_progress.end() ? nullptr : &u_it->second,
+              p);
+        }
+        if (
+          md.get_configuration().properties
+          != topic.configuration.properties) {
+            for (const auto& p : topic.partitions) {
+                _pending_deltas.emplace_back(
+                  model::ntp(tp_ns.ns, tp_ns.tp, p.assignment.id),
+                  p.assignment,
+                  offset,
+                  delta::op_type::update_properties);
+            }
+        }
+    }
+
+    /**
+     * Replace the content of the table
+     */
+    _topics.clear();
+    _topics_hierarchy.clear();
+    _updates_in_progress.clear();
+    for (const auto& topic : snap.topics) {
+        const auto& tp_ns = topic.configuration.tp_ns;
+        std::vector<partition_assignment> assignments;
+        assignments.reserve(topic.partitions.size());
+        for (const auto& p : topic.partitions) {
+            assignments.push_back(p.assignment);
+        }
+        topic_metadata_item md{
+          .metadata = topic.source_topic
+                        ? topic_metadata(
+                          topic.configuration,
+                          assignments_set(
+                            assignments.begin(), assignments.end()),
+                          topic.revision,
+                          *topic.source_topic,
+                          topic.remote_revision)
+                        : topic_metadata(
+                          topic_configuration_assignment(
+                            topic.configuration, std::move(assignments)),
+                          topic.revision,
+                          topic.remote_revision)};
+        if (topic.source_topic) {
+            model::topic_namespace source(tp_ns.ns, *topic.source_topic);
+            _topics_hierarchy[source].emplace(tp_ns);
+        } else {
+            for (const auto& p : topic.partitions) {
+                md.replica_revisions[p.assignment.id] = p.replicas_revisions;
+                if (!p.update) {
+                    continue;
+                }
+                _updates_in_progress.emplace(
+                  model::ntp(tp_ns.ns, tp_ns.tp, p.assignment.id),
+                  in_progress_update{
+                    .previous_replicas = p.update->previous_replicas,
+                    .target_replicas = p.update->target_replicas,
+                    .state = p.update->state,
+                    .update_revision = p.update->update_revision,
+                    .cancel_revision = p.update->cancel_revision,
+                    .replicas_revisions = p.update->replicas_revisions,
+                  });
+            }
+        }
+        bump_version(md);
+        _topics.emplace(tp_ns, std::move(md));
+    }
+    // non replicable topics follow the updates of their source topic
+    std::vector<std::pair<model::ntp, in_progress_update>> children_updates;
+    for (const auto& [ntp, update] : _updates_in_progress) {
+        auto it = _topics_hierarchy.find(model::topic_namespace_view(ntp));
+        if (it == _topics_hierarchy.end()) {
+            continue;
+        }
+        for (const auto& child : it->second) {
+            children_updates.emplace_back(
+              model::ntp(child.ns, child.tp, ntp.tp.partition),
+              in_progress_update{
+                .previous_replicas = update.target_replicas,
+                .state = in_progress_state::update_requested,
+                .update_revision = update.update_revision,
+              });
+        }
+    }
+    for (auto& [ntp, update] : children_updates) {
+        _updates_in_progress.emplace(std::move(ntp), std::move(update));
+    }
+
+    std::vector<delta> changes(
+      std::next(_pending_deltas.begin(), first_delta), _pending_deltas.end());
+    _last_consumed_by_notifier = std::max(_last_consumed_by_notifier, offset);
+    notify(changes);
+}
+
 std::ostream&
 operator<<(std::ostream& o, topic_table::in_progress_state update) {
     switch (update) {
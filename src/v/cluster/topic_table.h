@@ -50,8 +50,13 @@ public:
 
     struct in_progress_update {
         std::vector<model::broker_shard> previous_replicas;
+        // replica set the partition is being moved to, kept when the move is
+        // cancelled
+        std::vector<model::broker_shard> target_replicas;
         in_progress_state state;
         model::revision_id update_revision;
+        // revision of the command which cancelled the update, if any
+        model::revision_id cancel_revision;
         replicas_revision_map replicas_revisions;
     };
 
@@ -60,6 +65,9 @@ public:
         // replicas revisions for each partition
         absl::node_hash_map<model::partition_id, replicas_revision_map>
           replica_revisions;
+        // changes whenever the topic metadata changes, versions are unique
+        // across all topics of the table
+        uint64_t version{0};
 
         bool is_topic_replicable() const {
             return metadata.is_topic_replicable();
@@ -154,6 +162,18 @@ public:
       apply(cancel_moving_partition_replicas_cmd, model::offset);
     ss::future<> stop();
 
+    /// Controller snapshot API
+
+    /// Returns the content of the table, the highest group id is left to
+    /// the caller as it is tracked by the partition allocator.
+    controller_snapshot_parts::topics_part make_snapshot() const;
+    /// Replaces the content of the table with the snapshot taken at given
+    /// offset of the controller log. Deltas bringing the partitions from
+    /// their current state to the one of the snapshot are published to the
+    /// delta API.
+    void apply_snapshot(
+      model::offset, const controller_snapshot_parts::topics_part&);
+
     /// Delta API
     /// NOTE: This API should only be consumed by a single entity, unless
     /// careful consideration is taken. This is because once notifications are
@@ -284,6 +304,23 @@ private:
     void deallocate_topic_partitions(const std::vector<partition_assignment>&);
 
     void notify_waiters();
+    void notify(const std::vector<delta>&);
+
+    // snapshot helpers, publishing the deltas which bring a partition or a
+    // topic from its current state to the snapshot one
+    void add_topic_from_snapshot(const controller_snapshot_parts::topic&);
+    void add_partition_from_snapshot(
+      const model::ntp&,
+      model::offset,
+      const controller_snapshot_parts::partition&);
+    void update_partition_from_snapshot(
+      model::offset,
+      const model::ntp&,
+      const partition_assignment& current,
+      const in_progress_update* current_update,
+      const controller_snapshot_parts::partition&);
+
+    void bump_version(topic_metadata_item& item) { item.version = ++_version; }
 
     template<typename Func>
     std::vector<std::invoke_result_t<Func, const topic_metadata_item&>>
@@ -300,6 +337,7 @@ private:
     std::vector<std::pair<cluster::notification_id_type, delta_cb_t>>
       _notifications;
     uint64_t _waiter_id{0};
+    uint64_t _version{0};
     model::offset _last_consumed_by_notifier{
       model::model_limits<model::offset>::min()};
 };
@@ -11,11 +11,15 @@
 
 #include "cluster/cluster_utils.h"
 #include "cluster/commands.h"
+#include "cluster/controller_snapshot.h"
 #include "cluster/partition_leaders_table.h"
 #include "cluster/topic_table.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
 #include "raft/types.h"
+#include "serde/serde.h"
+
+#include <seastar/core/coroutine.hh>
 
 #include <absl/container/node_hash_map.h>
 
@@ -201,6 +205,50 @@ topic_updates_dispatcher::apply_update(model::record_batch b) {
             });
       });
 }
+ss::future<iobuf> topic_updates_dispatcher::take_snapshot(model::offset) {
+    auto snapshot = _topic_table.local().make_snapshot();
+    snapshot.highest_group_id
+      = _partition_allocator.local().state().last_group_id();
+    co_return serde::to_iobuf(std::move(snapshot));
+}
+
+ss::future<>
+topic_updates_dispatcher::apply_snapshot(model::offset offset, iobuf&& buf) {
+    auto snapshot = serde::from_iobuf<controller_snapshot_parts::topics_part>(
+      std::move(buf));
+    co_await _topic_table.invoke_on_all(
+      [&snapshot, offset](topic_table& local_table) {
+          local_table.apply_snapshot(offset, snapshot);
+      });
+
+    /**
+     * Rebuild the allocation state, replicas a partition is moved from stay
+     * allocated until the move is finished
+     */
+    auto& allocator = _partition_allocator.local();
+    allocator.reset_allocation_state(snapshot.highest_group_id);
+    std::vector<ntp_leader> leaders;
+    for (const auto& topic : snapshot.topics) {
+        const auto& tp_ns = topic.configuration.tp_ns;
+        for (const auto& p : topic.partitions) {
+            const auto& p_as = p.assignment;
+            allocator.update_allocation_state(p_as.replicas, p_as.group);
+            if (p.update) {
+                allocator.add_allocations(subtract_replica_sets(
+                  p.update->previous_replicas, p_as.replicas));
+            }
+            model::ntp ntp(tp_ns.ns, tp_ns.tp, p_as.id);
+            if (
+              !p_as.replicas.empty()
+              && !_partition_leaders_table.local().get_leader(ntp)) {
+                leaders.emplace_back(
+                  std::move(ntp), p_as.replicas.begin()->node_id);
+            }
+        }
+    }
+    co_await update_leaders_with_estimates(std::move(leaders));
+}
+
 topic_updates_dispatcher::in_progress_map
 topic_updates_dispatcher::collect_in_progress(
   const model::topic_namespace& tp_ns,
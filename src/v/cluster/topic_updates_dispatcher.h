@@ -72,6 +72,10 @@ public:
                == model::record_batch_type::topic_management_cmd;
     }
 
+    // controller snapshot
+    ss::future<iobuf> take_snapshot(model::offset);
+    ss::future<> apply_snapshot(model::offset, iobuf&&);
+
 private:
     using in_progress_map = absl::
       node_hash_map<model::partition_id, std::vector<model::broker_shard>>;
@@ -86,8 +86,10 @@ ZSTD_DCtx* stream_zstd::decompressor() {
 }
 
 iobuf stream_zstd::do_compress(const iobuf& x) {
-    reset_compressor();
     ZSTD_CCtx* ctx = compressor().get();
+    // reuse the context of previous calls: resetting the session keeps the
+    // parameters and the allocated tables, creating a context does not
+    throw_if_error(ZSTD_CCtx_reset(ctx, ZSTD_reset_session_only));
     // NOTE: always enable content size. **decompression** depends on this
     throw_if_error(ZSTD_CCtx_setPledgedSrcSize(ctx, x.size_bytes()));
     // zstd requires linearized memory
@@ -200,6 +200,19 @@ configuration::configuration()
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       512_KiB,
       {.min = 128, .max = 5_MiB})
+  , raft_replicate_compression_min_bytes(
+      *this,
+      "raft_replicate_compression_min_bytes",
+      "Compress append entries requests, sent to replicate or recover "
+      "partitions, of at least this size with zstd. Trades CPU for less "
+      "replication traffic between nodes, e.g. across availability zones. "
+      "Heartbeats are compressed from this size as well. If not set, append "
+      "entries requests are not compressed and heartbeats are compressed "
+      "from 512 bytes",
+      {.needs_restart = needs_restart::no,
+       .example = "4096",
+       .visibility = visibility::tunable},
+      std::nullopt)
   , use_scheduling_groups(*this, "use_scheduling_groups")
   , enable_admin_api(*this, "enable_admin_api")
   , default_num_windows(
@@ -502,7 +515,7 @@ configuration::configuration()
       {.needs_restart = needs_restart::no,
        .example = "compact,delete",
        .visibility = visibility::user},
-      model::cleanup_policy_bitflags::deletion)
+      model::cleanup_policy_bitflags::compaction)
   , transaction_coordinator_delete_retention_ms(
       *this,
       "transaction_coordinator_delete_retention_ms",
@@ -596,6 +609,31 @@ configuration::configuration()
       "one follower",
       {.visibility = visibility::tunable},
       16)
+  , raft_adaptive_append_pipelining(
+      *this,
+      "raft_adaptive_append_pipelining",
+      "Adjust the number of concurrent append entries requests sent to a "
+      "follower, and the size of recovery requests, to the observed round "
+      "trip of the requests. "
+      "raft_max_concurrent_append_requests_per_follower is the initial number "
+      "of requests",
+      {.visibility = visibility::tunable},
+      false)
+  , raft_adaptive_append_pipeline_max_depth(
+      *this,
+      "raft_adaptive_append_pipeline_max_depth",
+      "Upper bound of concurrent append entries requests sent to one follower "
+      "when raft_adaptive_append_pipelining is enabled",
+      {.visibility = visibility::tunable},
+      64)
+  , raft_group_commit_max_delay_ms(
+      *this,
+      "raft_group_commit_max_delay_ms",
+      "Upper bound of the time a follower log flush may be delayed to be "
+      "coalesced with flushes of other raft groups on the same shard, 0 "
+      "starts a flush round as soon as the previous one completes",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0ms)
   , reclaim_min_size(
       *this,
       "reclaim_min_size",
@@ -650,6 +688,15 @@ configuration::configuration()
       "Key-value maximum segment size (bytes)",
       {.visibility = visibility::tunable},
       16_MiB)
+  , kvstore_incremental_snapshots(
+      *this,
+      "kvstore_incremental_snapshots",
+      "Snapshot only the keys changed since the previous snapshot when the "
+      "key-value store rolls its log, merging them into a full snapshot in the "
+      "background, and flush the log with group commit. Snapshots written in "
+      "this mode can't be read by versions without it.",
+      {.visibility = visibility::tunable},
+      false)
   , max_kafka_throttle_delay_ms(
       *this,
       "max_kafka_throttle_delay_ms",
@@ -693,6 +740,16 @@ configuration::configuration()
       "Free cache when segments roll",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       false)
+  , storage_idle_log_release_ms(
+      *this,
+      "storage_idle_log_release_ms",
+      "Time without reads nor writes after which a partition log releases "
+      "the memory of its active segment appender and of its caches, and its "
+      "raft leader the per follower replication pipelines. They are "
+      "recreated on the next access, a write reopens the active segment. "
+      "Disabled when not set",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      std::nullopt)
   , segment_appender_flush_timeout_ms(
       *this,
       "segment_appender_flush_timeout_ms",
@@ -727,6 +784,36 @@ configuration::configuration()
       "How many additional reads to issue ahead of current read location",
       {.example = "1", .visibility = visibility::tunable},
       10)
+  , storage_read_max_buffer_size(
+      *this,
+      "storage_read_max_buffer_size",
+      "Size up to which read buffers grow for readers scanning a log "
+      "sequentially, e.g. consumers catching up or recovering followers. "
+      "Set it to storage_read_buffer_size to disable adaptive read ahead.",
+      {.example = "1048576", .visibility = visibility::tunable},
+      1_MiB)
+  , storage_read_sequential_readahead_bytes(
+      *this,
+      "storage_read_sequential_readahead_bytes",
+      "Bytes read ahead of the consumer by a reader scanning a log "
+      "sequentially once its read buffers grew, at least one read buffer",
+      {.example = "4194304", .visibility = visibility::tunable},
+      4_MiB)
+  , storage_read_handle_linger_ms(
+      *this,
+      "storage_read_handle_linger_ms",
+      "Time segment files stay open after their last reader is done with "
+      "them, to be reused by the next read of the segment. 0 closes them "
+      "right away.",
+      {.example = "10000", .visibility = visibility::tunable},
+      10s)
+  , storage_read_max_lingering_handles(
+      *this,
+      "storage_read_max_lingering_handles",
+      "Maximum number of segment files kept open per shard after their last "
+      "reader is done with them. The least recently used are closed first.",
+      {.example = "1000", .visibility = visibility::tunable},
+      1000)
   , segment_fallocation_step(
       *this,
       "segment_fallocation_step",
@@ -756,6 +843,17 @@ configuration::configuration()
        .visibility = visibility::tunable},
       1024,
       {.min = 128})
+  , storage_max_concurrent_recovery_io(
+      *this,
+      "storage_max_concurrent_recovery_io",
+      "Maximum number of segment and index files opened or read "
+      "concurrently while recovering logs at startup, across all "
+      "partitions.",
+      {.needs_restart = needs_restart::no,
+       .example = "4096",
+       .visibility = visibility::tunable},
+      2048,
+      {.min = 16})
   , max_compacted_log_segment_size(
       *this,
       "max_compacted_log_segment_size",
@@ -809,6 +907,14 @@ configuration::configuration()
       "Interval between iterations of controller backend housekeeping loop",
       {.visibility = visibility::tunable},
       1s)
+  , controller_snapshot_max_age_sec(
+      *this,
+      "controller_snapshot_max_age_sec",
+      "Interval between snapshots of the controller state, the controller log "
+      "prefix covered by a snapshot is truncated. Snapshots are only taken "
+      "once the controller_snapshots feature is explicitly activated",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      60s)
   , node_management_operation_timeout_ms(
       *this,
       "node_management_operation_timeout_ms",
@@ -931,6 +1037,22 @@ configuration::configuration()
       "Enable remote write for all topics",
       {.visibility = visibility::tunable},
       false)
+  , cloud_storage_enable_replica_bootstrap(
+      *this,
+      "cloud_storage_enable_replica_bootstrap",
+      "Download the log of a new replica of a partition which has remote "
+      "read and write enabled from the cloud storage, so that only the tail "
+      "of the log which is not uploaded yet is recovered from the leader",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      false)
+  , cloud_storage_replica_bootstrap_timeout_ms(
+      *this,
+      "cloud_storage_replica_bootstrap_timeout_ms",
+      "Time after which the download of the log of a new replica from the "
+      "cloud storage is abandoned, the replica then recovers its log from "
+      "the leader",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      5min)
   , cloud_storage_access_key(
       *this,
       "cloud_storage_access_key",
@@ -1164,6 +1286,20 @@ configuration::configuration()
       "Update frequency for kafka queue depth control.",
       {.visibility = visibility::tunable},
       7s)
+  , kafka_latency_trace_sample_interval(
+      *this,
+      "kafka_latency_trace_sample_interval",
+      "Trace the latency breakdown of one in every N produce and fetch "
+      "requests. Zero disables tracing.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      0)
+  , kafka_latency_trace_slowest_retained(
+      *this,
+      "kafka_latency_trace_slowest_retained",
+      "Number of slowest traced requests retained per core for inspection "
+      "through the admin API.",
+      {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
+      32)
   , zstd_decompress_workspace_bytes(
       *this,
       "zstd_decompress_workspace_bytes",
@@ -1337,7 +1473,8 @@ configuration::configuration()
   , enable_rack_awareness(
       *this,
       "enable_rack_awareness",
-      "Enables rack-aware replica assignment",
+      "Enables rack-aware replica assignment, and consumers which set their "
+      "rack to fetch from a replica of their rack",
       {.needs_restart = needs_restart::no, .visibility = visibility::user},
       false) {}
 
@@ -73,6 +73,7 @@ struct configuration final : public config_store {
     deprecated_property max_version;
     bounded_property<std::optional<size_t>> raft_max_recovery_memory;
     bounded_property<size_t> raft_recovery_default_read_size;
+    property<std::optional<size_t>> raft_replicate_compression_min_bytes;
     // Kafka
     deprecated_property use_scheduling_groups;
     deprecated_property enable_admin_api;
@@ -141,6 +142,9 @@ struct configuration final : public config_store {
     property<size_t> raft_learner_recovery_rate;
     property<std::optional<uint32_t>> raft_smp_max_non_local_requests;
     property<uint32_t> raft_max_concurrent_append_requests_per_follower;
+    property<bool> raft_adaptive_append_pipelining;
+    property<uint32_t> raft_adaptive_append_pipeline_max_depth;
+    property<std::chrono::milliseconds> raft_group_commit_max_delay_ms;
 
     property<size_t> reclaim_min_size;
     property<size_t> reclaim_max_size;
@@ -151,6 +155,7 @@ struct configuration final : public config_store {
     property<bool> enable_pid_file;
     property<std::chrono::milliseconds> kvstore_flush_interval;
     property<size_t> kvstore_max_segment_size;
+    property<bool> kvstore_incremental_snapshots;
     property<std::chrono::milliseconds> max_kafka_throttle_delay_ms;
     property<size_t> kafka_max_bytes_per_fetch;
     property<std::chrono::milliseconds> raft_io_timeout_ms;
@@ -159,14 +164,21 @@ struct configuration final : public config_store {
     property<std::chrono::milliseconds>
       raft_transfer_leader_recovery_timeout_ms;
     property<bool> release_cache_on_segment_roll;
+    property<std::optional<std::chrono::milliseconds>>
+      storage_idle_log_release_ms;
     property<std::chrono::milliseconds> segment_appender_flush_timeout_ms;
     property<std::chrono::milliseconds> fetch_session_eviction_timeout_ms;
     bounded_property<size_t> append_chunk_size;
     property<size_t> storage_read_buffer_size;
     property<int16_t> storage_read_readahead_count;
+    property<size_t> storage_read_max_buffer_size;
+    property<size_t> storage_read_sequential_readahead_bytes;
+    property<std::chrono::milliseconds> storage_read_handle_linger_ms;
+    property<size_t> storage_read_max_lingering_handles;
     property<size_t> segment_fallocation_step;
     bounded_property<uint64_t> storage_target_replay_bytes;
     bounded_property<uint64_t> storage_max_concurrent_replay;
+    bounded_property<uint64_t> storage_max_concurrent_recovery_io;
     property<size_t> max_compacted_log_segment_size;
     property<int16_t> id_allocator_log_capacity;
     property<int16_t> id_allocator_batch_size;
@@ -176,6 +188,7 @@ struct configuration final : public config_store {
       kafka_mtls_principal_mapping_rules;
     property<std::chrono::milliseconds>
       controller_backend_housekeeping_interval_ms;
+    property<std::chrono::seconds> controller_snapshot_max_age_sec;
     property<std::chrono::milliseconds> node_management_operation_timeout_ms;
     // Compaction controller
     property<std::chrono::milliseconds> compaction_ctrl_update_interval_ms;
@@ -197,6 +210,9 @@ struct configuration final : public config_store {
     property<bool> cloud_storage_enabled;
     property<bool> cloud_storage_enable_remote_read;
     property<bool> cloud_storage_enable_remote_write;
+    property<bool> cloud_storage_enable_replica_bootstrap;
+    property<std::chrono::milliseconds>
+      cloud_storage_replica_bootstrap_timeout_ms;
     property<std::optional<ss::sstring>> cloud_storage_access_key;
     property<std::optional<ss::sstring>> cloud_storage_secret_key;
     property<std::optional<ss::sstring>> cloud_storage_region;
@@ -251,6 +267,10 @@ struct configuration final : public config_store {
     property<size_t> kafka_qdc_min_depth;
     property<size_t> kafka_qdc_max_depth;
     property<std::chrono::milliseconds> kafka_qdc_depth_update_ms;
+
+    // kafka request latency tracing
+    property<size_t> kafka_latency_trace_sample_interval;
+    property<size_t> kafka_latency_trace_slowest_retained;
     property<size_t> zstd_decompress_workspace_bytes;
     one_or_many_property<ss::sstring> full_raft_configuration_recovery_pattern;
     property<bool> enable_auto_rebalance_on_node_add;
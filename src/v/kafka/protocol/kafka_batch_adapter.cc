@@ -17,6 +17,7 @@
 #include "likely.h"
 #include "model/fundamental.h"
 #include "model/record.h"
+#include "model/record_utils.h"
 #include "raft/types.h"
 #include "storage/parser_utils.h"
 #include "vassert.h"
@@ -181,12 +182,13 @@ iobuf kafka_batch_adapter::adapt(iobuf&& kbatch) {
 
     /**
      * Perform some type of validation on the uncompressed input. In this case
-     * we make sure that the records can be materialized but we avoid
-     * re-encoding them using the lazy-record optimization.
+     * we make sure that the records are well framed, without materializing
+     * them, and we avoid re-encoding them using the lazy-record optimization.
      */
     if (!new_batch.compressed()) {
         try {
-            new_batch.for_each_record([](model::record r) { (void)r; });
+            (void)model::decode_record_spans(
+              new_batch.data(), new_batch.record_count());
         } catch (const std::exception& e) {
             vlog(klog.error, "Parsing uncompressed records: {}", e.what());
             return remainder;
@@ -260,6 +260,7 @@ path_type_map = {
                 "HighWatermark": ("model::offset", "int64"),
                 "LastStableOffset": ("model::offset", "int64"),
                 "LogStartOffset": ("model::offset", "int64"),
+                "PreferredReadReplica": ("model::node_id", "int32"),
                 "Records": ("kafka::batch_reader", "fetch_record_set"),
             },
         },
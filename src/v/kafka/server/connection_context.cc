@@ -185,24 +185,34 @@ ss::future<session_resources> connection_context::throttle_request(
         fut = ss::sleep_abortable(delay.duration, _rs.abort_source());
     }
     auto track = track_latency(hdr.key);
+    auto trace = track ? _proto.tracer().maybe_trace(hdr.key) : nullptr;
     return fut
-      .then([this, key = hdr.key, request_size] {
+      .then([this, key = hdr.key, request_size, trace] {
+          mark_trace(trace, trace_stage::throttled);
           return reserve_request_units(key, request_size);
       })
-      .then([this, delay, track, tracker = std::move(tracker)](
-              ss::semaphore_units<> units) mutable {
+      .then([this,
+             delay,
+             track,
+             tracker = std::move(tracker),
+             trace = std::move(trace),
+             key = hdr.key](ss::semaphore_units<> units) mutable {
           return server().get_request_unit().then(
             [this,
              delay,
              mem_units = std::move(units),
              track,
-             tracker = std::move(tracker)](
-              ss::semaphore_units<> qd_units) mutable {
+             tracker = std::move(tracker),
+             trace = std::move(trace),
+             key](ss::semaphore_units<> qd_units) mutable {
+                mark_trace(trace, trace_stage::resources_acquired);
                 session_resources r{
                   .backpressure_delay = delay.duration,
                   .memlocks = std::move(mem_units),
                   .queue_units = std::move(qd_units),
                   .tracker = std::move(tracker),
+                  .trace = std::move(trace),
+                  .key = key,
                 };
                 if (track) {
                     r.method_latency = _rs.hist().auto_measure();
@@ -259,7 +269,11 @@ connection_context::dispatch_method_once(request_header hdr, size_t size) {
               }
               auto self = shared_from_this();
               auto rctx = request_context(
-                self, std::move(hdr), std::move(buf), sres->backpressure_delay);
+                self,
+                std::move(hdr),
+                std::move(buf),
+                sres->backpressure_delay,
+                sres->trace);
               /*
                * we process requests in order since all subsequent requests
                * are dependent on authentication having completed.
@@ -407,6 +421,8 @@ ss::future<> connection_context::maybe_process_responses() {
         _responses.erase(it);
 
         if (resp_and_res.response->is_noop()) {
+            // acks=0 produce requests have no response to write
+            finish_trace(*resp_and_res.resources);
             return ss::make_ready_future<ss::stop_iteration>(
               ss::stop_iteration::no);
         }
@@ -420,7 +436,10 @@ ss::future<> connection_context::maybe_process_responses() {
               })
               // release the resources only once it has been written to the
               // connection.
-              .finally([resources = std::move(resp_and_res.resources)] {});
+              .finally([this, resources = std::move(resp_and_res.resources)] {
+                  mark_trace(resources->trace, trace_stage::response_sent);
+                  finish_trace(*resources);
+              });
         } catch (...) {
             vlog(
               klog.debug,
@@ -432,4 +451,10 @@ ss::future<> connection_context::maybe_process_responses() {
     });
 }
 
+void connection_context::finish_trace(const session_resources& resources) {
+    if (resources.trace) {
+        _proto.tracer().finish(resources.key, *resources.trace);
+    }
+}
+
 } // namespace kafka
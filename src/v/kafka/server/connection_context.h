@@ -19,6 +19,7 @@
 #include "security/sasl_authentication.h"
 #include "utils/hdr_hist.h"
 #include "utils/named_type.h"
+#include "utils/request_trace.h"
 
 #include <seastar/core/future.hh>
 #include <seastar/core/lowres_clock.hh>
@@ -72,6 +73,9 @@ struct session_resources {
     ss::semaphore_units<> queue_units;
     std::unique_ptr<hdr_hist::measurement> method_latency;
     std::unique_ptr<request_tracker> tracker;
+    // set when the request was sampled for latency tracing
+    request_trace_ptr trace;
+    api_key key;
 };
 
 class connection_context final
@@ -195,6 +199,8 @@ private:
      * @return ss::future<> a future which as described above.
      */
     ss::future<> maybe_process_responses();
+    /// Records the latency trace of a sampled request once it completed
+    void finish_trace(const session_resources&);
     ss::future<> do_process(request_context);
 
     ss::future<> handle_auth_v0(size_t);
@@ -19,6 +19,7 @@ class coordinator_ntp_mapper;
 class fetch_session_cache;
 class group_manager;
 class group_router;
+class latency_tracer;
 class quota_manager;
 class request_context;
 class rm_group_frontend;
@@ -1598,6 +1598,7 @@ void group::complete_offset_commit(
         // clear pending for this tp
         if (p_it->second.offset == md.offset) {
             _pending_offset_commits.erase(p_it);
+            update_offsets_accounting();
         }
     }
 }
@@ -1609,6 +1610,7 @@ void group::fail_offset_commit(
         // clear pending for this tp
         if (p_it->second.offset == md.offset) {
             _pending_offset_commits.erase(p_it);
+            update_offsets_accounting();
         }
     }
 }
@@ -2099,6 +2101,7 @@ group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
             _pending_offset_commits[tp] = md;
         }
     }
+    update_offsets_accounting();
 
     auto batch = std::move(builder).build();
     auto reader = model::make_memory_record_batch_reader(std::move(batch));
@@ -2553,6 +2556,7 @@ group::remove_topic_partitions(const std::vector<model::topic_partition>& tps) {
 
     _offsets.rehash(0);
     _pending_offset_commits.rehash(0);
+    update_offsets_accounting();
 
     // build offset tombstones
     storage::record_batch_builder builder(
@@ -26,6 +26,7 @@
 #include "model/namespace.h"
 #include "model/record.h"
 #include "seastarx.h"
+#include "utils/memory_accounting.h"
 #include "utils/mutex.h"
 
 #include <seastar/core/future.hh>
@@ -537,6 +538,7 @@ public:
               std::move(tp),
               std::make_unique<offset_metadata_with_probe>(
                 std::move(md), _id, tp, _enable_group_metrics));
+            update_offsets_accounting();
         }
     }
 
@@ -552,12 +554,25 @@ public:
               std::move(tp),
               std::make_unique<offset_metadata_with_probe>(
                 std::move(md), _id, tp, _enable_group_metrics));
+            update_offsets_accounting();
             return true;
         }
     }
 
     void insert_prepared(prepared_tx);
 
+    void update_offsets_accounting() {
+        // node maps allocate a node per element on top of the slot array
+        _offsets_accounted.update(
+          _offsets.capacity() * sizeof(void*)
+          + _offsets.size()
+              * (sizeof(decltype(_offsets)::value_type)
+                 + sizeof(offset_metadata_with_probe))
+          + _pending_offset_commits.capacity() * sizeof(void*)
+          + _pending_offset_commits.size()
+              * sizeof(decltype(_pending_offset_commits)::value_type));
+    }
+
     void try_set_fence(model::producer_id id, model::producer_epoch epoch) {
         auto [fence_it, _] = _fence_pid_epoch.try_emplace(id, epoch);
         if (fence_it->second < epoch) {
@@ -804,6 +819,7 @@ private:
 
     absl::node_hash_map<model::producer_identity, volatile_tx> _volatile_txs;
     absl::node_hash_map<model::producer_identity, prepared_tx> _prepared_txs;
+    accounted_memory _offsets_accounted{memory_subsystem::group_offsets};
 };
 
 using group_ptr = ss::lw_shared_ptr<group>;
@@ -68,10 +68,15 @@ static ss::future<read_result> read_from_partition(
   kafka::partition_proxy part,
   fetch_config config,
   bool foreign_read,
+  bool follower_read,
   std::optional<model::timeout_clock::time_point> deadline) {
     auto hw = part.high_watermark();
     auto lso = part.last_stable_offset();
     auto start_o = part.start_offset();
+    if (follower_read) {
+        // a follower log may hold offsets the leader did not commit yet
+        config.max_offset = std::min(config.max_offset, model::prev_offset(hw));
+    }
     // if we have no data read, return fast
     if (
       hw < config.start_offset || config.skip_read
@@ -100,6 +105,9 @@ static ss::future<read_result> read_from_partition(
         data = std::make_unique<iobuf>(std::move(result.data));
         part.probe().add_records_fetched(result.record_count);
         part.probe().add_bytes_fetched(data->size_bytes());
+        if (follower_read) {
+            part.probe().add_bytes_fetched_from_follower(data->size_bytes());
+        }
         if (result.record_count > 0) {
             // Reader should live at least until this point to hold on to the
             // segment locks so that prefix truncation doesn't happen.
@@ -131,24 +139,19 @@ static ss::future<read_result> read_from_partition(
 }
 
 /**
- * Entry point for reading from an ntp. This is executed on NTP home core and
- * build error responses if anything goes wrong.
+ * Reads from a partition, on its home core, once it was looked up.
  */
-static ss::future<read_result> do_read_from_ntp(
-  cluster::partition_manager& cluster_pm,
-  coproc::partition_manager& coproc_pm,
+static ss::future<read_result> do_read_from_partition_proxy(
+  partition_proxy partition,
   ntp_fetch_config ntp_config,
   bool foreign_read,
   std::optional<model::timeout_clock::time_point> deadline) {
-    /*
-     * lookup the ntp's partition
+    /**
+     * consumers which know about follower fetching (KIP-392) are served by
+     * followers, up to the offsets they know are committed
      */
-    auto kafka_partition = make_partition_proxy(
-      ntp_config.ntp(), cluster_pm, coproc_pm);
-    if (unlikely(!kafka_partition)) {
-        co_return read_result(error_code::unknown_topic_or_partition);
-    }
-    if (unlikely(!kafka_partition->is_leader())) {
+    const bool follower_read = !partition.is_leader();
+    if (unlikely(follower_read && !ntp_config.cfg.consumer_rack_id)) {
         co_return read_result(error_code::not_leader_for_partition);
     }
 
@@ -156,11 +159,26 @@ static ss::future<read_result> do_read_from_ntp(
      * validate leader epoch. for more details see KIP-320
      */
     auto leader_epoch_err = details::check_leader_epoch(
-      ntp_config.cfg.current_leader_epoch, *kafka_partition);
+      ntp_config.cfg.current_leader_epoch, partition);
     if (leader_epoch_err != error_code::none) {
         co_return read_result(leader_epoch_err);
     }
-    auto offset_ec = co_await kafka_partition->validate_fetch_offset(
+
+    if (ntp_config.cfg.consumer_rack_id && !follower_read) {
+        auto replica = partition.get_preferred_read_replica(
+          *ntp_config.cfg.consumer_rack_id);
+        if (replica) {
+            // redirect the consumer without reading, it fetches from the
+            // replica of its rack from now on
+            read_result res(
+              partition.start_offset(),
+              partition.high_watermark(),
+              partition.last_stable_offset());
+            res.preferred_replica = replica;
+            co_return res;
+        }
+    }
+    auto offset_ec = co_await partition.validate_fetch_offset(
       ntp_config.cfg.start_offset,
       default_fetch_timeout + model::timeout_clock::now());
 
@@ -168,7 +186,7 @@ static ss::future<read_result> do_read_from_ntp(
         if (
           ntp_config.cfg.isolation_level
           == model::isolation_level::read_committed) {
-            ntp_config.cfg.max_offset = kafka_partition->last_stable_offset();
+            ntp_config.cfg.max_offset = partition.last_stable_offset();
             if (ntp_config.cfg.max_offset > model::offset{0}) {
                 ntp_config.cfg.max_offset = ntp_config.cfg.max_offset
                                             - model::offset{1};
@@ -176,6 +194,16 @@ static ss::future<read_result> do_read_from_ntp(
         }
     }
 
+    if (offset_ec == error_code::offset_not_available) {
+        vlog(
+          klog.debug,
+          "follower of {} behind requested offset {}, high watermark: {}",
+          ntp_config.ntp(),
+          ntp_config.cfg.start_offset,
+          partition.high_watermark());
+        co_return read_result(offset_ec);
+    }
+
     if (offset_ec != error_code::none) {
         vlog(
           klog.warn,
@@ -183,13 +211,42 @@ static ss::future<read_result> do_read_from_ntp(
           "partition start offset: {}, high watermark: {}, ec: {}",
           ntp_config.ntp(),
           ntp_config.cfg.start_offset,
-          kafka_partition->start_offset(),
-          kafka_partition->high_watermark(),
+          partition.start_offset(),
+          partition.high_watermark(),
           offset_ec);
         co_return read_result(offset_ec);
     }
     co_return co_await read_from_partition(
-      std::move(*kafka_partition), ntp_config.cfg, foreign_read, deadline);
+      std::move(partition),
+      ntp_config.cfg,
+      foreign_read,
+      follower_read,
+      deadline);
+}
+
+/**
+ * Entry point for reading from an ntp. This is executed on NTP home core and
+ * build error responses if anything goes wrong.
+ */
+static ss::future<read_result> do_read_from_ntp(
+  cluster::partition_manager& cluster_pm,
+  coproc::partition_manager& coproc_pm,
+  ntp_fetch_config ntp_config,
+  bool foreign_read,
+  std::optional<model::timeout_clock::time_point> deadline) {
+    /*
+     * lookup the ntp's partition
+     */
+    auto kafka_partition = make_partition_proxy(
+      ntp_config.ntp(), cluster_pm, coproc_pm);
+    if (unlikely(!kafka_partition)) {
+        co_return read_result(error_code::unknown_topic_or_partition);
+    }
+    co_return co_await do_read_from_partition_proxy(
+      std::move(*kafka_partition),
+      std::move(ntp_config),
+      foreign_read,
+      deadline);
 }
 
 static ntp_fetch_config
@@ -212,6 +269,16 @@ ss::future<read_result> read_from_ntp(
       deadline);
 }
 
+ss::future<read_result> read_from_partition_proxy(
+  partition_proxy partition,
+  fetch_config config,
+  bool foreign_read,
+  std::optional<model::timeout_clock::time_point> deadline) {
+    auto ntp_config = make_ntp_fetch_config(partition.ntp(), config);
+    return do_read_from_partition_proxy(
+      std::move(partition), std::move(ntp_config), foreign_read, deadline);
+}
+
 static void fill_fetch_responses(
   op_context& octx,
   std::vector<read_result> results,
@@ -251,6 +318,10 @@ static void fill_fetch_responses(
         resp.log_start_offset = res.start_offset;
         resp.high_watermark = res.high_watermark;
         resp.last_stable_offset = res.last_stable_offset;
+        if (res.preferred_replica) {
+            resp.preferred_read_replica = *res.preferred_replica;
+            octx.has_preferred_replica = true;
+        }
 
         /**
          * According to KIP-74 we have to return first batch even if it would
@@ -482,6 +553,7 @@ class simple_fetch_planner final : public fetch_planner::impl {
                 .strict_max_bytes = octx.response_size > 0,
                 .skip_read = bytes_left_in_plan == 0 && max_bytes == 0,
                 .current_leader_epoch = fp.current_leader_epoch,
+                .consumer_rack_id = octx.consumer_rack_id,
               };
 
               plan.fetches_per_shard[*shard].push_back(
@@ -527,6 +599,7 @@ static ss::future<> fetch_topic_partitions(op_context& octx) {
     fetch_plan_executor executor
       = make_fetch_plan_executor<parallel_fetch_plan_executor>();
     co_await executor.execute_plan(octx, std::move(fetch_plan));
+    mark_trace(octx.rctx.trace(), trace_stage::partition_read);
 
     if (octx.should_stop_fetch()) {
         co_return;
@@ -592,6 +665,13 @@ op_context::op_context(request_context&& ctx, ss::smp_service_group ssg)
     bytes_left = std::min(
       config::shard_local_cfg().fetch_max_bytes(),
       size_t(request.data.max_bytes));
+    // the rack is only sent by consumers (fetch v11+) knowing how to follow a
+    // preferred read replica
+    if (
+      config::shard_local_cfg().enable_rack_awareness()
+      && !request.data.rack_id.empty()) {
+        consumer_rack_id = model::rack_id(request.data.rack_id);
+    }
     session_ctx = rctx.fetch_sessions().maybe_get_session(request);
     create_response_placeholders();
 }
@@ -659,6 +739,10 @@ bool update_fetch_partition(
         // Partitions with new data are always included in the response.
         include = true;
     }
+    if (resp.preferred_read_replica >= model::node_id{0}) {
+        // The consumer has to learn about the replica to fetch from.
+        include = true;
+    }
     if (partition.high_watermark != resp.high_watermark) {
         include = true;
         partition.high_watermark = model::offset(resp.high_watermark);
@@ -713,6 +797,8 @@ ss::future<response_ptr> op_context::send_response() && {
           .last_stable_offset = it->partition_response->last_stable_offset,
           .log_start_offset = it->partition_response->log_start_offset,
           .aborted = std::move(it->partition_response->aborted),
+          .preferred_read_replica
+          = it->partition_response->preferred_read_replica,
           .records = std::move(it->partition_response->records)};
 
         final_response.data.topics.back().partitions.push_back(std::move(r));
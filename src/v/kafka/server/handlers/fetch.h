@@ -12,8 +12,10 @@
 #include "cluster/rm_stm.h"
 #include "kafka/protocol/fetch.h"
 #include "kafka/server/handlers/handler.h"
+#include "kafka/server/partition_proxy.h"
 #include "kafka/types.h"
 #include "utils/intrusive_list_helpers.h"
+#include "utils/to_string.h"
 
 namespace kafka {
 
@@ -97,6 +99,7 @@ struct op_context {
     bool should_stop_fetch() const {
         return !request.debounce_delay() || over_min_bytes()
                || is_empty_request() || response_error
+               || has_preferred_replica
                || deadline <= model::timeout_clock::now();
     }
 
@@ -154,8 +157,12 @@ struct op_context {
     size_t response_size;
     // does the response contain an error
     bool response_error;
+    // does the response redirect the consumer to another replica
+    bool has_preferred_replica{false};
 
     bool initial_fetch = true;
+    // set if the consumer may fetch from followers
+    std::optional<model::rack_id> consumer_rack_id;
     fetch_session_ctx session_ctx;
     iteration_order_t iteration_order;
 };
@@ -169,17 +176,20 @@ struct fetch_config {
     bool strict_max_bytes{false};
     bool skip_read{false};
     kafka::leader_epoch current_leader_epoch;
+    // rack of a consumer which may fetch from followers (KIP-392)
+    std::optional<model::rack_id> consumer_rack_id;
 
     friend std::ostream& operator<<(std::ostream& o, const fetch_config& cfg) {
         fmt::print(
           o,
-          R"({{"start_offset": {}, "max_offset": {}, "isolation_lvl": {}, "max_bytes": {}, "strict_max_bytes": {}, "current_leader_epoch:" {}}})",
+          R"({{"start_offset": {}, "max_offset": {}, "isolation_lvl": {}, "max_bytes": {}, "strict_max_bytes": {}, "current_leader_epoch:" {}, "consumer_rack_id": {}}})",
           cfg.start_offset,
           cfg.max_offset,
           cfg.isolation_level,
           cfg.max_bytes,
           cfg.strict_max_bytes,
-          cfg.current_leader_epoch);
+          cfg.current_leader_epoch,
+          cfg.consumer_rack_id);
         return o;
     }
 };
@@ -271,6 +281,8 @@ struct read_result {
     error_code error;
     model::partition_id partition;
     std::vector<cluster::rm_stm::tx_range> aborted_transactions;
+    // replica the consumer should fetch from instead of the leader
+    std::optional<model::node_id> preferred_replica;
 };
 // struct aggregating fetch requests and corresponding response iterators for
 // the same shard
@@ -339,4 +351,11 @@ ss::future<read_result> read_from_ntp(
   bool,
   std::optional<model::timeout_clock::time_point>);
 
+/// Reads from a partition already looked up, on its home core
+ss::future<read_result> read_from_partition_proxy(
+  partition_proxy,
+  fetch_config,
+  bool,
+  std::optional<model::timeout_clock::time_point>);
+
 } // namespace kafka
@@ -20,6 +20,7 @@
 #include "kafka/server/handlers/details/leader_epoch.h"
 #include "kafka/server/handlers/details/security.h"
 #include "kafka/server/handlers/topics/topic_utils.h"
+#include "kafka/server/metadata_response_cache.h"
 #include "kafka/server/response.h"
 #include "kafka/types.h"
 #include "likely.h"
@@ -35,6 +36,8 @@
 #include <boost/numeric/conversion/cast.hpp>
 #include <fmt/ostream.h>
 
+#include <algorithm>
+
 namespace kafka {
 
 static constexpr model::node_id no_leader(-1);
@@ -209,6 +212,61 @@ static metadata_response::topic make_topic_response(
     return res;
 }
 
+/**
+ * Encodes the topics section of a response to a request for all topics,
+ * reusing topic blocks encoded for previous requests whose topic metadata and
+ * partition leaders did not change since.
+ */
+static std::pair<iobuf, size_t> get_encoded_topic_metadata(
+  request_context& ctx, const metadata_request& request) {
+    vassert(
+      request.list_all_topics
+        && !request.data.include_topic_authorized_operations,
+      "Only responses to all topics requests without authorized operations "
+      "are encoded from the cache");
+    auto& cache = ctx.get_metadata_response_cache();
+    const auto& md_cache = ctx.metadata_cache();
+    const auto& topics_md = md_cache.all_topics_metadata();
+    const auto version = ctx.header().version;
+
+    iobuf topics;
+    size_t count = 0;
+    for (const auto& [tp_ns, md] : topics_md) {
+        // same filtering as get_topic_metadata
+        if (tp_ns.ns != model::kafka_namespace) {
+            continue;
+        }
+        if (!ctx.authorized(
+              security::acl_operation::describe,
+              tp_ns.tp,
+              authz_quiet{true})) {
+            continue;
+        }
+        metadata_response_cache::versions versions{
+          .topic = md.version,
+          .leaders = md_cache.get_leaders_topic_version(tp_ns),
+        };
+        cache.append_topic(
+          tp_ns, versions, version, topics, [&md_cache, &tp_ns, &md] {
+              auto topic = make_topic_response_from_topic_metadata(
+                md_cache, cluster::topic_metadata(md.metadata));
+              topic.topic_authorized_operations = 0;
+              // leaders of leaderless partitions may be picked at random
+              const bool cacheable = std::all_of(
+                topic.partitions.begin(),
+                topic.partitions.end(),
+                [&md_cache, &tp_ns](const metadata_response::partition& p) {
+                    return md_cache.get_leader_id(tp_ns, p.partition_index)
+                      .has_value();
+                });
+              return metadata_response_cache::built_topic{
+                .topic = std::move(topic), .cacheable = cacheable};
+          });
+        ++count;
+    }
+    return {std::move(topics), count};
+}
+
 static ss::future<std::vector<metadata_response::topic>>
 get_topic_metadata(request_context& ctx, metadata_request& request) {
     std::vector<metadata_response::topic> res;
@@ -412,7 +470,16 @@ ss::future<response_ptr> metadata_handler::handle(
     metadata_request request;
     request.decode(ctx.reader(), ctx.header().version);
 
-    reply.data.topics = co_await get_topic_metadata(ctx, request);
+    // requests for all topics are served from encoded topic blocks
+    const bool encoded_topics = request.list_all_topics
+                                && !request.data
+                                      .include_topic_authorized_operations;
+    std::pair<iobuf, size_t> topics;
+    if (encoded_topics) {
+        topics = get_encoded_topic_metadata(ctx, request);
+    } else {
+        reply.data.topics = co_await get_topic_metadata(ctx, request);
+    }
 
     if (
       request.data.include_cluster_authorized_operations
@@ -422,6 +489,14 @@ ss::future<response_ptr> metadata_handler::handle(
           details::authorized_operations(ctx, security::default_cluster_name));
     }
 
+    if (encoded_topics) {
+        co_return co_await ctx.respond_encoded<metadata_response>(
+          encode_metadata_response(
+            reply,
+            ctx.header().version,
+            std::move(topics.first),
+            topics.second));
+    }
     co_return co_await ctx.respond(std::move(reply));
 }
 
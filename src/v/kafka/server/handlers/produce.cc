@@ -42,6 +42,7 @@
 #include <chrono>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string_view>
 
 namespace kafka {
@@ -180,9 +181,11 @@ static partition_produce_stages partition_append(
   model::record_batch_reader reader,
   int16_t acks,
   int32_t num_records,
-  int64_t num_bytes) {
-    auto stages = partition->replicate(
-      bid, std::move(reader), acks_to_replicate_options(acks));
+  int64_t num_bytes,
+  request_trace_ptr trace) {
+    auto opts = acks_to_replicate_options(acks);
+    opts.trace = std::move(trace);
+    auto stages = partition->replicate(bid, std::move(reader), opts);
     return partition_produce_stages{
       .dispatched = std::move(stages.request_enqueued),
       .produced = stages.replicate_finished.then_wrapped(
@@ -226,6 +229,83 @@ ss::future<produce_response::partition> finalize_request_with_error_code(
         .partition_index = ntp.tp.partition, .error_code = ec});
 }
 
+struct traced_partition {
+    produce_response::partition partition;
+    // copy of the trace of the partition shard
+    std::optional<request_trace> trace;
+};
+
+/**
+ * \brief appends to a partition on its home shard, `trace` is owned by the
+ * home shard.
+ */
+static ss::future<produce_response::partition> produce_on_partition_shard(
+  cluster::partition_manager& mgr,
+  model::ntp ntp,
+  std::unique_ptr<ss::promise<>> dispatch,
+  model::record_batch_reader reader,
+  model::batch_identity bid,
+  int16_t acks,
+  int32_t num_records,
+  int64_t batch_size,
+  ss::shard_id source_shard,
+  request_trace_ptr trace) {
+    auto partition = mgr.get(ntp);
+    if (!partition) {
+        return finalize_request_with_error_code(
+          error_code::unknown_topic_or_partition,
+          std::move(dispatch),
+          ntp,
+          source_shard);
+    }
+    if (unlikely(!partition->is_leader())) {
+        return finalize_request_with_error_code(
+          error_code::not_leader_for_partition,
+          std::move(dispatch),
+          ntp,
+          source_shard);
+    }
+    if (partition->is_read_replica_mode_enabled()) {
+        return finalize_request_with_error_code(
+          error_code::invalid_topic_exception,
+          std::move(dispatch),
+          ntp,
+          source_shard);
+    }
+    auto stages = partition_append(
+      ntp.tp.partition,
+      ss::make_lw_shared<replicated_partition>(std::move(partition)),
+      bid,
+      std::move(reader),
+      acks,
+      num_records,
+      batch_size,
+      std::move(trace));
+    return stages.dispatched
+      .then_wrapped([source_shard, dispatch = std::move(dispatch)](
+                      ss::future<> f) mutable {
+          if (f.failed()) {
+              (void)ss::smp::submit_to(
+                source_shard,
+                [dispatch = std::move(dispatch),
+                 e = f.get_exception()]() mutable {
+                    dispatch->set_exception(e);
+                    dispatch.reset();
+                });
+              return;
+          }
+          (void)ss::smp::submit_to(
+            source_shard,
+            [dispatch = std::move(dispatch)]() mutable {
+                dispatch->set_value();
+                dispatch.reset();
+            });
+      })
+      .then([f = std::move(stages.produced)]() mutable {
+          return std::move(f);
+      });
+}
+
 /**
  * \brief handle writing to a single topic partition.
  */
@@ -289,72 +369,44 @@ static partition_produce_stages produce_topic_partition(
              batch_size,
              bid,
              acks = octx.request.data.acks,
-             source_shard = ss::this_shard_id()](
+             source_shard = ss::this_shard_id(),
+             traced = bool(octx.rctx.trace())](
               cluster::partition_manager& mgr) mutable {
-                auto partition = mgr.get(ntp);
-                if (!partition) {
-                    return finalize_request_with_error_code(
-                      error_code::unknown_topic_or_partition,
-                      std::move(dispatch),
-                      ntp,
-                      source_shard);
-                }
-                if (unlikely(!partition->is_leader())) {
-                    return finalize_request_with_error_code(
-                      error_code::not_leader_for_partition,
-                      std::move(dispatch),
-                      ntp,
-                      source_shard);
-                }
-                if (partition->is_read_replica_mode_enabled()) {
-                    return finalize_request_with_error_code(
-                      error_code::invalid_topic_exception,
-                      std::move(dispatch),
-                      ntp,
-                      source_shard);
-                }
-                auto stages = partition_append(
-                  ntp.tp.partition,
-                  ss::make_lw_shared<replicated_partition>(
-                    std::move(partition)),
-                  bid,
-                  std::move(reader),
-                  acks,
-                  num_records,
-                  batch_size);
-                return stages.dispatched
-                  .then_wrapped([source_shard, dispatch = std::move(dispatch)](
-                                  ss::future<> f) mutable {
-                      if (f.failed()) {
-                          (void)ss::smp::submit_to(
-                            source_shard,
-                            [dispatch = std::move(dispatch),
-                             e = f.get_exception()]() mutable {
-                                dispatch->set_exception(e);
-                                dispatch.reset();
-                            });
-                          return;
-                      }
-                      (void)ss::smp::submit_to(
-                        source_shard,
-                        [dispatch = std::move(dispatch)]() mutable {
-                            dispatch->set_value();
-                            dispatch.reset();
-                        });
-                  })
-                  .then([f = std::move(stages.produced)]() mutable {
-                      return std::move(f);
+                // the request trace stays on the source shard, the stages
+                // reached here are stamped on a copy merged back into it
+                auto trace = traced ? ss::make_lw_shared<request_trace>(
+                               trace_stage::partition_shard)
+                                    : nullptr;
+                return produce_on_partition_shard(
+                         mgr,
+                         std::move(ntp),
+                         std::move(dispatch),
+                         std::move(reader),
+                         bid,
+                         acks,
+                         num_records,
+                         batch_size,
+                         source_shard,
+                         trace)
+                  .then([trace](produce_response::partition p) {
+                      return traced_partition{
+                        .partition = std::move(p),
+                        .trace = trace ? std::make_optional(*trace)
+                                       : std::nullopt};
                   });
             })
-          .then([&octx, start, m = std::move(m)](
-                  produce_response::partition p) {
+          .then([&octx, start, m = std::move(m)](traced_partition r) {
+              if (r.trace && octx.rctx.trace()) {
+                  octx.rctx.trace()->merge(*r.trace);
+              }
+              auto& p = r.partition;
               if (p.error_code == error_code::none) {
                   auto dur = std::chrono::steady_clock::now() - start;
                   octx.rctx.connection()->server().update_produce_latency(dur);
               } else {
                   m->set_trace(false);
               }
-              return p;
+              return std::move(p);
           });
     return partition_produce_stages{
       .dispatched = std::move(dispatch_f),
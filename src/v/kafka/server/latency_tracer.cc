@@ -0,0 +1,191 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "kafka/server/latency_tracer.h"
+
+#include "config/configuration.h"
+#include "kafka/protocol/schemata/fetch_request.h"
+#include "kafka/protocol/schemata/produce_request.h"
+#include "prometheus/prometheus_sanitize.h"
+
+#include <seastar/core/metrics.hh>
+
+#include <algorithm>
+#include <array>
+#include <span>
+
+namespace kafka {
+
+namespace {
+
+constexpr auto produce_stages = std::to_array<trace_stage>({
+  trace_stage::throttled,
+  trace_stage::resources_acquired,
+  trace_stage::dispatched,
+  trace_stage::partition_shard,
+  trace_stage::batcher_enqueued,
+  trace_stage::batcher_flushed,
+  trace_stage::log_appended,
+  trace_stage::log_flushed,
+  trace_stage::replicated,
+  trace_stage::response_ready,
+  trace_stage::response_sent,
+});
+
+constexpr auto fetch_stages = std::to_array<trace_stage>({
+  trace_stage::throttled,
+  trace_stage::resources_acquired,
+  trace_stage::dispatched,
+  trace_stage::partition_read,
+  trace_stage::response_ready,
+  trace_stage::response_sent,
+});
+
+bool slower(
+  const latency_tracer::trace_summary& a,
+  const latency_tracer::trace_summary& b) {
+    return a.total > b.total;
+}
+
+} // namespace
+
+latency_tracer::latency_tracer()
+  : _sample_interval(
+    config::shard_local_cfg().kafka_latency_trace_sample_interval.bind())
+  , _retained(
+      config::shard_local_cfg().kafka_latency_trace_slowest_retained.bind()) {
+    _retained.watch([this] {
+        while (_slowest.size() > _retained()) {
+            std::pop_heap(_slowest.begin(), _slowest.end(), slower);
+            _slowest.pop_back();
+        }
+    });
+    setup_metrics();
+}
+
+void latency_tracer::setup_metrics() {
+    namespace sm = ss::metrics;
+
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+
+    auto request_label = sm::label("request");
+    auto stage_label = sm::label("stage");
+    auto aggregate_labels = config::shard_local_cfg().aggregate_metrics()
+                              ? std::vector<sm::label>{sm::shard_label}
+                              : std::vector<sm::label>{};
+
+    std::vector<sm::metric_definition> defs;
+    auto add = [&](
+                 const ss::sstring& request,
+                 api_histograms& h,
+                 std::span<const trace_stage> stages) {
+        for (auto s : stages) {
+            auto& hist = h.stages[static_cast<size_t>(s)];
+            defs.push_back(
+              sm::make_histogram(
+                "stage_latency_us",
+                sm::description(
+                  "Time spent by sampled requests reaching a stage since the "
+                  "previous one"),
+                {request_label(request),
+                 stage_label(ss::sstring(to_string_view(s)))},
+                [&hist] { return hist.seastar_histogram_logform(); })
+                .aggregate(aggregate_labels));
+        }
+    };
+    add("produce", _produce, produce_stages);
+    add("fetch", _fetch, fetch_stages);
+
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("kafka:latency_trace"), defs);
+}
+
+latency_tracer::api_histograms* latency_tracer::histograms_for(api_key key) {
+    if (key == produce_api::key) {
+        return &_produce;
+    }
+    if (key == fetch_api::key) {
+        return &_fetch;
+    }
+    return nullptr;
+}
+
+request_trace_ptr latency_tracer::maybe_trace(api_key key) {
+    auto interval = _sample_interval();
+    if (interval == 0 || histograms_for(key) == nullptr) {
+        return nullptr;
+    }
+    if (++_counter < interval) {
+        return nullptr;
+    }
+    _counter = 0;
+    return ss::make_lw_shared<request_trace>();
+}
+
+void latency_tracer::finish(api_key key, const request_trace& trace) {
+    auto h = histograms_for(key);
+    if (!h) {
+        return;
+    }
+    auto stages = key == produce_api::key
+                           ? std::span<const trace_stage>(produce_stages)
+                           : std::span<const trace_stage>(fetch_stages);
+
+    auto start = trace.at(trace_stage::received);
+    if (!start) {
+        return;
+    }
+
+    trace_summary summary{
+      .key = key, .shard = ss::this_shard_id(), .total = {}, .stages = {}};
+    summary.stages.reserve(stages.size());
+    auto previous = *start;
+    for (auto s : stages) {
+        auto at = trace.at(s);
+        if (!at) {
+            continue;
+        }
+        // a request spanning several partitions keeps the latest stamp of
+        // every stage, so stages are not guaranteed to be monotonic
+        auto elapsed = std::max(
+          std::chrono::duration_cast<std::chrono::microseconds>(
+            *at - previous),
+          std::chrono::microseconds(0));
+        h->stages[static_cast<size_t>(s)].record(elapsed.count());
+        summary.stages.push_back(stage_latency{.stage = s, .elapsed = elapsed});
+        previous = std::max(previous, *at);
+    }
+    summary.total = std::chrono::duration_cast<std::chrono::microseconds>(
+      previous - *start);
+
+    auto retained = _retained();
+    if (retained == 0) {
+        return;
+    }
+    if (_slowest.size() < retained) {
+        _slowest.push_back(std::move(summary));
+        std::push_heap(_slowest.begin(), _slowest.end(), slower);
+    } else if (summary.total > _slowest.front().total) {
+        std::pop_heap(_slowest.begin(), _slowest.end(), slower);
+        _slowest.back() = std::move(summary);
+        std::push_heap(_slowest.begin(), _slowest.end(), slower);
+    }
+}
+
+std::vector<latency_tracer::trace_summary> latency_tracer::slowest() const {
+    auto ret = _slowest;
+    std::sort(ret.begin(), ret.end(), slower);
+    return ret;
+}
+
+} // namespace kafka
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "config/property.h"
+#include "kafka/protocol/types.h"
+#include "seastarx.h"
+#include "utils/hdr_hist.h"
+#include "utils/request_trace.h"
+
+#include <seastar/core/metrics_registration.hh>
+#include <seastar/core/sstring.hh>
+
+#include <array>
+#include <chrono>
+#include <vector>
+
+namespace kafka {
+
+/**
+ * Opt-in, sampled latency breakdown of produce and fetch requests.
+ *
+ * One in every `kafka_latency_trace_sample_interval` produce or fetch requests
+ * is traced: the request carries a `request_trace` through the connection,
+ * the api handler, the raft replicate batcher and the leader log flush, and
+ * each stage stamps its completion time. When the response has been written
+ * the time spent between consecutive stages is recorded into per-stage
+ * histograms, and the slowest traces are retained for inspection through the
+ * admin API.
+ *
+ * Meant to be used as a sharded service.
+ */
+class latency_tracer {
+public:
+    struct stage_latency {
+        trace_stage stage;
+        // time elapsed since the previous stage reached by the request
+        std::chrono::microseconds elapsed;
+    };
+
+    struct trace_summary {
+        api_key key;
+        ss::shard_id shard;
+        std::chrono::microseconds total;
+        std::vector<stage_latency> stages;
+    };
+
+    latency_tracer();
+
+    ss::future<> start() { return ss::now(); }
+    ss::future<> stop() { return ss::now(); }
+
+    /// Returns a trace for the request if it has been selected for sampling.
+    request_trace_ptr maybe_trace(api_key);
+
+    /// Records a completed trace into the stage histograms and keeps it if it
+    /// is one of the slowest seen so far.
+    void finish(api_key, const request_trace&);
+
+    /// The slowest traces retained on this shard, slowest first.
+    std::vector<trace_summary> slowest() const;
+
+    void reset_slowest() { _slowest.clear(); }
+
+private:
+    struct api_histograms {
+        std::array<hdr_hist, trace_stage_count> stages;
+    };
+
+    api_histograms* histograms_for(api_key);
+    void setup_metrics();
+
+    config::binding<size_t> _sample_interval;
+    config::binding<size_t> _retained;
+    size_t _counter{0};
+    api_histograms _produce;
+    api_histograms _fetch;
+    // min-heap on total latency, holds at most _retained entries
+    std::vector<trace_summary> _slowest;
+    ss::metrics::metric_groups _metrics;
+};
+
+} // namespace kafka
@@ -96,6 +96,11 @@ public:
           : error_code::offset_out_of_range;
     }
 
+    std::optional<model::node_id>
+    get_preferred_read_replica(const model::rack_id&) const final {
+        return std::nullopt;
+    }
+
 private:
     static model::offset offset_or_zero(model::offset o) {
         return o > model::offset(0) ? o : model::offset(0);
@@ -0,0 +1,96 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/server/metadata_response_cache.h"
+
+#include "vassert.h"
+
+namespace kafka {
+
+namespace {
+
+iobuf encode(metadata_response& reply, api_version version) {
+    iobuf out;
+    response_writer writer(out);
+    reply.encode(writer, version);
+    return out;
+}
+
+/*
+ * The topics array of a response is followed by the cluster authorized
+ * operations (v8+) and by the response tagged fields (flexible versions), all
+ * of fixed size when there are no tags.
+ */
+size_t trailer_size(api_version version) {
+    return (version >= api_version(8) ? sizeof(int32_t) : 0)
+           + (version >= metadata_api::min_flexible ? 1 : 0);
+}
+
+} // namespace
+
+iobuf encode_metadata_response_topic(
+  metadata_response_topic topic, api_version version) {
+    /*
+     * A response holding the topic alone only differs from an empty one by
+     * the topic block, which starts where the trailer of the empty response
+     * does: the length of a one element array takes as many bytes as the one
+     * of an empty array.
+     */
+    metadata_response reply;
+    auto empty = encode(reply, version);
+    reply.data.topics.push_back(std::move(topic));
+    auto full = encode(reply, version);
+    return full.share(
+      empty.size_bytes() - trailer_size(version),
+      full.size_bytes() - empty.size_bytes());
+}
+
+iobuf encode_metadata_response(
+  metadata_response& reply,
+  api_version version,
+  iobuf topics,
+  size_t topic_count) {
+    vassert(
+      reply.data.topics.empty(),
+      "Topics must be passed in their encoded form");
+    auto envelope = encode(reply, version);
+
+    // split the envelope around the empty topics array and put the encoded
+    // topics in between
+    const bool flex = version >= metadata_api::min_flexible;
+    const size_t trailer = trailer_size(version);
+    const size_t empty_array_size = flex ? 1 : sizeof(int32_t);
+    const size_t head_size = envelope.size_bytes() - trailer
+                             - empty_array_size;
+
+    iobuf out = envelope.share(0, head_size);
+    response_writer writer(out);
+    if (flex) {
+        writer.write_unsigned_varint(topic_count + 1);
+    } else {
+        writer.write(static_cast<int32_t>(topic_count));
+    }
+    out.append(std::move(topics));
+    if (trailer > 0) {
+        out.append(envelope.share(envelope.size_bytes() - trailer, trailer));
+    }
+    return out;
+}
+
+void metadata_response_cache::apply(
+  const std::vector<cluster::topic_table::delta>& deltas) {
+    using op_type = cluster::topic_table::delta::op_type;
+    for (const auto& d : deltas) {
+        if (d.type == op_type::del || d.type == op_type::del_non_replicable) {
+            _entries.erase(model::topic_namespace(d.ntp.ns, d.ntp.tp.topic));
+        }
+    }
+}
+
+} // namespace kafka
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "bytes/iobuf.h"
+#include "cluster/topic_table.h"
+#include "kafka/protocol/metadata.h"
+#include "kafka/protocol/response_writer.h"
+#include "kafka/types.h"
+#include "model/metadata.h"
+
+#include <absl/container/node_hash_map.h>
+
+#include <concepts>
+#include <vector>
+
+namespace kafka {
+
+/// Encodes a single topic of a metadata response, as an element of the topics
+/// array encoded by metadata_response_data::encode.
+iobuf encode_metadata_response_topic(metadata_response_topic, api_version);
+
+/// Encodes `reply`, which must not contain any topics, with a topics array
+/// made of `topic_count` already encoded topic blocks.
+iobuf encode_metadata_response(
+  metadata_response& reply, api_version, iobuf topics, size_t topic_count);
+
+/**
+ * Per shard cache of encoded metadata response topic blocks.
+ *
+ * Building the topic section of a metadata response walks every partition,
+ * looks up its leader and encodes the result, which is what dominates the
+ * handling of full metadata requests in clusters with many partitions. Blocks
+ * are kept encoded per topic and api version instead, together with the
+ * versions of the topic metadata and of its partition leaders they were
+ * built from. A block is rebuilt only after one of those versions changed, so
+ * a leadership change re-encodes a single topic and serving a full metadata
+ * request mostly shares already encoded fragments.
+ */
+class metadata_response_cache {
+public:
+    struct versions {
+        // cluster::topic_table::topic_metadata_item::version
+        uint64_t topic{0};
+        // cluster::partition_leaders_table::topic_version
+        uint64_t leaders{0};
+
+        friend bool operator==(const versions&, const versions&) = default;
+    };
+
+    struct built_topic {
+        metadata_response_topic topic;
+        // false when the topic depends on more than the versioned metadata,
+        // i.e. leaders which are guessed because the partition has none
+        bool cacheable{true};
+    };
+
+    /**
+     * Appends the encoded block of the topic to `out`. `build` is invoked to
+     * create the topic response when there is no cached block for `v`.
+     */
+    template<typename Func>
+    requires std::same_as<std::invoke_result_t<Func>, built_topic>
+    void append_topic(
+      const model::topic_namespace& tp_ns,
+      versions v,
+      api_version version,
+      iobuf& out,
+      Func&& build) {
+        auto idx = static_cast<size_t>(version());
+        auto it = _entries.find(tp_ns);
+        if (it != _entries.end() && it->second.version == v) {
+            auto& blocks = it->second.blocks;
+            if (idx < blocks.size() && !blocks[idx].empty()) {
+                ++_hits;
+                out.append(blocks[idx].share(0, blocks[idx].size_bytes()));
+                return;
+            }
+        }
+
+        ++_misses;
+        auto built = build();
+        auto block = encode_metadata_response_topic(
+          std::move(built.topic), version);
+        if (!built.cacheable) {
+            if (it != _entries.end()) {
+                _entries.erase(it);
+            }
+            out.append(std::move(block));
+            return;
+        }
+        if (it == _entries.end()) {
+            it = _entries.emplace(tp_ns, entry{}).first;
+        }
+        if (it->second.version != v) {
+            it->second = entry{.version = v};
+        }
+        auto& blocks = it->second.blocks;
+        if (idx >= blocks.size()) {
+            blocks.resize(idx + 1);
+        }
+        blocks[idx] = block.share(0, block.size_bytes());
+        out.append(std::move(block));
+    }
+
+    /// Drops the blocks of topics deleted by the deltas.
+    void apply(const std::vector<cluster::topic_table::delta>&);
+
+    size_t size() const { return _entries.size(); }
+    uint64_t hits() const { return _hits; }
+    uint64_t misses() const { return _misses; }
+
+private:
+    struct entry {
+        versions version;
+        // indexed by api version, empty if not encoded yet
+        std::vector<iobuf> blocks;
+    };
+
+    absl::node_hash_map<
+      model::topic_namespace,
+      entry,
+      model::topic_namespace_hash,
+      model::topic_namespace_eq>
+      _entries;
+    uint64_t _hits{0};
+    uint64_t _misses{0};
+};
+
+} // namespace kafka
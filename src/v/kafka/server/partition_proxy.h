@@ -57,6 +57,8 @@ public:
           validate_fetch_offset(model::offset, model::timeout_clock::time_point)
           = 0;
         virtual cluster::partition_probe& probe() = 0;
+        virtual std::optional<model::node_id>
+        get_preferred_read_replica(const model::rack_id&) const = 0;
         virtual ~impl() noexcept = default;
     };
 
@@ -113,6 +115,13 @@ public:
         return _impl->validate_fetch_offset(o, deadline);
     }
 
+    /// The replica a consumer in the given rack should rather fetch from,
+    /// if any.
+    std::optional<model::node_id>
+    get_preferred_read_replica(const model::rack_id& consumer_rack) const {
+        return _impl->get_preferred_read_replica(consumer_rack);
+    }
+
 private:
     std::unique_ptr<impl> _impl;
 };
@@ -9,6 +9,7 @@
 
 #include "protocol.h"
 
+#include "cluster/metadata_cache.h"
 #include "cluster/topics_frontend.h"
 #include "config/broker_authn_endpoint.h"
 #include "config/configuration.h"
@@ -63,6 +64,7 @@ protocol::protocol(
   ss::sharded<cluster::tx_gateway_frontend>& tx_gateway_frontend,
   ss::sharded<coproc::partition_manager>& coproc_partition_manager,
   ss::sharded<v8_engine::data_policy_table>& data_policy_table,
+  ss::sharded<latency_tracer>& latency_tracer,
   std::optional<qdc_monitor::config> qdc_config) noexcept
   : _smp_group(smp)
   , _topics_frontend(tf)
@@ -86,6 +88,7 @@ protocol::protocol(
   , _tx_gateway_frontend(tx_gateway_frontend)
   , _coproc_partition_manager(coproc_partition_manager)
   , _data_policy_table(data_policy_table)
+  , _latency_tracer(latency_tracer)
   , _mtls_principal_mapper(
       config::shard_local_cfg().kafka_mtls_principal_mapping_rules.bind()) {
     if (qdc_config) {
@@ -93,6 +96,17 @@ protocol::protocol(
     }
     _probe.setup_metrics();
     _probe.setup_public_metrics();
+    // blocks of deleted topics would never be looked up again
+    _topic_delta_notify_handle
+      = _metadata_cache.local().register_topic_delta_notification(
+        [this](const std::vector<cluster::topic_table::delta>& deltas) {
+            _metadata_response_cache.apply(deltas);
+        });
+}
+
+protocol::~protocol() noexcept {
+    _metadata_cache.local().unregister_topic_delta_notification(
+      _topic_delta_notify_handle);
 }
 
 coordinator_ntp_mapper& protocol::coordinator_mapper() {
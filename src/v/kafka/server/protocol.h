@@ -17,6 +17,8 @@
 #include "kafka/latency_probe.h"
 #include "kafka/server/fetch_metadata_cache.hh"
 #include "kafka/server/fwd.h"
+#include "kafka/server/latency_tracer.h"
+#include "kafka/server/metadata_response_cache.h"
 #include "kafka/server/queue_depth_monitor.h"
 #include "net/server.h"
 #include "security/authorizer.h"
@@ -52,12 +54,13 @@ public:
       ss::sharded<cluster::tx_gateway_frontend>&,
       ss::sharded<coproc::partition_manager>&,
       ss::sharded<v8_engine::data_policy_table>&,
+      ss::sharded<latency_tracer>&,
       std::optional<qdc_monitor::config>) noexcept;
 
-    ~protocol() noexcept override = default;
+    ~protocol() noexcept override;
     protocol(const protocol&) = delete;
     protocol& operator=(const protocol&) = delete;
-    protocol(protocol&&) noexcept = default;
+    protocol(protocol&&) noexcept = delete;
     protocol& operator=(protocol&&) noexcept = delete;
 
     const char* name() const final { return "kafka rpc protocol"; }
@@ -135,8 +138,14 @@ public:
         return _fetch_metadata_cache;
     }
 
+    kafka::metadata_response_cache& get_metadata_response_cache() {
+        return _metadata_response_cache;
+    }
+
     latency_probe& probe() { return _probe; }
 
+    latency_tracer& tracer() { return _latency_tracer.local(); }
+
 private:
     ss::smp_service_group _smp_group;
     ss::sharded<cluster::topics_frontend>& _topics_frontend;
@@ -158,8 +167,11 @@ private:
     ss::sharded<cluster::tx_gateway_frontend>& _tx_gateway_frontend;
     ss::sharded<coproc::partition_manager>& _coproc_partition_manager;
     ss::sharded<v8_engine::data_policy_table>& _data_policy_table;
+    ss::sharded<latency_tracer>& _latency_tracer;
     std::optional<qdc_monitor> _qdc_mon;
     kafka::fetch_metadata_cache _fetch_metadata_cache;
+    kafka::metadata_response_cache _metadata_response_cache;
+    cluster::notification_id_type _topic_delta_notify_handle;
     security::tls::principal_mapper _mtls_principal_mapper;
 
     latency_probe _probe;
@@ -0,0 +1,47 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/server/replica_selector.h"
+
+namespace kafka {
+
+std::optional<model::node_id> select_preferred_read_replica(
+  const model::rack_id& consumer_rack,
+  const std::optional<model::rack_id>& leader_rack,
+  const std::vector<replica_info>& followers) {
+    if (leader_rack == consumer_rack) {
+        return std::nullopt;
+    }
+    const replica_info* selected = nullptr;
+    for (const auto& f : followers) {
+        if (!f.is_in_sync || f.rack != consumer_rack) {
+            continue;
+        }
+        if (selected == nullptr || f.match_index > selected->match_index) {
+            selected = &f;
+        }
+    }
+    if (selected == nullptr) {
+        return std::nullopt;
+    }
+    return selected->id;
+}
+
+error_code validate_follower_fetch_offset(
+  model::offset fetch_offset,
+  model::offset start_offset,
+  model::offset log_end) {
+    if (fetch_offset < start_offset) {
+        return error_code::offset_out_of_range;
+    }
+    return fetch_offset <= log_end ? error_code::none
+                                   : error_code::offset_not_available;
+}
+
+} // namespace kafka
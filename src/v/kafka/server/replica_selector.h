@@ -0,0 +1,59 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "kafka/protocol/errors.h"
+#include "model/fundamental.h"
+#include "model/metadata.h"
+
+#include <optional>
+#include <vector>
+
+namespace kafka {
+
+/// A follower of a partition, as seen by its leader.
+struct replica_info {
+    model::node_id id;
+    std::optional<model::rack_id> rack;
+    /// last log offset the follower is known to have replicated
+    model::offset match_index;
+    /// the follower is a live voter which is not being recovered
+    bool is_in_sync{false};
+};
+
+/**
+ * Rack aware replica selection (KIP-392).
+ *
+ * Returns the replica a consumer located in `consumer_rack` should fetch
+ * from instead of the leader: the in sync follower of the consumer rack
+ * which replicated the most data. Returns nothing when the leader is in the
+ * consumer rack or when no in sync follower is, the consumer then keeps
+ * fetching from the leader.
+ */
+std::optional<model::node_id> select_preferred_read_replica(
+  const model::rack_id& consumer_rack,
+  const std::optional<model::rack_id>& leader_rack,
+  const std::vector<replica_info>& followers);
+
+/**
+ * Validates the offset a consumer fetches from a follower, in kafka offsets.
+ *
+ * The follower high watermark lags the leader one, offsets up to the local
+ * `log_end` are served once they become visible. Offsets past it may exist on
+ * the leader: the follower is behind rather than the offset out of range,
+ * which would make the consumer reset its position.
+ */
+error_code validate_follower_fetch_offset(
+  model::offset fetch_offset,
+  model::offset start_offset,
+  model::offset log_end);
+
+} // namespace kafka
@@ -13,6 +13,7 @@
 #include "cluster/errc.h"
 #include "kafka/protocol/errors.h"
 #include "kafka/server/logger.h"
+#include "kafka/server/replica_selector.h"
 #include "kafka/types.h"
 #include "model/fundamental.h"
 #include "model/timeout_clock.h"
@@ -237,13 +238,33 @@ replicated_partition::aborted_transactions(
 
 ss::future<std::optional<storage::timequery_result>>
 replicated_partition::timequery(storage::timequery_config cfg) {
-    return _partition->timequery(cfg).then(
-      [this](std::optional<storage::timequery_result> r) {
-          if (r) {
-              r->offset = _translator->from_log_offset(r->offset);
-          }
-          return r;
-      });
+    if (
+      _partition->is_read_replica_mode_enabled()
+      && _partition->cloud_data_available()) {
+        co_return co_await _partition->cloud_timequery(cfg);
+    }
+
+    auto local_kafka_start_offset = _translator->from_log_offset(
+      _partition->start_offset());
+    if (
+      _partition->is_remote_fetch_enabled()
+      && _partition->cloud_data_available()
+      && _partition->start_cloud_offset() < local_kafka_start_offset) {
+        // records older than the local log can only be found in the cloud
+        auto cloud_cfg = cfg;
+        cloud_cfg.max_offset = std::min(
+          cfg.max_offset, local_kafka_start_offset - model::offset(1));
+        auto r = co_await _partition->cloud_timequery(cloud_cfg);
+        if (r) {
+            co_return r;
+        }
+    }
+
+    auto r = co_await _partition->timequery(cfg);
+    if (r) {
+        r->offset = _translator->from_log_offset(r->offset);
+    }
+    co_return r;
 }
 
 ss::future<result<model::offset>> replicated_partition::replicate(
@@ -317,6 +338,12 @@ ss::future<error_code> replicated_partition::validate_fetch_offset(
     const auto log_end = model::next_offset(
       _translator->from_log_offset(_partition->dirty_offset()));
 
+    if (!_partition->is_leader()) {
+        // consumer fetching from a follower
+        co_return validate_follower_fetch_offset(
+          fetch_offset, start_offset(), log_end);
+    }
+
     while (fetch_offset > high_watermark() && fetch_offset <= log_end) {
         if (model::timeout_clock::now() > deadline) {
             break;
@@ -356,4 +383,24 @@ ss::future<error_code> replicated_partition::validate_fetch_offset(
       : error_code::offset_out_of_range;
 }
 
+std::optional<model::node_id> replicated_partition::get_preferred_read_replica(
+  const model::rack_id& consumer_rack) const {
+    const auto cfg = _partition->group_configuration();
+    auto rack_of = [&cfg](model::node_id id) -> std::optional<model::rack_id> {
+        auto broker = cfg.find_broker(id);
+        return broker ? broker->rack() : std::nullopt;
+    };
+
+    std::vector<replica_info> followers;
+    for (const auto& f : _partition->raft()->get_follower_metrics()) {
+        followers.push_back(replica_info{
+          .id = f.id,
+          .rack = rack_of(f.id),
+          .match_index = f.match_index,
+          .is_in_sync = !f.is_learner && f.is_live && !f.under_replicated});
+    }
+    return select_preferred_read_replica(
+      consumer_rack, rack_of(_partition->raft()->self().id()), followers);
+}
+
 } // namespace kafka
@@ -124,6 +124,9 @@ public:
     ss::future<error_code> validate_fetch_offset(
       model::offset, model::timeout_clock::time_point) final;
 
+    std::optional<model::node_id>
+    get_preferred_read_replica(const model::rack_id&) const final;
+
 private:
     ss::future<std::vector<cluster::rm_stm::tx_range>>
       aborted_transactions_local(
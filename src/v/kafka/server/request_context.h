@@ -62,11 +62,13 @@ public:
       ss::lw_shared_ptr<connection_context> conn,
       request_header&& header,
       iobuf&& request,
-      ss::lowres_clock::duration throttle_delay) noexcept
+      ss::lowres_clock::duration throttle_delay,
+      request_trace_ptr trace = nullptr) noexcept
       : _conn(std::move(conn))
       , _header(std::move(header))
       , _reader(std::move(request))
-      , _throttle_delay(throttle_delay) {}
+      , _throttle_delay(throttle_delay)
+      , _trace(std::move(trace)) {}
 
     request_context(const request_context&) = delete;
     request_context& operator=(const request_context&) = delete;
@@ -82,6 +84,9 @@ public:
 
     latency_probe& probe() { return _conn->server().probe(); }
 
+    /// Latency trace of the request, null unless it was sampled.
+    const request_trace_ptr& trace() const { return _trace; }
+
     const cluster::metadata_cache& metadata_cache() const {
         return _conn->server().metadata_cache();
     }
@@ -144,6 +149,10 @@ public:
         return _conn->server().get_fetch_metadata_cache();
     }
 
+    metadata_response_cache& get_metadata_response_cache() {
+        return _conn->server().get_metadata_response_cache();
+    }
+
     template<typename ResponseType>
     requires requires(
       ResponseType r, response_writer& writer, api_version version) {
@@ -176,6 +185,25 @@ public:
         }
         auto resp = std::make_unique<response>(is_flexible);
         r.encode(resp->writer(), version);
+        mark_trace(_trace, trace_stage::response_ready);
+        return ss::make_ready_future<response_ptr>(std::move(resp));
+    }
+
+    /// Sends a response the handler already encoded at the request version.
+    template<typename ResponseType>
+    ss::future<response_ptr> respond_encoded(iobuf encoded) {
+        vlog(
+          klog.trace,
+          "[{}:{}] sending {}:{} encoded response of {} bytes",
+          _conn->client_host(),
+          _conn->client_port(),
+          ResponseType::api_type::key,
+          ResponseType::api_type::name,
+          encoded.size_bytes());
+        auto resp = std::make_unique<response>(
+          flex_enabled(header().is_flexible()));
+        resp->writer().write_direct(std::move(encoded));
+        mark_trace(_trace, trace_stage::response_ready);
         return ss::make_ready_future<response_ptr>(std::move(resp));
     }
 
@@ -216,6 +244,7 @@ private:
     request_header _header;
     request_reader _reader;
     ss::lowres_clock::duration _throttle_delay;
+    request_trace_ptr _trace;
 };
 
 // Executes the API call identified by the specified request_context.
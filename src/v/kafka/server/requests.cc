@@ -110,6 +110,7 @@ process_result_stages process_generic(
           handler->name()));
     }
 
+    mark_trace(ctx.trace(), trace_stage::dispatched);
     return handler->handle(std::move(ctx), g);
 }
 
@@ -7,15 +7,22 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "cluster/partition_probe.h"
+#include "config/configuration.h"
 #include "kafka/protocol/batch_consumer.h"
+#include "kafka/protocol/batch_reader.h"
 #include "kafka/server/handlers/fetch.h"
+#include "kafka/server/partition_proxy.h"
+#include "kafka/server/replica_selector.h"
 #include "kafka/types.h"
 #include "model/fundamental.h"
+#include "model/tests/random_batch.h"
 #include "redpanda/tests/fixture.h"
 #include "resource_mgmt/io_priority.h"
 #include "test_utils/async.h"
 
 #include <seastar/core/smp.hh>
+#include <seastar/util/defer.hh>
 
 #include <fmt/ostream.h>
 
@@ -659,3 +666,203 @@ FIXTURE_TEST(fetch_request_max_bytes, redpanda_thread_fixture) {
     BOOST_REQUIRE(
       fetch_one_byte.data.topics[0].partitions[0].records->size_bytes() > 0);
 }
+
+namespace {
+
+/**
+ * Follower replica holding one record per offset in [start, log_end), of
+ * which the offsets below its high watermark are visible.
+ */
+class follower_partition final : public kafka::partition_proxy::impl {
+public:
+    follower_partition(
+      model::offset start,
+      model::offset log_end,
+      model::offset hw,
+      model::offset lso)
+      : _ntp(model::kafka_namespace, model::topic("t"), model::partition_id(0))
+      , _start(start)
+      , _log_end(log_end)
+      , _hw(hw)
+      , _lso(lso)
+      , _probe(cluster::make_materialized_partition_probe()) {}
+
+    const model::ntp& ntp() const final { return _ntp; }
+    model::offset start_offset() const final { return _start; }
+    model::offset high_watermark() const final { return _hw; }
+    model::offset last_stable_offset() const final { return _lso; }
+    kafka::leader_epoch leader_epoch() const final {
+        return kafka::leader_epoch(1);
+    }
+    std::optional<model::offset>
+    get_leader_epoch_last_offset(kafka::leader_epoch) const final {
+        return std::nullopt;
+    }
+    bool is_elected_leader() const final { return false; }
+    bool is_leader() const final { return false; }
+    ss::future<std::error_code> linearizable_barrier() final {
+        return ss::make_ready_future<std::error_code>(std::error_code());
+    }
+
+    ss::future<storage::translating_reader> make_reader(
+      storage::log_reader_config cfg,
+      std::optional<model::timeout_clock::time_point>) final {
+        // serves every offset of the local log the reader asks for
+        model::record_batch_reader::data_t batches;
+        for (auto o = std::max(cfg.start_offset, _start);
+             o < _log_end && o <= cfg.max_offset;
+             o = model::next_offset(o)) {
+            batches.push_back(model::test::make_random_batch(o, 1, false));
+        }
+        return ss::make_ready_future<storage::translating_reader>(
+          storage::translating_reader(
+            model::make_memory_record_batch_reader(std::move(batches))));
+    }
+
+    ss::future<std::optional<storage::timequery_result>>
+    timequery(storage::timequery_config) final {
+        return ss::make_ready_future<std::optional<storage::timequery_result>>(
+          std::nullopt);
+    }
+    ss::future<std::vector<cluster::rm_stm::tx_range>> aborted_transactions(
+      model::offset,
+      model::offset,
+      ss::lw_shared_ptr<const storage::offset_translator_state>) final {
+        return ss::make_ready_future<std::vector<cluster::rm_stm::tx_range>>();
+    }
+    ss::future<kafka::error_code> validate_fetch_offset(
+      model::offset o, model::timeout_clock::time_point) final {
+        return ss::make_ready_future<kafka::error_code>(
+          kafka::validate_follower_fetch_offset(o, _start, _log_end));
+    }
+    cluster::partition_probe& probe() final { return _probe; }
+    std::optional<model::node_id>
+    get_preferred_read_replica(const model::rack_id&) const final {
+        return std::nullopt;
+    }
+
+private:
+    model::ntp _ntp;
+    model::offset _start;
+    model::offset _log_end;
+    model::offset _hw;
+    model::offset _lso;
+    cluster::partition_probe _probe;
+};
+
+kafka::read_result read_from_follower(
+  model::offset start,
+  model::offset log_end,
+  model::offset hw,
+  model::offset lso,
+  model::offset fetch_offset,
+  model::isolation_level isolation = model::isolation_level::read_uncommitted,
+  std::optional<model::rack_id> consumer_rack = model::rack_id("a")) {
+    kafka::fetch_config config{
+      .start_offset = fetch_offset,
+      .max_offset = model::model_limits<model::offset>::max(),
+      .isolation_level = isolation,
+      .max_bytes = std::numeric_limits<size_t>::max(),
+      .timeout = model::no_timeout,
+      .current_leader_epoch = kafka::invalid_leader_epoch,
+      .consumer_rack_id = std::move(consumer_rack),
+    };
+    return kafka::read_from_partition_proxy(
+             kafka::make_partition_proxy<follower_partition>(
+               start, log_end, hw, lso),
+             config,
+             false,
+             model::no_timeout)
+      .get0();
+}
+
+model::offset last_offset_read(const kafka::read_result& res) {
+    return kafka::batch_reader(res.get_data().copy()).last_offset();
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(follower_fetch_bounded_by_high_watermark) {
+    // the follower log holds offsets the leader did not commit yet
+    auto res = read_from_follower(
+      model::offset(0),
+      model::offset(10),
+      model::offset(6),
+      model::offset(6),
+      model::offset(2));
+    BOOST_REQUIRE_EQUAL(res.error, kafka::error_code::none);
+    BOOST_REQUIRE_EQUAL(res.high_watermark, model::offset(6));
+    BOOST_REQUIRE(res.has_data());
+    BOOST_REQUIRE_EQUAL(last_offset_read(res), model::offset(5));
+
+    // offsets replicated to the follower but not visible yet are empty reads
+    res = read_from_follower(
+      model::offset(0),
+      model::offset(10),
+      model::offset(6),
+      model::offset(6),
+      model::offset(8));
+    BOOST_REQUIRE_EQUAL(res.error, kafka::error_code::none);
+    BOOST_REQUIRE(!res.has_data());
+}
+
+SEASTAR_THREAD_TEST_CASE(follower_fetch_bounded_by_last_stable_offset) {
+    config::shard_local_cfg().enable_transactions.set_value(true);
+    auto reset = ss::defer(
+      [] { config::shard_local_cfg().enable_transactions.reset(); });
+
+    auto res = read_from_follower(
+      model::offset(0),
+      model::offset(10),
+      model::offset(8),
+      model::offset(4),
+      model::offset(0),
+      model::isolation_level::read_committed);
+    BOOST_REQUIRE_EQUAL(res.error, kafka::error_code::none);
+    BOOST_REQUIRE_EQUAL(res.last_stable_offset, model::offset(4));
+    BOOST_REQUIRE_EQUAL(last_offset_read(res), model::offset(3));
+
+    // uncommitted reads are only bounded by the high watermark
+    res = read_from_follower(
+      model::offset(0),
+      model::offset(10),
+      model::offset(8),
+      model::offset(4),
+      model::offset(0));
+    BOOST_REQUIRE_EQUAL(last_offset_read(res), model::offset(7));
+}
+
+SEASTAR_THREAD_TEST_CASE(follower_fetch_offset_out_of_range) {
+    // prefix truncated on the follower, the consumer resets its position
+    auto res = read_from_follower(
+      model::offset(3),
+      model::offset(10),
+      model::offset(6),
+      model::offset(6),
+      model::offset(1));
+    BOOST_REQUIRE_EQUAL(res.error, kafka::error_code::offset_out_of_range);
+    BOOST_REQUIRE(!res.has_data());
+
+    // past the follower log end the offset may exist on the leader, the
+    // consumer retries instead of resetting its position
+    res = read_from_follower(
+      model::offset(0),
+      model::offset(10),
+      model::offset(6),
+      model::offset(6),
+      model::offset(11));
+    BOOST_REQUIRE_EQUAL(res.error, kafka::error_code::offset_not_available);
+    BOOST_REQUIRE(!res.has_data());
+
+    // followers only serve consumers which know about follower fetching
+    res = read_from_follower(
+      model::offset(0),
+      model::offset(10),
+      model::offset(6),
+      model::offset(6),
+      model::offset(2),
+      model::isolation_level::read_uncommitted,
+      std::nullopt);
+    BOOST_REQUIRE_EQUAL(
+      res.error, kafka::error_code::not_leader_for_partition);
+}
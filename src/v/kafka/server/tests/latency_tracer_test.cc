@@ -0,0 +1,202 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "config/configuration.h"
+#include "kafka/protocol/schemata/fetch_request.h"
+#include "kafka/protocol/schemata/metadata_request.h"
+#include "kafka/protocol/schemata/produce_request.h"
+#include "kafka/server/latency_tracer.h"
+#include "utils/request_trace.h"
+
+#include <seastar/core/sleep.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+struct tracer_config {
+    tracer_config(size_t sample_interval, size_t retained) {
+        auto& cfg = config::shard_local_cfg();
+        cfg.disable_metrics.set_value(true);
+        cfg.kafka_latency_trace_sample_interval.set_value(sample_interval);
+        cfg.kafka_latency_trace_slowest_retained.set_value(retained);
+    }
+
+    ~tracer_config() {
+        auto& cfg = config::shard_local_cfg();
+        cfg.disable_metrics.reset();
+        cfg.kafka_latency_trace_sample_interval.reset();
+        cfg.kafka_latency_trace_slowest_retained.reset();
+    }
+};
+
+// a produce trace which took at least `step` between its stages
+request_trace make_produce_trace(std::chrono::milliseconds step) {
+    request_trace trace;
+    for (auto s :
+         {trace_stage::dispatched,
+          trace_stage::replicated,
+          trace_stage::response_sent}) {
+        ss::sleep(step).get();
+        trace.mark(s);
+    }
+    return trace;
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_request_trace_keeps_latest_stamps) {
+    request_trace trace;
+    BOOST_REQUIRE(trace.at(trace_stage::received));
+    BOOST_REQUIRE(!trace.at(trace_stage::partition_shard));
+
+    // the part of a request handled by another shard
+    request_trace shard_trace(trace_stage::partition_shard);
+    BOOST_REQUIRE(!shard_trace.at(trace_stage::received));
+    ss::sleep(1ms).get();
+    shard_trace.mark(trace_stage::replicated);
+
+    trace.merge(shard_trace);
+    BOOST_REQUIRE(
+      trace.at(trace_stage::partition_shard)
+      == shard_trace.at(trace_stage::partition_shard));
+    BOOST_REQUIRE(
+      trace.at(trace_stage::replicated)
+      == shard_trace.at(trace_stage::replicated));
+    BOOST_REQUIRE(
+      *trace.at(trace_stage::received)
+      < *shard_trace.at(trace_stage::partition_shard));
+
+    // a partition replicated earlier doesn't move the stage back
+    auto latest = *trace.at(trace_stage::replicated);
+    request_trace earlier(trace_stage::partition_shard);
+    earlier.mark(trace_stage::replicated);
+    ss::sleep(1ms).get();
+    trace.mark(trace_stage::replicated);
+    auto marked = *trace.at(trace_stage::replicated);
+    BOOST_REQUIRE(marked > latest);
+    trace.merge(earlier);
+    BOOST_REQUIRE(*trace.at(trace_stage::replicated) == marked);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_latency_tracer_sampling) {
+    {
+        tracer_config cfg(0, 8);
+        kafka::latency_tracer tracer;
+        for (int i = 0; i < 10; ++i) {
+            BOOST_REQUIRE(!tracer.maybe_trace(kafka::produce_api::key));
+        }
+    }
+
+    tracer_config cfg(3, 8);
+    kafka::latency_tracer tracer;
+    // only produce and fetch requests are traced
+    for (int i = 0; i < 10; ++i) {
+        BOOST_REQUIRE(!tracer.maybe_trace(kafka::metadata_api::key));
+    }
+    for (int i = 1; i <= 9; ++i) {
+        auto key = i % 2 ? kafka::produce_api::key : kafka::fetch_api::key;
+        auto trace = tracer.maybe_trace(key);
+        BOOST_REQUIRE_EQUAL(bool(trace), i % 3 == 0);
+        if (trace) {
+            BOOST_REQUIRE(trace->at(trace_stage::received));
+        }
+    }
+}
+
+SEASTAR_THREAD_TEST_CASE(test_latency_tracer_records_stages) {
+    tracer_config cfg(1, 8);
+    kafka::latency_tracer tracer;
+
+    auto trace = make_produce_trace(2ms);
+    tracer.finish(kafka::produce_api::key, trace);
+
+    auto slowest = tracer.slowest();
+    BOOST_REQUIRE_EQUAL(slowest.size(), 1);
+    auto& summary = slowest.front();
+    BOOST_REQUIRE_EQUAL(summary.key, kafka::produce_api::key);
+    BOOST_REQUIRE_EQUAL(summary.shard, ss::this_shard_id());
+
+    // only the stages reached are reported, in order
+    BOOST_REQUIRE_EQUAL(summary.stages.size(), 3);
+    BOOST_REQUIRE(summary.stages[0].stage == trace_stage::dispatched);
+    BOOST_REQUIRE(summary.stages[1].stage == trace_stage::replicated);
+    BOOST_REQUIRE(summary.stages[2].stage == trace_stage::response_sent);
+    std::chrono::microseconds sum{0};
+    for (auto& s : summary.stages) {
+        BOOST_REQUIRE(s.elapsed >= 2ms);
+        sum += s.elapsed;
+    }
+    // stage latencies are truncated to microseconds
+    BOOST_REQUIRE(sum <= summary.total);
+    BOOST_REQUIRE(summary.total - sum < 3us);
+
+    // stages of other requests are not recorded for fetches
+    request_trace fetch;
+    fetch.mark(trace_stage::batcher_enqueued);
+    fetch.mark(trace_stage::partition_read);
+    tracer.finish(kafka::fetch_api::key, fetch);
+    slowest = tracer.slowest();
+    BOOST_REQUIRE_EQUAL(slowest.size(), 2);
+    auto& fetch_summary = slowest.back();
+    BOOST_REQUIRE_EQUAL(fetch_summary.key, kafka::fetch_api::key);
+    BOOST_REQUIRE_EQUAL(fetch_summary.stages.size(), 1);
+    BOOST_REQUIRE(
+      fetch_summary.stages[0].stage == trace_stage::partition_read);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_latency_tracer_finishes_unsent_responses) {
+    tracer_config cfg(1, 8);
+    kafka::latency_tracer tracer;
+
+    // acks=0 produce requests finish without writing a response
+    request_trace trace;
+    trace.mark(trace_stage::dispatched);
+    ss::sleep(1ms).get();
+    trace.mark(trace_stage::response_ready);
+    tracer.finish(kafka::produce_api::key, trace);
+
+    auto slowest = tracer.slowest();
+    BOOST_REQUIRE_EQUAL(slowest.size(), 1);
+    BOOST_REQUIRE_EQUAL(slowest.front().stages.size(), 2);
+    BOOST_REQUIRE(
+      slowest.front().stages.back().stage == trace_stage::response_ready);
+    BOOST_REQUIRE(slowest.front().total >= 1ms);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_latency_tracer_retains_slowest) {
+    tracer_config cfg(1, 2);
+    kafka::latency_tracer tracer;
+
+    auto fast = make_produce_trace(1ms);
+    auto slow = make_produce_trace(5ms);
+    auto medium = make_produce_trace(3ms);
+    tracer.finish(kafka::produce_api::key, fast);
+    tracer.finish(kafka::produce_api::key, slow);
+    tracer.finish(kafka::produce_api::key, medium);
+
+    auto slowest = tracer.slowest();
+    BOOST_REQUIRE_EQUAL(slowest.size(), 2);
+    BOOST_REQUIRE(slowest[0].total >= 15ms);
+    BOOST_REQUIRE(slowest[1].total >= 9ms);
+    BOOST_REQUIRE(slowest[1].total < slowest[0].total);
+
+    // shrinking the retained traces drops the fastest ones
+    config::shard_local_cfg().kafka_latency_trace_slowest_retained.set_value(
+      size_t(1));
+    slowest = tracer.slowest();
+    BOOST_REQUIRE_EQUAL(slowest.size(), 1);
+    BOOST_REQUIRE(slowest[0].total >= 15ms);
+
+    tracer.reset_slowest();
+    BOOST_REQUIRE(tracer.slowest().empty());
+}
@@ -0,0 +1,162 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iobuf.h"
+#include "kafka/protocol/metadata.h"
+#include "kafka/server/handlers/metadata.h"
+#include "kafka/server/metadata_response_cache.h"
+#include "model/fundamental.h"
+#include "model/namespace.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace kafka; // NOLINT
+
+namespace {
+
+metadata_response::topic make_topic(ss::sstring name, int partitions) {
+    metadata_response::topic t;
+    t.error_code = error_code::none;
+    t.name = model::topic(std::move(name));
+    t.topic_authorized_operations = 0;
+    for (int i = 0; i < partitions; ++i) {
+        metadata_response::partition p;
+        p.error_code = error_code::none;
+        p.partition_index = model::partition_id(i);
+        p.leader_id = model::node_id(i % 3);
+        p.leader_epoch = kafka::leader_epoch(i + 1);
+        p.replica_nodes = {
+          model::node_id(0), model::node_id(1), model::node_id(2)};
+        p.isr_nodes = {model::node_id(i % 3)};
+        t.partitions.push_back(std::move(p));
+    }
+    return t;
+}
+
+metadata_response make_envelope() {
+    metadata_response r;
+    r.data.brokers.push_back(metadata_response::broker{
+      .node_id = model::node_id(0), .host = "localhost", .port = 9092});
+    r.data.cluster_id = "cluster";
+    r.data.controller_id = model::node_id(0);
+    r.data.cluster_authorized_operations = 0;
+    return r;
+}
+
+iobuf encode(metadata_response r, api_version version) {
+    iobuf out;
+    response_writer writer(out);
+    r.encode(writer, version);
+    return out;
+}
+
+metadata_response_cache::built_topic
+built(metadata_response::topic t, bool cacheable = true) {
+    return {.topic = std::move(t), .cacheable = cacheable};
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(encoded_response_matches_generated_encoding) {
+    std::vector<metadata_response::topic> topics{
+      make_topic("a", 1), make_topic("b", 5), make_topic("c", 0)};
+
+    for (api_version version = metadata_handler::min_supported;
+         version <= metadata_handler::max_supported;
+         ++version) {
+
+        auto expected = make_envelope();
+        expected.data.topics = topics;
+
+        iobuf encoded_topics;
+        for (auto t : topics) {
+            encoded_topics.append(
+              encode_metadata_response_topic(std::move(t), version));
+        }
+        auto envelope = make_envelope();
+        auto actual = encode_metadata_response(
+          envelope, version, std::move(encoded_topics), topics.size());
+
+        BOOST_REQUIRE_EQUAL(actual, encode(std::move(expected), version));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(cache_is_invalidated_by_versions) {
+    metadata_response_cache cache;
+    model::topic_namespace tp_ns(model::kafka_namespace, model::topic("a"));
+    const api_version version(7);
+    int builds = 0;
+    auto build = [&builds] {
+        ++builds;
+        return built(make_topic("a", 3));
+    };
+
+    iobuf first;
+    cache.append_topic(tp_ns, {.topic = 1, .leaders = 1}, version, first, build);
+    iobuf second;
+    cache.append_topic(
+      tp_ns, {.topic = 1, .leaders = 1}, version, second, build);
+    BOOST_REQUIRE_EQUAL(builds, 1);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 1);
+    BOOST_REQUIRE_EQUAL(first, second);
+
+    // blocks are kept per api version
+    iobuf other_version;
+    cache.append_topic(
+      tp_ns, {.topic = 1, .leaders = 1}, api_version(6), other_version, build);
+    BOOST_REQUIRE_EQUAL(builds, 2);
+
+    // leadership or topic change rebuilds the block
+    cache.append_topic(tp_ns, {.topic = 1, .leaders = 2}, version, first, build);
+    cache.append_topic(tp_ns, {.topic = 2, .leaders = 2}, version, first, build);
+    BOOST_REQUIRE_EQUAL(builds, 4);
+    BOOST_REQUIRE_EQUAL(cache.misses(), 4);
+    BOOST_REQUIRE_EQUAL(cache.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(non_cacheable_topics_are_always_built) {
+    metadata_response_cache cache;
+    model::topic_namespace tp_ns(model::kafka_namespace, model::topic("a"));
+    int builds = 0;
+    auto build = [&builds] {
+        ++builds;
+        return built(make_topic("a", 3), false);
+    };
+
+    for (int i = 0; i < 3; ++i) {
+        iobuf out;
+        cache.append_topic(
+          tp_ns, {.topic = 1, .leaders = 1}, api_version(7), out, build);
+        BOOST_REQUIRE_GT(out.size_bytes(), 0);
+    }
+    BOOST_REQUIRE_EQUAL(builds, 3);
+    BOOST_REQUIRE_EQUAL(cache.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(deleted_topics_are_evicted) {
+    metadata_response_cache cache;
+    model::topic_namespace a(model::kafka_namespace, model::topic("a"));
+    model::topic_namespace b(model::kafka_namespace, model::topic("b"));
+    for (const auto& tp_ns : {a, b}) {
+        iobuf out;
+        cache.append_topic(
+          tp_ns, {.topic = 1, .leaders = 1}, api_version(7), out, [&tp_ns] {
+              return built(make_topic(tp_ns.tp(), 1));
+          });
+    }
+    BOOST_REQUIRE_EQUAL(cache.size(), 2);
+
+    using delta = cluster::topic_table::delta;
+    cache.apply({delta(
+      model::ntp(a.ns, a.tp, model::partition_id(0)),
+      cluster::partition_assignment{},
+      model::offset(10),
+      delta::op_type::del)});
+    BOOST_REQUIRE_EQUAL(cache.size(), 1);
+}
@@ -0,0 +1,69 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "kafka/server/replica_selector.h"
+#include "model/fundamental.h"
+#include "model/metadata.h"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace kafka; // NOLINT
+
+namespace {
+
+replica_info
+follower(int id, const char* rack, int64_t match_index, bool in_sync = true) {
+    return replica_info{
+      .id = model::node_id(id),
+      .rack = model::rack_id(rack),
+      .match_index = model::offset(match_index),
+      .is_in_sync = in_sync};
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_consumer_in_leader_rack_fetches_from_leader) {
+    auto selected = select_preferred_read_replica(
+      model::rack_id("a"), model::rack_id("a"), {follower(1, "a", 100)});
+    BOOST_REQUIRE(!selected);
+}
+
+BOOST_AUTO_TEST_CASE(test_follower_of_consumer_rack_is_preferred) {
+    auto selected = select_preferred_read_replica(
+      model::rack_id("b"),
+      model::rack_id("a"),
+      {follower(1, "c", 100), follower(2, "b", 100)});
+    BOOST_REQUIRE(selected);
+    BOOST_REQUIRE_EQUAL(*selected, model::node_id(2));
+}
+
+BOOST_AUTO_TEST_CASE(test_most_caught_up_follower_is_preferred) {
+    auto selected = select_preferred_read_replica(
+      model::rack_id("b"),
+      model::rack_id("a"),
+      {follower(1, "b", 90), follower(2, "b", 100), follower(3, "b", 95)});
+    BOOST_REQUIRE(selected);
+    BOOST_REQUIRE_EQUAL(*selected, model::node_id(2));
+}
+
+BOOST_AUTO_TEST_CASE(test_out_of_sync_followers_are_not_selected) {
+    auto selected = select_preferred_read_replica(
+      model::rack_id("b"),
+      model::rack_id("a"),
+      {follower(1, "b", 100, false), follower(2, "c", 100)});
+    BOOST_REQUIRE(!selected);
+
+    // leader without a rack
+    selected = select_preferred_read_replica(
+      model::rack_id("b"),
+      std::nullopt,
+      {follower(1, "b", 100, false), follower(2, "b", 80)});
+    BOOST_REQUIRE(selected);
+    BOOST_REQUIRE_EQUAL(*selected, model::node_id(2));
+}
@@ -13,7 +13,13 @@
 #include "model/record.h"
 #include "reflection/adl.h"
 #include "utils/vint.h"
+#include "vassert.h"
 
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
 #include <type_traits>
 
 namespace model {
@@ -182,17 +188,21 @@ static inline void append_vint_to_iobuf(iobuf& b, int64_t v) {
 
 void append_record_to_buffer(iobuf& a, const model::record& r) {
     a.reserve_memory(vint::max_length * 6);
-    append_vint_to_iobuf(a, r.size_bytes());
-
-    const auto attrs = ss::cpu_to_be(r.attributes().value());
-    // NOLINTNEXTLINE
-    a.append(reinterpret_cast<const char*>(&attrs), sizeof(attrs));
 
-    append_vint_to_iobuf(a, r.timestamp_delta());
-    append_vint_to_iobuf(a, r.offset_delta());
+    // the fields preceding the key are encoded together and appended at once
+    std::array<uint8_t, sizeof(int8_t) + 4 * vint::max_length> prefix{};
+    const int64_t size = r.size_bytes();
+    size_t prefix_size = vint::serialize_many(&size, 1, prefix.data());
+    prefix[prefix_size++] = static_cast<uint8_t>(r.attributes().value());
+    const std::array<int64_t, 3> fields{
+      r.timestamp_delta(), r.offset_delta(), r.key_size()};
+    prefix_size += vint::serialize_many(
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      fields.data(), fields.size(), prefix.data() + prefix_size);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    a.append(reinterpret_cast<const char*>(prefix.data()), prefix_size);
 
     a.reserve_memory(r.key_size() + r.value_size());
-    append_vint_to_iobuf(a, r.key_size());
     if (r.key_size() > 0) {
         for (auto& f : r.key()) {
             a.append(f.get(), f.size());
@@ -224,4 +234,120 @@ void append_record_to_buffer(iobuf& a, const model::record& r) {
     }
 }
 
+/// Reads consecutive varints, all at once when they are in the current
+/// fragment
+template<size_t n>
+static std::array<int64_t, n> read_varlongs(iobuf_const_parser& parser) {
+    std::array<int64_t, n> values{};
+    const auto contiguous = parser.peek_contiguous();
+    const auto consumed = vint::deserialize_many(
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      reinterpret_cast<const uint8_t*>(contiguous.data()),
+      contiguous.size(),
+      values.data(),
+      n);
+    if (likely(consumed != 0)) {
+        parser.skip(consumed);
+        return values;
+    }
+    for (auto& v : values) {
+        v = parser.read_varlong().first;
+    }
+    return values;
+}
+
+static void skip_nullable(iobuf_const_parser& parser, int64_t size) {
+    if (size > 0) {
+        parser.skip(size);
+    }
+}
+
+std::vector<record_span>
+decode_record_spans(const iobuf& records, int32_t record_count) {
+    // size, attributes, deltas, key and value sizes and header count
+    constexpr size_t min_record_size = 7;
+    std::vector<record_span> spans;
+    // the count comes from the batch header, it is not trusted any more
+    // than the records
+    spans.reserve(std::min(
+      static_cast<size_t>(std::max(record_count, 0)),
+      records.size_bytes() / min_record_size));
+    iobuf_const_parser parser(records);
+    for (int32_t i = 0; i < record_count; ++i) {
+        record_span s{};
+        s.offset = parser.bytes_consumed();
+        auto [record_size, rv] = parser.read_varlong();
+        if (unlikely(record_size < 0)) {
+            throw std::out_of_range(
+              fmt::format("Record {} has a negative size", i));
+        }
+        s.size_bytes = rv + record_size;
+        s.attributes = parser.consume_type<int8_t>();
+
+        const auto [timestamp_delta, offset_delta, key_size]
+          = read_varlongs<3>(parser);
+        s.timestamp_delta = timestamp_delta;
+        s.offset_delta = static_cast<int32_t>(offset_delta);
+        s.key_size = static_cast<int32_t>(key_size);
+        s.key_offset = parser.bytes_consumed();
+        skip_nullable(parser, key_size);
+
+        const auto [value_size, vv] = parser.read_varlong();
+        s.value_size = static_cast<int32_t>(value_size);
+        s.value_offset = parser.bytes_consumed();
+        skip_nullable(parser, value_size);
+
+        const auto [header_count, hv] = parser.read_varlong();
+        s.header_count = static_cast<int32_t>(header_count);
+        s.headers_offset = parser.bytes_consumed();
+        for (int64_t h = 0; h < header_count; ++h) {
+            skip_nullable(parser, parser.read_varlong().first);
+            skip_nullable(parser, parser.read_varlong().first);
+        }
+
+        if (unlikely(parser.bytes_consumed() != s.offset + s.size_bytes)) {
+            throw std::out_of_range(fmt::format(
+              "Record {} spans {} bytes but its size is {}",
+              i,
+              parser.bytes_consumed() - s.offset,
+              s.size_bytes));
+        }
+        spans.push_back(s);
+    }
+    if (unlikely(parser.bytes_left())) {
+        throw std::out_of_range(fmt::format(
+          "Record iteration stopped with {} bytes remaining",
+          parser.bytes_left()));
+    }
+    return spans;
+}
+
+std::optional<std::pair<model::offset, model::timestamp>>
+find_first_record_at_or_after(const record_batch& b, model::timestamp t) {
+    vassert(!b.compressed(), "Cannot scan records of compressed batch {}", b);
+    const auto& hdr = b.header();
+    if (hdr.attrs.timestamp_type() == timestamp_type::append_time) {
+        // every record carries the batch max timestamp
+        if (hdr.max_timestamp >= t) {
+            return std::make_pair(hdr.base_offset, hdr.max_timestamp);
+        }
+        return std::nullopt;
+    }
+    iobuf_const_parser parser(b.data());
+    for (int32_t i = 0; i < hdr.record_count; ++i) {
+        auto [record_size, attr] = parse_record_meta_from_buffer(parser);
+        auto [timestamp_delta, tv] = parser.read_varlong();
+        auto [offset_delta, ov] = parser.read_varlong();
+        const auto ts = model::timestamp(
+          hdr.first_timestamp() + timestamp_delta);
+        if (ts >= t) {
+            return std::make_pair(
+              hdr.base_offset + model::offset(offset_delta), ts);
+        }
+        // record_size covers everything following the size itself
+        parser.skip(record_size - sizeof(attr) - tv - ov);
+    }
+    return std::nullopt;
+}
+
 } // namespace model
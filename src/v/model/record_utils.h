@@ -13,6 +13,12 @@
 
 #include "bytes/iobuf_parser.h"
 #include "hashing/crc32c.h"
+#include "model/fundamental.h"
+#include "model/timestamp.h"
+
+#include <optional>
+#include <utility>
+#include <vector>
 
 namespace model {
 
@@ -34,4 +40,36 @@ model::record parse_one_record_from_buffer(iobuf_parser& parser);
 model::record parse_one_record_copy_from_buffer(iobuf_const_parser& parser);
 void append_record_to_buffer(iobuf& a, const model::record& r);
 
+/// \brief framing of a record within the records of a batch. Offsets are
+/// relative to the beginning of the records, negative sizes are null.
+struct record_span {
+    size_t offset;
+    /// bytes of the record, its size included
+    size_t size_bytes;
+    int8_t attributes;
+    int64_t timestamp_delta;
+    int32_t offset_delta;
+    size_t key_offset;
+    int32_t key_size;
+    size_t value_offset;
+    int32_t value_size;
+    /// headers follow their count
+    size_t headers_offset;
+    int32_t header_count;
+};
+
+/// \brief decodes the framing of `record_count` uncompressed records in a
+/// single pass. Keys, values and headers are skipped rather than copied or
+/// shared, the varints preceding the key are decoded together. Throws
+/// std::out_of_range when a record doesn't match its size or when bytes
+/// follow the last one.
+std::vector<record_span>
+decode_record_spans(const iobuf& records, int32_t record_count);
+
+/// \brief offset and timestamp of the first record of an uncompressed batch
+/// whose timestamp is not lower than `t`. Only the record fields preceding
+/// the key are decoded, keys, values and headers are skipped.
+std::optional<std::pair<model::offset, model::timestamp>>
+find_first_record_at_or_after(const record_batch&, model::timestamp t);
+
 } // namespace model
@@ -11,6 +11,7 @@
 #include "model/record_utils.h"
 #include "model/tests/random_batch.h"
 #include "model/timestamp.h"
+#include "utils/vint.h"
 
 #include <seastar/testing/thread_test_case.hh>
 
@@ -78,3 +79,57 @@ SEASTAR_THREAD_TEST_CASE(set_max_timestamp) {
     BOOST_TEST(crc == batch.header().crc);
     BOOST_TEST(hdr_crc == batch.header().header_crc);
 }
+
+SEASTAR_THREAD_TEST_CASE(decode_record_spans_matches_records) {
+    auto batch = model::test::make_random_batch(model::offset(0), 50, false);
+    const auto spans = model::decode_record_spans(
+      batch.data(), batch.record_count());
+    const auto records = batch.copy_records();
+    auto data = batch.data().copy();
+    BOOST_REQUIRE_EQUAL(spans.size(), records.size());
+
+    size_t offset = 0;
+    for (size_t i = 0; i < spans.size(); ++i) {
+        const auto& s = spans[i];
+        const auto& r = records[i];
+        BOOST_REQUIRE_EQUAL(s.offset, offset);
+        BOOST_REQUIRE_EQUAL(
+          s.size_bytes, vint::vint_size(r.size_bytes()) + r.size_bytes());
+        BOOST_REQUIRE_EQUAL(s.attributes, r.attributes().value());
+        BOOST_REQUIRE_EQUAL(s.timestamp_delta, r.timestamp_delta());
+        BOOST_REQUIRE_EQUAL(s.offset_delta, r.offset_delta());
+        BOOST_REQUIRE_EQUAL(s.key_size, r.key_size());
+        BOOST_REQUIRE_EQUAL(s.value_size, r.value_size());
+        BOOST_REQUIRE_EQUAL(
+          s.header_count, static_cast<int32_t>(r.headers().size()));
+        if (r.key_size() > 0) {
+            BOOST_REQUIRE_EQUAL(
+              data.share(s.key_offset, s.key_size), r.key());
+        }
+        if (r.value_size() > 0) {
+            BOOST_REQUIRE_EQUAL(
+              data.share(s.value_offset, s.value_size), r.value());
+        }
+        offset += s.size_bytes;
+    }
+    BOOST_REQUIRE_EQUAL(offset, batch.data().size_bytes());
+}
+
+SEASTAR_THREAD_TEST_CASE(decode_record_spans_rejects_bad_framing) {
+    auto batch = model::test::make_random_batch(model::offset(0), 5, false);
+
+    // a missing record
+    BOOST_REQUIRE_THROW(
+      model::decode_record_spans(batch.data(), batch.record_count() + 1),
+      std::out_of_range);
+    // bytes after the last record
+    BOOST_REQUIRE_THROW(
+      model::decode_record_spans(batch.data(), batch.record_count() - 1),
+      std::out_of_range);
+    // a truncated record
+    auto data = batch.data().copy();
+    auto truncated = data.share(0, data.size_bytes() - 1);
+    BOOST_REQUIRE_THROW(
+      model::decode_record_spans(truncated, batch.record_count()),
+      std::out_of_range);
+}
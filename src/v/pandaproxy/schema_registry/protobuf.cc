@@ -244,9 +244,17 @@ make_canonical_protobuf_schema(sharded_store& store, unparsed_schema schema) {
        schema.def().type()},
       std::move(schema).refs()};
 
-    auto validated = co_await validate_protobuf_schema(store, temp);
-    co_return canonical_schema{
-      std::move(temp).sub(), std::move(validated), std::move(temp).refs()};
+    // The validation and compatibility checks that follow look the parsed
+    // schema up by its canonical form, cache it under that one
+    const auto generation = store.cache().generation();
+    valid_schema validated{
+      co_await make_protobuf_schema_definition(store, temp)};
+    canonical_schema canonical{
+      std::move(temp).sub(),
+      {validated.raw()(), schema_type::protobuf},
+      std::move(temp).refs()};
+    store.cache_valid_schema(generation, canonical, validated);
+    co_return canonical;
 }
 
 namespace {
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#include "pandaproxy/schema_registry/schema_cache.h"
+
+#include "hashing/xx.h"
+
+namespace pandaproxy::schema_registry {
+
+namespace {
+
+uint64_t hash_schema(const canonical_schema& schema, uint64_t seed) {
+    incremental_xxhash64 h{seed};
+    // Strings are length prefixed so that adjacent fields can't alias
+    auto update_str = [&h](std::string_view s) {
+        h.update(s.size());
+        h.update(s);
+    };
+    h.update(static_cast<int>(schema.type()));
+    update_str(schema.sub()());
+    update_str(schema.def().raw()());
+    h.update(schema.refs().size());
+    for (const auto& ref : schema.refs()) {
+        update_str(ref.name);
+        update_str(ref.sub());
+        h.update(ref.version());
+    }
+    return h.digest();
+}
+
+} // namespace
+
+schema_fingerprint make_schema_fingerprint(const canonical_schema& schema) {
+    // Verdicts are memoized by fingerprint only, two seeds make collisions
+    // between the schemas of a registry vanishingly unlikely.
+    return {
+      .lo = hash_schema(schema, 0), .hi = hash_schema(schema, 0x9e3779b9)};
+}
+
+schema_cache::schema_cache(size_t max_schemas, size_t max_verdicts)
+  : _schemas(max_schemas)
+  , _verdicts(max_verdicts) {}
+
+std::optional<valid_schema> schema_cache::get_schema(
+  const schema_fingerprint& fp, const canonical_schema& schema) {
+    auto* e = _schemas.get(fp);
+    if (e == nullptr || e->schema != schema) {
+        ++_misses;
+        return std::nullopt;
+    }
+    ++_hits;
+    return e->valid;
+}
+
+void schema_cache::put_schema(
+  uint64_t generation,
+  const schema_fingerprint& fp,
+  const canonical_schema& schema,
+  const valid_schema& valid) {
+    if (generation != _generation) {
+        return;
+    }
+    _schemas.put(fp, schema_entry{.schema = schema, .valid = valid});
+}
+
+std::optional<bool> schema_cache::get_verdict(
+  const schema_fingerprint& reader, const schema_fingerprint& writer) {
+    auto* v = _verdicts.get(verdict_key{.reader = reader, .writer = writer});
+    if (v == nullptr) {
+        ++_misses;
+        return std::nullopt;
+    }
+    ++_hits;
+    return *v;
+}
+
+void schema_cache::put_verdict(
+  uint64_t generation,
+  const schema_fingerprint& reader,
+  const schema_fingerprint& writer,
+  bool compatible) {
+    if (generation != _generation) {
+        return;
+    }
+    _verdicts.put(verdict_key{.reader = reader, .writer = writer}, compatible);
+}
+
+void schema_cache::clear_verdicts() {
+    ++_generation;
+    _verdicts.clear();
+}
+
+void schema_cache::clear() {
+    ++_generation;
+    _schemas.clear();
+    _verdicts.clear();
+}
+
+} // namespace pandaproxy::schema_registry
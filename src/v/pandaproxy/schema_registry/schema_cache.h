@@ -0,0 +1,196 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "pandaproxy/schema_registry/types.h"
+#include "utils/intrusive_list_helpers.h"
+
+#include <seastar/core/future.hh>
+
+#include <absl/container/node_hash_map.h>
+
+#include <optional>
+
+namespace pandaproxy::schema_registry {
+
+///\brief Identifies a canonical schema: its subject, definition, type and
+/// references.
+struct schema_fingerprint {
+    uint64_t lo{0};
+    uint64_t hi{0};
+
+    friend bool
+    operator==(const schema_fingerprint&, const schema_fingerprint&)
+      = default;
+
+    template<typename H>
+    friend H AbslHashValue(H h, const schema_fingerprint& fp) {
+        return H::combine(std::move(h), fp.lo, fp.hi);
+    }
+};
+
+schema_fingerprint make_schema_fingerprint(const canonical_schema& schema);
+
+namespace detail {
+
+///\brief A map bounded to `capacity` entries which evicts the least recently
+/// used entry.
+template<typename Key, typename Value>
+class lru_map {
+public:
+    explicit lru_map(size_t capacity)
+      : _capacity(capacity) {}
+    lru_map(const lru_map&) = delete;
+    lru_map& operator=(const lru_map&) = delete;
+    lru_map(lru_map&&) = delete;
+    lru_map& operator=(lru_map&&) = delete;
+    ~lru_map() = default;
+
+    ///\brief Return the value of `key` and mark it as the most recently used,
+    /// or nullptr if it is absent.
+    Value* get(const Key& key) {
+        auto it = _entries.find(key);
+        if (it == _entries.end()) {
+            return nullptr;
+        }
+        auto& e = it->second;
+        e._hook.unlink();
+        _lru.push_back(e);
+        return &e.value;
+    }
+
+    void put(Key key, Value value) {
+        auto [it, inserted] = _entries.try_emplace(
+          std::move(key), std::move(value));
+        auto& e = it->second;
+        if (inserted) {
+            e.key = &it->first;
+        } else {
+            e.value = std::move(value);
+            e._hook.unlink();
+        }
+        _lru.push_back(e);
+        while (_entries.size() > _capacity) {
+            auto& oldest = _lru.front();
+            _lru.pop_front();
+            _entries.erase(*oldest.key);
+        }
+    }
+
+    void clear() {
+        _lru.clear();
+        _entries.clear();
+    }
+
+    size_t size() const { return _entries.size(); }
+
+private:
+    struct entry {
+        explicit entry(Value v)
+          : value(std::move(v)) {}
+
+        Value value;
+        const Key* key{nullptr};
+        intrusive_list_hook _hook;
+    };
+
+    size_t _capacity;
+    absl::node_hash_map<Key, entry> _entries;
+    intrusive_list<entry, &entry::_hook> _lru;
+};
+
+} // namespace detail
+
+///\brief Shard local cache of parsed schemas and of compatibility verdicts.
+///
+/// Parsing a schema, and for protobuf building its descriptors along with
+/// those of its references, dominates the cost of registering a schema and of
+/// checking its compatibility, and the same few schemas are parsed over and
+/// over: a client registering a schema has it checked against the existing
+/// versions of the subject, which are parsed again on every registration.
+///
+/// Parsed schemas are kept by fingerprint of their canonical form and
+/// verified against it on lookup. The result of checking that a reader schema
+/// can read data written with a writer schema is memoized by the pair of
+/// fingerprints. Verdicts are dropped whenever a compatibility level changes,
+/// and everything is dropped when a subject or version is deleted or
+/// rewritten, since the same subject version may then refer to a different
+/// definition. Results computed across such a change are not inserted: the
+/// caller reads `generation()` before parsing and passes it back on insertion.
+class schema_cache {
+public:
+    static constexpr size_t default_max_schemas = 1000;
+    static constexpr size_t default_max_verdicts = 10000;
+
+    explicit schema_cache(
+      size_t max_schemas = default_max_schemas,
+      size_t max_verdicts = default_max_verdicts);
+
+    ss::future<> stop() { return ss::now(); }
+
+    ///\brief Return the parsed form of `schema` if it is cached.
+    std::optional<valid_schema>
+    get_schema(const schema_fingerprint& fp, const canonical_schema& schema);
+
+    void put_schema(
+      uint64_t generation,
+      const schema_fingerprint& fp,
+      const canonical_schema& schema,
+      const valid_schema& valid);
+
+    ///\brief Return whether `reader` was found able to read data written
+    /// with `writer`, if that was checked before.
+    std::optional<bool> get_verdict(
+      const schema_fingerprint& reader, const schema_fingerprint& writer);
+
+    void put_verdict(
+      uint64_t generation,
+      const schema_fingerprint& reader,
+      const schema_fingerprint& writer,
+      bool compatible);
+
+    void clear_verdicts();
+    void clear();
+
+    uint64_t generation() const { return _generation; }
+    size_t schemas() const { return _schemas.size(); }
+    size_t verdicts() const { return _verdicts.size(); }
+    uint64_t hits() const { return _hits; }
+    uint64_t misses() const { return _misses; }
+
+private:
+    struct schema_entry {
+        canonical_schema schema;
+        valid_schema valid;
+    };
+
+    struct verdict_key {
+        schema_fingerprint reader;
+        schema_fingerprint writer;
+
+        friend bool operator==(const verdict_key&, const verdict_key&)
+          = default;
+
+        template<typename H>
+        friend H AbslHashValue(H h, const verdict_key& k) {
+            return H::combine(std::move(h), k.reader, k.writer);
+        }
+    };
+
+    detail::lru_map<schema_fingerprint, schema_entry> _schemas;
+    detail::lru_map<verdict_key, bool> _verdicts;
+    uint64_t _generation{0};
+    uint64_t _hits{0};
+    uint64_t _misses{0};
+};
+
+} // namespace pandaproxy::schema_registry
@@ -58,10 +58,14 @@ bool check_compatible(const valid_schema& reader, const valid_schema& writer) {
 
 ss::future<> sharded_store::start(ss::smp_service_group sg) {
     _smp_opts = ss::smp_submit_to_options{sg};
-    return _store.start();
+    co_await _store.start();
+    co_await _cache.start();
 }
 
-ss::future<> sharded_store::stop() { return _store.stop(); }
+ss::future<> sharded_store::stop() {
+    co_await _cache.stop();
+    co_await _store.stop();
+}
 
 ss::future<canonical_schema>
 sharded_store::make_canonical_schema(unparsed_schema schema) {
@@ -82,35 +86,74 @@ sharded_store::make_canonical_schema(unparsed_schema schema) {
 }
 
 ss::future<> sharded_store::validate_schema(canonical_schema schema) {
-    switch (schema.type()) {
-    case schema_type::avro: {
-        co_await make_avro_schema_definition(*this, schema);
-        co_return;
-    }
-    case schema_type::protobuf:
-        co_await validate_protobuf_schema(*this, std::move(schema));
-        co_return;
-    case schema_type::json:
-        throw as_exception(invalid_schema_type(schema.type()));
-    }
-    __builtin_unreachable();
+    co_await make_valid_schema(std::move(schema));
 }
 
 ss::future<valid_schema>
 sharded_store::make_valid_schema(canonical_schema schema) {
+    const auto fp = make_schema_fingerprint(schema);
+    co_return co_await make_valid_schema(schema, fp);
+}
+
+ss::future<valid_schema> sharded_store::make_valid_schema(
+  const canonical_schema& schema, schema_fingerprint fp) {
+    auto& cache = _cache.local();
+    if (auto cached = cache.get_schema(fp, schema); cached.has_value()) {
+        co_return std::move(cached).value();
+    }
+    const auto generation = cache.generation();
+
     // This method seems to confuse clang 12.0.1
     // See #3596 for details, especially if modifying it.
+    std::optional<valid_schema> valid;
     switch (schema.type()) {
     case schema_type::avro: {
-        co_return co_await make_avro_schema_definition(*this, schema);
+        valid.emplace(co_await make_avro_schema_definition(*this, schema));
+        break;
     }
     case schema_type::protobuf: {
-        co_return co_await make_protobuf_schema_definition(*this, schema);
+        valid.emplace(co_await make_protobuf_schema_definition(*this, schema));
+        break;
     }
     case schema_type::json:
-        break;
+        throw as_exception(invalid_schema_type(schema.type()));
+    }
+    cache.put_schema(generation, fp, schema, *valid);
+    co_return std::move(valid).value();
+}
+
+void sharded_store::cache_valid_schema(
+  uint64_t generation,
+  const canonical_schema& schema,
+  const valid_schema& valid) {
+    _cache.local().put_schema(
+      generation, make_schema_fingerprint(schema), schema, valid);
+}
+
+ss::future<bool> sharded_store::check_compatible(
+  const canonical_schema& reader,
+  schema_fingerprint reader_fp,
+  const canonical_schema& writer,
+  schema_fingerprint writer_fp) {
+    auto& cache = _cache.local();
+    if (auto verdict = cache.get_verdict(reader_fp, writer_fp)) {
+        co_return *verdict;
     }
-    throw as_exception(invalid_schema_type(schema.type()));
+    const auto generation = cache.generation();
+    auto reader_valid = co_await make_valid_schema(reader, reader_fp);
+    auto writer_valid = co_await make_valid_schema(writer, writer_fp);
+    const bool compatible = schema_registry::check_compatible(
+      reader_valid, writer_valid);
+    cache.put_verdict(generation, reader_fp, writer_fp, compatible);
+    co_return compatible;
+}
+
+ss::future<> sharded_store::clear_cache() {
+    return _cache.invoke_on_all([](schema_cache& c) { c.clear(); });
+}
+
+ss::future<> sharded_store::clear_cached_verdicts() {
+    return _cache.invoke_on_all([](schema_cache& c) { c.clear_verdicts(); });
 }
 
 ss::future<sharded_store::insert_result>
@@ -311,10 +354,12 @@ ss::future<std::vector<schema_id>> sharded_store::referenced_by(
 ss::future<std::vector<schema_version>> sharded_store::delete_subject(
   seq_marker marker, subject sub, permanent_delete permanent) {
     auto sub_shard{shard_for(sub)};
-    co_return co_await _store.invoke_on(
+    auto versions = co_await _store.invoke_on(
       sub_shard, _smp_opts, [marker, sub{std::move(sub)}, permanent](store& s) {
           return s.delete_subject(marker, sub, permanent).value();
       });
+    co_await clear_cache();
+    co_return versions;
 }
 
 ss::future<is_deleted> sharded_store::is_subject_deleted(subject sub) {
@@ -355,10 +400,12 @@ sharded_store::get_subject_version_written_at(subject sub, schema_version ver) {
 ss::future<bool>
 sharded_store::delete_subject_version(subject sub, schema_version ver) {
     auto sub_shard{shard_for(sub)};
-    co_return co_await _store.invoke_on(
+    auto deleted = co_await _store.invoke_on(
       sub_shard, _smp_opts, [sub{std::move(sub)}, ver](store& s) {
           return s.delete_subject_version(sub, ver).value();
       });
+    co_await clear_cache();
+    co_return deleted;
 }
 
 ss::future<compatibility_level> sharded_store::get_compatibility() {
@@ -380,26 +427,32 @@ sharded_store::set_compatibility(compatibility_level compatibility) {
         return s.set_compatibility(compatibility).value();
     };
     auto reduce = std::logical_and<>{};
-    co_return co_await _store.map_reduce0(map, true, reduce);
+    auto updated = co_await _store.map_reduce0(map, true, reduce);
+    co_await clear_cached_verdicts();
+    co_return updated;
 }
 
 ss::future<bool> sharded_store::set_compatibility(
   seq_marker marker, subject sub, compatibility_level compatibility) {
     auto sub_shard{shard_for(sub)};
-    co_return co_await _store.invoke_on(
+    auto updated = co_await _store.invoke_on(
       sub_shard,
       _smp_opts,
       [marker, sub{std::move(sub)}, compatibility](store& s) {
           return s.set_compatibility(marker, sub, compatibility).value();
       });
+    co_await clear_cached_verdicts();
+    co_return updated;
 }
 
 ss::future<bool> sharded_store::clear_compatibility(subject sub) {
     auto sub_shard{shard_for(sub)};
-    co_return co_await _store.invoke_on(
+    auto cleared = co_await _store.invoke_on(
       sub_shard, _smp_opts, [sub{std::move(sub)}](store& s) {
           return s.clear_compatibility(sub).value();
       });
+    co_await clear_cached_verdicts();
+    co_return cleared;
 }
 
 ss::future<bool>
@@ -431,7 +484,7 @@ ss::future<bool> sharded_store::upsert_subject(
   schema_id id,
   is_deleted deleted) {
     auto sub_shard{shard_for(sub)};
-    co_return co_await _store.invoke_on(
+    auto inserted = co_await _store.invoke_on(
       sub_shard,
       _smp_opts,
       [marker,
@@ -443,6 +496,12 @@ ss::future<bool> sharded_store::upsert_subject(
           return s.upsert_subject(
             marker, std::move(sub), std::move(refs), version, id, deleted);
       });
+    if (!inserted) {
+        // An existing version was rewritten, schemas referencing it may have
+        // been parsed against its previous definition
+        co_await clear_cache();
+    }
+    co_return inserted;
 }
 
 /// \brief Get the schema ID to be used for next insert
@@ -525,7 +584,7 @@ ss::future<bool> sharded_store::is_compatible(
         ver_it = versions.begin();
     }
 
-    auto new_valid = co_await make_valid_schema(new_schema);
+    const auto new_fp = make_schema_fingerprint(new_schema);
 
     auto is_compat = true;
     for (; is_compat && ver_it != versions.end(); ++ver_it) {
@@ -535,21 +594,25 @@ ss::future<bool> sharded_store::is_compatible(
 
         auto old_schema = co_await get_subject_schema(
           sub, ver_it->version, include_deleted::no);
-        auto old_valid = co_await make_valid_schema(old_schema.schema);
+        const auto old_fp = make_schema_fingerprint(old_schema.schema);
 
         if (
           compat == compatibility_level::backward
           || compat == compatibility_level::backward_transitive
           || compat == compatibility_level::full
           || compat == compatibility_level::full_transitive) {
-            is_compat = is_compat && check_compatible(new_valid, old_valid);
+            is_compat = is_compat
+                        && co_await check_compatible(
+                          new_schema, new_fp, old_schema.schema, old_fp);
         }
         if (
           compat == compatibility_level::forward
           || compat == compatibility_level::forward_transitive
           || compat == compatibility_level::full
           || compat == compatibility_level::full_transitive) {
-            is_compat = is_compat && check_compatible(old_valid, new_valid);
+            is_compat = is_compat
+                        && co_await check_compatible(
+                          old_schema.schema, old_fp, new_schema, new_fp);
         }
     }
     co_return is_compat;
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "pandaproxy/schema_registry/schema_cache.h"
 #include "pandaproxy/schema_registry/types.h"
 
 #include <seastar/core/sharded.hh>
@@ -124,7 +125,30 @@ public:
     ss::future<bool>
     is_compatible(schema_version version, canonical_schema new_schema);
 
+    ///\brief The parsed schema and compatibility cache of this shard.
+    const schema_cache& cache() const { return _cache.local(); }
+
+    ///\brief Cache `valid`, parsed from a definition of `schema` before it
+    /// was made canonical, unless the cache was cleared since `generation`.
+    void cache_valid_schema(
+      uint64_t generation,
+      const canonical_schema& schema,
+      const valid_schema& valid);
+
 private:
+    ss::future<valid_schema>
+    make_valid_schema(const canonical_schema& schema, schema_fingerprint fp);
+
+    ///\brief Check that `reader` can read data written with `writer`.
+    ss::future<bool> check_compatible(
+      const canonical_schema& reader,
+      schema_fingerprint reader_fp,
+      const canonical_schema& writer,
+      schema_fingerprint writer_fp);
+
+    ss::future<> clear_cache();
+    ss::future<> clear_cached_verdicts();
+
     ss::future<bool>
     upsert_schema(schema_id id, canonical_schema_definition def);
 
@@ -149,6 +173,7 @@ private:
 
     ss::smp_submit_to_options _smp_opts;
     ss::sharded<store> _store;
+    ss::sharded<schema_cache> _cache;
 
     ///\brief Access must occur only on shard 0.
     schema_id _next_schema_id{1};
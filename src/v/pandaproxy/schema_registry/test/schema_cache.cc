@@ -0,0 +1,167 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "pandaproxy/schema_registry/schema_cache.h"
+
+#include "pandaproxy/schema_registry/sharded_store.h"
+#include "pandaproxy/schema_registry/test/compatibility_avro.h"
+#include "pandaproxy/schema_registry/types.h"
+
+#include <seastar/testing/thread_test_case.hh>
+#include <seastar/util/defer.hh>
+
+#include <boost/test/unit_test.hpp>
+
+namespace pp = pandaproxy;
+namespace pps = pp::schema_registry;
+
+SEASTAR_THREAD_TEST_CASE(test_schema_cache_lru) {
+    pps::detail::lru_map<int, int> lru(2);
+    lru.put(1, 10);
+    lru.put(2, 20);
+    // 1 becomes the most recently used, 2 is evicted
+    BOOST_REQUIRE_EQUAL(*lru.get(1), 10);
+    lru.put(3, 30);
+    BOOST_REQUIRE_EQUAL(lru.size(), 2);
+    BOOST_REQUIRE(lru.get(2) == nullptr);
+    BOOST_REQUIRE_EQUAL(*lru.get(3), 30);
+
+    // overwriting refreshes the entry
+    lru.put(1, 11);
+    lru.put(4, 40);
+    BOOST_REQUIRE(lru.get(3) == nullptr);
+    BOOST_REQUIRE_EQUAL(*lru.get(1), 11);
+
+    lru.clear();
+    BOOST_REQUIRE_EQUAL(lru.size(), 0);
+    BOOST_REQUIRE(lru.get(1) == nullptr);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_schema_cache_fingerprint) {
+    const pps::subject sub{"sub"};
+    const pps::canonical_schema s1{sub, schema1};
+    BOOST_REQUIRE(
+      pps::make_schema_fingerprint(s1)
+      == pps::make_schema_fingerprint(pps::canonical_schema{sub, schema1}));
+    BOOST_REQUIRE(
+      pps::make_schema_fingerprint(s1)
+      != pps::make_schema_fingerprint(pps::canonical_schema{sub, schema2}));
+    BOOST_REQUIRE(
+      pps::make_schema_fingerprint(s1)
+      != pps::make_schema_fingerprint(
+        pps::canonical_schema{pps::subject{"other"}, schema1}));
+    BOOST_REQUIRE(
+      pps::make_schema_fingerprint(s1)
+      != pps::make_schema_fingerprint(pps::canonical_schema{
+        sub, schema1, {{"ref", pps::subject{"ref"}, pps::schema_version{1}}}}));
+}
+
+SEASTAR_THREAD_TEST_CASE(test_schema_cache_compatibility) {
+    pps::sharded_store s;
+    s.start(ss::default_smp_service_group()).get();
+    auto stop_store = ss::defer([&s]() { s.stop().get(); });
+
+    pps::seq_marker dummy_marker;
+    const pps::subject sub{"sub"};
+    s.set_compatibility(pps::compatibility_level::backward).get();
+    s.upsert(
+       dummy_marker,
+       {sub, schema1},
+       pps::schema_id{1},
+       pps::schema_version{1},
+       pps::is_deleted::no)
+      .get();
+
+    const auto& cache = s.cache();
+    BOOST_REQUIRE(
+      s.is_compatible(pps::schema_version{1}, {sub, schema2}).get());
+    BOOST_REQUIRE_EQUAL(cache.schemas(), 2);
+    BOOST_REQUIRE_EQUAL(cache.verdicts(), 1);
+
+    // the verdict is memoized, nothing is parsed again
+    const auto hits = cache.hits();
+    const auto misses = cache.misses();
+    BOOST_REQUIRE(
+      s.is_compatible(pps::schema_version{1}, {sub, schema2}).get());
+    BOOST_REQUIRE_EQUAL(cache.hits(), hits + 1);
+    BOOST_REQUIRE_EQUAL(cache.misses(), misses);
+
+    // parsed schemas survive a change of compatibility level, verdicts don't
+    s.set_compatibility(pps::compatibility_level::forward).get();
+    BOOST_REQUIRE_EQUAL(cache.schemas(), 2);
+    BOOST_REQUIRE_EQUAL(cache.verdicts(), 0);
+    BOOST_REQUIRE(
+      s.is_compatible(pps::schema_version{1}, {sub, schema3}).get());
+    BOOST_REQUIRE_EQUAL(cache.verdicts(), 1);
+
+    s.set_compatibility(dummy_marker, sub, pps::compatibility_level::backward)
+      .get();
+    BOOST_REQUIRE_EQUAL(cache.verdicts(), 0);
+
+    // deleting drops everything
+    s.is_compatible(pps::schema_version{1}, {sub, schema2}).get();
+    s.upsert(
+       dummy_marker,
+       {sub, schema1},
+       pps::schema_id{1},
+       pps::schema_version{1},
+       pps::is_deleted::yes)
+      .get();
+    BOOST_REQUIRE_EQUAL(cache.schemas(), 0);
+    BOOST_REQUIRE_EQUAL(cache.verdicts(), 0);
+
+    s.make_valid_schema({sub, schema1}).get();
+    BOOST_REQUIRE_EQUAL(cache.schemas(), 1);
+    s.delete_subject_version(sub, pps::schema_version{1}).get();
+    BOOST_REQUIRE_EQUAL(cache.schemas(), 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_schema_cache_invalid_schema) {
+    pps::sharded_store s;
+    s.start(ss::default_smp_service_group()).get();
+    auto stop_store = ss::defer([&s]() { s.stop().get(); });
+
+    // failures to parse are not cached
+    const pps::canonical_schema invalid{
+      pps::subject{"sub"},
+      pps::canonical_schema_definition{
+        R"({"type":"record","name":"r","fields":[{"type":"nope","name":"f"}]})",
+        pps::schema_type::avro}};
+    for (int i = 0; i < 2; ++i) {
+        BOOST_REQUIRE_THROW(
+          s.validate_schema(invalid).get(), pps::exception_base);
+    }
+    BOOST_REQUIRE_EQUAL(s.cache().schemas(), 0);
+    BOOST_REQUIRE_EQUAL(s.cache().misses(), 2);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_schema_cache_canonical_protobuf) {
+    pps::sharded_store s;
+    s.start(ss::default_smp_service_group()).get();
+    auto stop_store = ss::defer([&s]() { s.stop().get(); });
+
+    // the parsed schema is cached under its canonical form, not the text it
+    // was parsed from
+    const pps::unparsed_schema unparsed{
+      pps::subject{"sub"},
+      pps::unparsed_schema_definition{
+        R"(syntax =   "proto3";
+// not part of the canonical form
+message Simple {   string id = 1; })",
+        pps::schema_type::protobuf}};
+    auto canonical = s.make_canonical_schema(unparsed).get();
+    BOOST_REQUIRE_NE(canonical.def().raw()(), unparsed.def().raw()());
+    BOOST_REQUIRE_EQUAL(s.cache().schemas(), 1);
+
+    const auto hits = s.cache().hits();
+    const auto misses = s.cache().misses();
+    s.validate_schema(canonical).get();
+    BOOST_REQUIRE_EQUAL(s.cache().hits(), hits + 1);
+    BOOST_REQUIRE_EQUAL(s.cache().misses(), misses);
+}
@@ -0,0 +1,102 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "pandaproxy/schema_registry/avro.h"
+#include "pandaproxy/schema_registry/sharded_store.h"
+#include "pandaproxy/schema_registry/types.h"
+#include "ssx/sformat.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+#include <vector>
+
+namespace pps = pandaproxy::schema_registry;
+
+namespace {
+
+constexpr int field_count = 500;
+constexpr int version_count = 5;
+
+/// A record with `fields` string fields, each version adds a defaulted field
+/// so that every version is backward compatible with the previous ones.
+pps::canonical_schema_definition make_schema(int fields) {
+    ss::sstring def = R"({"type":"record","name":"large","fields":[)";
+    for (int i = 0; i < fields; ++i) {
+        def += ssx::sformat(
+          R"({}{{"type":"string","name":"field_{}","default":"v{}"}})",
+          i == 0 ? "" : ",",
+          i,
+          i);
+    }
+    def += "]}";
+    return pps::sanitize_avro_schema_definition(
+             {std::move(def), pps::schema_type::avro})
+      .value();
+}
+
+/**
+ * A subject with a history of large schemas with a transitive compatibility
+ * level: registering a schema checks it against every version.
+ */
+struct schema_registry_fixture {
+    schema_registry_fixture() {
+        store.start(ss::default_smp_service_group()).get();
+        store.set_compatibility(pps::compatibility_level::backward_transitive)
+          .get();
+        for (int v = 1; v <= version_count; ++v) {
+            pps::canonical_schema schema{sub, make_schema(field_count + v)};
+            store
+              .upsert(
+                pps::seq_marker{},
+                schema,
+                pps::schema_id{v},
+                pps::schema_version{v},
+                pps::is_deleted::no)
+              .get();
+            versions.push_back(std::move(schema));
+        }
+    }
+    schema_registry_fixture(const schema_registry_fixture&) = delete;
+    schema_registry_fixture& operator=(const schema_registry_fixture&)
+      = delete;
+    schema_registry_fixture(schema_registry_fixture&&) = delete;
+    schema_registry_fixture& operator=(schema_registry_fixture&&) = delete;
+    ~schema_registry_fixture() { store.stop().get(); }
+
+    pps::subject sub{"large-value"};
+    pps::sharded_store store;
+    std::vector<pps::canonical_schema> versions;
+};
+
+} // namespace
+
+// Registration of an already registered schema, as done by producers on
+// startup: validation and compatibility checks are served by the cache.
+PERF_TEST_F(schema_registry_fixture, register_existing_cached) {
+    auto schema = versions.back();
+    perf_tests::start_measuring_time();
+    auto res = store.project_ids(std::move(schema)).get();
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(res);
+}
+
+// The same work done without the cache: parse the schema being registered and
+// every version of the subject, then check compatibility against each one.
+PERF_TEST_F(schema_registry_fixture, register_existing_uncached) {
+    auto schema = versions.back();
+    perf_tests::start_measuring_time();
+    auto valid = pps::make_avro_schema_definition(store, schema).get();
+    bool compat = true;
+    for (const auto& v : versions) {
+        auto old = pps::make_avro_schema_definition(store, v).get();
+        compat = compat && pps::check_compatible(valid, old);
+    }
+    perf_tests::stop_measuring_time();
+    perf_tests::do_not_optimize(compat);
+}
@@ -12,6 +12,7 @@
 #include <seastar/util/variant_utils.hh>
 
 #include <exception>
+#include <optional>
 #include <variant>
 #include <vector>
 namespace raft {
@@ -49,6 +50,8 @@ ss::future<> append_entries_buffer::stop() {
     // wait for gate to be closed so all the pending requests will finish before
     // we invalidate pending promisses
     co_await std::move(f);
+    // replies of appended requests are propagated once their flush completes
+    co_await std::exchange(_replies_propagated, ss::now());
     auto response_promises = std::exchange(_responses, {});
     // set errors
     for (auto& p : response_promises) {
@@ -93,7 +96,7 @@ ss::future<> append_entries_buffer::do_flush(
   request_t requests, response_t response_promises, ss::semaphore_units<> u) {
     bool needs_flush = false;
     std::vector<reply_t> replies;
-    auto f = ss::now();
+    std::optional<ss::future<model::offset>> f;
     {
         ss::semaphore_units<> op_lock_units = std::move(u);
         replies.reserve(requests.size());
@@ -111,20 +114,62 @@ ss::future<> append_entries_buffer::do_flush(
             }
         }
         if (needs_flush) {
-            f = _consensus.flush_log();
+            f = _consensus.group_commit_flush_log();
+        } else {
+            f = ss::make_ready_future<model::offset>(
+              _consensus._flushed_offset);
         }
     }
 
+    if (_consensus._group_commit) {
+        /**
+         * The group commit flushes the log of a group once per round. The
+         * buffer keeps appending requests while the flush is pending so that
+         * all the requests appended meanwhile share the next flush of the
+         * group. Replies are propagated in the order of the requests.
+         */
+        _replies_propagated = propagate_after_flush(
+          std::exchange(_replies_propagated, ss::now()),
+          std::move(*f),
+          std::move(replies),
+          std::move(response_promises));
+        _flushed.broadcast();
+        co_return;
+    }
+
     // units were released before flushing log
-    co_await std::move(f);
+    auto flushed = co_await std::move(*f);
 
-    propagate_results(std::move(replies), std::move(response_promises));
+    propagate_results(
+      std::move(replies), std::move(response_promises), flushed);
     _flushed.broadcast();
     co_return;
 }
 
+ss::future<> append_entries_buffer::propagate_after_flush(
+  ss::future<> previous,
+  ss::future<model::offset> flushed,
+  std::vector<reply_t> replies,
+  response_t response_promises) {
+    co_await std::move(previous);
+    model::offset flushed_offset;
+    try {
+        flushed_offset = co_await std::move(flushed);
+    } catch (...) {
+        auto e = std::current_exception();
+        for (auto& p : response_promises) {
+            p.set_exception(e);
+        }
+        co_return;
+    }
+    propagate_results(
+      std::move(replies), std::move(response_promises), flushed_offset);
+}
+
 void append_entries_buffer::propagate_results(
-  std::vector<reply_t> replies, response_t response_promises) {
+  std::vector<reply_t> replies,
+  response_t response_promises,
+  model::offset flushed_offset) {
     vassert(
       replies.size() == response_promises.size(),
       "Number of requests and response promiseshave to be equal. Have {} "
@@ -135,11 +180,12 @@ void append_entries_buffer::propagate_results(
     for (auto& reply : replies) {
         ss::visit(
           reply,
-          [&resp_it, this](append_entries_reply r) {
+          [&resp_it, flushed_offset](append_entries_reply r) {
               // this is important, we want to update response committed
               // offset here as we flushed after the response structure was
-              // created
-              r.last_flushed_log_index = _consensus._flushed_offset;
+              // created. The offset is the one flushed for these requests,
+              // the log may have been flushed further meanwhile.
+              r.last_flushed_log_index = flushed_offset;
               resp_it->set_value(r);
           },
           [&resp_it](std::exception_ptr& e) {
@@ -3,6 +3,7 @@
 #include "raft/types.h"
 
 #include <seastar/core/condition-variable.hh>
+#include <seastar/core/future.hh>
 #include <seastar/core/gate.hh>
 #include <seastar/core/semaphore.hh>
 
@@ -139,7 +140,14 @@ private:
     ss::future<> flush();
     ss::future<> do_flush(request_t, response_t, ss::semaphore_units<>);
 
-    void propagate_results(std::vector<reply_t>, response_t);
+    /// replies carry `flushed_offset`, the offset flushed for their requests
+    void propagate_results(
+      std::vector<reply_t>, response_t, model::offset flushed_offset);
+    ss::future<> propagate_after_flush(
+      ss::future<> previous,
+      ss::future<model::offset> flushed,
+      std::vector<reply_t>,
+      response_t);
 
     consensus& _consensus;
     request_t _requests;
@@ -147,6 +155,8 @@ private:
     ss::condition_variable _enqueued;
     ss::gate _gate;
     ss::condition_variable _flushed;
+    // replies waiting for a pending group commit flush
+    ss::future<> _replies_propagated = ss::now();
     const size_t _max_buffered;
 };
 
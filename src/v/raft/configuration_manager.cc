@@ -311,14 +311,11 @@ ss::future<>
 configuration_manager::start(bool reset, model::revision_id initial_revision) {
     _initial_revision = initial_revision;
     if (reset) {
-        return _storage.kvs()
-          .remove(
-            storage::kvstore::key_space::consensus, configurations_map_key())
-          .then([this] {
-              return _storage.kvs().remove(
-                storage::kvstore::key_space::consensus,
-                highest_known_offset_key());
-          });
+        std::vector<storage::kvstore::write_op> ops;
+        ops.emplace_back(configurations_map_key(), std::nullopt);
+        ops.emplace_back(highest_known_offset_key(), std::nullopt);
+        return _storage.kvs().write_batch(
+          storage::kvstore::key_space::consensus, std::move(ops));
     }
 
     auto map_buf = _storage.kvs().get(
@@ -33,6 +33,7 @@
 #include "rpc/types.h"
 #include "ssx/future-util.h"
 #include "storage/api.h"
+#include "units.h"
 #include "vlog.h"
 
 #include <seastar/core/condition-variable.hh>
@@ -96,7 +97,8 @@ consensus::consensus(
   storage::api& storage,
   std::optional<std::reference_wrapper<recovery_throttle>> recovery_throttle,
   recovery_memory_quota& recovery_mem_quota,
-  raft_feature_table& ft)
+  raft_feature_table& ft,
+  std::optional<std::reference_wrapper<group_commit_coordinator>> group_commit)
   : _self(nid, initial_cfg.revision_id())
   , _group(group)
   , _jit(std::move(jit))
@@ -110,10 +112,7 @@ consensus::consensus(
   , _disk_timeout(disk_timeout)
   , _client_protocol(client)
   , _leader_notification(std::move(cb))
-  , _fstats(
-      _self,
-      config::shard_local_cfg()
-        .raft_max_concurrent_append_requests_per_follower())
+  , _fstats(_self, make_pipeline_config())
   , _batcher(this, config::shard_local_cfg().raft_replicate_batch_window_size())
   , _event_manager(this)
   , _ctxlog(group, _log.config().ntp())
@@ -127,6 +126,7 @@ consensus::consensus(
   , _recovery_throttle(recovery_throttle)
   , _recovery_mem_quota(recovery_mem_quota)
   , _features(ft)
+  , _group_commit(group_commit)
   , _snapshot_mgr(
       std::filesystem::path(_log.config().work_directory()),
       storage::simple_snapshot_manager::default_snapshot_filename,
@@ -141,6 +141,24 @@ consensus::consensus(
     });
 }
 
+pipeline_controller::config consensus::make_pipeline_config() {
+    const auto& cfg = config::shard_local_cfg();
+    const auto depth = cfg.raft_max_concurrent_append_requests_per_follower();
+    if (!cfg.raft_adaptive_append_pipelining()) {
+        return pipeline_controller::fixed(depth);
+    }
+    const auto max_depth = std::max(
+      depth, cfg.raft_adaptive_append_pipeline_max_depth());
+    const auto max_batch = cfg.raft_recovery_default_read_size();
+    return pipeline_controller::config{
+      .initial_depth = depth,
+      .min_depth = 1,
+      .max_depth = max_depth,
+      .min_batch_bytes = std::min<size_t>(32_KiB, max_batch),
+      .max_batch_bytes = max_batch,
+    };
+}
+
 void consensus::setup_metrics() {
     namespace sm = ss::metrics;
 
@@ -149,6 +167,7 @@ void consensus::setup_metrics() {
     }
 
     _probe.setup_metrics(_log.config().ntp());
+    _fstats.setup_metrics(_log.config().ntp());
     auto labels = probe::create_metric_labels(_log.config().ntp());
     auto aggregate_labels = config::shard_local_cfg().aggregate_metrics()
                               ? std::vector<sm::label>{sm::shard_label}
@@ -731,7 +750,9 @@ replicate_stages consensus::do_replicate(
     }
 
     return wrap_stages_with_gate(
-      _bg, _batcher.replicate(expected_term, std::move(rdr), opts.consistency));
+      _bg,
+      _batcher.replicate(
+        expected_term, std::move(rdr), opts.consistency, std::move(opts.trace)));
 }
 
 ss::future<model::record_batch_reader>
@@ -1825,6 +1846,36 @@ ss::future<> consensus::hydrate_snapshot() {
       });
 }
 
+ss::future<std::optional<consensus::snapshot_data>>
+consensus::read_snapshot_data() {
+    auto reader = co_await _snapshot_mgr.open_snapshot();
+    if (!reader) {
+        co_return std::nullopt;
+    }
+
+    std::optional<snapshot_data> ret;
+    std::exception_ptr ex;
+    try {
+        auto parser = iobuf_parser(co_await reader->read_metadata());
+        auto metadata = reflection::adl<snapshot_metadata>{}.from(parser);
+        // reads the snapshot blob up to the end of the file
+        auto size = co_await reader->get_snapshot_size();
+        auto data = co_await read_iobuf_exactly(reader->input(), size);
+        ret = snapshot_data{
+          .last_included_index = metadata.last_included_index,
+          .data = std::move(data),
+        };
+    } catch (...) {
+        ex = std::current_exception();
+    }
+
+    co_await reader->close();
+    if (ex) {
+        std::rethrow_exception(ex);
+    }
+    co_return ret;
+}
+
 ss::future<> consensus::truncate_to_latest_snapshot() {
     // we have to prefix truncate config manage at exactly last offset included
     // in snapshot as this is the offset of configuration included in snapshot
@@ -2174,6 +2225,13 @@ append_entries_reply consensus::make_append_entries_reply(
     return reply;
 }
 
+ss::future<model::offset> consensus::group_commit_flush_log() {
+    if (_group_commit) {
+        return _group_commit->get().flush(*this);
+    }
+    return flush_log().then([this] { return _flushed_offset; });
+}
+
 ss::future<> consensus::flush_log() {
     if (!_has_pending_flushes) {
         return ss::now();
@@ -2181,29 +2239,46 @@ ss::future<> consensus::flush_log() {
     _probe.log_flushed();
     _has_pending_flushes = false;
     auto flushed_up_to = _log.offsets().dirty_offset;
-    return _log.flush().then([this, flushed_up_to] {
-        auto lstats = _log.offsets();
-        /**
-         * log flush may be interleaved with trucation, hence we need to check
-         * if log was truncated, if so we do nothing, flushed offset will be
-         * updated in the truncation path.
-         */
-        if (flushed_up_to > lstats.dirty_offset) {
-            return;
-        }
+    return _log.flush().then(
+      [this, flushed_up_to] { update_flushed_offset(flushed_up_to); });
+}
 
-        _flushed_offset = std::max(flushed_up_to, _flushed_offset);
-        vlog(_ctxlog.trace, "flushed offset updated: {}", _flushed_offset);
-        // TODO: remove this assertion when we will remove committed_offset
-        // from storage.
-        vassert(
-          lstats.committed_offset >= _flushed_offset,
-          "Raft incorrectly tracking flushed log offset. Expected offset: {}, "
-          " current log offsets: {}, log: {}",
-          _flushed_offset,
-          lstats,
-          _log);
-    });
+ss::future<ss::noncopyable_function<void()>> consensus::write_out_log() {
+    if (!_has_pending_flushes) {
+        co_return [] {};
+    }
+    _probe.log_flushed();
+    _has_pending_flushes = false;
+    auto flushed_up_to = _log.offsets().dirty_offset;
+    auto mark_synced = co_await _log.write_out();
+    co_return [this, flushed_up_to, mark_synced = std::move(mark_synced)] {
+        mark_synced();
+        update_flushed_offset(flushed_up_to);
+    };
+}
+
+void consensus::update_flushed_offset(model::offset flushed_up_to) {
+    auto lstats = _log.offsets();
+    /**
+     * log flush may be interleaved with trucation, hence we need to check
+     * if log was truncated, if so we do nothing, flushed offset will be
+     * updated in the truncation path.
+     */
+    if (flushed_up_to > lstats.dirty_offset) {
+        return;
+    }
+
+    _flushed_offset = std::max(flushed_up_to, _flushed_offset);
+    vlog(_ctxlog.trace, "flushed offset updated: {}", _flushed_offset);
+    // TODO: remove this assertion when we will remove committed_offset
+    // from storage.
+    vassert(
+      lstats.committed_offset >= _flushed_offset,
+      "Raft incorrectly tracking flushed log offset. Expected offset: {}, "
+      " current log offsets: {}, log: {}",
+      _flushed_offset,
+      lstats,
+      _log);
 }
 
 ss::future<storage::append_result> consensus::disk_append(
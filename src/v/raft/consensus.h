@@ -20,6 +20,7 @@
 #include "raft/consensus_utils.h"
 #include "raft/event_manager.h"
 #include "raft/follower_stats.h"
+#include "raft/group_commit_coordinator.h"
 #include "raft/group_configuration.h"
 #include "raft/logger.h"
 #include "raft/mutex_buffer.h"
@@ -95,7 +96,8 @@ public:
       storage::api&,
       std::optional<std::reference_wrapper<recovery_throttle>>,
       recovery_memory_quota&,
-      raft_feature_table&);
+      raft_feature_table&,
+      std::optional<std::reference_wrapper<group_commit_coordinator>>);
 
     /// Initial call. Allow for internal state recovery
     ss::future<> start();
@@ -170,6 +172,21 @@ public:
      */
     ss::future<> write_snapshot(write_snapshot_cfg);
 
+    struct snapshot_data {
+        // last offset included in the snapshot
+        model::offset last_included_index;
+        // state machine part of the snapshot
+        iobuf data;
+    };
+    /**
+     * \brief Reads the state machine data of the current snapshot
+     *
+     * Returns the data passed to write_snapshot or received with
+     * install_snapshot, used by state machines to recover the state of the
+     * log prefix that was truncated.
+     */
+    ss::future<std::optional<snapshot_data>> read_snapshot_data();
+
     /// Increment and returns next append_entries order tracking sequence for
     /// follower with given node id
     follower_req_seq next_follower_sequence(vnode);
@@ -367,6 +384,12 @@ public:
      */
     void unblock_new_leadership() { _node_priority_override.reset(); }
 
+    /// Drops the follower state the leader only needs while replicating, for
+    /// followers nothing was replicated to for `idle_timeout`.
+    void release_idle_follower_state(std::chrono::milliseconds idle_timeout) {
+        _fstats.release_idle_pipelines(idle_timeout);
+    }
+
 private:
     friend replicate_entries_stm;
     friend vote_stm;
@@ -375,6 +398,7 @@ private:
     friend replicate_batcher;
     friend event_manager;
     friend append_entries_buffer;
+    friend group_commit_coordinator;
     using update_last_quorum_index
       = ss::bool_class<struct update_last_quorum_index>;
     // all these private functions assume that we are under exclusive operations
@@ -458,6 +482,15 @@ private:
 
     /// \brief _does not_ hold the lock.
     ss::future<> flush_log();
+    /// Flushes the log as a part of the shard wide group commit, if there is
+    /// one, or immediately otherwise. Resolves with the flushed offset right
+    /// after the flush.
+    ss::future<model::offset> group_commit_flush_log();
+    /// flush_log() split around a sync of the whole filesystem: writes out the
+    /// log and resolves with a function to call once the filesystem was
+    /// synced, see storage::log::write_out.
+    ss::future<ss::noncopyable_function<void()>> write_out_log();
+    void update_flushed_offset(model::offset flushed_up_to);
 
     void maybe_step_down();
 
@@ -465,6 +498,8 @@ private:
 
     void setup_metrics();
 
+    static pipeline_controller::config make_pipeline_config();
+
     bytes voted_for_key() const {
         return raft::details::serialize_group_key(
           _group, metadata_key::voted_for);
@@ -635,6 +670,8 @@ private:
     std::optional<std::reference_wrapper<recovery_throttle>> _recovery_throttle;
     recovery_memory_quota& _recovery_mem_quota;
     raft_feature_table& _features;
+    std::optional<std::reference_wrapper<group_commit_coordinator>>
+      _group_commit;
     storage::simple_snapshot_manager _snapshot_mgr;
     std::optional<storage::snapshot_writer> _snapshot_writer;
     model::offset _last_snapshot_index;
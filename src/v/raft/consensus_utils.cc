@@ -543,4 +543,28 @@ ss::future<> bootstrap_pre_existing_partition(
       initial_nodes);
 }
 
+ss::future<> bootstrap_replica_from_log_suffix(
+  const storage::ntp_config& ntp_cfg,
+  model::offset start_offset,
+  model::term_id prev_term,
+  offset_translator_delta delta) {
+    raft::snapshot_metadata meta = {
+      .last_included_index = prev_offset(start_offset),
+      .last_included_term = prev_term,
+      .version = raft::snapshot_metadata::current_version,
+      .latest_configuration = raft::group_configuration(
+        std::vector<model::broker>{}, ntp_cfg.get_revision()),
+      .cluster_time = ss::lowres_clock::now(),
+      .log_start_delta = delta,
+    };
+
+    storage::simple_snapshot_manager tmp_snapshot_mgr(
+      std::filesystem::path(ntp_cfg.work_directory()),
+      storage::simple_snapshot_manager::default_snapshot_filename,
+      raft_priority());
+
+    co_await raft::details::persist_snapshot(
+      tmp_snapshot_mgr, std::move(meta), iobuf());
+}
+
 } // namespace raft::details
@@ -189,4 +189,19 @@ ss::future<> bootstrap_pre_existing_partition(
   model::offset max_rp_offset,
   model::term_id last_included_term,
   std::vector<model::broker> initial_nodes);
+
+/// Creates persistent state for a new replica of an existing raft group whose
+/// log was partially downloaded from S3 with its raft offsets preserved.
+///
+/// The function is supposed to be called before creating the raft group. It
+/// creates a raft snapshot right before 'start_offset', the base offset of the
+/// first downloaded segment, so that the group starts from there with the
+/// offset translator 'delta' of that segment. The snapshot carries an empty
+/// configuration: the configurations of the downloaded segments are read when
+/// the group starts and the newer ones are recovered from the leader.
+ss::future<> bootstrap_replica_from_log_suffix(
+  const storage::ntp_config& ntp_cfg,
+  model::offset start_offset,
+  model::term_id prev_term,
+  offset_translator_delta delta);
 } // namespace raft::details
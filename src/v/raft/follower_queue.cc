@@ -23,4 +23,14 @@ ss::future<ss::semaphore_units<>> follower_queue::get_append_entries_unit() {
     co_return co_await ss::get_units(*_sem, 1);
 }
 
+void follower_queue::set_max_concurrent_append_entries(uint32_t max) {
+    if (max > _max_concurrent_append_entries) {
+        _sem->signal(max - _max_concurrent_append_entries);
+    } else if (max < _max_concurrent_append_entries) {
+        // may go negative until in flight requests return their units
+        _sem->consume(_max_concurrent_append_entries - max);
+    }
+    _max_concurrent_append_entries = max;
+}
+
 } // namespace raft
@@ -36,19 +36,13 @@ public:
                && _sem->available_units() == _max_concurrent_append_entries;
     }
 
-private:
     /**
-     * TODO: consider using queue depth control to automatically adjust number
-     * of concurrent requests per follower. In general it should be fine to make
-     * this static since scaling throughput is usually achieved by increasing
-     * partition count. We may need to increase number of concurrent requests
-     * per partition to increase throughput when partition number is low and we
-     * are fine with increasing latency.
-     *
-     * Things to consider:
-     * - per shard concurrency controll
-     * - token-bucket based throughput limitter
+     * Changes the number of concurrent requests, requests already in flight
+     * are not affected.
      */
+    void set_max_concurrent_append_entries(uint32_t);
+
+private:
     uint32_t _max_concurrent_append_entries;
     std::unique_ptr<ss::semaphore> _sem;
 };
@@ -9,7 +9,12 @@
 
 #include "raft/follower_stats.h"
 
+#include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
 #include "raft/group_configuration.h"
+#include "raft/probe.h"
+
+#include <seastar/core/metrics.hh>
 
 #include <absl/container/node_hash_map.h>
 
@@ -40,11 +45,13 @@ void follower_stats::update_with_configuration(const group_configuration& cfg) {
         // and remove
         if (!cfg.contains(it->first)) {
             it->second.follower_state_change.broken();
+            _pipelines.erase(it->first);
             _followers.erase(it++);
             continue;
         }
         ++it;
     }
+    update_accounting();
 }
 
 ss::future<ss::semaphore_units<>>
@@ -52,7 +59,8 @@ follower_stats::get_append_entries_unit(vnode id) {
     if (auto it = _queues.find(id); it != _queues.end()) {
         return it->second.get_append_entries_unit();
     }
-    auto [it, _] = _queues.emplace(id, _max_concurrent_append_entries);
+    auto [it, _] = _queues.emplace(id, get_pipeline(id).controller.depth());
+    update_accounting();
 
     return it->second.get_append_entries_unit();
 }
@@ -61,7 +69,129 @@ void follower_stats::return_append_entries_units(vnode id) {
     if (auto it = _queues.find(id);
         it != _queues.end() && it->second.is_idle()) {
         _queues.erase(it);
+        update_accounting();
+    }
+}
+
+void follower_stats::record_append_entries_rtt(
+  vnode id, pipeline_controller::clock_type::duration rtt, bool limited) {
+    // follower may have been removed while the request was in flight
+    if (!_followers.contains(id)) {
+        return;
+    }
+    auto& controller = get_pipeline(id).controller;
+    controller.record(rtt, limited);
+    if (auto it = _queues.find(id); it != _queues.end()) {
+        it->second.set_max_concurrent_append_entries(controller.depth());
+    }
+}
+
+void follower_stats::record_append_entries_failure(vnode id) {
+    if (!_followers.contains(id)) {
+        return;
+    }
+    auto& controller = get_pipeline(id).controller;
+    controller.record_failure();
+    if (auto it = _queues.find(id); it != _queues.end()) {
+        it->second.set_max_concurrent_append_entries(controller.depth());
+    }
+}
+
+size_t follower_stats::append_entries_batch_bytes(vnode id) const {
+    if (auto it = _pipelines.find(id); it != _pipelines.end()) {
+        return it->second.controller.batch_bytes();
     }
+    return _pipeline_cfg.max_batch_bytes;
+}
+
+follower_stats::follower_pipeline& follower_stats::get_pipeline(vnode id) {
+    auto [it, inserted] = _pipelines.try_emplace(id, _pipeline_cfg);
+    if (inserted) {
+        setup_pipeline_metrics(id, it->second);
+        update_accounting();
+    }
+    it->second.last_used = pipeline_controller::clock_type::now();
+    return it->second;
+}
+
+void follower_stats::release_idle_pipelines(
+  pipeline_controller::clock_type::duration idle_timeout) {
+    const auto now = pipeline_controller::clock_type::now();
+    for (auto it = _pipelines.begin(); it != _pipelines.end();) {
+        // a follower with a queue has requests in flight
+        if (
+          !_queues.contains(it->first)
+          && it->second.last_used + idle_timeout <= now) {
+            _pipelines.erase(it++);
+            continue;
+        }
+        ++it;
+    }
+    // erasing keeps the slot arrays, give them back too
+    _pipelines.rehash(0);
+    _queues.rehash(0);
+    update_accounting();
+}
+
+void follower_stats::setup_metrics(const model::ntp& ntp) {
+    _metrics_ntp = ntp;
+    for (auto& [id, pipeline] : _pipelines) {
+        setup_pipeline_metrics(id, pipeline);
+    }
+}
+
+void follower_stats::setup_pipeline_metrics(
+  vnode id, follower_pipeline& pipeline) {
+    namespace sm = ss::metrics;
+    // a fixed pipeline would only export its configuration
+    if (!_metrics_ntp || !_pipeline_cfg.is_adaptive()) {
+        return;
+    }
+    auto labels = probe::create_metric_labels(*_metrics_ntp);
+    labels.push_back(sm::label("follower_id")(id.id()));
+    // aggregated pipelines are summed over the followers too
+    std::vector<sm::label> aggregate_labels;
+    if (config::shard_local_cfg().aggregate_metrics()) {
+        aggregate_labels = {
+          sm::shard_label, sm::label("partition"), sm::label("follower_id")};
+    }
+    const auto& c = pipeline.controller;
+    auto to_us = [](pipeline_controller::clock_type::duration d) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(d)
+          .count();
+    };
+
+    pipeline.metrics.clear();
+    pipeline.metrics.add_group(
+      prometheus_sanitize::metrics_name("raft"),
+      {sm::make_gauge(
+         "follower_pipeline_depth",
+         [&c] { return c.depth(); },
+         sm::description(
+           "Concurrent append entries requests allowed to a follower"),
+         labels)
+         .aggregate(aggregate_labels),
+       sm::make_gauge(
+         "follower_pipeline_batch_bytes",
+         [&c] { return c.batch_bytes(); },
+         sm::description("Size of recovery append entries requests sent to a "
+                         "follower"),
+         labels)
+         .aggregate(aggregate_labels),
+       sm::make_gauge(
+         "follower_pipeline_rtt_us",
+         [&c, to_us] { return to_us(c.smoothed_rtt()); },
+         sm::description(
+           "Smoothed round trip of append entries requests sent to a follower"),
+         labels)
+         .aggregate(aggregate_labels),
+       sm::make_gauge(
+         "follower_pipeline_min_rtt_us",
+         [&c, to_us] { return to_us(c.min_rtt()); },
+         sm::description(
+           "Minimal round trip of append entries requests sent to a follower"),
+         labels)
+         .aggregate(aggregate_labels)});
 }
 
 std::ostream& operator<<(std::ostream& o, const follower_stats& s) {
@@ -13,9 +13,13 @@
 
 #include "model/metadata.h"
 #include "raft/follower_queue.h"
+#include "raft/pipeline_controller.h"
 #include "raft/types.h"
+#include "utils/memory_accounting.h"
 #include "vassert.h"
 
+#include <seastar/core/metrics_registration.hh>
+
 #include <absl/container/node_hash_map.h>
 
 namespace raft {
@@ -26,9 +30,9 @@ public:
     using iterator = container_t::iterator;
     using const_iterator = container_t::const_iterator;
 
-    explicit follower_stats(vnode self, uint32_t max_concurrent_append_entries)
+    follower_stats(vnode self, pipeline_controller::config pipeline_cfg)
       : _self(self)
-      , _max_concurrent_append_entries(max_concurrent_append_entries) {}
+      , _pipeline_cfg(pipeline_cfg) {}
 
     const follower_index_metadata& get(vnode n) const {
         auto it = _followers.find(n);
@@ -57,6 +61,7 @@ public:
         _followers.erase(n);
         auto [it, success] = _followers.emplace(n, std::move(m));
         vassert(success, "could not insert node:{}", n);
+        update_accounting();
         return it;
     }
 
@@ -74,14 +79,66 @@ public:
 
     void return_append_entries_units(vnode);
 
+    /**
+     * Feeds the follower pipeline with the round trip of an append entries
+     * request, `limited` is set when the request waited for its unit.
+     */
+    void record_append_entries_rtt(
+      vnode, pipeline_controller::clock_type::duration, bool limited);
+
+    /// Feeds the follower pipeline with a failed or timed out request
+    void record_append_entries_failure(vnode);
+
+    /// Size of a request the follower pipeline currently asks for
+    size_t append_entries_batch_bytes(vnode) const;
+
+    void setup_metrics(const model::ntp&);
+
+    /**
+     * Drops the pipelines of followers nothing was sent to for
+     * `idle_timeout`, with their metrics. They start over from the configured
+     * depth on the next request.
+     */
+    void release_idle_pipelines(
+      pipeline_controller::clock_type::duration idle_timeout);
+
     void update_with_configuration(const group_configuration&);
 
 private:
     friend std::ostream& operator<<(std::ostream&, const follower_stats&);
+
+    void update_accounting() {
+        // node maps allocate a node per element on top of the slot array
+        _accounted.update(
+          _followers.capacity() * sizeof(void*)
+          + _followers.size() * sizeof(container_t::value_type)
+          + _queues.capacity() * sizeof(void*)
+          + _queues.size() * sizeof(decltype(_queues)::value_type)
+          + _pipelines.capacity() * sizeof(void*)
+          + _pipelines.size() * sizeof(decltype(_pipelines)::value_type));
+    }
+
+    struct follower_pipeline {
+        explicit follower_pipeline(pipeline_controller::config cfg)
+          : controller(cfg) {}
+
+        pipeline_controller controller;
+        pipeline_controller::clock_type::time_point last_used{
+          pipeline_controller::clock_type::now()};
+        ss::metrics::metric_groups metrics;
+    };
+
+    follower_pipeline& get_pipeline(vnode);
+    void setup_pipeline_metrics(vnode, follower_pipeline&);
+
     vnode _self;
-    uint32_t _max_concurrent_append_entries;
+    pipeline_controller::config _pipeline_cfg;
     container_t _followers;
     absl::node_hash_map<vnode, follower_queue> _queues;
+    // outlives the queue which is removed whenever it becomes idle
+    absl::node_hash_map<vnode, follower_pipeline> _pipelines;
+    std::optional<model::ntp> _metrics_ntp;
+    accounted_memory _accounted{memory_subsystem::raft_follower_state};
 };
 
 } // namespace raft
@@ -0,0 +1,273 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "raft/group_commit_coordinator.h"
+
+#include "raft/consensus.h"
+#include "raft/logger.h"
+#include "ssx/future-util.h"
+#include "vlog.h"
+
+#include <seastar/core/alien.hh>
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/loop.hh>
+#include <seastar/core/reactor.hh>
+#include <seastar/core/sleep.hh>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <system_error>
+#include <thread>
+
+namespace raft {
+
+/**
+ * Runs syncfs(2) on a thread of its own, it blocks until all the dirty data
+ * of the filesystem reached the disk which would stall the reactor. One sync
+ * at a time, rounds do not overlap.
+ */
+class group_commit_coordinator::filesystem_syncer {
+public:
+    explicit filesystem_syncer(ss::sstring directory)
+      : _directory(std::move(directory))
+      , _alien(ss::engine().alien())
+      , _shard(ss::this_shard_id())
+      , _thread([this] { run(); }) {}
+
+    filesystem_syncer(const filesystem_syncer&) = delete;
+    filesystem_syncer& operator=(const filesystem_syncer&) = delete;
+    filesystem_syncer(filesystem_syncer&&) = delete;
+    filesystem_syncer& operator=(filesystem_syncer&&) = delete;
+
+    ~filesystem_syncer() noexcept { stop(); }
+
+    const ss::sstring& directory() const { return _directory; }
+
+    ss::future<> sync() {
+        _done.emplace();
+        auto f = _done->get_future();
+        {
+            std::lock_guard lock(_mutex);
+            _requested = true;
+        }
+        _cv.notify_one();
+        return f;
+    }
+
+    /// must not be called while a sync is in flight
+    void stop() noexcept {
+        if (!_thread.joinable()) {
+            return;
+        }
+        {
+            std::lock_guard lock(_mutex);
+            _stopping = true;
+        }
+        _cv.notify_one();
+        _thread.join();
+    }
+
+private:
+    void run() {
+        int fd = ::open(_directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        const int open_error = fd < 0 ? errno : 0;
+        while (true) {
+            {
+                std::unique_lock lock(_mutex);
+                _cv.wait(lock, [this] { return _requested || _stopping; });
+                if (_stopping) {
+                    break;
+                }
+                _requested = false;
+            }
+            int error = open_error;
+            if (fd >= 0 && ::syncfs(fd) != 0) {
+                error = errno;
+            }
+            ss::alien::run_on(_alien, _shard, [this, error]() noexcept {
+                auto done = std::exchange(_done, std::nullopt);
+                if (error == 0) {
+                    done->set_value();
+                } else {
+                    done->set_exception(std::system_error(
+                      error, std::system_category(), "syncfs"));
+                }
+            });
+        }
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    }
+
+    ss::sstring _directory;
+    ss::alien::instance& _alien;
+    ss::shard_id _shard;
+    // reactor side, fulfilled through the alien queue
+    std::optional<ss::promise<>> _done;
+
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _requested{false};
+    bool _stopping{false};
+    std::thread _thread;
+};
+
+group_commit_coordinator::group_commit_coordinator(
+  config::binding<std::chrono::milliseconds> max_delay)
+  : _max_delay(std::move(max_delay)) {}
+
+group_commit_coordinator::~group_commit_coordinator() noexcept = default;
+
+void group_commit_coordinator::start(ss::sstring data_directory) {
+    _syncer = std::make_unique<filesystem_syncer>(std::move(data_directory));
+    ssx::spawn_with_gate(_gate, [this] {
+        return ss::do_until(
+          [this] { return _gate.is_closed(); },
+          [this] {
+              return _has_pending.wait([this] { return !_pending.empty(); })
+                .then([this] {
+                    auto window = coalescing_window();
+                    if (window == std::chrono::microseconds::zero()) {
+                        return ss::now();
+                    }
+                    return ss::sleep(window);
+                })
+                .then([this] { return run_round(); });
+          });
+    });
+}
+
+ss::future<> group_commit_coordinator::stop() {
+    _has_pending.broken();
+    co_await _gate.close();
+    if (_syncer) {
+        _syncer->stop();
+    }
+    // groups are stopped before the coordinator, nobody should be waiting
+    for (auto& [_, p] : std::exchange(_pending, {})) {
+        p.promise.set_exception(ss::gate_closed_exception());
+    }
+}
+
+ss::future<model::offset> group_commit_coordinator::flush(consensus& c) {
+    if (_gate.is_closed() || c._bg.is_closed()) {
+        return ss::make_exception_future<model::offset>(
+          ss::gate_closed_exception());
+    }
+    ++_requests;
+    auto [it, inserted] = _pending.try_emplace(&c);
+    if (inserted) {
+        it->second.group = ss::gate::holder(c._bg);
+    }
+    auto f = it->second.promise.get_shared_future();
+    _has_pending.signal();
+    return f;
+}
+
+std::chrono::microseconds group_commit_coordinator::coalescing_window() const {
+    // a lone group does not wait for company
+    if (_groups_per_round.get() <= 1) {
+        return std::chrono::microseconds::zero();
+    }
+    return std::min<std::chrono::microseconds>(
+      std::chrono::microseconds(_round_latency_us.get() / 2), _max_delay());
+}
+
+ss::future<> group_commit_coordinator::run_round() {
+    auto round = std::exchange(_pending, {});
+    ++_rounds;
+    _flushes += round.size();
+    const auto started = std::chrono::steady_clock::now();
+    const auto groups = round.size();
+
+    if (groups > 1 && _syncer) {
+        co_await sync_groups(round);
+    }
+    co_await flush_groups(round);
+
+    _round_latency_us.update(
+      std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - started)
+        .count());
+    _groups_per_round.update(groups);
+}
+
+ss::future<> group_commit_coordinator::sync_groups(pending_t& round) {
+    co_await ss::parallel_for_each(round, [](pending_t::value_type& p) {
+        auto c = p.first;
+        return c->write_out_log().then_wrapped(
+          [c, &pending = p.second](
+            ss::future<ss::noncopyable_function<void()>> f) {
+              if (f.failed()) {
+                  // the group is flushed on its own which reports the error
+                  f.ignore_ready_future();
+                  c->_has_pending_flushes = true;
+                  return;
+              }
+              pending.mark_synced = f.get();
+          });
+    });
+
+    try {
+        co_await _syncer->sync();
+        ++_filesystem_syncs;
+    } catch (...) {
+        vlog(
+          raftlog.warn,
+          "Unable to sync the filesystem holding {}, flushing groups one by "
+          "one from now on - {}",
+          _syncer->directory(),
+          std::current_exception());
+        for (auto& [c, pending] : round) {
+            if (pending.mark_synced) {
+                pending.mark_synced.reset();
+                c->_has_pending_flushes = true;
+            }
+        }
+        _syncer->stop();
+        _syncer.reset();
+        co_return;
+    }
+
+    // deliver the offset flushed for each group right after its sync
+    for (auto it = round.begin(); it != round.end();) {
+        auto& [c, pending] = *it;
+        if (!pending.mark_synced) {
+            ++it;
+            continue;
+        }
+        (*pending.mark_synced)();
+        pending.promise.set_value(c->_flushed_offset);
+        // releases the group and the segment it held
+        round.erase(it++);
+    }
+}
+
+ss::future<> group_commit_coordinator::flush_groups(pending_t& round) {
+    return ss::parallel_for_each(round, [](pending_t::value_type& p) {
+        auto c = p.first;
+        return c->flush_log().then_wrapped(
+          [c, &promise = p.second.promise](ss::future<> f) {
+              if (f.failed()) {
+                  promise.set_exception(f.get_exception());
+              } else {
+                  promise.set_value(c->_flushed_offset);
+              }
+          });
+    });
+}
+
+} // namespace raft
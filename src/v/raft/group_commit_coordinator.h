@@ -0,0 +1,108 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+#include "config/property.h"
+#include "model/fundamental.h"
+#include "raft/fwd.h"
+#include "seastarx.h"
+#include "utils/moving_average.h"
+
+#include <seastar/core/condition-variable.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/shared_future.hh>
+#include <seastar/core/sstring.hh>
+#include <seastar/util/noncopyable_function.hh>
+
+#include <absl/container/node_hash_map.h>
+
+#include <chrono>
+#include <memory>
+#include <optional>
+
+namespace raft {
+
+/**
+ * Shard wide group commit of follower log flushes.
+ *
+ * Followers used to flush their log as soon as a batch of append entries
+ * requests requiring a flush had been appended, so a shard hosting thousands
+ * of groups issued a flush per group per request batch. Instead, followers
+ * register their pending flush with the coordinator which runs flush rounds:
+ * every group registered while a round is in flight is flushed by the next
+ * round. The append entries buffer of a group keeps appending requests while
+ * its flush is pending, so all the request batches appended in the meantime
+ * share that flush and are acknowledged together when it completes.
+ *
+ * A round of a single group flushes its log. A round of several groups writes
+ * out their logs without syncing them and then syncs the filesystem holding
+ * the data directory once, on a thread of its own, which makes all of them
+ * durable with a single syncfs(2) instead of a fdatasync(2) per group. If the
+ * filesystem cannot be synced the groups are flushed one by one, and later
+ * rounds do not try again.
+ *
+ * Rounds are self clocking, under load they grow with the flush latency. When
+ * the previous round flushed several groups the coordinator may also wait for
+ * a fraction of the observed round latency, bounded by `max_delay` (off by
+ * default), before starting a round to let more groups join it.
+ */
+class group_commit_coordinator {
+public:
+    explicit group_commit_coordinator(
+      config::binding<std::chrono::milliseconds> max_delay);
+    ~group_commit_coordinator() noexcept;
+
+    /// `data_directory` holds the logs of the groups
+    void start(ss::sstring data_directory);
+    ss::future<> stop();
+
+    /// Resolves when the log of the group was flushed by a round started
+    /// after this call, with the flushed offset of the group right after the
+    /// flush. The group is not stopped before it resolved.
+    ss::future<model::offset> flush(consensus&);
+
+    uint64_t rounds() const { return _rounds; }
+    uint64_t requests() const { return _requests; }
+    uint64_t flushes() const { return _flushes; }
+    uint64_t filesystem_syncs() const { return _filesystem_syncs; }
+
+private:
+    class filesystem_syncer;
+
+    struct pending_flush {
+        // holds the group open until its result was delivered
+        ss::gate::holder group;
+        ss::shared_promise<model::offset> promise;
+        // set once the log was written out, marks it flushed after the sync
+        std::optional<ss::noncopyable_function<void()>> mark_synced;
+    };
+    using pending_t = absl::node_hash_map<consensus*, pending_flush>;
+
+    ss::future<> run_round();
+    ss::future<> flush_groups(pending_t&);
+    ss::future<> sync_groups(pending_t&);
+    std::chrono::microseconds coalescing_window() const;
+
+    config::binding<std::chrono::milliseconds> _max_delay;
+    std::unique_ptr<filesystem_syncer> _syncer;
+    pending_t _pending;
+    ss::condition_variable _has_pending;
+    ss::gate _gate;
+    // average duration of a round and number of groups flushed per round
+    moving_average<int64_t, 16> _round_latency_us{0};
+    moving_average<size_t, 16> _groups_per_round{0};
+
+    uint64_t _rounds{0};
+    uint64_t _requests{0};
+    uint64_t _flushes{0};
+    uint64_t _filesystem_syncs{0};
+};
+
+} // namespace raft
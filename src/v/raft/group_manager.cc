@@ -18,6 +18,7 @@
 #include <seastar/core/scheduling.hh>
 
 #include <optional>
+#include <vector>
 
 namespace raft {
 
@@ -38,13 +39,46 @@ group_manager::group_manager(
   , _heartbeats(heartbeat_interval, _client, _self, heartbeat_timeout)
   , _storage(storage.local())
   , _recovery_throttle(recovery_throttle.local())
-  , _recovery_mem_quota(std::move(recovery_mem_cfg)) {
+  , _recovery_mem_quota(std::move(recovery_mem_cfg))
+  , _group_commit(
+      config::shard_local_cfg().raft_group_commit_max_delay_ms.bind())
+  , _idle_release_timeout(
+      config::shard_local_cfg().storage_idle_log_release_ms.bind()) {
     setup_metrics();
+    _idle_release_timer.set_callback(
+      [this] { release_idle_follower_state(); });
+    _idle_release_timeout.watch([this] { arm_idle_release_timer(); });
 }
 
-ss::future<> group_manager::start() { return _heartbeats.start(); }
+ss::future<> group_manager::start() {
+    _group_commit.start(_storage.log_mgr().config().base_dir);
+    arm_idle_release_timer();
+    return _heartbeats.start();
+}
+
+void group_manager::arm_idle_release_timer() {
+    _idle_release_timer.cancel();
+    if (_gate.is_closed()) {
+        return;
+    }
+    // same idle timeout as the logs of the groups
+    if (auto timeout = _idle_release_timeout(); timeout) {
+        _idle_release_timer.arm_periodic(*timeout);
+    }
+}
+
+void group_manager::release_idle_follower_state() {
+    auto timeout = _idle_release_timeout();
+    if (!timeout) {
+        return;
+    }
+    for (auto& group : _groups) {
+        group->release_idle_follower_state(*timeout);
+    }
+}
 
 ss::future<> group_manager::stop() {
+    _idle_release_timer.cancel();
     auto f = _gate.close();
     if (!_heartbeats.is_stopped()) {
         // In normal redpanda process shutdown, heartbeats would
@@ -53,16 +87,21 @@ ss::future<> group_manager::stop() {
         f = f.then([this] { return _heartbeats.stop(); });
     }
 
-    return f.then([this] {
-        return ss::parallel_for_each(
-          _groups,
-          [](ss::lw_shared_ptr<consensus> raft) { return raft->stop(); });
-    });
+    return f
+      .then([this] {
+          return ss::parallel_for_each(
+            _groups,
+            [](ss::lw_shared_ptr<consensus> raft) { return raft->stop(); });
+      })
+      .then([this] {
+          // stopped groups do not wait for flushes anymore
+          return _group_commit.stop();
+      });
 }
 
 ss::future<> group_manager::stop_heartbeats() { return _heartbeats.stop(); }
 
-ss::future<ss::lw_shared_ptr<raft::consensus>> group_manager::create_group(
+ss::lw_shared_ptr<raft::consensus> group_manager::make_consensus(
   raft::group_id id, std::vector<model::broker> nodes, storage::log log) {
     auto revision = log.config().get_revision();
     auto raft_cfg = raft::group_configuration(std::move(nodes), revision);
@@ -72,7 +111,7 @@ ss::future<ss::lw_shared_ptr<raft::consensus>> group_manager::create_group(
         raft_cfg.set_version(group_configuration::version_t(3));
     }
 
-    auto raft = ss::make_lw_shared<raft::consensus>(
+    return ss::make_lw_shared<raft::consensus>(
       _self,
       id,
       std::move(raft_cfg),
@@ -88,8 +127,13 @@ ss::future<ss::lw_shared_ptr<raft::consensus>> group_manager::create_group(
       _storage,
       _recovery_throttle,
       _recovery_mem_quota,
-      _raft_feature_table);
+      _raft_feature_table,
+      _group_commit);
+}
 
+ss::future<ss::lw_shared_ptr<raft::consensus>> group_manager::create_group(
+  raft::group_id id, std::vector<model::broker> nodes, storage::log log) {
+    auto raft = make_consensus(id, std::move(nodes), std::move(log));
     return ss::with_gate(_gate, [this, raft] {
         return _heartbeats.register_group(raft).then([this, raft] {
             _groups.push_back(raft);
@@ -98,6 +142,24 @@ ss::future<ss::lw_shared_ptr<raft::consensus>> group_manager::create_group(
     });
 }
 
+ss::future<std::vector<ss::lw_shared_ptr<raft::consensus>>>
+group_manager::create_groups(std::vector<create_group_request> requests) {
+    std::vector<ss::lw_shared_ptr<raft::consensus>> groups;
+    groups.reserve(requests.size());
+    for (auto& r : requests) {
+        groups.push_back(
+          make_consensus(r.id, std::move(r.nodes), std::move(r.log)));
+    }
+
+    return ss::with_gate(_gate, [this, groups = std::move(groups)]() mutable {
+        return _heartbeats.register_groups(groups).then(
+          [this, groups = std::move(groups)]() mutable {
+              _groups.insert(_groups.end(), groups.begin(), groups.end());
+              return std::move(groups);
+          });
+    });
+}
+
 ss::future<> group_manager::remove(ss::lw_shared_ptr<raft::consensus> c) {
     return c->stop()
       .then([c] { return c->remove_persistent_state(); })
@@ -141,9 +203,28 @@ void group_manager::setup_metrics() {
     _metrics.add_group(
       prometheus_sanitize::metrics_name("raft"),
       {sm::make_gauge(
-        "group_count",
-        [this] { return _groups.size(); },
-        sm::description("Number of raft groups"))});
+         "group_count",
+         [this] { return _groups.size(); },
+         sm::description("Number of raft groups")),
+       sm::make_counter(
+         "group_commit_rounds",
+         [this] { return _group_commit.rounds(); },
+         sm::description("Number of follower group commit rounds")),
+       sm::make_counter(
+         "group_commit_requests",
+         [this] { return _group_commit.requests(); },
+         sm::description("Number of follower log flushes requested")),
+       sm::make_counter(
+         "group_commit_flushes",
+         [this] { return _group_commit.flushes(); },
+         sm::description(
+           "Number of follower log flushes issued by group commit rounds")),
+       sm::make_counter(
+         "group_commit_filesystem_syncs",
+         [this] { return _group_commit.filesystem_syncs(); },
+         sm::description(
+           "Number of filesystem syncs flushing several follower logs at "
+           "once"))});
 }
 
 void group_manager::set_feature_active(raft_feature f) {
@@ -13,6 +13,7 @@
 #include "cluster/types.h"
 #include "model/metadata.h"
 #include "raft/consensus_client_protocol.h"
+#include "raft/group_commit_coordinator.h"
 #include "raft/heartbeat_manager.h"
 #include "raft/raft_feature_table.h"
 #include "raft/recovery_memory_quota.h"
@@ -22,10 +23,13 @@
 
 #include <seastar/core/metrics_registration.hh>
 #include <seastar/core/scheduling.hh>
+#include <seastar/core/timer.hh>
 
 #include <absl/container/flat_hash_map.h>
 
+#include <optional>
 #include <tuple>
+#include <vector>
 
 namespace raft {
 
@@ -52,9 +56,22 @@ public:
     ss::future<> stop();
     ss::future<> stop_heartbeats();
 
+    struct create_group_request {
+        raft::group_id id;
+        std::vector<model::broker> nodes;
+        storage::log log;
+    };
+
     ss::future<ss::lw_shared_ptr<raft::consensus>> create_group(
       raft::group_id id, std::vector<model::broker> nodes, storage::log log);
 
+    /**
+     * Creates many groups at once, the groups are registered with the
+     * heartbeat manager in a single step. Results are in the request order.
+     */
+    ss::future<std::vector<ss::lw_shared_ptr<raft::consensus>>>
+      create_groups(std::vector<create_group_request>);
+
     ss::future<> shutdown(ss::lw_shared_ptr<raft::consensus>);
 
     ss::future<> remove(ss::lw_shared_ptr<raft::consensus>);
@@ -87,8 +104,12 @@ public:
     void set_feature_active(raft_feature);
 
 private:
+    ss::lw_shared_ptr<raft::consensus> make_consensus(
+      raft::group_id id, std::vector<model::broker> nodes, storage::log log);
     void trigger_leadership_notification(raft::leadership_status);
     void setup_metrics();
+    void arm_idle_release_timer();
+    void release_idle_follower_state();
 
     model::node_id _self;
     model::timeout_clock::duration _disk_timeout;
@@ -105,6 +126,10 @@ private:
     recovery_throttle& _recovery_throttle;
     recovery_memory_quota _recovery_mem_quota;
     raft_feature_table _raft_feature_table;
+    group_commit_coordinator _group_commit;
+    config::binding<std::optional<std::chrono::milliseconds>>
+      _idle_release_timeout;
+    ss::timer<> _idle_release_timer;
 };
 
 } // namespace raft
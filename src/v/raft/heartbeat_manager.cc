@@ -31,11 +31,15 @@
 #include <bits/stdint-uintn.h>
 #include <boost/range/iterator_range.hpp>
 
+#include <algorithm>
+
 namespace raft {
 ss::logger hbeatlog{"r/heartbeat"};
 using consensus_ptr = heartbeat_manager::consensus_ptr;
 using consensus_set = heartbeat_manager::consensus_set;
 
+static constexpr size_t default_heartbeat_min_compression_bytes = 512;
+
 struct heartbeat_requests {
     /// Requests to dispatch.  Can include request to self.
     std::vector<heartbeat_manager::node_heartbeat> requests;
@@ -238,6 +242,14 @@ ss::future<> heartbeat_manager::do_heartbeat(node_heartbeat&& r) {
       r.meta_map.size(),
       r.target);
 
+    // heartbeats are always compressed, with the replication threshold when
+    // it is set
+    size_t min_compression_bytes = default_heartbeat_min_compression_bytes;
+    if (auto min_bytes
+        = config::shard_local_cfg().raft_replicate_compression_min_bytes();
+        min_bytes) {
+        min_compression_bytes = *min_bytes;
+    }
     auto f = _client_protocol
                .heartbeat(
                  r.target,
@@ -245,7 +257,7 @@ ss::future<> heartbeat_manager::do_heartbeat(node_heartbeat&& r) {
                  rpc::client_opts(
                    clock_type::now() + _heartbeat_timeout,
                    rpc::compression_type::zstd,
-                   512))
+                   min_compression_bytes))
                .then([node = r.target,
                       groups = std::move(r.meta_map),
                       gate = std::move(gate),
@@ -355,6 +367,21 @@ heartbeat_manager::register_group(ss::lw_shared_ptr<consensus> ptr) {
     });
 }
 
+ss::future<> heartbeat_manager::register_groups(
+  std::vector<ss::lw_shared_ptr<consensus>> groups) {
+    return _lock.with([this, groups = std::move(groups)]() mutable {
+        const auto expected_size = _consensus_groups.size() + groups.size();
+        std::sort(
+          groups.begin(), groups.end(), details::consensus_ptr_by_group_id{});
+        _consensus_groups.insert(
+          boost::container::ordered_unique_range, groups.begin(), groups.end());
+        vassert(
+          _consensus_groups.size() == expected_size,
+          "double registration of a group among {} registered groups",
+          groups.size());
+    });
+}
+
 ss::future<> heartbeat_manager::start() {
     dispatch_heartbeats();
     return ss::make_ready_future<>();
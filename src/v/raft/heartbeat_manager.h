@@ -128,6 +128,9 @@ public:
       duration_type);
 
     ss::future<> register_group(ss::lw_shared_ptr<consensus>);
+    /// Registers many groups at once, merging them into the sorted set of
+    /// groups in a single pass instead of one insertion per group.
+    ss::future<> register_groups(std::vector<ss::lw_shared_ptr<consensus>>);
     ss::future<> deregister_group(raft::group_id);
 
     ss::future<> start();
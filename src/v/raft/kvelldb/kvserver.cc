@@ -191,7 +191,8 @@ private:
           _storage,
           std::nullopt,
           _recovery_memory_quota,
-          _features);
+          _features,
+          std::nullopt);
         return _consensus->start().then(
           [this] { return _hbeats.register_group(_consensus); });
     }
@@ -19,8 +19,10 @@
 #include "raft/consensus.h"
 #include "raft/errc.h"
 #include "raft/state_machine.h"
+#include "serde/serde.h"
 #include "ssx/future-util.h"
 #include "utils/expiring_promise.h"
+#include "utils/mutex.h"
 #include "vassert.h"
 
 #include <seastar/core/coroutine.hh>
@@ -46,6 +48,14 @@ namespace raft {
         { s.is_batch_applicable(const_batch) } -> std::convertible_to<bool>;
         { s.apply_update(std::move(batch)) } -> std::same_as<ss::future<std::error_code>>;
     };
+
+    template<typename T>
+    concept SnapshotableState = State<T> && requires(T s,
+                                                     model::offset offset,
+                                                     iobuf buf) {
+        { s.take_snapshot(offset) } -> std::same_as<ss::future<iobuf>>;
+        { s.apply_snapshot(offset, std::move(buf)) } -> std::same_as<ss::future<>>;
+    };
 // clang-format on
 
 using persistent_last_applied
@@ -67,6 +77,15 @@ using persistent_last_applied
 // when batch is applicable for one state is has to be not applicable for
 // another
 //
+// When all the states are snapshotable, `write_snapshot` persists their
+// content as of the last applied offset in the raft snapshot and truncates the
+// log prefix it covers. Each state contributes a separately serialized part,
+// parts are stored in the order of the states. When the state machine falls
+// behind the log start (after a restart or an install_snapshot) the parts are
+// handed back to the states with `apply_snapshot`. A state that is appended to
+// the list receives no part from older snapshots and starts from its initial
+// state.
+//
 // +---------+               +---------+      +-------+ +---------+
 // | caller  |               | mux_stm |      | raft  | | state_1 |
 // +---------+               +---------+      +-------+ +---------+
@@ -129,10 +148,17 @@ public:
       ss::abort_source& as,
       std::optional<model::term_id> term = std::nullopt);
 
+    /// Persists a snapshot of all the states at the last applied offset and
+    /// prefix truncates the log up to that offset
+    ss::future<> write_snapshot() requires(SnapshotableState<T>&&...);
+
 private:
     using promise_t = expiring_promise<std::error_code>;
 
     ss::future<> apply(model::record_batch b) final;
+    ss::future<> do_apply(model::record_batch b);
+    ss::future<> handle_eviction() final;
+    ss::future<> apply_snapshot_parts(model::offset, std::vector<iobuf>&);
     class replicate_units {
     public:
         explicit replicate_units(mux_state_machine<T...>* stm)
@@ -171,9 +197,15 @@ private:
     consensus* _c;
     absl::node_hash_map<model::offset, std::error_code> _results;
     model::offset _last_applied;
+    // last offset covered by a snapshot loaded into the states, results of
+    // commands up to this offset are unknown
+    model::offset _last_snapshot_applied;
     int64_t _pending = 0;
     const persistent_last_applied _persist_last_applied;
     ss::condition_variable _new_result;
+    // serializes applying batches with taking and loading snapshots so that
+    // a snapshot never contains a partially applied batch
+    mutex _apply_mutex;
     // we keep states in a tuple to automatically dispatch updates to correct
     // state
     std::tuple<T&...> _state;
@@ -263,6 +295,15 @@ requires(State<T>, ...)
                               return;
                           }
                           auto it = _results.find(last_offset);
+                          if (
+                            it == _results.end()
+                            && last_offset <= _last_snapshot_applied) {
+                              // the entry was applied as a part of a
+                              // snapshot, its outcome is unknown
+                              promise->set_value(
+                                make_error_code(errc::timeout));
+                              return;
+                          }
                           vassert(
                             it != _results.end(),
                             "last applied offset {} is greater than "
@@ -296,51 +337,138 @@ template<typename... T>
 requires(State<T>, ...) ss::future<> mux_state_machine<T...>::apply(
   model::record_batch b) {
     return ss::with_gate(_gate, [this, b = std::move(b)]() mutable {
-        // lookup for the state to apply the update
-        auto state = std::apply(
-          [&b](T&... st) {
-              using variant_t = std::variant<T*...>;
-              std::optional<variant_t> res;
-              (void)((res = is_batch_applicable(st, b), res) || ...);
-              return res;
+        return _apply_mutex.with([this, b = std::move(b)]() mutable {
+            return do_apply(std::move(b));
+        });
+    });
+}
+
+template<typename... T>
+requires(State<T>, ...) ss::future<> mux_state_machine<T...>::do_apply(
+  model::record_batch b) {
+    // lookup for the state to apply the update
+    auto state = std::apply(
+      [&b](T&... st) {
+          using variant_t = std::variant<T*...>;
+          std::optional<variant_t> res;
+          (void)((res = is_batch_applicable(st, b), res) || ...);
+          return res;
+      },
+      _state);
+
+    // applicable state not found
+    if (!state) {
+        vassert(
+          b.header().type == model::record_batch_type::checkpoint
+            || b.header().type == model::record_batch_type::raft_configuration,
+          "State handler for batch of type: {} not found",
+          b.header().type);
+        return ss::now();
+    }
+
+    auto last_offset = b.last_offset();
+    // apply update
+    auto result_f = std::visit(
+      [b = std::move(b)](auto& state) mutable {
+          return state->apply_update(std::move(b));
+      },
+      *state);
+
+    return result_f.then([this, last_offset](std::error_code ec) {
+        _last_applied = last_offset;
+        if (_pending > 0) {
+            _results.emplace(last_offset, ec);
+            _new_result.broadcast();
+        } else {
+            _results.clear();
+        }
+        if (_persist_last_applied && last_offset > _c->read_last_applied()) {
+            ssx::spawn_with_gate(_gate, [this, last_offset] {
+                return _c->write_last_applied(last_offset);
+            });
+        }
+    });
+}
+
+template<typename... T>
+requires(State<T>, ...) ss::future<> mux_state_machine<T...>::write_snapshot()
+requires(SnapshotableState<T>&&...) {
+    auto holder = _gate.hold();
+    std::vector<iobuf> parts;
+    parts.reserve(sizeof...(T));
+    model::offset offset;
+    {
+        auto units = co_await _apply_mutex.get_units();
+        offset = _last_applied;
+        if (
+          offset < model::offset(0) || offset < _c->start_offset()
+          || offset > _c->last_visible_index()) {
+            // nothing new to snapshot or the applied offset is not yet
+            // visible, retry with the next snapshot
+            co_return;
+        }
+
+        co_await std::apply(
+          [offset, &parts](T&... st) {
+              auto f = ss::now();
+              ((f = std::move(f).then([&st, offset, &parts] {
+                    return st.take_snapshot(offset).then([&parts](iobuf part) {
+                        parts.push_back(std::move(part));
+                    });
+                })),
+               ...);
+              return f;
           },
           _state);
+    }
+
+    co_await _c->write_snapshot(
+      write_snapshot_cfg(offset, serde::to_iobuf(std::move(parts))));
+}
 
-        // applicable state not found
-        if (!state) {
-            vassert(
-              b.header().type == model::record_batch_type::checkpoint
-                || b.header().type
-                     == model::record_batch_type::raft_configuration,
-              "State handler for batch of type: {} not found",
-              b.header().type);
-            return ss::now();
+template<typename... T>
+requires(State<T>, ...) ss::future<> mux_state_machine<T...>::
+  apply_snapshot_parts(model::offset offset, std::vector<iobuf>& parts) {
+    return std::apply(
+      [offset, &parts](T&... st) {
+          size_t idx = 0;
+          auto f = ss::now();
+          ((f = std::move(f).then([&st, offset, &parts, i = idx++] {
+                if (i >= parts.size()) {
+                    // state unknown to the node that took the snapshot
+                    return ss::now();
+                }
+                return st.apply_snapshot(offset, std::move(parts[i]));
+            })),
+           ...);
+          return f;
+      },
+      _state);
+}
+
+template<typename... T>
+requires(State<T>, ...) ss::future<> mux_state_machine<T...>::
+  handle_eviction() {
+    if constexpr (!(SnapshotableState<T> && ...)) {
+        co_await state_machine::handle_eviction();
+    } else {
+        auto units = co_await _apply_mutex.get_units();
+        auto snapshot = co_await _c->read_snapshot_data();
+        if (!snapshot) {
+            co_await state_machine::handle_eviction();
+            co_return;
         }
 
-        auto last_offset = b.last_offset();
-        // apply update
-        auto result_f = std::visit(
-          [b = std::move(b)](auto& state) mutable {
-              return state->apply_update(std::move(b));
-          },
-          *state);
-
-        return result_f.then([this, last_offset](std::error_code ec) {
-            _last_applied = last_offset;
-            if (_pending > 0) {
-                _results.emplace(last_offset, ec);
-                _new_result.broadcast();
-            } else {
-                _results.clear();
-            }
-            if (
-              _persist_last_applied && last_offset > _c->read_last_applied()) {
-                ssx::spawn_with_gate(_gate, [this, last_offset] {
-                    return _c->write_last_applied(last_offset);
-                });
-            }
-        });
-    });
+        auto offset = snapshot->last_included_index;
+        auto parts = serde::from_iobuf<std::vector<iobuf>>(
+          std::move(snapshot->data));
+        co_await apply_snapshot_parts(offset, parts);
+
+        _last_applied = offset;
+        _last_snapshot_applied = offset;
+        set_next(model::next_offset(offset));
+        _new_result.broadcast();
+    }
 }
 
 } // namespace raft
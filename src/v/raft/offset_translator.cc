@@ -365,29 +365,21 @@ ss::future<> offset_translator::do_checkpoint() {
     size_t bytes_processed = _bytes_processed;
     size_t map_version = _map_version;
 
-    std::optional<iobuf> map_buf;
-    if (map_version > _map_version_at_checkpoint) {
-        map_buf.emplace(_state->serialize_map());
+    // Both keys are written in the same kvstore batch, the map is never
+    // persisted without the highest known offset nor the other way around.
+    std::vector<storage::kvstore::write_op> ops;
+    const bool map_changed = map_version > _map_version_at_checkpoint;
+    if (map_changed) {
+        ops.emplace_back(offsets_map_key(), _state->serialize_map());
     }
+    ops.emplace_back(
+      highest_known_offset_key(), reflection::to_iobuf(_highest_known_offset));
 
-    iobuf hko_buf = reflection::to_iobuf(_highest_known_offset);
-
-    // Persisting offsets map before highest offset so that if the latter
-    // fails, we are still left with a consistent state (map can be
-    // recreated by reading log from the highest known offset).
-
-    if (map_buf) {
-        co_await _storage_api.kvs().put(
-          storage::kvstore::key_space::offset_translator,
-          offsets_map_key(),
-          std::move(*map_buf));
+    co_await _storage_api.kvs().write_batch(
+      storage::kvstore::key_space::offset_translator, std::move(ops));
+    if (map_changed) {
         _map_version_at_checkpoint = map_version;
     }
-
-    co_await _storage_api.kvs().put(
-      storage::kvstore::key_space::offset_translator,
-      highest_known_offset_key(),
-      std::move(hko_buf));
     _bytes_processed_at_checkpoint = bytes_processed;
     _bytes_processed_units.return_all();
 
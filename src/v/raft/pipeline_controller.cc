@@ -0,0 +1,143 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "raft/pipeline_controller.h"
+
+#include "vassert.h"
+
+#include <fmt/ostream.h>
+
+#include <algorithm>
+#include <limits>
+#include <ostream>
+#include <utility>
+
+namespace raft {
+
+namespace {
+// the pipeline grows while less than this many requests are queued
+constexpr double grow_below_queued = 1.0;
+// and shrinks when more than this many requests are queued
+constexpr double shrink_above_queued = 3.0;
+// weight of a new sample in the smoothed round trip, as in TCP
+constexpr double srtt_gain = 1.0 / 8;
+// number of samples after which the minimal round trip is refreshed
+constexpr uint32_t min_rtt_window = 512;
+} // namespace
+
+pipeline_controller::config pipeline_controller::fixed(uint32_t depth) {
+    return config{
+      .initial_depth = depth,
+      .min_depth = depth,
+      .max_depth = depth,
+      .min_batch_bytes = std::numeric_limits<size_t>::max(),
+      .max_batch_bytes = std::numeric_limits<size_t>::max(),
+    };
+}
+
+pipeline_controller::pipeline_controller(config cfg)
+  : _cfg(cfg)
+  , _depth(std::clamp(cfg.initial_depth, cfg.min_depth, cfg.max_depth))
+  , _batch_bytes(cfg.max_batch_bytes) {
+    vassert(
+      cfg.min_depth > 0 && cfg.min_depth <= cfg.max_depth
+        && cfg.min_batch_bytes <= cfg.max_batch_bytes,
+      "invalid pipeline configuration, depth: [{},{}], batch: [{},{}]",
+      cfg.min_depth,
+      cfg.max_depth,
+      cfg.min_batch_bytes,
+      cfg.max_batch_bytes);
+}
+
+void pipeline_controller::record(clock_type::duration rtt, bool limited) {
+    rtt = std::max(rtt, clock_type::duration(1));
+
+    if (_srtt == clock_type::duration(0)) {
+        _srtt = rtt;
+    } else {
+        _srtt += std::chrono::duration_cast<clock_type::duration>(
+          (rtt - _srtt) * srtt_gain);
+    }
+
+    _min_rtt = std::min(_min_rtt, rtt);
+    _window_min_rtt = std::min(_window_min_rtt, rtt);
+    if (++_window_samples >= min_rtt_window) {
+        _min_rtt = _window_min_rtt;
+        _window_min_rtt = clock_type::duration::max();
+        _window_samples = 0;
+    }
+
+    _round_limited |= limited;
+    on_reply();
+}
+
+void pipeline_controller::record_failure() {
+    _round_failed = true;
+    on_reply();
+}
+
+void pipeline_controller::on_reply() {
+    // adjust once per round trip of the whole pipeline, a reply is only
+    // influenced by adjustments made before the request was sent
+    if (++_round_samples < _depth) {
+        return;
+    }
+    const auto round_limited = std::exchange(_round_limited, false);
+    _round_samples = 0;
+
+    // as a loss in TCP, a failed request shrinks the pipeline once a round
+    if (std::exchange(_round_failed, false)) {
+        shrink();
+        return;
+    }
+
+    const auto queued = _depth
+                        * (1.0
+                           - std::chrono::duration<double>(_min_rtt)
+                               / std::chrono::duration<double>(_srtt));
+    if (queued > shrink_above_queued) {
+        shrink();
+    } else if (queued < grow_below_queued && round_limited) {
+        grow();
+    }
+}
+
+void pipeline_controller::grow() {
+    if (_depth < _cfg.max_depth) {
+        ++_depth;
+        return;
+    }
+    _batch_bytes = _batch_bytes > _cfg.max_batch_bytes / 2
+                     ? _cfg.max_batch_bytes
+                     : std::max(_batch_bytes * 2, _cfg.min_batch_bytes);
+}
+
+void pipeline_controller::shrink() {
+    // request size only grows at the maximum depth
+    if (_depth == _cfg.max_depth && _batch_bytes > _cfg.min_batch_bytes) {
+        _batch_bytes = std::max(_cfg.min_batch_bytes, _batch_bytes / 2);
+        return;
+    }
+    // multiplicative decrease, congestion builds up quickly with deep pipes
+    _depth = std::max(_cfg.min_depth, _depth - std::max(_depth / 4, 1U));
+}
+
+std::ostream& operator<<(std::ostream& o, const pipeline_controller& c) {
+    fmt::print(
+      o,
+      "{{depth: {}, batch_bytes: {}, srtt: {}us, min_rtt: {}us}}",
+      c._depth,
+      c._batch_bytes,
+      std::chrono::duration_cast<std::chrono::microseconds>(c._srtt).count(),
+      std::chrono::duration_cast<std::chrono::microseconds>(c.min_rtt())
+        .count());
+    return o;
+}
+
+} // namespace raft
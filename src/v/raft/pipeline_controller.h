@@ -0,0 +1,113 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+
+namespace raft {
+
+/**
+ * Adaptive pipelining of append entries requests sent to a single follower.
+ *
+ * The controller tracks the smallest observed round trip of an append
+ * entries request (the cost of an empty pipe: network propagation plus the
+ * follower append) and the smoothed round trip (the follower ack latency
+ * under the current load). Their ratio tells how many of the in flight
+ * requests are queued rather than being processed:
+ *
+ *      queued = depth * (1 - min_rtt / srtt)
+ *
+ * Once per round of `depth` replies the controller:
+ *
+ *  - grows the pipeline when the requests had to wait for a free slot and
+ *    almost nothing is queued, first its depth and then, when the depth is
+ *    at its upper bound, the size of a request,
+ *  - shrinks the pipeline when requests queue up, undoing the growth in the
+ *    reverse order: first the request size, then the depth.
+ *
+ * Requests start at the maximum size, the pipeline only trades it for depth
+ * when it is congested at its maximum depth.
+ *
+ * With few partitions over high latency links this fills the pipe, with many
+ * partitions it keeps the follower queues, and the latency, short.
+ */
+class pipeline_controller {
+public:
+    // round trips are too short to be measured with the lowres clock
+    using clock_type = std::chrono::steady_clock;
+
+    struct config {
+        uint32_t initial_depth;
+        uint32_t min_depth;
+        uint32_t max_depth;
+        size_t min_batch_bytes;
+        size_t max_batch_bytes;
+
+        /// false when the pipeline can neither change its depth nor its
+        /// request size
+        bool is_adaptive() const {
+            return min_depth < max_depth || min_batch_bytes < max_batch_bytes;
+        }
+    };
+
+    /// A pipeline which never changes its depth nor limits request sizes
+    static config fixed(uint32_t depth);
+
+    explicit pipeline_controller(config);
+
+    /**
+     * Records the round trip of an append entries request. `limited` is set
+     * when the request had to wait for a free pipeline slot.
+     */
+    void record(clock_type::duration rtt, bool limited);
+
+    /**
+     * Records an append entries request which failed or timed out. Its round
+     * trip is unknown, it counts as congestion: the pipeline shrinks at the
+     * end of the round.
+     */
+    void record_failure();
+
+    uint32_t depth() const { return _depth; }
+    size_t batch_bytes() const { return _batch_bytes; }
+    clock_type::duration smoothed_rtt() const { return _srtt; }
+    /// zero until the first round trip is recorded
+    clock_type::duration min_rtt() const {
+        return _min_rtt == clock_type::duration::max()
+                 ? clock_type::duration(0)
+                 : _min_rtt;
+    }
+
+private:
+    friend std::ostream& operator<<(std::ostream&, const pipeline_controller&);
+
+    void on_reply();
+    void grow();
+    void shrink();
+
+    config _cfg;
+    uint32_t _depth;
+    size_t _batch_bytes;
+
+    clock_type::duration _srtt{0};
+    clock_type::duration _min_rtt{clock_type::duration::max()};
+    // minimum of the current window, it replaces `_min_rtt` when the window
+    // ends so that the baseline follows route and load changes
+    clock_type::duration _window_min_rtt{clock_type::duration::max()};
+    uint32_t _window_samples{0};
+
+    uint32_t _round_samples{0};
+    bool _round_limited{false};
+    bool _round_failed{false};
+};
+
+} // namespace raft
@@ -9,6 +9,7 @@
 
 #include "raft/recovery_stm.h"
 
+#include "config/configuration.h"
 #include "model/fundamental.h"
 #include "model/record_batch_reader.h"
 #include "outcome_future_utils.h"
@@ -143,8 +144,13 @@ ss::future<> recovery_stm::do_recover(ss::io_priority_class iopc) {
     }
     // acquire read memory:
     auto read_memory_units = co_await _memory_quota.acquire_read_memory();
+    // the follower pipeline may ask for smaller requests than the quota
+    // allows when the link to the follower is congested
+    const auto read_size = std::min(
+      read_memory_units.count(),
+      _ptr->_fstats.append_entries_batch_bytes(_node_id));
     auto reader = co_await read_range_for_recovery(
-      follower_next_offset, iopc, is_learner, read_memory_units.count());
+      follower_next_offset, iopc, is_learner, read_size);
     // no batches for recovery, do nothing
     if (!reader) {
         co_return;
@@ -486,6 +492,12 @@ ss::future<result<append_entries_reply>> recovery_stm::dispatch_append_entries(
     rpc::client_opts opts(append_entries_timeout());
     opts.resource_units = ss::make_foreign(
       ss::make_lw_shared<std::vector<ss::semaphore_units<>>>(std::move(units)));
+    if (auto min_bytes
+        = config::shard_local_cfg().raft_replicate_compression_min_bytes();
+        min_bytes) {
+        opts.compression = rpc::compression_type::zstd;
+        opts.min_compression_bytes = *min_bytes;
+    }
 
     return _ptr->_client_protocol
       .append_entries(_node_id.id(), std::move(r), std::move(opts))
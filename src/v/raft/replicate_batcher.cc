@@ -42,13 +42,15 @@ replicate_batcher::replicate_batcher(consensus* ptr, size_t cache_size)
 replicate_stages replicate_batcher::replicate(
   std::optional<model::term_id> expected_term,
   model::record_batch_reader&& r,
-  consistency_level consistency_lvl) {
+  consistency_level consistency_lvl,
+  request_trace_ptr trace) {
     ss::promise<> enqueued;
     auto enqueued_f = enqueued.get_future();
     try {
         gate_guard guard(_bg);
         auto f
-          = do_cache(expected_term, std::move(r), consistency_lvl)
+          = do_cache(
+              expected_term, std::move(r), consistency_lvl, std::move(trace))
               .then_wrapped(
                 [this,
                  enqueued = std::move(enqueued),
@@ -105,10 +107,11 @@ ss::future<> replicate_batcher::stop() {
 ss::future<replicate_batcher::item_ptr> replicate_batcher::do_cache(
   std::optional<model::term_id> expected_term,
   model::record_batch_reader&& r,
-  consistency_level consistency_lvl) {
+  consistency_level consistency_lvl,
+  request_trace_ptr trace) {
     return model::consume_reader_to_memory(std::move(r), model::no_timeout)
-      .then([this, expected_term, consistency_lvl](
-              ss::circular_buffer<model::record_batch> batches) {
+      .then([this, expected_term, consistency_lvl, trace = std::move(trace)](
+              ss::circular_buffer<model::record_batch> batches) mutable {
           ss::circular_buffer<model::record_batch> data;
           size_t bytes = std::accumulate(
             batches.cbegin(),
@@ -118,7 +121,11 @@ ss::future<replicate_batcher::item_ptr> replicate_batcher::do_cache(
                 return sum + b.size_bytes();
             });
           return do_cache_with_backpressure(
-            expected_term, std::move(batches), bytes, consistency_lvl);
+            expected_term,
+            std::move(batches),
+            bytes,
+            consistency_lvl,
+            std::move(trace));
       });
 }
 
@@ -127,7 +134,8 @@ replicate_batcher::do_cache_with_backpressure(
   std::optional<model::term_id> expected_term,
   ss::circular_buffer<model::record_batch> batches,
   size_t bytes,
-  consistency_level consistency_lvl) {
+  consistency_level consistency_lvl,
+  request_trace_ptr trace) {
     /**
      * Produce a message larger than the internal raft batch accumulator
      * (default 1Mb) the semaphore can't be acquired. Closing
@@ -142,27 +150,31 @@ replicate_batcher::do_cache_with_backpressure(
      */
 
     return ss::get_units(_max_batch_size_sem, std::min(bytes, _max_batch_size))
-      .then(
-        [this, expected_term, batches = std::move(batches), consistency_lvl](
-          ss::semaphore_units<> u) mutable {
-            size_t record_count = 0;
-            auto i = ss::make_lw_shared<item>();
-            for (auto& b : batches) {
-                record_count += b.record_count();
-                if (b.header().ctx.owner_shard == ss::this_shard_id()) {
-                    i->data.push_back(std::move(b));
-                } else {
-                    i->data.push_back(b.copy());
-                }
-            }
-            i->expected_term = expected_term;
-            i->record_count = record_count;
-            i->units = std::move(u);
-            i->consistency_lvl = consistency_lvl;
+      .then([this,
+             expected_term,
+             batches = std::move(batches),
+             consistency_lvl,
+             trace = std::move(trace)](ss::semaphore_units<> u) mutable {
+          size_t record_count = 0;
+          auto i = ss::make_lw_shared<item>();
+          for (auto& b : batches) {
+              record_count += b.record_count();
+              if (b.header().ctx.owner_shard == ss::this_shard_id()) {
+                  i->data.push_back(std::move(b));
+              } else {
+                  i->data.push_back(b.copy());
+              }
+          }
+          i->expected_term = expected_term;
+          i->record_count = record_count;
+          i->units = std::move(u);
+          i->consistency_lvl = consistency_lvl;
+          mark_trace(trace, trace_stage::batcher_enqueued);
+          i->trace = std::move(trace);
 
-            _item_cache.emplace_back(i);
-            return i;
-        });
+          _item_cache.emplace_back(i);
+          return i;
+      });
 }
 
 ss::future<> replicate_batcher::flush(
@@ -215,6 +227,7 @@ ss::future<> replicate_batcher::flush(
                     needs_flush
                       = append_entries_request::flush_after_append::yes;
                 }
+                mark_trace(n->trace, trace_stage::batcher_flushed);
                 for (auto& b : n->data) {
                     b.set_term(term);
                     data.push_back(std::move(b));
@@ -272,6 +285,7 @@ static void propagate_result(
     auto last_offset = r.value().last_offset;
     for (auto it = notifications.rbegin(); it != notifications.rend(); ++it) {
         if (pred(*it)) {
+            mark_trace((*it)->trace, trace_stage::replicated);
             (*it)->_promise.set_value(replicate_result{last_offset});
         }
         last_offset = last_offset - model::offset((*it)->record_count);
@@ -296,9 +310,17 @@ ss::future<> replicate_batcher::do_flush(
     _ptr->_probe.replicate_batch_flushed();
     auto stm = ss::make_lw_shared<replicate_entries_stm>(
       _ptr, std::move(req), std::move(seqs));
+    for (auto& n : notifications) {
+        if (n->trace) {
+            stm->add_trace(n->trace);
+        }
+    }
     try {
         auto holder = _bg.hold();
         auto leader_result = co_await stm->apply(std::move(u));
+        for (auto& n : notifications) {
+            mark_trace(n->trace, trace_stage::log_appended);
+        }
 
         /**
          * First phase, if leader result has error just propagate error
@@ -39,6 +39,7 @@ public:
          * processing the request.
          */
         ss::semaphore_units<> units;
+        request_trace_ptr trace;
     };
     using item_ptr = ss::lw_shared_ptr<item>;
     explicit replicate_batcher(consensus* ptr, size_t cache_size);
@@ -52,7 +53,8 @@ public:
     replicate_stages replicate(
       std::optional<model::term_id>,
       model::record_batch_reader&&,
-      consistency_level);
+      consistency_level,
+      request_trace_ptr = nullptr);
 
     ss::future<> flush(ss::semaphore_units<> u, bool const transfer_flush);
 
@@ -68,12 +70,14 @@ private:
     ss::future<item_ptr> do_cache(
       std::optional<model::term_id>,
       model::record_batch_reader&&,
-      consistency_level);
+      consistency_level,
+      request_trace_ptr);
     ss::future<replicate_batcher::item_ptr> do_cache_with_backpressure(
       std::optional<model::term_id>,
       ss::circular_buffer<model::record_batch>,
       size_t,
-      consistency_level);
+      consistency_level,
+      request_trace_ptr);
 
     consensus* _ptr;
     ss::semaphore _max_batch_size_sem;
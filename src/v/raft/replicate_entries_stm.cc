@@ -9,6 +9,7 @@
 
 #include "raft/replicate_entries_stm.h"
 
+#include "config/configuration.h"
 #include "likely.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
@@ -55,7 +56,12 @@ ss::future<result<append_entries_reply>> replicate_entries_stm::flush_log() {
     }
 
     auto f = flush_f
-               .then([this]() {
+               .then([this, flushed = bool(_req->flush)]() {
+                   if (flushed) {
+                       for (auto& t : _traces) {
+                           t->mark(trace_stage::log_flushed);
+                       }
+                   }
                    /**
                     * Replicate STM _dirty_offset is set to the dirty offset of
                     * a log after successfull self append. After flush we are
@@ -99,9 +105,18 @@ replicate_entries_stm::send_append_entries_request(
 
     auto opts = rpc::client_opts(append_entries_timeout());
     opts.resource_units = ss::make_foreign<ss::lw_shared_ptr<units_t>>(_units);
+    if (auto min_bytes
+        = config::shard_local_cfg().raft_replicate_compression_min_bytes();
+        min_bytes) {
+        opts.compression = rpc::compression_type::zstd;
+        opts.min_compression_bytes = *min_bytes;
+    }
 
-    auto f = _ptr->_fstats.get_append_entries_unit(n).then_wrapped(
-      [this, req = std::move(req), opts = std::move(opts), n](
+    auto units_f = _ptr->_fstats.get_append_entries_unit(n);
+    // the follower pipeline is full when the unit is not available right away
+    const bool limited = !units_f.available();
+    auto f = std::move(units_f).then_wrapped(
+      [this, req = std::move(req), opts = std::move(opts), n, limited](
         ss::future<ss::semaphore_units<>> f) mutable {
           // we want to signal dispatch semaphore after calling append entries.
           // When dispatch semaphore is released the append_entries_stm releases
@@ -116,9 +131,20 @@ replicate_entries_stm::send_append_entries_request(
           }
           auto u = f.get();
 
+          const auto sent_at = pipeline_controller::clock_type::now();
           return _ptr->_client_protocol
             .append_entries(n.id(), std::move(req), std::move(opts))
-            .then([this](result<append_entries_reply> reply) {
+            .then([this, n, sent_at, limited](
+                    result<append_entries_reply> reply) {
+                if (reply) {
+                    _ptr->_fstats.record_append_entries_rtt(
+                      n,
+                      pipeline_controller::clock_type::now() - sent_at,
+                      limited);
+                } else {
+                    // timed out or not delivered, a congestion signal
+                    _ptr->_fstats.record_append_entries_failure(n);
+                }
                 return _ptr->validate_reply_target_node(
                   "append_entries_replicate", std::move(reply));
             })
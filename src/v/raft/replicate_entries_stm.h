@@ -19,6 +19,7 @@
 #include "raft/logger.h"
 #include "seastarx.h"
 #include "storage/types.h"
+#include "utils/request_trace.h"
 
 #include <seastar/core/gate.hh>
 #include <seastar/core/semaphore.hh>
@@ -105,6 +106,10 @@ public:
      */
     ss::future<> wait_for_shutdown();
 
+    /// Sampled requests carried by this append, stamped when the leader log
+    /// is flushed
+    void add_trace(request_trace_ptr t) { _traces.push_back(std::move(t)); }
+
 private:
     ss::future<append_entries_request> share_request();
 
@@ -135,6 +140,7 @@ private:
     ss::lw_shared_ptr<std::vector<ss::semaphore_units<>>> _units;
     std::optional<result<storage::append_result>> _append_result;
     uint16_t _requests_count = 0;
+    std::vector<request_trace_ptr> _traces;
 };
 
 } // namespace raft
@@ -115,7 +115,13 @@ ss::future<> state_machine::apply() {
       .then([this] {
           auto f = ss::now();
           if (_next < _raft->start_offset()) {
-              f = handle_eviction();
+              f = handle_eviction().then([this] {
+                  // the state up to the evicted prefix may have been
+                  // recovered from a snapshot
+                  if (_next > model::offset(0)) {
+                      _waiters.notify(model::prev_offset(_next));
+                  }
+              });
           }
           return f.then([this] {
               // build a reader for log range [_next, +inf).
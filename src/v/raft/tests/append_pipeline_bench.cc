@@ -0,0 +1,156 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "raft/follower_queue.h"
+#include "raft/pipeline_controller.h"
+#include "units.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/loop.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/testing/perf_tests.hh>
+
+#include <boost/range/irange.hpp>
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <chrono>
+
+/*
+ * Replication throughput of a single partition to one follower across
+ * simulated round trips, with the static append entries pipeline and with
+ * the adaptive one.
+ *
+ * The leader keeps the follower pipeline full, every request goes through
+ * the follower queue exactly like in the replicate path. The simulated link
+ * serializes requests at `link_bandwidth` and adds the round trip, the
+ * follower appends one request at a time. The throughput and the final
+ * pipeline state are printed when a test finishes.
+ */
+
+namespace {
+
+using namespace std::chrono_literals;
+using clock_type = raft::pipeline_controller::clock_type;
+
+constexpr size_t request_size = 16_KiB;
+constexpr size_t requests_per_op = 128;
+// 10 Gbps
+constexpr double link_bandwidth = 1.25e9;
+constexpr auto follower_append_time = 20us;
+// production defaults
+constexpr uint32_t initial_depth = 16;
+constexpr uint32_t max_depth = 64;
+
+raft::pipeline_controller::config make_config(bool adaptive) {
+    if (!adaptive) {
+        return raft::pipeline_controller::fixed(initial_depth);
+    }
+    return raft::pipeline_controller::config{
+      .initial_depth = initial_depth,
+      .min_depth = 1,
+      .max_depth = max_depth,
+      .min_batch_bytes = 32_KiB,
+      .max_batch_bytes = 512_KiB,
+    };
+}
+
+template<int rtt_us, bool adaptive>
+struct pipeline_fixture {
+    pipeline_fixture()
+      : controller(make_config(adaptive))
+      , queue(controller.depth()) {}
+
+    pipeline_fixture(const pipeline_fixture&) = delete;
+    pipeline_fixture& operator=(const pipeline_fixture&) = delete;
+    pipeline_fixture(pipeline_fixture&&) = delete;
+    pipeline_fixture& operator=(pipeline_fixture&&) = delete;
+
+    ~pipeline_fixture() {
+        if (requests == 0) {
+            return;
+        }
+        const auto elapsed = std::chrono::duration<double>(
+          clock_type::now() - started);
+        fmt::print(
+          "rtt {}us, {} pipeline: {:.1f} MiB/s, depth {}, srtt {}us\n",
+          rtt_us,
+          adaptive ? "adaptive" : "static",
+          double(requests * request_size) / elapsed.count() / double(1_MiB),
+          controller.depth(),
+          std::chrono::duration_cast<std::chrono::microseconds>(
+            controller.smoothed_rtt())
+            .count());
+    }
+
+    /// One-way trip, transmission and follower append of a request
+    ss::future<> deliver() {
+        const auto now = clock_type::now();
+        const auto tx = std::chrono::duration_cast<clock_type::duration>(
+          std::chrono::duration<double>(double(request_size) / link_bandwidth));
+        link_free_at = std::max(link_free_at, now) + tx;
+        const auto arrival = link_free_at
+                             + std::chrono::microseconds(rtt_us / 2);
+        follower_free_at = std::max(follower_free_at, arrival)
+                           + follower_append_time;
+        // the reply travels back
+        co_await ss::sleep(
+          follower_free_at + std::chrono::microseconds(rtt_us / 2) - now);
+    }
+
+    ss::future<> send_one() {
+        auto units_f = queue.get_append_entries_unit();
+        const bool limited = !units_f.available();
+        auto units = co_await std::move(units_f);
+        const auto sent_at = clock_type::now();
+        co_await deliver();
+        controller.record(clock_type::now() - sent_at, limited);
+        queue.set_max_concurrent_append_entries(controller.depth());
+    }
+
+    ss::future<size_t> run() {
+        if (requests == 0) {
+            started = clock_type::now();
+        }
+        requests += requests_per_op;
+        perf_tests::start_measuring_time();
+        co_await ss::parallel_for_each(
+          boost::irange<size_t>(0, requests_per_op),
+          [this](size_t) { return send_one(); });
+        perf_tests::stop_measuring_time();
+        co_return requests_per_op;
+    }
+
+    raft::pipeline_controller controller;
+    raft::follower_queue queue;
+    clock_type::time_point link_free_at;
+    clock_type::time_point follower_free_at;
+    size_t requests{0};
+    clock_type::time_point started;
+};
+
+using static_rtt_100us = pipeline_fixture<100, false>;
+using adaptive_rtt_100us = pipeline_fixture<100, true>;
+using static_rtt_1ms = pipeline_fixture<1'000, false>;
+using adaptive_rtt_1ms = pipeline_fixture<1'000, true>;
+using static_rtt_10ms = pipeline_fixture<10'000, false>;
+using adaptive_rtt_10ms = pipeline_fixture<10'000, true>;
+using static_rtt_50ms = pipeline_fixture<50'000, false>;
+using adaptive_rtt_50ms = pipeline_fixture<50'000, true>;
+
+} // namespace
+
+PERF_TEST_F(static_rtt_100us, replicate) { return run(); }
+PERF_TEST_F(adaptive_rtt_100us, replicate) { return run(); }
+PERF_TEST_F(static_rtt_1ms, replicate) { return run(); }
+PERF_TEST_F(adaptive_rtt_1ms, replicate) { return run(); }
+PERF_TEST_F(static_rtt_10ms, replicate) { return run(); }
+PERF_TEST_F(adaptive_rtt_10ms, replicate) { return run(); }
+PERF_TEST_F(static_rtt_50ms, replicate) { return run(); }
+PERF_TEST_F(adaptive_rtt_50ms, replicate) { return run(); }
@@ -7,6 +7,7 @@
 // the Business Source License, use of this software will be governed
 // by the Apache License, Version 2.0
 
+#include "bytes/iobuf_parser.h"
 #include "model/adl_serde.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
@@ -20,12 +21,14 @@
 #include "storage/log.h"
 #include "storage/log_manager.h"
 #include "storage/record_batch_builder.h"
+#include "storage/snapshot.h"
 #include "test_utils/randoms.h"
 // testing
 #include "raft/tests/simple_record_fixture.h"
 #include "test_utils/fixture.h"
 
 #include <seastar/core/print.hh>
+#include <seastar/core/seastar.hh>
 #include <seastar/util/log.hh>
 
 using namespace std::chrono_literals; // NOLINT
@@ -115,3 +118,35 @@ FIXTURE_TEST(empty_log, bootstrap_fixture) {
     BOOST_REQUIRE_EQUAL(cfg.data_batches_seen(), 0);
     BOOST_REQUIRE_EQUAL(cfg.config_batches_seen(), 0);
 }
+
+FIXTURE_TEST(replica_bootstrapped_from_log_suffix, bootstrap_fixture) {
+    // the downloaded segments of a new replica start at offset 100
+    storage::ntp_config ntp_cfg(
+      _ntp, "test.dir", nullptr, model::revision_id(7));
+    ss::recursive_touch_directory(ntp_cfg.work_directory()).get();
+    raft::details::bootstrap_replica_from_log_suffix(
+      ntp_cfg,
+      model::offset(100),
+      model::term_id(3),
+      raft::offset_translator_delta(12))
+      .get();
+
+    storage::simple_snapshot_manager snapshot_mgr(
+      std::filesystem::path(ntp_cfg.work_directory()),
+      storage::simple_snapshot_manager::default_snapshot_filename,
+      ss::default_priority_class());
+    auto reader = snapshot_mgr.open_snapshot().get0();
+    BOOST_REQUIRE(reader.has_value());
+    auto parser = iobuf_parser(reader->read_metadata().get0());
+    auto meta = reflection::adl<raft::snapshot_metadata>{}.from(parser);
+    reader->close().get();
+
+    BOOST_REQUIRE_EQUAL(meta.last_included_index, model::offset(99));
+    BOOST_REQUIRE_EQUAL(meta.last_included_term, model::term_id(3));
+    BOOST_REQUIRE_EQUAL(
+      meta.log_start_delta, raft::offset_translator_delta(12));
+    // the configuration is recovered from the downloaded segments
+    BOOST_REQUIRE_EQUAL(
+      meta.latest_configuration.revision_id(), model::revision_id(7));
+    BOOST_REQUIRE(meta.latest_configuration.brokers().empty());
+}
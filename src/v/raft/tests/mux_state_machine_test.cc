@@ -15,6 +15,7 @@
 #include "raft/types.h"
 #include "random/generators.h"
 #include "reflection/adl.h"
+#include "serde/serde.h"
 #include "storage/record_batch_builder.h"
 #include "storage/tests/utils/disk_log_builder.h"
 #include "test_utils/async.h"
@@ -164,6 +165,33 @@ struct simple_kv {
     }
 };
 
+template<int8_t bt>
+struct snapshotable_kv : simple_kv<bt> {
+    ss::future<iobuf> take_snapshot(model::offset) {
+        std::vector<ss::sstring> keys;
+        std::vector<int> values;
+        for (const auto& [k, v] : this->kv_map) {
+            keys.push_back(k);
+            values.push_back(v);
+        }
+        iobuf buf;
+        serde::write(buf, std::move(keys));
+        serde::write(buf, std::move(values));
+        return ss::make_ready_future<iobuf>(std::move(buf));
+    }
+
+    ss::future<> apply_snapshot(model::offset, iobuf&& buf) {
+        iobuf_parser parser(std::move(buf));
+        auto keys = serde::read<std::vector<ss::sstring>>(parser);
+        auto values = serde::read<std::vector<int>>(parser);
+        this->kv_map.clear();
+        for (size_t i = 0; i < keys.size(); ++i) {
+            this->kv_map.emplace(std::move(keys[i]), values[i]);
+        }
+        return ss::now();
+    }
+};
+
 ss::logger kvlog{"kv-test"};
 
 template<typename T>
@@ -447,3 +475,58 @@ FIXTURE_TEST(timeout_test, mux_state_machine_fixture) {
     state_1.as.request_abort();
     BOOST_REQUIRE_EQUAL(res, raft::errc::timeout);
 }
+
+FIXTURE_TEST(test_snapshot_recovery, mux_state_machine_fixture) {
+    start_raft();
+    snapshotable_kv<batch_type_1> state_1;
+    snapshotable_kv<batch_type_2> state_2;
+    {
+        raft::mux_state_machine stm(
+          kvlog,
+          _raft.get(),
+          raft::persistent_last_applied::yes,
+          state_1,
+          state_2);
+        stm.start().get0();
+        auto stop = ss::defer([&stm] { stm.stop().get0(); });
+        wait_for_becoming_leader();
+        ss::abort_source as;
+
+        for (int i = 0; i < 10; ++i) {
+            auto res = stm
+                         .replicate_and_wait(
+                           serialize_cmd(
+                             set_cmd{fmt::format("key-{}", i), i},
+                             i % 2 == 0 ? batch_type_1 : batch_type_2),
+                           model::timeout_clock::now() + 2s,
+                           as)
+                         .get0();
+            BOOST_REQUIRE_EQUAL(res, errc::success);
+        }
+        stm.write_snapshot().get0();
+    }
+    // snapshot covers all the applied entries
+    BOOST_REQUIRE_EQUAL(
+      _raft->start_offset(),
+      model::next_offset(_raft->committed_offset()));
+
+    // a new state machine recovers the states from the snapshot as the log
+    // prefix is gone
+    snapshotable_kv<batch_type_1> recovered_1;
+    snapshotable_kv<batch_type_2> recovered_2;
+    raft::mux_state_machine stm(
+      kvlog,
+      _raft.get(),
+      raft::persistent_last_applied::yes,
+      recovered_1,
+      recovered_2);
+    stm.start().get0();
+    auto stop = ss::defer([&stm] { stm.stop().get0(); });
+    stm.wait(_raft->committed_offset(), model::timeout_clock::now() + 1s)
+      .get0();
+
+    BOOST_REQUIRE_EQUAL(recovered_1.kv_map.size(), 5);
+    BOOST_REQUIRE_EQUAL(recovered_2.kv_map.size(), 5);
+    BOOST_REQUIRE(recovered_1.kv_map == state_1.kv_map);
+    BOOST_REQUIRE(recovered_2.kv_map == state_2.kv_map);
+}
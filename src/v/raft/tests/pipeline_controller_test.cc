@@ -0,0 +1,132 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#define BOOST_TEST_MODULE raft
+#include "raft/pipeline_controller.h"
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+raft::pipeline_controller::config adaptive_config() {
+    return raft::pipeline_controller::config{
+      .initial_depth = 4,
+      .min_depth = 1,
+      .max_depth = 32,
+      .min_batch_bytes = 32 * 1024,
+      .max_batch_bytes = 512 * 1024,
+    };
+}
+
+// records `rounds` full rounds of replies with the same round trip
+void record_rounds(
+  raft::pipeline_controller& c,
+  int rounds,
+  std::chrono::microseconds rtt,
+  bool limited) {
+    for (int r = 0; r < rounds; ++r) {
+        const auto depth = c.depth();
+        for (uint32_t i = 0; i < depth; ++i) {
+            c.record(rtt, limited);
+        }
+    }
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_CASE(test_fixed_pipeline_never_changes) {
+    raft::pipeline_controller c(raft::pipeline_controller::fixed(16));
+    record_rounds(c, 100, 100us, true);
+    BOOST_REQUIRE_EQUAL(c.depth(), 16);
+    record_rounds(c, 100, 100ms, true);
+    BOOST_REQUIRE_EQUAL(c.depth(), 16);
+    BOOST_REQUIRE_EQUAL(
+      c.batch_bytes(), raft::pipeline_controller::fixed(16).max_batch_bytes);
+}
+
+BOOST_AUTO_TEST_CASE(test_grows_only_when_limited) {
+    raft::pipeline_controller c(adaptive_config());
+    // round trip does not grow with depth, the pipe is not full
+    record_rounds(c, 10, 10ms, false);
+    BOOST_REQUIRE_EQUAL(c.depth(), 4);
+
+    record_rounds(c, 10, 10ms, true);
+    BOOST_REQUIRE_EQUAL(c.depth(), 14);
+
+    record_rounds(c, 100, 10ms, true);
+    BOOST_REQUIRE_EQUAL(c.depth(), 32);
+    BOOST_REQUIRE_EQUAL(c.batch_bytes(), 512 * 1024);
+}
+
+BOOST_AUTO_TEST_CASE(test_shrinks_when_requests_queue_up) {
+    raft::pipeline_controller c(adaptive_config());
+    record_rounds(c, 30, 1ms, true);
+    BOOST_REQUIRE_EQUAL(c.depth(), 32);
+
+    // the round trip doubles, half of the requests are queued
+    record_rounds(c, 50, 2ms, true);
+    BOOST_REQUIRE_LT(c.depth(), 32);
+    // request size is traded first when congested at the maximum depth
+    BOOST_REQUIRE_EQUAL(c.batch_bytes(), 32 * 1024);
+    BOOST_REQUIRE_EQUAL(
+      std::chrono::duration_cast<std::chrono::microseconds>(c.min_rtt()),
+      1ms);
+}
+
+BOOST_AUTO_TEST_CASE(test_request_size_grows_back_at_maximum_depth) {
+    raft::pipeline_controller c(adaptive_config());
+    record_rounds(c, 30, 1ms, true);
+    record_rounds(c, 4, 4ms, true);
+    BOOST_REQUIRE_EQUAL(c.depth(), 32);
+    BOOST_REQUIRE_LT(c.batch_bytes(), 512 * 1024);
+
+    // latency back to the baseline
+    record_rounds(c, 100, 1ms, true);
+    BOOST_REQUIRE_EQUAL(c.depth(), 32);
+    BOOST_REQUIRE_EQUAL(c.batch_bytes(), 512 * 1024);
+}
+
+BOOST_AUTO_TEST_CASE(test_failures_shrink_the_pipeline) {
+    raft::pipeline_controller c(adaptive_config());
+    record_rounds(c, 30, 1ms, true);
+    BOOST_REQUIRE_EQUAL(c.depth(), 32);
+    const auto min_rtt = c.min_rtt();
+
+    // a single failed request in a round of otherwise fast replies
+    c.record_failure();
+    for (uint32_t i = 1; i < 32; ++i) {
+        c.record(1ms, true);
+    }
+    BOOST_REQUIRE_EQUAL(c.batch_bytes(), 256 * 1024);
+    // timed out requests are not round trip samples
+    BOOST_REQUIRE(c.min_rtt() == min_rtt);
+
+    for (int r = 0; r < 10; ++r) {
+        const auto depth = c.depth();
+        for (uint32_t i = 0; i < depth; ++i) {
+            c.record_failure();
+        }
+    }
+    BOOST_REQUIRE_LT(c.depth(), 32);
+}
+
+BOOST_AUTO_TEST_CASE(test_fixed_pipeline_ignores_failures) {
+    BOOST_REQUIRE(!raft::pipeline_controller::fixed(16).is_adaptive());
+    BOOST_REQUIRE(adaptive_config().is_adaptive());
+
+    raft::pipeline_controller c(raft::pipeline_controller::fixed(16));
+    for (int i = 0; i < 100; ++i) {
+        c.record_failure();
+    }
+    BOOST_REQUIRE_EQUAL(c.depth(), 16);
+}
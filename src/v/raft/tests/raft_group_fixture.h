@@ -105,7 +105,8 @@ struct raft_node {
               std::nullopt),
             .default_read_buffer_size = config::mock_binding(512_KiB),
           };
-      }) {
+      })
+      , group_commit(config::mock_binding(1ms)) {
         _features.set_feature_active(
           raft::raft_feature::improved_config_change);
         cache.start().get();
@@ -167,7 +168,8 @@ struct raft_node {
           storage.local(),
           recovery_throttle.local(),
           recovery_mem_quota,
-          _features);
+          _features,
+          group_commit);
 
         // create connections to initial nodes
         consensus->config().for_each_broker(
@@ -216,6 +218,7 @@ struct raft_node {
         hbeats->start().get0();
         hbeats->register_group(consensus).get();
         started = true;
+        group_commit.start(storage.local().log_mgr().config().base_dir);
         consensus->start().get0();
         if (log->config().is_collectable()) {
             _nop_stm = std::make_unique<raft::log_eviction_stm>(
@@ -253,6 +256,7 @@ struct raft_node {
               tstlog.info("Stopping raft at {}", broker.id());
               return consensus->stop();
           })
+          .then([this] { return group_commit.stop(); })
           .then([this] {
               if (_nop_stm != nullptr) {
                   return _nop_stm->stop();
@@ -348,6 +352,7 @@ struct raft_node {
     ss::sharded<test_raft_manager> raft_manager;
     leader_clb_t leader_callback;
     raft::recovery_memory_quota recovery_mem_quota;
+    raft::group_commit_coordinator group_commit;
     std::unique_ptr<raft::heartbeat_manager> hbeats;
     consensus_ptr consensus;
     std::unique_ptr<raft::log_eviction_stm> _nop_stm;
@@ -23,6 +23,7 @@
 #include "raft/group_configuration.h"
 #include "reflection/async_adl.h"
 #include "utils/named_type.h"
+#include "utils/request_trace.h"
 
 #include <seastar/core/condition-variable.hh>
 #include <seastar/core/io_priority_class.hh>
@@ -461,6 +462,8 @@ struct replicate_options {
       : consistency(l) {}
 
     consistency_level consistency;
+    // set when the originating request is sampled for latency tracing
+    request_trace_ptr trace;
 };
 
 using offset_translator_delta = named_type<int64_t, struct ot_delta_tag>;
@@ -42,6 +42,7 @@
 #include "json/schema.h"
 #include "json/stringbuffer.h"
 #include "json/writer.h"
+#include "kafka/server/handlers/handler_interface.h"
 #include "kafka/types.h"
 #include "model/fundamental.h"
 #include "model/metadata.h"
@@ -66,6 +67,7 @@
 #include "security/scram_algorithm.h"
 #include "security/scram_authenticator.h"
 #include "ssx/metrics.h"
+#include "utils/memory_accounting.h"
 #include "vlog.h"
 
 #include <seastar/core/coroutine.hh>
@@ -101,7 +103,10 @@ admin_server::admin_server(
   ss::sharded<cluster::shard_table>& st,
   ss::sharded<cluster::metadata_cache>& metadata_cache,
   ss::sharded<archival::scheduler_service>& archival_service,
-  ss::sharded<rpc::connection_cache>& connection_cache)
+  ss::sharded<rpc::connection_cache>& connection_cache,
+  ss::sharded<cpu_profiler>& cpu_profiler,
+  ss::sharded<heap_profiler>& heap_profiler,
+  ss::sharded<kafka::latency_tracer>& kafka_latency_tracer)
   : _log_level_timer([this] { log_level_timer_handler(); })
   , _server("admin")
   , _cfg(std::move(cfg))
@@ -112,7 +117,10 @@ admin_server::admin_server(
   , _metadata_cache(metadata_cache)
   , _connection_cache(connection_cache)
   , _auth(config::shard_local_cfg().admin_api_require_auth.bind(), _controller)
-  , _archival_service(archival_service) {}
+  , _archival_service(archival_service)
+  , _cpu_profiler(cpu_profiler)
+  , _heap_profiler(heap_profiler)
+  , _kafka_latency_tracer(kafka_latency_tracer) {}
 
 ss::future<> admin_server::start() {
     configure_metrics_route();
@@ -2762,6 +2770,51 @@ void admin_server::register_transaction_routes() {
       });
 }
 
+/**
+ * Collects the profiles of the shard named by the `shard` query parameter, or
+ * of every shard, and replies with the text `format` makes of them.
+ */
+template<typename Profiler, typename Format>
+static ss::future<ss::json::json_return_type> collect_profile(
+  ss::sharded<Profiler>& profiler,
+  const ss::httpd::request& req,
+  Format format) {
+    std::optional<ss::shard_id> shard;
+    if (auto s = req.get_query_param("shard"); !s.empty()) {
+        try {
+            shard = boost::lexical_cast<ss::shard_id>(s);
+        } catch (const boost::bad_lexical_cast&) {
+            throw ss::httpd::bad_param_exception(
+              fmt::format("Invalid shard: {}", s));
+        }
+        if (*shard >= ss::smp::count) {
+            throw ss::httpd::bad_param_exception(
+              fmt::format("Shard {} does not exist", *shard));
+        }
+    }
+
+    std::vector<typename Profiler::shard_profile> profiles;
+    if (shard) {
+        profiles.push_back(co_await profiler.invoke_on(
+          *shard, [](Profiler& p) { return p.collect(); }));
+    } else {
+        profiles = co_await profiler.map(
+          [](Profiler& p) { return p.collect(); });
+    }
+
+    using body_writer_t
+      = std::function<ss::future<>(ss::output_stream<char>&&)>;
+    co_return ss::json::json_return_type(body_writer_t(
+      [body = format(profiles)](ss::output_stream<char>&& os) {
+          return ss::do_with(
+            std::move(os),
+            body,
+            [](ss::output_stream<char>& os, const ss::sstring& body) {
+                return os.write(body).finally([&os] { return os.close(); });
+            });
+      }));
+}
+
 void admin_server::register_debug_routes() {
     register_route<user>(
       ss::httpd::debug_json::reset_leaders_info,
@@ -2804,6 +2857,213 @@ void admin_server::register_debug_routes() {
 
           co_return ss::json::json_return_type(ans);
       });
+
+    register_route<superuser>(
+      ss::httpd::debug_json::start_cpu_profiler,
+      [this](std::unique_ptr<ss::httpd::request> req)
+        -> ss::future<ss::json::json_return_type> {
+          auto sample_period = cpu_profiler::default_sample_period;
+          if (auto p = req->get_query_param("sample_period_ms"); !p.empty()) {
+              try {
+                  sample_period = std::chrono::milliseconds(
+                    boost::lexical_cast<unsigned int>(p));
+              } catch (const boost::bad_lexical_cast&) {
+                  throw ss::httpd::bad_param_exception(
+                    fmt::format("Invalid sample_period_ms: {}", p));
+              }
+          }
+          auto max_samples = cpu_profiler::default_max_samples;
+          if (auto p = req->get_query_param("max_samples"); !p.empty()) {
+              try {
+                  max_samples = boost::lexical_cast<size_t>(p);
+              } catch (const boost::bad_lexical_cast&) {
+                  throw ss::httpd::bad_param_exception(
+                    fmt::format("Invalid max_samples: {}", p));
+              }
+          }
+          if (sample_period.count() == 0 || max_samples == 0) {
+              throw ss::httpd::bad_param_exception(
+                "sample_period_ms and max_samples must be positive");
+          }
+
+          vlog(
+            logger.info,
+            "Starting cpu profiler: sample period {}ms, max samples {}",
+            sample_period.count(),
+            max_samples);
+          co_await _cpu_profiler.invoke_on_all(
+            [sample_period, max_samples](cpu_profiler& p) {
+                p.enable(sample_period, max_samples);
+            });
+          co_return ss::json::json_void();
+      });
+
+    register_route<superuser>(
+      ss::httpd::debug_json::stop_cpu_profiler,
+      [this](std::unique_ptr<ss::httpd::request>)
+        -> ss::future<ss::json::json_return_type> {
+          vlog(logger.info, "Stopping cpu profiler");
+          co_await _cpu_profiler.invoke_on_all(
+            [](cpu_profiler& p) { p.disable(); });
+          co_return ss::json::json_void();
+      });
+
+    register_route<superuser>(
+      ss::httpd::debug_json::get_cpu_profile,
+      [this](std::unique_ptr<ss::httpd::request> req)
+        -> ss::future<ss::json::json_return_type> {
+          auto format = req->get_query_param("format");
+          if (format.empty()) {
+              format = "folded";
+          }
+          if (format != "folded" && format != "pprof") {
+              throw ss::httpd::bad_param_exception(
+                fmt::format("Unknown cpu profile format: {}", format));
+          }
+
+          co_return co_await collect_profile(
+            _cpu_profiler,
+            *req,
+            [pprof = format == "pprof"](
+              const std::vector<cpu_profiler::shard_profile>& profiles) {
+                return pprof ? cpu_profiler::to_pprof(profiles)
+                             : cpu_profiler::to_folded(profiles);
+            });
+      });
+
+    register_route<superuser>(
+      ss::httpd::debug_json::start_heap_profiler,
+      [this](std::unique_ptr<ss::httpd::request> req)
+        -> ss::future<ss::json::json_return_type> {
+          auto sample_interval = heap_profiler::default_sample_interval;
+          if (auto p = req->get_query_param("sample_interval_bytes");
+              !p.empty()) {
+              try {
+                  sample_interval = boost::lexical_cast<size_t>(p);
+              } catch (const boost::bad_lexical_cast&) {
+                  throw ss::httpd::bad_param_exception(
+                    fmt::format("Invalid sample_interval_bytes: {}", p));
+              }
+          }
+          if (sample_interval == 0) {
+              throw ss::httpd::bad_param_exception(
+                "sample_interval_bytes must be positive");
+          }
+
+          vlog(
+            logger.info,
+            "Starting heap profiler: sample interval {} bytes",
+            sample_interval);
+          co_await _heap_profiler.invoke_on_all(
+            [sample_interval](heap_profiler& p) { p.enable(sample_interval); });
+          co_return ss::json::json_void();
+      });
+
+    register_route<superuser>(
+      ss::httpd::debug_json::stop_heap_profiler,
+      [this](std::unique_ptr<ss::httpd::request>)
+        -> ss::future<ss::json::json_return_type> {
+          vlog(logger.info, "Stopping heap profiler");
+          co_await _heap_profiler.invoke_on_all(
+            [](heap_profiler& p) { p.disable(); });
+          co_return ss::json::json_void();
+      });
+
+    register_route<superuser>(
+      ss::httpd::debug_json::get_heap_profile,
+      [this](std::unique_ptr<ss::httpd::request> req)
+        -> ss::future<ss::json::json_return_type> {
+          co_return co_await collect_profile(
+            _heap_profiler,
+            *req,
+            [](const std::vector<heap_profiler::shard_profile>& profiles) {
+                return heap_profiler::to_folded(profiles);
+            });
+      });
+
+    register_route<user>(
+      ss::httpd::debug_json::get_memory_accounting,
+      [](std::unique_ptr<ss::httpd::request>)
+        -> ss::future<ss::json::json_return_type> {
+          using live_bytes_t = std::array<size_t, memory_subsystem_count>;
+          using result_t = ss::httpd::debug_json::memory_accounting;
+          std::vector<result_t> ans;
+          for (ss::shard_id shard = 0; shard < ss::smp::count; ++shard) {
+              auto live = co_await ss::smp::submit_to(shard, [] {
+                  live_bytes_t ret{};
+                  for (size_t i = 0; i < memory_subsystem_count; ++i) {
+                      ret[i] = accounted_memory::live_bytes(
+                        static_cast<memory_subsystem>(i));
+                  }
+                  return ret;
+              });
+              for (size_t i = 0; i < memory_subsystem_count; ++i) {
+                  result_t r;
+                  r.shard = shard;
+                  r.subsystem = ss::sstring(
+                    to_string_view(static_cast<memory_subsystem>(i)));
+                  r.live_bytes = live[i];
+                  ans.push_back(std::move(r));
+              }
+          }
+          co_return ss::json::json_return_type(ans);
+      });
+
+    register_route<user>(
+      ss::httpd::debug_json::get_kafka_latency_traces,
+      [this](std::unique_ptr<ss::httpd::request>)
+        -> ss::future<ss::json::json_return_type> {
+          if (!_kafka_latency_tracer.local_is_initialized()) {
+              throw ss::httpd::base_exception(
+                "Kafka latency tracer is not running",
+                ss::httpd::reply::status_type::service_unavailable);
+          }
+          auto per_shard = co_await _kafka_latency_tracer.map(
+            [](kafka::latency_tracer& t) { return t.slowest(); });
+
+          std::vector<kafka::latency_tracer::trace_summary> traces;
+          for (auto& shard_traces : per_shard) {
+              std::move(
+                shard_traces.begin(),
+                shard_traces.end(),
+                std::back_inserter(traces));
+          }
+          std::sort(
+            traces.begin(), traces.end(), [](const auto& a, const auto& b) {
+                return a.total > b.total;
+            });
+
+          using result_t = ss::httpd::debug_json::latency_trace;
+          std::vector<result_t> ans;
+          ans.reserve(traces.size());
+          for (const auto& t : traces) {
+              result_t r;
+              r.shard = t.shard;
+              auto handler = kafka::handler_for_key(t.key);
+              r.request = handler ? ss::sstring((*handler)->name())
+                                  : ss::sstring("unknown");
+              r.total_us = t.total.count();
+              for (const auto& s : t.stages) {
+                  ss::httpd::debug_json::stage_latency sl;
+                  sl.stage = ss::sstring(to_string_view(s.stage));
+                  sl.elapsed_us = s.elapsed.count();
+                  r.stages.push(sl);
+              }
+              ans.push_back(std::move(r));
+          }
+          co_return ss::json::json_return_type(ans);
+      });
+
+    register_route<superuser>(
+      ss::httpd::debug_json::reset_kafka_latency_traces,
+      [this](std::unique_ptr<ss::httpd::request>)
+        -> ss::future<ss::json::json_return_type> {
+          if (_kafka_latency_tracer.local_is_initialized()) {
+              co_await _kafka_latency_tracer.invoke_on_all(
+                [](kafka::latency_tracer& t) { t.reset_slowest(); });
+          }
+          co_return ss::json::json_void();
+      });
 }
 
 void admin_server::register_cluster_routes() {
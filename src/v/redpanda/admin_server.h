@@ -14,10 +14,13 @@
 #include "cluster/fwd.h"
 #include "config/endpoint_tls_config.h"
 #include "coproc/partition_manager.h"
+#include "kafka/server/latency_tracer.h"
 #include "model/metadata.h"
 #include "request_auth.h"
 #include "rpc/connection_cache.h"
 #include "seastarx.h"
+#include "utils/cpu_profiler.h"
+#include "utils/heap_profiler.h"
 
 #include <seastar/core/scheduling.hh>
 #include <seastar/core/sstring.hh>
@@ -52,7 +55,10 @@ public:
       ss::sharded<cluster::shard_table>&,
       ss::sharded<cluster::metadata_cache>&,
       ss::sharded<archival::scheduler_service>&,
-      ss::sharded<rpc::connection_cache>&);
+      ss::sharded<rpc::connection_cache>&,
+      ss::sharded<cpu_profiler>&,
+      ss::sharded<heap_profiler>&,
+      ss::sharded<kafka::latency_tracer>&);
 
     ss::future<> start();
     ss::future<> stop();
@@ -207,4 +213,7 @@ private:
     request_authenticator _auth;
     bool _ready{false};
     ss::sharded<archival::scheduler_service>& _archival_service;
+    ss::sharded<cpu_profiler>& _cpu_profiler;
+    ss::sharded<heap_profiler>& _heap_profiler;
+    ss::sharded<kafka::latency_tracer>& _kafka_latency_tracer;
 };
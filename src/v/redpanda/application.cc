@@ -41,6 +41,7 @@
 #include "kafka/server/group_manager.h"
 #include "kafka/server/group_metadata_migration.h"
 #include "kafka/server/group_router.h"
+#include "kafka/server/latency_tracer.h"
 #include "kafka/server/protocol.h"
 #include "kafka/server/queue_depth_monitor.h"
 #include "kafka/server/quota_manager.h"
@@ -471,6 +472,8 @@ void application::configure_admin_server() {
     }
 
     syschecks::systemd_message("constructing http server").get();
+    construct_service(_cpu_profiler).get();
+    construct_service(_heap_profiler).get();
     construct_service(
       _admin,
       admin_server_cfg_from_global_cfg(_scheduling_groups),
@@ -480,7 +483,10 @@ void application::configure_admin_server() {
       std::ref(shard_table),
       std::ref(metadata_cache),
       std::ref(archival_scheduler),
-      std::ref(_connection_cache))
+      std::ref(_connection_cache),
+      std::ref(_cpu_profiler),
+      std::ref(_heap_profiler),
+      std::ref(kafka_latency_tracer))
       .get();
 }
 
@@ -499,7 +505,9 @@ static storage::kvstore_config kvstore_config_from_global_config() {
       config::shard_local_cfg().kvstore_max_segment_size(),
       config::shard_local_cfg().kvstore_flush_interval.bind(),
       config::node().data_directory().as_sstring(),
-      storage::debug_sanitize_files::no);
+      storage::debug_sanitize_files::no,
+      storage::kvstore_incremental_snapshots(
+        config::shard_local_cfg().kvstore_incremental_snapshots()));
 }
 
 static storage::log_config
@@ -786,6 +794,7 @@ void application::wire_up_redpanda_services() {
     // metrics and quota management
     syschecks::systemd_message("Adding kafka quota manager").get();
     construct_service(quota_mgr).get();
+    construct_service(kafka_latency_tracer).get();
 
     _deferred.emplace_back([this] {
         if (_kafka_server.local_is_initialized()) {
@@ -1423,6 +1432,7 @@ void application::start_kafka(::stop_signal& app_signal) {
             tx_gateway_frontend,
             cp_partition_manager,
             data_policies,
+            kafka_latency_tracer,
             qdc_config);
           s.set_protocol(std::move(proto));
       })
@@ -106,6 +106,7 @@ public:
     ss::sharded<cluster::tx_gateway_frontend> tx_gateway_frontend;
     ss::sharded<v8_engine::data_policy_table> data_policies;
     ss::sharded<cloud_storage::cache> shadow_index_cache;
+    ss::sharded<kafka::latency_tracer> kafka_latency_tracer;
 
 private:
     using deferred_actions
@@ -165,6 +166,8 @@ private:
     ss::sharded<kafka::group_manager> _co_group_manager;
     ss::sharded<net::server> _rpc;
     ss::sharded<admin_server> _admin;
+    ss::sharded<cpu_profiler> _cpu_profiler;
+    ss::sharded<heap_profiler> _heap_profiler;
     ss::sharded<net::conn_quota> _kafka_conn_quotas;
     ss::sharded<net::server> _kafka_server;
     ss::sharded<kafka::client::client> _proxy_client;
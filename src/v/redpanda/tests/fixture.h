@@ -105,6 +105,7 @@ public:
           app.tx_gateway_frontend,
           app.cp_partition_manager,
           app.data_policies,
+          app.kafka_latency_tracer,
           std::nullopt);
     }
 
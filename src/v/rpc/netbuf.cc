@@ -14,6 +14,8 @@
 #include "rpc/types.h"
 #include "vassert.h"
 
+#include <chrono>
+
 namespace rpc {
 iobuf header_as_iobuf(const header& h) {
     iobuf b;
@@ -24,9 +26,16 @@ iobuf header_as_iobuf(const header& h) {
       "Header size must be known and exact");
     return b;
 }
+/*
+ * compression is synchronous: a single zstd context per shard serves every
+ * connection, reused across messages instead of being allocated per message.
+ */
+static thread_local compression::stream_zstd payload_compressor;
+
 /// \brief used to send the bytes down the wire
 /// we re-compute the header-checksum on every call
-ss::scattered_message<char> netbuf::as_scattered() && {
+ss::scattered_message<char>
+netbuf::as_scattered(compression_probe* probe) && {
     if (_hdr.correlation_id == 0 || _hdr.meta == 0) {
         throw std::runtime_error(
           "cannot compose scattered view with incomplete header. missing "
@@ -35,8 +44,15 @@ ss::scattered_message<char> netbuf::as_scattered() && {
     if (
       _out.size_bytes() >= _min_compression_bytes
       && rpc::compression_type::zstd == _hdr.compression) {
-        compression::stream_zstd fn;
-        _out = fn.compress(std::move(_out));
+        const auto uncompressed = _out.size_bytes();
+        const auto start = std::chrono::steady_clock::now();
+        _out = payload_compressor.compress(std::move(_out));
+        if (probe) {
+            probe->record(
+              uncompressed,
+              _out.size_bytes(),
+              std::chrono::steady_clock::now() - start);
+        }
     } else {
         // didn't meet min requirements
         _hdr.compression = rpc::compression_type::none;
@@ -26,6 +26,7 @@
 
 #include <fmt/format.h>
 
+#include <chrono>
 #include <memory>
 #include <optional>
 
@@ -267,8 +268,11 @@ struct v0_message_codec {
 };
 
 template<typename T, typename Codec>
-ss::future<T> parse_type(ss::input_stream<char>& in, const header& h) {
-    return read_iobuf_exactly(in, h.payload_size).then([h](iobuf io) {
+ss::future<T> parse_type(
+  ss::input_stream<char>& in,
+  const header& h,
+  compression_probe* probe = nullptr) {
+    return read_iobuf_exactly(in, h.payload_size).then([h, probe](iobuf io) {
         validate_payload_and_header(io, h);
 
         switch (h.compression) {
@@ -276,8 +280,15 @@ ss::future<T> parse_type(ss::input_stream<char>& in, const header& h) {
             break;
 
         case compression_type::zstd: {
+            const auto start = std::chrono::steady_clock::now();
             compression::stream_zstd fn;
             io = fn.uncompress(std::move(io));
+            if (probe) {
+                probe->record(
+                  io.size_bytes(),
+                  h.payload_size,
+                  std::chrono::steady_clock::now() - start);
+            }
             break;
         }
 
@@ -99,6 +99,42 @@ public:
                 [this] { return _methods[{{loop.index-1}}].probes.latency_hist().seastar_histogram_logform(); },
                 sm::description("Internal RPC service latency"),
                 labels)
+                .aggregate(aggregate_labels),
+              sm::make_counter(
+                "request_uncompressed_bytes",
+                [this] { return _methods[{{loop.index-1}}].probes.request_compression().uncompressed_bytes(); },
+                sm::description("Size of compressed requests once decompressed"),
+                labels)
+                .aggregate(aggregate_labels),
+              sm::make_counter(
+                "request_compressed_bytes",
+                [this] { return _methods[{{loop.index-1}}].probes.request_compression().compressed_bytes(); },
+                sm::description("Size of compressed requests on the wire"),
+                labels)
+                .aggregate(aggregate_labels),
+              sm::make_counter(
+                "request_decompression_time_us",
+                [this] { return std::chrono::duration_cast<std::chrono::microseconds>(_methods[{{loop.index-1}}].probes.request_compression().time()).count(); },
+                sm::description("Time spent decompressing requests"),
+                labels)
+                .aggregate(aggregate_labels),
+              sm::make_counter(
+                "reply_uncompressed_bytes",
+                [this] { return _methods[{{loop.index-1}}].probes.reply_compression().uncompressed_bytes(); },
+                sm::description("Size of compressed replies before compression"),
+                labels)
+                .aggregate(aggregate_labels),
+              sm::make_counter(
+                "reply_compressed_bytes",
+                [this] { return _methods[{{loop.index-1}}].probes.reply_compression().compressed_bytes(); },
+                sm::description("Size of compressed replies on the wire"),
+                labels)
+                .aggregate(aggregate_labels),
+              sm::make_counter(
+                "reply_compression_time_us",
+                [this] { return std::chrono::duration_cast<std::chrono::microseconds>(_methods[{{loop.index-1}}].probes.reply_compression().time()).count(); },
+                sm::description("Time spent compressing replies"),
+                labels)
                 .aggregate(aggregate_labels)});
         }
       {%- endfor %}
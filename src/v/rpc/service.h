@@ -63,7 +63,8 @@ struct service::execution_helper {
       Func&& f) {
         return ctx.permanent_memory_reservation(ctx.get_header().payload_size)
           .then([f = std::forward<Func>(f), method_id, &in, &ctx]() mutable {
-              return parse_type<Input, Codec>(in, ctx.get_header())
+              return parse_type<Input, Codec>(
+                       in, ctx.get_header(), ctx.payload_compression_probe())
                 .then_wrapped([f = std::forward<Func>(f),
                                &ctx](ss::future<Input> input_f) mutable {
                     if (input_f.failed()) {
@@ -38,6 +38,9 @@ struct server_context_impl final : streaming_context {
     }
     ~server_context_impl() override { res.probe().request_completed(); }
     const header& get_header() const final { return hdr; }
+    compression_probe* payload_compression_probe() final {
+        return probes ? &probes->request_compression() : nullptr;
+    }
     void signal_body_parse() final { pr.set_value(); }
     void body_parse_exception(std::exception_ptr e) final {
         pr.set_exception(std::move(e));
@@ -45,6 +48,8 @@ struct server_context_impl final : streaming_context {
     net::server::resources res;
     header hdr;
     ss::promise<> pr;
+    // probes of the method handling the request, once it is known
+    method_probes* probes{nullptr};
 };
 
 ss::future<> simple_protocol::apply(net::server::resources rs) {
@@ -73,7 +78,8 @@ send_reply(ss::lw_shared_ptr<server_context_impl> ctx, netbuf buf) {
     buf.set_compression(rpc::compression_type::zstd);
     buf.set_correlation_id(ctx->get_header().correlation_id);
 
-    auto view = std::move(buf).as_scattered();
+    auto view = std::move(buf).as_scattered(
+      ctx->probes ? &ctx->probes->reply_compression() : nullptr);
     if (ctx->res.conn_gate().is_closed()) {
         // do not write if gate is closed
         rpclog.debug(
@@ -160,6 +166,7 @@ simple_protocol::dispatch_method_once(header h, net::server::resources rs) {
               }
 
               method* m = it->get()->method_from_id(method_id);
+              ctx->probes = &m->probes;
 
               return m->handle(ctx->res.conn->input(), *ctx)
                 .then_wrapped([ctx, m, l = ctx->res.hist().auto_measure(), rs](
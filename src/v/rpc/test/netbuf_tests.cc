@@ -45,3 +45,31 @@ SEASTAR_THREAD_TEST_CASE(netbuf_pod) {
     BOOST_REQUIRE_EQUAL(src.y, dst.y);
     BOOST_REQUIRE_EQUAL(src.z, dst.z);
 }
+
+SEASTAR_THREAD_TEST_CASE(netbuf_compression_probes) {
+    auto n = rpc::netbuf();
+    const ss::sstring src(16384, 'r');
+    n.set_correlation_id(42);
+    n.set_service_method_id(66);
+    n.set_compression(rpc::compression_type::zstd);
+    n.set_min_compression_bytes(1024);
+    reflection::async_adl<ss::sstring>{}.to(n.buffer(), ss::sstring(src)).get();
+    rpc::compression_probe sent;
+    auto bufs = std::move(n).as_scattered(&sent).release().release();
+    BOOST_REQUIRE_EQUAL(sent.payloads(), 1);
+    BOOST_REQUIRE_GT(sent.uncompressed_bytes(), src.size());
+    BOOST_REQUIRE_LT(sent.compressed_bytes(), sent.uncompressed_bytes());
+
+    rpc::compression_probe received;
+    auto in = make_iobuf_input_stream(iobuf(std::move(bufs)));
+    auto hdr = rpc::parse_header(in).get0();
+    BOOST_REQUIRE(hdr);
+    auto dst = rpc::parse_type<ss::sstring, rpc::default_message_codec>(
+                 in, *hdr, &received)
+                 .get0();
+    BOOST_REQUIRE_EQUAL(src, dst);
+    BOOST_REQUIRE_EQUAL(received.payloads(), 1);
+    BOOST_REQUIRE_EQUAL(received.compressed_bytes(), sent.compressed_bytes());
+    BOOST_REQUIRE_EQUAL(
+      received.uncompressed_bytes(), sent.uncompressed_bytes());
+}
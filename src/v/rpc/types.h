@@ -169,6 +169,30 @@ struct client_opts {
     resource_units_t resource_units;
 };
 
+/// \brief sizes and cpu time of the payloads compressed or decompressed
+/// by a method. Only compressed payloads are accounted.
+class compression_probe {
+public:
+    void record(
+      size_t uncompressed, size_t compressed, std::chrono::nanoseconds t) {
+        ++_payloads;
+        _uncompressed_bytes += uncompressed;
+        _compressed_bytes += compressed;
+        _time += t;
+    }
+
+    uint64_t payloads() const { return _payloads; }
+    uint64_t uncompressed_bytes() const { return _uncompressed_bytes; }
+    uint64_t compressed_bytes() const { return _compressed_bytes; }
+    std::chrono::nanoseconds time() const { return _time; }
+
+private:
+    uint64_t _payloads{0};
+    uint64_t _uncompressed_bytes{0};
+    uint64_t _compressed_bytes{0};
+    std::chrono::nanoseconds _time{0};
+};
+
 /// \brief used to pass environment context to the class
 /// actually doing the work
 class streaming_context {
@@ -186,6 +210,8 @@ public:
     /// to the dispatching thread that it can resume parsing for a new RPC
     virtual void signal_body_parse() = 0;
     virtual void body_parse_exception(std::exception_ptr) = 0;
+    /// \brief where to account the decompression of the payload, if anywhere
+    virtual compression_probe* payload_compression_probe() { return nullptr; }
 
     /// \brief keep these units until destruction of context.
     /// usually, we want to keep the reservation of the memory size permanently
@@ -204,8 +230,10 @@ private:
 class netbuf {
 public:
     /// \brief used to send the bytes down the wire
-    /// we re-compute the header-checksum on every call
-    ss::scattered_message<char> as_scattered() &&;
+    /// we re-compute the header-checksum on every call. the compression of
+    /// the payload, if any, is accounted in `probe`.
+    ss::scattered_message<char>
+    as_scattered(compression_probe* probe = nullptr) &&;
 
     void set_status(rpc::status);
     void set_correlation_id(uint32_t);
@@ -243,9 +271,22 @@ public:
     hdr_hist& latency_hist() { return _latency_hist; }
     const hdr_hist& latency_hist() const { return _latency_hist; }
 
+    /// decompression of the requests received
+    compression_probe& request_compression() { return _request_compression; }
+    const compression_probe& request_compression() const {
+        return _request_compression;
+    }
+    /// compression of the replies sent
+    compression_probe& reply_compression() { return _reply_compression; }
+    const compression_probe& reply_compression() const {
+        return _reply_compression;
+    }
+
 private:
     // roughly 2024 bytes
     hdr_hist _latency_hist{120s, 1ms};
+    compression_probe _request_compression;
+    compression_probe _reply_compression;
 };
 
 /// \brief most method implementations will be codegenerated
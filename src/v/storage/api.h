@@ -57,6 +57,7 @@ public:
       , _log_conf_cb(std::move(log_conf_cb)) {}
 
     ss::future<> start() {
+        _resources.file_handles().setup_metrics();
         _kvstore = std::make_unique<kvstore>(_kv_conf_cb(), _resources);
         return _kvstore->start().then([this] {
             _log_mgr = std::make_unique<log_manager>(
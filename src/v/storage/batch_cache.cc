@@ -135,6 +135,7 @@ batch_cache::put(batch_cache_index& index, const model::record_batch& input) {
         auto r = new range(index, input);
         _lru.push_back(*r);
         _size_bytes += r->memory_size();
+        _accounted.update(_size_bytes);
         return entry(0, r->weak_from_this());
     }
 
@@ -144,6 +145,7 @@ batch_cache::put(batch_cache_index& index, const model::record_batch& input) {
         auto r = new range(index);
         _lru.push_back(*r);
         _size_bytes += r->memory_size();
+        _accounted.update(_size_bytes);
         index._small_batches_range = r->weak_from_this();
     }
 
@@ -153,6 +155,7 @@ batch_cache::put(batch_cache_index& index, const model::record_batch& input) {
     int64_t diff = (int64_t)index._small_batches_range->memory_size()
                    - initial_sz;
     _size_bytes += diff;
+    _accounted.update(_size_bytes);
     _background_reclaimer.notify();
     return entry(offset, index._small_batches_range->weak_from_this());
 }
@@ -172,6 +175,7 @@ void batch_cache::evict(range_ptr&& e) {
         // r-value reference `e` wouldn't do that.
         auto p = std::exchange(e, {});
         _size_bytes -= p->memory_size();
+        _accounted.update(_size_bytes);
         _lru.erase_and_dispose(
           _lru.iterator_to(*p), [](range* e) { delete e; });
     }
@@ -273,6 +277,7 @@ size_t batch_cache::reclaim(size_t size) {
 
     _last_reclaim = ss::lowres_clock::now();
     _size_bytes -= reclaimed;
+    _accounted.update(_size_bytes);
     return reclaimed;
 }
 
@@ -304,7 +309,11 @@ batch_cache_index::read_result batch_cache_index::read(
         auto batch = it->second.batch();
 
         auto take = !type_filter || type_filter == batch.header().type;
-        take &= !first_ts || batch.header().first_timestamp >= *first_ts;
+        take &= !first_ts
+                || std::max(
+                     batch.header().first_timestamp,
+                     batch.header().max_timestamp)
+                     >= *first_ts;
         offset = batch.last_offset() + model::offset(1);
         if (take) {
             batch_cache::range::lock_guard g(*it->second.range());
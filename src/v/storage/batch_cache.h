@@ -13,6 +13,7 @@
 #include "model/record.h"
 #include "units.h"
 #include "utils/intrusive_list_helpers.h"
+#include "utils/memory_accounting.h"
 #include "vassert.h"
 
 #include <seastar/core/circular_buffer.hh>
@@ -373,6 +374,7 @@ private:
     reclaimer _reclaimer;
     bool _is_reclaiming{false};
     size_t _size_bytes{0};
+    accounted_memory _accounted{memory_subsystem::batch_cache};
 
     reclaim_options _reclaim_opts;
     ss::lowres_clock::time_point _last_reclaim;
@@ -23,6 +23,7 @@
 #include "storage/logger.h"
 #include "storage/offset_assignment.h"
 #include "storage/offset_to_filepos_consumer.h"
+#include "storage/parser_utils.h"
 #include "storage/readers_cache.h"
 #include "storage/segment.h"
 #include "storage/segment_set.h"
@@ -737,6 +738,9 @@ ss::future<> disk_log_impl::new_segment(
                 if (config().is_compacted()) {
                     h->mark_as_compacted_segment();
                 }
+                if (!_segs.empty()) {
+                    _segs.back()->clear_idle_appender();
+                }
                 _segs.add(std::move(h));
                 _probe.segment_created();
                 _stm_manager->make_snapshot_in_background();
@@ -748,6 +752,7 @@ ss::future<> disk_log_impl::new_segment(
 // config timeout is for the one calling reader consumer
 log_appender disk_log_impl::make_appender(log_append_config cfg) {
     vassert(!_closed, "make_appender on closed log - {}", *this);
+    _last_access = ss::lowres_clock::now();
     auto now = log_clock::now();
     auto ofs = offsets();
     auto next_offset = ofs.dirty_offset;
@@ -781,6 +786,18 @@ ss::future<> disk_log_impl::flush() {
     return _segs.back()->flush();
 }
 
+ss::future<ss::noncopyable_function<void()>> disk_log_impl::write_out() {
+    vassert(!_closed, "write_out on closed log - {}", *this);
+    if (_segs.empty()) {
+        co_return [] {};
+    }
+    auto seg = _segs.back();
+    auto mark_synced = co_await seg->write_out();
+    co_return [seg = std::move(seg), mark_synced = std::move(mark_synced)] {
+        mark_synced();
+    };
+}
+
 size_t disk_log_impl::max_segment_size() const {
     // override for segment size
     if (config().has_overrides() && config().get_overrides().segment_size) {
@@ -831,6 +848,12 @@ ss::future<> disk_log_impl::maybe_roll(
     }
     auto ptr = _segs.back();
     if (!ptr->has_appender()) {
+        if (
+          ptr->has_idle_appender() && t == term()
+          && ptr->size_bytes() < _max_segment_size) {
+            // appends resume where they stopped when the log became idle
+            return reopen_idle_appender(ptr, iopc);
+        }
         return new_segment(next_offset, t, iopc);
     }
     bool size_should_roll = false;
@@ -847,6 +870,47 @@ ss::future<> disk_log_impl::maybe_roll(
     return ss::make_ready_future<>();
 }
 
+ss::future<> disk_log_impl::reopen_idle_appender(
+  ss::lw_shared_ptr<segment> seg, ss::io_priority_class iopc) {
+    vlog(
+      stlog.debug,
+      "reopening appender of idle segment {}",
+      seg->reader().filename());
+    auto appender = co_await internal::make_segment_appender(
+      std::filesystem::path(seg->reader().filename()),
+      _manager.config().sanitize_fileops,
+      internal::number_of_chunks_from_config(config()),
+      internal::segment_size_from_config(config()),
+      iopc,
+      resources());
+    co_await seg->reopen_appender(std::move(appender));
+}
+
+ss::future<> disk_log_impl::release_idle_resources() {
+    if (_closed) {
+        co_return;
+    }
+    // close() and remove() wait for the segments to be released
+    gate_guard guard(_compaction_gate);
+    vlog(stlog.debug, "releasing resources of idle log {}", config().ntp());
+
+    // cached readers hold the segments read locks and their buffers
+    co_await _readers_cache->evict_range(
+      model::offset::min(), model::offset::max());
+
+    std::vector<ss::lw_shared_ptr<segment>> segments;
+    for (auto& s : _segs) {
+        if (
+          s->has_appender()
+          || (s->has_cache() && !s->cache()->get().empty())) {
+            segments.push_back(s);
+        }
+    }
+    for (auto& s : segments) {
+        co_await s->release_idle_resources();
+    }
+}
+
 ss::future<model::record_batch_reader>
 disk_log_impl::make_unchecked_reader(log_reader_config config) {
     vassert(!_closed, "make_reader on closed log - {}", *this);
@@ -876,6 +940,7 @@ disk_log_impl::make_cached_reader(log_reader_config config) {
 ss::future<model::record_batch_reader>
 disk_log_impl::make_reader(log_reader_config config) {
     vassert(!_closed, "make_reader on closed log - {}", *this);
+    _last_access = ss::lowres_clock::now();
     if (config.start_offset < _start_offset) {
         return ss::make_exception_future<model::record_batch_reader>(
           std::runtime_error(fmt::format(
@@ -897,13 +962,19 @@ disk_log_impl::make_reader(log_reader_config config) {
 ss::future<model::record_batch_reader>
 disk_log_impl::make_reader(timequery_config config) {
     vassert(!_closed, "make_reader on closed log - {}", *this);
+    _last_access = ss::lowres_clock::now();
     return _lock_mngr.range_lock(config).then(
       [this, cfg = config](std::unique_ptr<lock_manager::lease> lease) {
           auto start_offset = _start_offset;
           if (!lease->range.empty()) {
+              auto& first = *lease->range.begin();
               // adjust for partial visibility of segment prefix
               start_offset = std::max(
-                start_offset, (*lease->range.begin())->offsets().base_offset);
+                start_offset, first->offsets().base_offset);
+              // skip the part of the segment the time index rules out
+              if (auto entry = first->index().find_nearest(cfg.time); entry) {
+                  start_offset = std::max(start_offset, entry->offset);
+              }
           }
           log_reader_config config(
             start_offset,
@@ -953,23 +1024,19 @@ disk_log_impl::timequery(timequery_config cfg) {
     if (_segs.empty()) {
         return ss::make_ready_future<std::optional<timequery_result>>();
     }
-    return make_reader(std::move(cfg))
-      .then([cfg](model::record_batch_reader reader) {
+    return make_reader(cfg)
+      .then([](model::record_batch_reader reader) {
           return model::consume_reader_to_memory(
-                   std::move(reader), model::no_timeout)
-            .then([cfg](model::record_batch_reader::storage_t st) {
-                using ret_t = std::optional<timequery_result>;
-                auto& batches = std::get<model::record_batch_reader::data_t>(
-                  st);
-                if (
-                  !batches.empty()
-                  && batches.front().header().first_timestamp >= cfg.time) {
-                    return ret_t(timequery_result(
-                      batches.front().base_offset(),
-                      batches.front().header().first_timestamp));
-                }
-                return ret_t();
-            });
+            std::move(reader), model::no_timeout);
+      })
+      .then([cfg](model::record_batch_reader::storage_t st) {
+          auto& batches = std::get<model::record_batch_reader::data_t>(st);
+          if (batches.empty()) {
+              return ss::make_ready_future<std::optional<timequery_result>>();
+          }
+          // the reader skipped batches without any record >= cfg.time
+          return internal::batch_timequery(
+            std::move(batches.front()), cfg.time);
       });
 }
 
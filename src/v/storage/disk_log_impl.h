@@ -63,6 +63,7 @@ public:
     ss::future<std::optional<ss::sstring>> close() final;
     ss::future<> remove() final;
     ss::future<> flush() final;
+    ss::future<ss::noncopyable_function<void()>> write_out() final;
     ss::future<> truncate(truncate_config) final;
     ss::future<> truncate_prefix(truncate_prefix_config) final;
     ss::future<> compact(compaction_config) final;
@@ -102,6 +103,16 @@ public:
 
     int64_t compaction_backlog() const final;
 
+    /// Last time the log was appended to or read from
+    ss::lowres_clock::time_point last_access() const { return _last_access; }
+    /**
+     * Releases the memory a log which is not being accessed does not need:
+     * its cached readers, cached batches and the appender of its active
+     * segment. Everything is recreated on demand, the next append reopens an
+     * appender on the active segment.
+     */
+    ss::future<> release_idle_resources();
+
 private:
     friend class disk_log_appender; // for multi-term appends
     friend class disk_log_builder;  // for tests
@@ -137,6 +148,8 @@ private:
       model::offset starting_offset,
       model::term_id term_for_this_segment,
       ss::io_priority_class prio);
+    ss::future<>
+      reopen_idle_appender(ss::lw_shared_ptr<segment>, ss::io_priority_class);
 
     ss::future<> do_truncate(truncate_config);
     ss::future<> remove_full_segments(model::offset o);
@@ -188,6 +201,7 @@ private:
     model::offset _max_collectible_offset;
     size_t _max_segment_size;
     std::unique_ptr<readers_cache> _readers_cache;
+    ss::lowres_clock::time_point _last_access{ss::lowres_clock::now()};
     // average ratio of segment sizes after segment size before compaction
     moving_average<double, 5> _compaction_ratio{1.0};
 
@@ -0,0 +1,146 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "storage/file_handle_cache.h"
+
+#include "config/configuration.h"
+#include "prometheus/prometheus_sanitize.h"
+#include "ssx/future-util.h"
+#include "storage/logger.h"
+#include "vassert.h"
+#include "vlog.h"
+
+#include <seastar/core/metrics.hh>
+
+namespace storage {
+
+file_handle_cache::file_handle_cache(
+  config::binding<size_t> max_handles,
+  config::binding<std::chrono::milliseconds> linger)
+  : _max_handles(std::move(max_handles))
+  , _linger(std::move(linger)) {
+    _timer.set_callback([this] {
+        evict(ss::lowres_clock::now());
+        rearm();
+    });
+    _max_handles.watch([this] { evict(ss::lowres_clock::now()); });
+    _linger.watch([this] {
+        evict(ss::lowres_clock::now());
+        rearm();
+    });
+}
+
+file_handle_cache::~file_handle_cache() noexcept {
+    _timer.cancel();
+    // readers close their files when their segment is closed, which happens
+    // before the cache goes away: only unlink what may be left.
+    _lru.clear();
+}
+
+bool file_handle_cache::release(segment_reader& r) {
+    if (_linger() == std::chrono::milliseconds(0) || _max_handles() == 0) {
+        return false;
+    }
+    vassert(!r._linger_hook.is_linked(), "{} released twice", r.filename());
+    r._released_at = ss::lowres_clock::now();
+    _lru.push_back(r);
+    ++_lingering;
+    evict(r._released_at);
+    if (!_timer.armed()) {
+        rearm();
+    }
+    return true;
+}
+
+void file_handle_cache::acquire(segment_reader& r) {
+    if (r._linger_hook.is_linked()) {
+        r._linger_hook.unlink();
+        --_lingering;
+        ++_hits;
+    }
+}
+
+void file_handle_cache::forget(segment_reader& r) {
+    if (r._linger_hook.is_linked()) {
+        r._linger_hook.unlink();
+        --_lingering;
+    }
+}
+
+void file_handle_cache::evict(ss::lowres_clock::time_point now) {
+    const auto linger = _linger();
+    while (!_lru.empty()
+           && (_lingering > _max_handles()
+               || _lru.front()._released_at + linger <= now)) {
+        close_lingering(_lru.front());
+    }
+}
+
+void file_handle_cache::close(segment_reader& r) {
+    if (r._linger_hook.is_linked()) {
+        close_lingering(r);
+    }
+}
+
+void file_handle_cache::close_lingering(segment_reader& r) {
+    forget(r);
+    vlog(stlog.debug, "Closing lingering segment file {}", r.filename());
+    // nothing uses the file: closing it does not need the reader to be kept
+    // alive, nor the open lock since a get() would simply reopen the file
+    auto data_file = std::exchange(r._data_file, ss::file{});
+    file_closed();
+    ssx::background = data_file.close()
+                        .handle_exception([](const std::exception_ptr& e) {
+                            vlog(
+                              stlog.warn,
+                              "Error closing lingering segment file: {}",
+                              e);
+                        })
+                        .finally([data_file] {});
+}
+
+void file_handle_cache::rearm() {
+    if (_lru.empty()) {
+        _timer.cancel();
+        return;
+    }
+    _timer.rearm(_lru.front()._released_at + _linger());
+}
+
+void file_handle_cache::setup_metrics() {
+    if (config::shard_local_cfg().disable_metrics()) {
+        return;
+    }
+    namespace sm = ss::metrics;
+    _metrics.add_group(
+      prometheus_sanitize::metrics_name("storage:segment_files"),
+      {
+        sm::make_counter(
+          "opens",
+          [this] { return _opens; },
+          sm::description("Number of segment files opened for reading")),
+        sm::make_counter(
+          "lingering_hits",
+          [this] { return _hits; },
+          sm::description(
+            "Number of reads which reused a segment file kept open after its "
+            "last reader was done with it")),
+        sm::make_gauge(
+          "open",
+          [this] { return _open_files; },
+          sm::description("Number of segment files open for reading")),
+        sm::make_gauge(
+          "lingering",
+          [this] { return _lingering; },
+          sm::description(
+            "Number of segment files kept open while no reader uses them")),
+      });
+}
+
+} // namespace storage
@@ -0,0 +1,96 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "config/property.h"
+#include "seastarx.h"
+#include "storage/segment_reader.h"
+#include "utils/intrusive_list_helpers.h"
+
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/metrics_registration.hh>
+#include <seastar/core/timer.hh>
+
+#include <chrono>
+#include <cstdint>
+
+namespace storage {
+
+/**
+ * Keeps the data files of segment readers open for a while after their last
+ * user released them.
+ *
+ * A segment_reader opens its file on first use and used to close it as soon
+ * as the last handle on it was closed, so consumers reading segments which
+ * are not held open by the readers cache (fetches spread over many
+ * partitions, timequeries, list offsets) paid for an open and a close per
+ * read. Released files are kept open instead, in a shard wide LRU, and the
+ * next read of the segment reuses them. A lingering file is closed once it
+ * was not used for `linger`, when more than `max_handles` files linger
+ * (least recently released first), or when its segment is closed.
+ */
+class file_handle_cache {
+public:
+    file_handle_cache(
+      config::binding<size_t> max_handles,
+      config::binding<std::chrono::milliseconds> linger);
+    file_handle_cache(const file_handle_cache&) = delete;
+    file_handle_cache& operator=(const file_handle_cache&) = delete;
+    file_handle_cache(file_handle_cache&&) = delete;
+    file_handle_cache& operator=(file_handle_cache&&) = delete;
+    ~file_handle_cache() noexcept;
+
+    /// The last user of the file of `r` released it: keep the file open.
+    /// Returns false if the file must be closed right away.
+    bool release(segment_reader& r);
+    /// `r` uses its lingering file again.
+    void acquire(segment_reader& r);
+    /// `r` closes its file itself, e.g. its segment is closed.
+    void forget(segment_reader& r);
+    /// Close the file of `r` now if it is lingering.
+    void close(segment_reader& r);
+
+    /// A segment file was opened or closed by its reader.
+    void file_opened() {
+        ++_opens;
+        ++_open_files;
+    }
+    void file_closed() { --_open_files; }
+
+    size_t lingering() const { return _lingering; }
+    size_t open_files() const { return _open_files; }
+    uint64_t hits() const { return _hits; }
+    uint64_t opens() const { return _opens; }
+
+    void setup_metrics();
+
+private:
+    // close the least recently released files beyond the budget, and the
+    // files which lingered for too long
+    void evict(ss::lowres_clock::time_point now);
+    void close_lingering(segment_reader& r);
+    void rearm();
+
+    config::binding<size_t> _max_handles;
+    config::binding<std::chrono::milliseconds> _linger;
+    intrusive_list<segment_reader, &segment_reader::_linger_hook> _lru;
+    ss::timer<ss::lowres_clock> _timer;
+
+    size_t _lingering{0};
+    size_t _open_files{0};
+    uint64_t _hits{0};
+    uint64_t _opens{0};
+
+    ss::metrics::metric_groups _metrics;
+};
+
+} // namespace storage
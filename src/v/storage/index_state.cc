@@ -24,10 +24,19 @@
 #include <fmt/format.h>
 #include <fmt/ostream.h>
 
+#include <algorithm>
+#include <limits>
 #include <optional>
 
 namespace storage {
 
+static uint32_t relative_time(model::timestamp base, model::timestamp t) {
+    // We know that a segment cannot be > 4GB but it can span more than
+    // 2^32 ms, saturate instead of wrapping to keep the index sorted
+    return static_cast<uint32_t>(std::clamp<int64_t>(
+      t() - base(), 0, std::numeric_limits<uint32_t>::max()));
+}
+
 bool index_state::maybe_index(
   size_t accumulator,
   size_t step,
@@ -47,6 +56,7 @@ bool index_state::maybe_index(
     bool retval = false;
     // index_state
     if (empty()) {
+        bitflags &= ~unsorted_time_index_flag;
         base_timestamp = first_timestamp;
         max_timestamp = first_timestamp;
         retval = true;
@@ -61,10 +71,10 @@ bool index_state::maybe_index(
     max_timestamp = std::max(max_timestamp, last_timestamp);
     // always saving the first batch simplifies a lot of book keeping
     if (accumulator >= step || retval) {
-        // We know that a segment cannot be > 4GB
+        // max timestamp so far rather than the batch's, see header
         add_entry(
           batch_base_offset() - base_offset(),
-          std::max(last_timestamp() - base_timestamp(), int64_t{0}),
+          relative_time(base_timestamp, max_timestamp),
           starting_position_in_file);
 
         retval = true;
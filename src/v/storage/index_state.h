@@ -25,7 +25,7 @@ namespace storage {
    1 byte  - version
    4 bytes - size - does not include the version or size
    8 bytes - checksum - xxhash32 -- we checksum everything below the checksum
-   4 bytes - bitflags - unused
+   4 bytes - bitflags - see index_state::unsorted_time_index_flag
    8 bytes - based_offset
    8 bytes - max_offset
    8 bytes - base_time
@@ -34,9 +34,21 @@ namespace storage {
    [] relative_offset_index
    [] relative_time_index
    [] position_index
+
+   Since version 5 the entries of the relative_time_index hold the max
+   timestamp of all the batches up to and including the indexed one, so that
+   the index stays sorted when timestamps are not monotonic. The layout is
+   unchanged, older versions can read it. Indices written before that hold
+   the timestamp of the indexed batch only and are flagged as unsorted.
  */
 struct index_state
-  : serde::envelope<index_state, serde::version<4>, serde::compat_version<4>> {
+  : serde::envelope<index_state, serde::version<5>, serde::compat_version<4>> {
+    /// first version with a sorted, max timestamp so far, time index
+    static constexpr int8_t sorted_time_index_version = 5;
+    /// set in `bitflags` when the time index was started by a version older
+    /// than `sorted_time_index_version`; it cannot be searched
+    static constexpr uint32_t unsorted_time_index_flag = 1;
+
     index_state() = default;
     index_state(index_state&&) noexcept = default;
     index_state& operator=(index_state&&) noexcept = default;
@@ -45,7 +57,6 @@ struct index_state
 
     index_state copy() const { return *this; }
 
-    /// \brief unused
     uint32_t bitflags{0};
     // the batch's base_offset of the first batch
     model::offset base_offset{0};
@@ -63,6 +74,16 @@ struct index_state
 
     bool empty() const { return relative_offset_index.empty(); }
 
+    bool time_index_sorted() const {
+        return (bitflags & unsorted_time_index_flag) == 0;
+    }
+
+    size_t memory_size() const {
+        return relative_offset_index.memory_size()
+               + relative_time_index.memory_size()
+               + position_index.memory_size();
+    }
+
     void
     add_entry(uint32_t relative_offset, uint32_t relative_time, uint64_t pos) {
         relative_offset_index.push_back(relative_offset);
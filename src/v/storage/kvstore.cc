@@ -15,17 +15,24 @@
 #include "prometheus/prometheus_sanitize.h"
 #include "raft/types.h"
 #include "reflection/adl.h"
+#include "ssx/future-util.h"
+#include "ssx/sformat.h"
 #include "storage/parser.h"
 #include "storage/record_batch_builder.h"
 #include "storage/segment_set.h"
 #include "storage/types.h"
+#include "utils/directory_walker.h"
 #include "vlog.h"
 
+#include <seastar/core/coroutine.hh>
 #include <seastar/core/metrics.hh>
 #include <seastar/core/thread.hh>
 #include <seastar/util/defer.hh>
 #include <seastar/util/log.hh>
 
+#include <numeric>
+#include <regex>
+
 static ss::logger lg("kvstore");
 
 namespace storage {
@@ -38,6 +45,10 @@ kvstore::kvstore(kvstore_config kv_conf, storage_resources& resources)
       std::filesystem::path(_ntpc.work_directory()),
       simple_snapshot_manager::default_snapshot_filename,
       ss::default_priority_class())
+  , _delta_snap(
+      delta_snapshot_prefix,
+      std::filesystem::path(_ntpc.work_directory()),
+      ss::default_priority_class())
   , _timer([this] { _sem.signal(); }) {}
 
 ss::future<> kvstore::start() {
@@ -71,6 +82,20 @@ ss::future<> kvstore::start() {
               "key_count",
               [this] { return _db.size(); },
               ss::metrics::description("Number of keys in the database")),
+            ss::metrics::make_total_bytes(
+              "log_bytes_written",
+              [this] { return _probe.log_bytes_written; },
+              ss::metrics::description("Number of bytes written to the log")),
+            ss::metrics::make_total_bytes(
+              "snapshot_bytes_written",
+              [this] { return _probe.snapshot_bytes_written; },
+              ss::metrics::description(
+                "Number of bytes written to full and delta snapshots")),
+            ss::metrics::make_total_operations(
+              "snapshots_merged",
+              [this] { return _probe.merged_snapshots; },
+              ss::metrics::description(
+                "Number of times delta snapshots were merged")),
           });
     }
 
@@ -91,8 +116,20 @@ ss::future<> kvstore::start() {
                         if (_gate.is_closed()) {
                             return ss::now();
                         }
-                        return roll().then(
-                          [this] { return flush_and_apply_ops(); });
+                        _flushing = true;
+                        return roll()
+                          .then([this] { return flush_and_apply_ops(); })
+                          .finally([this] {
+                              _flushing = false;
+                              // group commit: operations queued during the
+                              // flush don't wait for another commit interval
+                              if (
+                                _conf.incremental_snapshots
+                                && !_ops.empty()) {
+                                  _timer.cancel();
+                                  _sem.signal();
+                              }
+                          });
                     });
                 });
           });
@@ -174,14 +211,49 @@ ss::future<> kvstore::put(key_space ks, bytes key, std::optional<iobuf> value) {
     return ss::with_gate(
       _gate, [this, key = std::move(key), value = std::move(value)]() mutable {
           auto& w = _ops.emplace_back(std::move(key), std::move(value));
-          if (!_timer.armed()) {
-              _timer.arm(_conf.commit_interval());
-          }
+          schedule_flush();
           return w.done.get_future();
       });
 }
 
+ss::future<> kvstore::write_batch(key_space ks, std::vector<write_op> ops) {
+    vassert(_started, "kvstore has not been started");
+    if (ops.empty()) {
+        return ss::now();
+    }
+
+    return ss::with_gate(_gate, [this, ks, ops = std::move(ops)]() mutable {
+        // operations queued in the same continuation are flushed together
+        std::vector<ss::future<>> done;
+        done.reserve(ops.size());
+        for (auto& [key, value] : ops) {
+            if (value) {
+                _probe.entry_written();
+            } else {
+                _probe.entry_removed();
+            }
+            auto& w = _ops.emplace_back(
+              make_spaced_key(ks, key), std::move(value));
+            done.push_back(w.done.get_future());
+        }
+        schedule_flush();
+        return ss::when_all_succeed(done.begin(), done.end());
+    });
+}
+
+void kvstore::schedule_flush() {
+    // with group commit the flusher picks up the operation as soon as the
+    // flush in flight completes
+    const bool group_commit = _flushing && _conf.incremental_snapshots;
+    if (!_timer.armed() && !group_commit) {
+        _timer.arm(_conf.commit_interval());
+    }
+}
+
 void kvstore::apply_op(bytes key, std::optional<iobuf> value) {
+    if (_conf.incremental_snapshots) {
+        _dirty_keys.insert(key);
+    }
     auto it = _db.find(key);
     bool found = it != _db.end();
     if (value) {
@@ -231,6 +303,7 @@ ss::future<> kvstore::flush_and_apply_ops() {
     }
     auto batch = std::move(builder).build();
     auto last_offset = batch.last_offset();
+    _probe.log_written(batch.size_bytes());
 
     /*
      * 1. write batch
@@ -282,7 +355,10 @@ ss::future<> kvstore::roll() {
         // cleaned-up segment.
         auto seg = std::exchange(_segment, nullptr);
         return seg->close()
-          .then([this] { return save_snapshot(); })
+          .then([this] {
+              return _conf.incremental_snapshots ? save_delta_snapshot()
+                                                 : save_snapshot();
+          })
           .then([seg] {
               vlog(
                 lg.debug,
@@ -313,6 +389,25 @@ ss::future<> kvstore::roll() {
     return ss::now();
 }
 
+/*
+ * Snapshot data is a size prefixed batch
+ */
+static iobuf serialize_snapshot_batch(model::record_batch batch) {
+    iobuf data;
+    auto ph = data.reserve(sizeof(int32_t));
+    reflection::serialize(data, std::move(batch));
+    auto size = ss::cpu_to_le(int32_t(data.size_bytes() - sizeof(int32_t)));
+    ph.write((const char*)&size, sizeof(size));
+    return data;
+}
+
+static ss::future<>
+write_snapshot(snapshot_writer& wr, iobuf meta, iobuf data) {
+    co_await wr.write_metadata(std::move(meta));
+    co_await write_iobuf_to_output_stream(std::move(data), wr.output());
+    co_await wr.close();
+}
+
 ss::future<> kvstore::save_snapshot() {
     vassert(
       _next_offset >= model::offset(0),
@@ -321,13 +416,12 @@ ss::future<> kvstore::save_snapshot() {
 
     // no operations have been applied to the db
     if (_next_offset == model::offset(0)) {
-        return ss::now();
+        co_return;
     }
 
-    vlog(
-      lg.debug,
-      "Creating snapshot at offset {}",
-      _next_offset - model::offset(1));
+    // the last log offset represented in the snapshot
+    auto last_offset = _next_offset - model::offset(1);
+    vlog(lg.debug, "Creating snapshot at offset {}", last_offset);
 
     // package up the db into a batch
     storage::record_batch_builder builder(
@@ -337,38 +431,121 @@ ss::future<> kvstore::save_snapshot() {
           bytes_to_iobuf(entry.first),
           entry.second.share(0, entry.second.size_bytes()));
     }
-    auto batch = std::move(builder).build();
+    auto data = serialize_snapshot_batch(std::move(builder).build());
+    auto size = data.size_bytes();
 
-    // serialize batch: size_prefix + batch
-    iobuf data;
-    auto ph = data.reserve(sizeof(int32_t));
-    reflection::serialize(data, std::move(batch));
-    auto size = ss::cpu_to_le(int32_t(data.size_bytes() - sizeof(int32_t)));
-    ph.write((const char*)&size, sizeof(size));
+    iobuf meta;
+    reflection::serialize(meta, last_offset);
 
-    return _snap.start_snapshot().then(
-      [this, data = std::move(data)](snapshot_writer writer) mutable {
-          return ss::do_with(
-            std::move(writer),
-            [this, data = std::move(data)](snapshot_writer& wr) mutable {
-                // the last log offset represented in the snapshot
-                auto last_offset = _next_offset - model::offset(1);
-
-                iobuf meta;
-                reflection::serialize(meta, last_offset);
-
-                return wr.write_metadata(std::move(meta))
-                  .then([&wr, data = std::move(data)]() mutable {
-                      auto& os = wr.output(); // kept alive by do_with above
-                      return write_iobuf_to_output_stream(std::move(data), os);
-                  })
-                  .then([&wr] { return wr.close(); })
-                  .then([this, &wr]() {
-                      vlog(lg.debug, "Finishing snapshot creation");
-                      return _snap.finish_snapshot(wr);
-                  });
-            });
-      });
+    auto writer = co_await _snap.start_snapshot();
+    co_await write_snapshot(writer, std::move(meta), std::move(data));
+    vlog(lg.debug, "Finishing snapshot creation");
+    co_await _snap.finish_snapshot(writer);
+    _snapshot_size = size;
+    _probe.snapshot_written(size);
+
+    co_await remove_merged_deltas(last_offset);
+}
+
+ss::future<> kvstore::save_delta_snapshot() {
+    // no operations have been applied since the previous snapshot
+    if (_next_offset == _delta_base_offset) {
+        co_return;
+    }
+
+    auto base_offset = _delta_base_offset;
+    auto last_offset = _next_offset - model::offset(1);
+    vlog(
+      lg.debug,
+      "Creating delta snapshot of {} keys for offsets [{}, {}]",
+      _dirty_keys.size(),
+      base_offset,
+      last_offset);
+
+    // a missing value is a deletion, like in the log
+    storage::record_batch_builder builder(
+      model::record_batch_type::kvstore, model::offset(0));
+    for (const auto& key : _dirty_keys) {
+        std::optional<iobuf> value;
+        if (auto it = _db.find(key); it != _db.end()) {
+            value = it->second.share(0, it->second.size_bytes());
+        }
+        builder.add_raw_kv(
+          bytes_to_iobuf(key), reflection::to_iobuf(std::move(value)));
+    }
+    auto data = serialize_snapshot_batch(std::move(builder).build());
+    auto size = data.size_bytes();
+
+    iobuf meta;
+    reflection::serialize(meta, base_offset, last_offset);
+
+    // operations are applied by the flusher and by recovery, which are also
+    // the only callers, so the dirty keys don't change while writing
+    auto filename = ssx::sformat("{}.{}", delta_snapshot_prefix, last_offset);
+    auto writer = co_await _delta_snap.start_snapshot(filename);
+    co_await write_snapshot(writer, std::move(meta), std::move(data));
+    co_await _delta_snap.finish_snapshot(writer);
+    _probe.snapshot_written(size);
+
+    _deltas.push_back(delta_snapshot{
+      .filename = filename,
+      .base_offset = base_offset,
+      .last_offset = last_offset,
+      .size_bytes = size});
+    _dirty_keys.clear();
+    _delta_base_offset = _next_offset;
+
+    maybe_merge_snapshots();
+}
+
+void kvstore::maybe_merge_snapshots() {
+    if (_merging) {
+        return;
+    }
+    auto delta_bytes = std::accumulate(
+      _deltas.begin(),
+      _deltas.end(),
+      size_t(0),
+      [](size_t acc, const delta_snapshot& d) { return acc + d.size_bytes; });
+    // merging costs as much as writing the deltas did, which bounds the
+    // write amplification, while the number of deltas bounds recovery time
+    if (
+      _deltas.size() < max_delta_snapshots && delta_bytes < _snapshot_size) {
+        return;
+    }
+
+    vlog(
+      lg.debug,
+      "Merging {} delta snapshots of {} bytes, snapshot size {}",
+      _deltas.size(),
+      delta_bytes,
+      _snapshot_size);
+    _merging = true;
+    _probe.snapshots_merged();
+    ssx::spawn_with_gate(_gate, [this] {
+        // the snapshot is built synchronously, concurrent flushes only apply
+        // operations past its offset
+        return save_snapshot()
+          .handle_exception([](std::exception_ptr e) {
+              vlog(lg.warn, "Failed to merge delta snapshots: {}", e);
+          })
+          .finally([this] { _merging = false; });
+    });
+}
+
+ss::future<> kvstore::remove_merged_deltas(model::offset last_offset) {
+    std::vector<ss::sstring> merged;
+    std::erase_if(_deltas, [&merged, last_offset](const delta_snapshot& d) {
+        if (d.last_offset > last_offset) {
+            return false;
+        }
+        merged.push_back(d.filename);
+        return true;
+    });
+    for (const auto& filename : merged) {
+        vlog(lg.debug, "Removing merged delta snapshot {}", filename);
+        co_await _delta_snap.remove_snapshot(filename);
+    }
 }
 
 ss::future<> kvstore::recover() {
@@ -378,6 +555,7 @@ ss::future<> kvstore::recover() {
          * is found, or the offset immediately following the snapshot offset.
          */
         load_snapshot_in_thread();
+        load_delta_snapshots_in_thread();
 
         auto dir = std::filesystem::path(_ntpc.work_directory());
         auto segments
@@ -390,6 +568,7 @@ ss::future<> kvstore::recover() {
               config::shard_local_cfg().storage_read_buffer_size(),
               config::shard_local_cfg().storage_read_readahead_count(),
               std::nullopt,
+              {},
               _resources)
               .get0();
 
@@ -397,30 +576,12 @@ ss::future<> kvstore::recover() {
     });
 }
 
-void kvstore::load_snapshot_in_thread() {
-    _gate.check(); // early out on shutdown
-
-    // open snapshot reader, if a snapshot exists
-    auto reader = _snap.open_snapshot().get0();
-    if (!reader) {
-        vlog(lg.debug, "Load snapshot: no snapshot found");
-        _next_offset = model::offset(0);
-        return;
-    }
-    auto close_reader = ss::defer([&reader] { reader->close().get(); });
-
-    // the snapshot metadata contains the last offset represented
-    auto snap_meta = reader->read_metadata().get0();
-    iobuf_parser parser(std::move(snap_meta));
-    auto last_offset = model::offset(
-      reflection::adl<model::offset::type>{}.from(parser));
-    vlog(
-      lg.debug,
-      "Load snapshot: loading snapshot with last offset {}",
-      last_offset);
-
-    // read and restore db from snapshot
-    auto buf = read_iobuf_exactly(reader->input(), sizeof(int32_t)).get0();
+/*
+ * Reads the size prefixed batch of a snapshot and checks its integrity
+ */
+static model::record_batch
+read_snapshot_batch_in_thread(snapshot_reader& reader) {
+    auto buf = read_iobuf_exactly(reader.input(), sizeof(int32_t)).get0();
     if (buf.size_bytes() != sizeof(int32_t)) {
         throw std::runtime_error(fmt::format(
           "Failed to read snapshot size. Wanted {} bytes != {}",
@@ -429,7 +590,7 @@ void kvstore::load_snapshot_in_thread() {
     }
     auto size = reflection::from_iobuf<int32_t>(std::move(buf));
 
-    buf = read_iobuf_exactly(reader->input(), size).get0();
+    buf = read_iobuf_exactly(reader.input(), size).get0();
     if ((int32_t)buf.size_bytes() != size) {
         throw std::runtime_error(fmt::format(
           "Failed to read snapshot data. Wanted {} bytes != {}",
@@ -452,6 +613,34 @@ void kvstore::load_snapshot_in_thread() {
           header_crc,
           batch.header().header_crc));
     }
+    return batch;
+}
+
+void kvstore::load_snapshot_in_thread() {
+    _gate.check(); // early out on shutdown
+
+    // open snapshot reader, if a snapshot exists
+    auto reader = _snap.open_snapshot().get0();
+    if (!reader) {
+        vlog(lg.debug, "Load snapshot: no snapshot found");
+        _next_offset = model::offset(0);
+        return;
+    }
+    auto close_reader = ss::defer([&reader] { reader->close().get(); });
+
+    // the snapshot metadata contains the last offset represented
+    auto snap_meta = reader->read_metadata().get0();
+    iobuf_parser parser(std::move(snap_meta));
+    auto last_offset = model::offset(
+      reflection::adl<model::offset::type>{}.from(parser));
+    vlog(
+      lg.debug,
+      "Load snapshot: loading snapshot with last offset {}",
+      last_offset);
+
+    // read and restore db from snapshot
+    auto batch = read_snapshot_batch_in_thread(*reader);
+    _snapshot_size = batch.size_bytes() + sizeof(int32_t);
 
     batch.for_each_record([this](model::record r) {
         auto key = iobuf_to_bytes(r.release_key());
@@ -469,6 +658,98 @@ void kvstore::load_snapshot_in_thread() {
     _next_offset = last_offset + model::offset(1);
 }
 
+void kvstore::load_delta_snapshots_in_thread() {
+    _gate.check(); // early out on shutdown
+
+    _delta_base_offset = _next_offset;
+    if (!ss::file_exists(_ntpc.work_directory()).get0()) {
+        return;
+    }
+    _delta_snap.remove_partial_snapshots().get();
+
+    // delta snapshots are named after the last offset they represent
+    std::vector<std::pair<model::offset, ss::sstring>> found;
+    const std::regex re(
+      fmt::format(R"(^{}\.(\d+)$)", delta_snapshot_prefix));
+    directory_walker::walk(
+      _ntpc.work_directory(),
+      [&found, &re](ss::directory_entry ent) {
+          if (!ent.type || *ent.type != ss::directory_entry_type::regular) {
+              return ss::now();
+          }
+          std::cmatch match;
+          if (std::regex_match(ent.name.c_str(), match, re)) {
+              found.emplace_back(
+                model::offset(std::stoll(match[1].str())), ent.name);
+          }
+          return ss::now();
+      })
+      .get();
+    std::sort(found.begin(), found.end());
+
+    for (auto& [last_offset, filename] : found) {
+        if (last_offset < _next_offset) {
+            vlog(lg.debug, "Removing merged delta snapshot {}", filename);
+            _delta_snap.remove_snapshot(filename).get();
+            continue;
+        }
+
+        auto reader = _delta_snap.open_snapshot(filename).get0();
+        if (!reader) {
+            throw std::runtime_error(
+              fmt::format("Delta snapshot {} not found", filename));
+        }
+        auto close_reader = ss::defer([&reader] { reader->close().get(); });
+
+        auto snap_meta = reader->read_metadata().get0();
+        iobuf_parser parser(std::move(snap_meta));
+        auto base_offset = model::offset(
+          reflection::adl<model::offset::type>{}.from(parser));
+        auto meta_last_offset = model::offset(
+          reflection::adl<model::offset::type>{}.from(parser));
+        if (meta_last_offset != last_offset) {
+            throw std::runtime_error(fmt::format(
+              "Delta snapshot {} metadata last offset {} doesn't match its "
+              "name",
+              filename,
+              meta_last_offset));
+        }
+        // deltas may overlap with the full snapshot, which is merged while
+        // operations are still being applied, but not leave a hole.
+        if (base_offset > _next_offset) {
+            throw std::runtime_error(fmt::format(
+              "Delta snapshot {} starts at offset {} past expected offset {}",
+              filename,
+              base_offset,
+              _next_offset));
+        }
+        vlog(
+          lg.debug,
+          "Load snapshot: applying delta snapshot for offsets [{}, {}]",
+          base_offset,
+          last_offset);
+
+        auto batch = read_snapshot_batch_in_thread(*reader);
+        auto size = batch.size_bytes() + sizeof(int32_t);
+        batch.for_each_record([this](model::record r) {
+            auto key = iobuf_to_bytes(r.release_key());
+            auto value = reflection::from_iobuf<std::optional<iobuf>>(
+              r.release_value());
+            apply_op(std::move(key), std::move(value));
+        });
+
+        _next_offset = last_offset + model::offset(1);
+        _deltas.push_back(delta_snapshot{
+          .filename = filename,
+          .base_offset = base_offset,
+          .last_offset = last_offset,
+          .size_bytes = size});
+    }
+
+    _dirty_keys.clear();
+    _delta_base_offset = _next_offset;
+}
+
 void kvstore::replay_segments_in_thread(segment_set segs) {
     vlog(
       lg.debug,
@@ -481,11 +762,23 @@ void kvstore::replay_segments_in_thread(segment_set segs) {
     }
 
     // find segment that starts at _next_offset
-    const auto match = std::find_if(
+    auto match = std::find_if(
       segs.begin(), segs.end(), [this](const ss::lw_shared_ptr<segment>& seg) {
           return seg->offsets().base_offset == _next_offset;
       });
 
+    // a merged snapshot may end in the middle of a segment, batches it
+    // represents are skipped by the replay
+    if (match == segs.end()) {
+        match = std::find_if(
+          segs.begin(),
+          segs.end(),
+          [this](const ss::lw_shared_ptr<segment>& seg) {
+              return seg->offsets().base_offset < _next_offset
+                     && seg->offsets().dirty_offset >= _next_offset;
+          });
+    }
+
     // we didn't find an exact match, and the last segment starts after
     // _next_offset. this is unrecoverable. it's effectively a hole in the log.
     if (
@@ -506,8 +799,8 @@ void kvstore::replay_segments_in_thread(segment_set segs) {
           "Replaying segment with base offset {}",
           seg->offsets().base_offset);
         vassert(
-          seg->offsets().base_offset == _next_offset,
-          "Segment base offset {} != expected next offset {}",
+          seg->offsets().base_offset <= _next_offset,
+          "Segment base offset {} > expected next offset {}",
           seg->offsets().base_offset,
           _next_offset);
 
@@ -548,21 +841,29 @@ void kvstore::replay_segments_in_thread(segment_set segs) {
     // accumulation of segments in cases where the system restarts many times
     // without ever filling up a segment and snapshotting when rolling. they'll
     // be removed on the next startup.
-    save_snapshot().get();
+    if (_conf.incremental_snapshots) {
+        save_delta_snapshot().get();
+    } else {
+        save_snapshot().get();
+    }
 }
 
 batch_consumer::consume_result kvstore::replay_consumer::accept_batch_start(
-  const model::record_batch_header&) const {
+  const model::record_batch_header& h) const {
     if (_store->_gate.is_closed()) {
         // early out on shutdown
         return batch_consumer::consume_result::stop_parser;
     }
+    // already represented in the snapshot
+    if (h.last_offset() < _store->_next_offset) {
+        return batch_consumer::consume_result::skip_batch;
+    }
     return batch_consumer::consume_result::accept_batch;
 }
 
 void kvstore::replay_consumer::skip_batch_start(
   model::record_batch_header h, size_t, size_t) {
-    vassert(false, "kvstore should never skip batches, header: {}", h);
+    vlog(lg.trace, "Replay: skipping batch represented in snapshot: {}", h);
 }
 
 void kvstore::replay_consumer::consume_batch_start(
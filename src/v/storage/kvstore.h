@@ -27,6 +27,11 @@
 #include <seastar/core/timer.hh>
 
 #include <absl/container/flat_hash_map.h>
+#include <absl/container/flat_hash_set.h>
+
+#include <optional>
+#include <utility>
+#include <vector>
 
 namespace storage {
 
@@ -71,22 +76,41 @@ namespace storage {
  * issue for either of these limitations since they exhibit a natural bound on
  * the set of unique keys and queue depth of at most a few bytes *
  * O(#-partitions-per-core).
+ *
+ * Incremental snapshots
+ * =====================
+ *
+ * By default every segment roll serializes the entire database into a new
+ * snapshot. With incremental snapshots enabled a roll only writes the keys
+ * changed since the previous snapshot (deletions included) into a delta
+ * snapshot covering the offsets of the rolled segment. Once the deltas add up
+ * to more than the full snapshot, or there are too many of them, they are
+ * merged into a new full snapshot in the background. Recovery loads the full
+ * snapshot, applies the deltas following it, and replays the remaining log.
+ *
+ * In this mode the log is also flushed with group commit: operations arriving
+ * while a flush is in flight are flushed as soon as it completes rather than
+ * after another commit interval.
  */
 struct kvstore_config {
     size_t max_segment_size;
     config::binding<std::chrono::milliseconds> commit_interval;
     ss::sstring base_dir;
     debug_sanitize_files sanitize_fileops;
+    kvstore_incremental_snapshots incremental_snapshots;
 
     kvstore_config(
       size_t max_segment_size,
       config::binding<std::chrono::milliseconds> commit_interval,
       ss::sstring base_dir,
-      debug_sanitize_files sanitize_fileops)
+      debug_sanitize_files sanitize_fileops,
+      kvstore_incremental_snapshots incremental_snapshots
+      = kvstore_incremental_snapshots::no)
       : max_segment_size(max_segment_size)
       , commit_interval(commit_interval)
       , base_dir(std::move(base_dir))
-      , sanitize_fileops(sanitize_fileops) {}
+      , sanitize_fileops(sanitize_fileops)
+      , incremental_snapshots(incremental_snapshots) {}
 };
 
 class kvstore {
@@ -109,18 +133,36 @@ public:
     ss::future<> put(key_space ks, bytes key, iobuf value);
     ss::future<> remove(key_space ks, bytes key);
 
+    /**
+     * Puts (engaged values) and removals (std::nullopt) of several keys. They
+     * are written to the log in the same batch, so they are applied
+     * atomically and cost a single operation to flush.
+     */
+    using write_op = std::pair<bytes, std::optional<iobuf>>;
+    ss::future<> write_batch(key_space ks, std::vector<write_op> ops);
+
     bool empty() const {
         vassert(_started, "kvstore has not been started");
         return _db.empty();
     }
 
+    /// Bytes written to the log and to snapshots, for write amplification.
+    uint64_t log_bytes_written() const { return _probe.log_bytes_written; }
+    uint64_t snapshot_bytes_written() const {
+        return _probe.snapshot_bytes_written;
+    }
+
 private:
+    static constexpr size_t max_delta_snapshots = 16;
+    static constexpr const char* delta_snapshot_prefix = "delta_snapshot";
+
     kvstore_config _conf;
     storage_resources& _resources;
     ntp_config _ntpc;
     ss::gate _gate;
     ss::abort_source _as;
     simple_snapshot_manager _snap;
+    snapshot_manager _delta_snap;
     bool _started{false};
 
     /**
@@ -145,15 +187,36 @@ private:
     std::vector<op> _ops;
     ss::timer<> _timer;
     ss::semaphore _sem{0};
+    bool _flushing{false};
     ss::lw_shared_ptr<segment> _segment;
     model::offset _next_offset;
     absl::flat_hash_map<bytes, iobuf, bytes_type_hash, bytes_type_eq> _db;
 
+    /*
+     * Incremental snapshots. The keys changed by the operations applied
+     * since `_delta_base_offset` are written to the next delta snapshot.
+     */
+    struct delta_snapshot {
+        ss::sstring filename;
+        model::offset base_offset;
+        model::offset last_offset;
+        size_t size_bytes{0};
+    };
+    std::vector<delta_snapshot> _deltas;
+    absl::flat_hash_set<bytes, bytes_type_hash, bytes_type_eq> _dirty_keys;
+    model::offset _delta_base_offset;
+    size_t _snapshot_size{0};
+    bool _merging{false};
+
     ss::future<> put(key_space ks, bytes key, std::optional<iobuf> value);
+    void schedule_flush();
     void apply_op(bytes key, std::optional<iobuf> value);
     ss::future<> flush_and_apply_ops();
     ss::future<> roll();
     ss::future<> save_snapshot();
+    ss::future<> save_delta_snapshot();
+    void maybe_merge_snapshots();
+    ss::future<> remove_merged_deltas(model::offset);
 
     /*
      * Recovery
@@ -163,6 +226,7 @@ private:
      */
     ss::future<> recover();
     void load_snapshot_in_thread();
+    void load_delta_snapshots_in_thread();
     void replay_segments_in_thread(segment_set);
 
     /**
@@ -202,12 +266,18 @@ private:
         void entry_removed() { ++entries_removed; }
         void add_cached_bytes(size_t count) { cached_bytes += count; }
         void dec_cached_bytes(size_t count) { cached_bytes -= count; }
+        void log_written(size_t count) { log_bytes_written += count; }
+        void snapshot_written(size_t count) { snapshot_bytes_written += count; }
+        void snapshots_merged() { ++merged_snapshots; }
 
         uint64_t segments_rolled{0};
         uint64_t entries_fetched{0};
         uint64_t entries_written{0};
         uint64_t entries_removed{0};
         size_t cached_bytes{0};
+        uint64_t log_bytes_written{0};
+        uint64_t snapshot_bytes_written{0};
+        uint64_t merged_snapshots{0};
 
         ss::metrics::metric_groups metrics;
     };
@@ -22,6 +22,7 @@
 
 #include <seastar/core/abort_source.hh>
 #include <seastar/core/shared_ptr.hh>
+#include <seastar/util/noncopyable_function.hh>
 
 #include <utility>
 
@@ -62,6 +63,7 @@ public:
         virtual ss::future<> remove() = 0;
 
         virtual ss::future<> flush() = 0;
+        virtual ss::future<ss::noncopyable_function<void()>> write_out() = 0;
 
         virtual ss::future<std::optional<timequery_result>>
           timequery(timequery_config) = 0;
@@ -103,6 +105,18 @@ public:
     ss::future<> remove() { return _impl->remove(); }
     ss::future<> flush() { return _impl->flush(); }
 
+    /**
+     * \brief Writes out the appended data without syncing it
+     *
+     * Resolves with a function which marks the data as flushed, like flush()
+     * does, to be called once a sync of the whole filesystem started after
+     * the future resolved. Truncation waits until the function is destroyed.
+     * Lets callers make the data of many logs durable at once.
+     */
+    ss::future<ss::noncopyable_function<void()>> write_out() {
+        return _impl->write_out();
+    }
+
     /**
      * \brief Truncate the suffix of log at a base offset
      *
@@ -26,6 +26,8 @@ struct log_housekeeping_meta {
     log handle;
     bitflags flags{bitflags::none};
     ss::lowres_clock::time_point last_compaction;
+    // when the resources of the idle log were last released
+    ss::lowres_clock::time_point last_idle_release;
 
     intrusive_list_hook link;
 };
@@ -18,6 +18,7 @@
 #include "ssx/future-util.h"
 #include "storage/batch_cache.h"
 #include "storage/compacted_index_writer.h"
+#include "storage/disk_log_impl.h"
 #include "storage/fs_utils.h"
 #include "storage/kvstore.h"
 #include "storage/log.h"
@@ -52,6 +53,7 @@
 #include <exception>
 #include <filesystem>
 #include <optional>
+#include <vector>
 
 namespace storage {
 using logs_type = absl::flat_hash_map<model::ntp, log_housekeeping_meta>;
@@ -97,13 +99,31 @@ ss::future<> log_manager::clean_close(storage::log& log) {
           "writing clean record for: {} {}",
           log.config().ntp(),
           clean_segment.value());
+        internal::clean_segment_value clean{
+          .segment_name = std::filesystem::path(clean_segment.value())
+                            .filename()
+                            .string()};
+        // closing flushed every segment and its index: checkpoint them so
+        // that the next startup can trust them instead of validating them
+        if (auto dlog = dynamic_cast<disk_log_impl*>(log.get_impl()); dlog) {
+            clean.segments.reserve(dlog->segments().size());
+            for (const auto& s : dlog->segments()) {
+                auto crc = s->index().file_crc();
+                if (!crc) {
+                    continue;
+                }
+                clean.segments.push_back(segment_checkpoint{
+                  .name
+                  = std::filesystem::path(s->filename()).filename().string(),
+                  .size_bytes = s->file_size(),
+                  .index_crc = *crc,
+                  .dirty_offset = s->offsets().dirty_offset});
+            }
+        }
         co_await _kvstore.put(
           kvstore::key_space::storage,
           internal::clean_segment_key(log.config().ntp()),
-          serde::to_iobuf(internal::clean_segment_value{
-            .segment_name = std::filesystem::path(clean_segment.value())
-                              .filename()
-                              .string()}));
+          serde::to_iobuf(std::move(clean)));
     }
 }
 
@@ -168,10 +188,54 @@ ss::future<> log_manager::housekeeping() {
 
     return ss::with_scheduling_group(
       _config.compaction_sg, [this, collection_threshold] {
-          return housekeeping_scan(collection_threshold);
+          return housekeeping_scan(collection_threshold).then([this] {
+              auto idle
+                = config::shard_local_cfg().storage_idle_log_release_ms();
+              if (!idle) {
+                  return ss::now();
+              }
+              return release_idle_logs(*idle);
+          });
       });
 }
 
+/**
+ * Most partitions of a node with many of them are not written to nor read
+ * from for long periods of time. Their logs give back the memory they only
+ * need while being accessed until the next access.
+ */
+ss::future<>
+log_manager::release_idle_logs(ss::lowres_clock::duration idle_timeout) {
+    const auto now = ss::lowres_clock::now();
+    std::vector<log> idle;
+    for (auto& log_meta : _logs_list) {
+        auto dlog = dynamic_cast<disk_log_impl*>(log_meta.handle.get_impl());
+        if (
+          !dlog || dlog->last_access() + idle_timeout > now
+          || dlog->last_access() < log_meta.last_idle_release) {
+            continue;
+        }
+        log_meta.last_idle_release = now;
+        idle.push_back(log_meta.handle);
+    }
+    if (idle.empty()) {
+        co_return;
+    }
+
+    vlog(stlog.debug, "releasing resources of {} idle logs", idle.size());
+    for (auto& l : idle) {
+        if (_abort_source.abort_requested()) {
+            co_return;
+        }
+        try {
+            co_await dynamic_cast<disk_log_impl*>(l.get_impl())
+              ->release_idle_resources();
+        } catch (const ss::gate_closed_exception&) {
+            // the log was closed or removed in the meantime
+        }
+    }
+}
+
 /**
  *
  * @param read_buf_size size of underlying ss::input_stream's buffer
@@ -219,23 +283,23 @@ ss::future<log> log_manager::manage(ntp_config cfg) {
     co_return co_await do_manage(std::move(cfg));
 }
 
-ss::future<> log_manager::recover_log_state(const ntp_config& cfg) {
-    return ss::file_exists(cfg.work_directory())
-      .then([this,
-             offset_key = internal::start_offset_key(cfg.ntp()),
-             segment_key = internal::clean_segment_key(cfg.ntp())](
-              bool dir_exists) {
-          if (dir_exists) {
-              return ss::now();
-          }
-          // directory was deleted, make sure we do not have any state in KV
-          // store.
-          return _kvstore.remove(kvstore::key_space::storage, offset_key)
-            .then([this, segment_key] {
-                return _kvstore.remove(
-                  kvstore::key_space::storage, segment_key);
-            });
-      });
+ss::future<bool> log_manager::recover_log_state(const ntp_config& cfg) {
+    if (co_await ss::file_exists(cfg.work_directory())) {
+        co_return true;
+    }
+    // directory was deleted, make sure we do not have any state in KV
+    // store. the keys are absent for a new log, checking first keeps the
+    // creation of many partitions from writing to the kvstore.
+    std::vector<kvstore::write_op> ops;
+    for (auto& key :
+         {internal::start_offset_key(cfg.ntp()),
+          internal::clean_segment_key(cfg.ntp())}) {
+        if (_kvstore.get(kvstore::key_space::storage, key)) {
+            ops.emplace_back(key, std::nullopt);
+        }
+    }
+    co_await _kvstore.write_batch(kvstore::key_space::storage, std::move(ops));
+    co_return false;
 }
 
 ss::future<log> log_manager::do_manage(ntp_config cfg) {
@@ -259,28 +323,52 @@ ss::future<log> log_manager::do_manage(ntp_config cfg) {
     }
 
     std::optional<ss::sstring> last_clean_segment;
+    std::vector<segment_checkpoint> checkpoint;
     auto clean_iobuf = _kvstore.get(
       kvstore::key_space::storage, internal::clean_segment_key(cfg.ntp()));
     if (clean_iobuf) {
-        last_clean_segment = serde::from_iobuf<internal::clean_segment_value>(
-                               std::move(clean_iobuf.value()))
-                               .segment_name;
+        auto clean = serde::from_iobuf<internal::clean_segment_value>(
+          std::move(clean_iobuf.value()));
+        // the checkpoint supersedes the last clean segment, which is only
+        // trusted by name
+        if (clean.segments.empty()) {
+            last_clean_segment = std::move(clean.segment_name);
+        } else {
+            checkpoint = std::move(clean.segments);
+        }
     }
+    const bool has_checkpoint = !checkpoint.empty();
 
-    co_await recover_log_state(cfg);
+    const bool dir_exists = co_await recover_log_state(cfg);
 
     ss::sstring path = cfg.work_directory();
     with_cache cache_enabled = cfg.cache_enabled();
-    auto segments = co_await recover_segments(
-      std::filesystem::path(path),
-      _config.sanitize_fileops,
-      cfg.is_compacted(),
-      [this, cache_enabled] { return create_cache(cache_enabled); },
-      _abort_source,
-      config::shard_local_cfg().storage_read_buffer_size(),
-      config::shard_local_cfg().storage_read_readahead_count(),
-      last_clean_segment,
-      _resources);
+    segment_set segments(segment_set::underlying_t{});
+    if (dir_exists) {
+        segments = co_await recover_segments(
+          std::filesystem::path(path),
+          _config.sanitize_fileops,
+          cfg.is_compacted(),
+          [this, cache_enabled] { return create_cache(cache_enabled); },
+          _abort_source,
+          config::shard_local_cfg().storage_read_buffer_size(),
+          config::shard_local_cfg().storage_read_readahead_count(),
+          last_clean_segment,
+          std::move(checkpoint),
+          _resources);
+    } else {
+        // a new log has no segments to recover, the first segment file is
+        // created by the first append
+        co_await ss::recursive_touch_directory(path);
+    }
+
+    if (dir_exists && has_checkpoint) {
+        // the checkpoint describes the log as it was closed: it may be
+        // written to once open, a clean close checkpoints it again. this
+        // way a checkpoint is only ever trusted after a clean shutdown.
+        co_await _kvstore.remove(
+          kvstore::key_space::storage, internal::clean_segment_key(cfg.ntp()));
+    }
 
     auto l = storage::make_disk_backed_log(
       std::move(cfg), *this, std::move(segments), _kvstore);
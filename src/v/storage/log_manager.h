@@ -250,10 +250,13 @@ private:
     std::optional<batch_cache_index> create_cache(with_cache);
 
     ss::future<> dispatch_topic_dir_deletion(ss::sstring dir);
-    ss::future<> recover_log_state(const ntp_config&);
+    /// Returns false when the log directory does not exist, i.e. the log is
+    /// new.
+    ss::future<bool> recover_log_state(const ntp_config&);
     ss::future<> async_clear_logs();
 
     ss::future<> housekeeping_scan(model::timestamp);
+    ss::future<> release_idle_logs(ss::lowres_clock::duration);
 
     log_config _config;
     kvstore& _kvstore;
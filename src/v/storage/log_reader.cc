@@ -10,6 +10,7 @@
 #include "storage/log_reader.h"
 
 #include "bytes/iobuf.h"
+#include "config/configuration.h"
 #include "model/record.h"
 #include "storage/logger.h"
 #include "vassert.h"
@@ -62,9 +63,12 @@ batch_consumer::consume_result skipping_consumer::accept_batch_start(
         _reader._config.start_offset = header.last_offset() + model::offset(1);
         return batch_consumer::consume_result::skip_batch;
     }
-    if (_reader._config.first_timestamp > header.first_timestamp) {
+    if (
+      _reader._config.first_timestamp
+      > std::max(header.first_timestamp, header.max_timestamp)) {
         // kakfa needs to guarantee that the returned record is >=
-        // first_timestamp
+        // first_timestamp. some clients leave the max timestamp of single
+        // record batches uninitialized
         _reader._config.start_offset = header.last_offset() + model::offset(1);
         return batch_consumer::consume_result::skip_batch;
     }
@@ -75,14 +79,16 @@ batch_consumer::consume_result skipping_consumer::accept_batch_start(
 void skipping_consumer::skip_batch_start(
   model::record_batch_header header,
   size_t /*physical_base_offset*/,
-  size_t /*size_on_disk*/) {
+  size_t size_on_disk) {
+    _reader.add_disk_bytes(size_on_disk);
     _expected_next_batch = header.last_offset() + model::offset(1);
 }
 
 void skipping_consumer::consume_batch_start(
   model::record_batch_header header,
   size_t /*physical_base_offset*/,
-  size_t /*size_on_disk*/) {
+  size_t size_on_disk) {
+    _reader.add_disk_bytes(size_on_disk);
     _expected_next_batch = header.last_offset() + model::offset(1);
     _header = header;
     _header.ctx.term = _reader._seg.offsets().term;
@@ -124,30 +130,55 @@ void skipping_consumer::print(std::ostream& os) const {
 }
 
 log_segment_batch_reader::log_segment_batch_reader(
-  segment& seg, log_reader_config& config, probe& p) noexcept
+  segment& seg,
+  log_reader_config& config,
+  probe& p,
+  readahead_tracker& readahead) noexcept
   : _seg(seg)
   , _config(config)
-  , _probe(p) {}
+  , _probe(p)
+  , _readahead(readahead) {}
 
 ss::future<std::unique_ptr<continuous_batch_parser>>
 log_segment_batch_reader::initialize(
   model::timeout_clock::time_point timeout,
   std::optional<model::offset> next_cached_batch) {
+    _stream_bytes = 0;
     auto input = co_await _seg.offset_data_stream(
-      _config.start_offset, _config.prio);
+      _config.start_offset, _config.prio, [this] { return next_window(); });
     co_return std::make_unique<continuous_batch_parser>(
       std::make_unique<skipping_consumer>(*this, timeout, next_cached_batch),
       std::move(input));
 }
 
+readahead_window log_segment_batch_reader::next_window() {
+    // the previous window was consumed, account its reads
+    record_stream_reads();
+    auto w = _readahead.window(_seg.reader().default_readahead());
+    _stream_readahead = w.readahead;
+    return w;
+}
+
+void log_segment_batch_reader::record_stream_reads() {
+    _readahead.record_stream(_stream_readahead, _stream_bytes);
+    _probe.add_stream_reads(_stream_readahead, _stream_bytes);
+    _stream_bytes = 0;
+}
+
 ss::future<> log_segment_batch_reader::close() {
     if (_iterator) {
+        record_stream_reads();
         return _iterator->close();
     }
 
     return ss::make_ready_future<>();
 }
 
+void log_segment_batch_reader::add_disk_bytes(size_t bytes) {
+    _stream_bytes += bytes;
+    _readahead.add_sequential_bytes(bytes);
+}
+
 void log_segment_batch_reader::add_one(model::record_batch&& batch) {
     _state.buffer.emplace_back(std::move(batch));
     const auto& b = _state.buffer.back();
@@ -219,7 +250,10 @@ log_reader::log_reader(
   : _lease(std::move(l))
   , _iterator(_lease->range.begin())
   , _config(config)
-  , _probe(probe) {
+  , _probe(probe)
+  , _readahead(
+      config::shard_local_cfg().storage_read_max_buffer_size(),
+      config::shard_local_cfg().storage_read_sequential_readahead_bytes()) {
     if (config.abort_source) {
         auto op_sub = config.abort_source.value().get().subscribe(
           [this]() noexcept { set_end_of_stream(); });
@@ -234,7 +268,7 @@ log_reader::log_reader(
 
     if (_iterator.next_seg != _lease->range.end()) {
         _iterator.reader = std::make_unique<log_segment_batch_reader>(
-          **_iterator.next_seg, _config, _probe);
+          **_iterator.next_seg, _config, _probe, _readahead);
     }
 }
 
@@ -254,7 +288,7 @@ ss::future<> log_reader::find_next_valid_iterator() {
     }
     if (_iterator.next_seg != _lease->range.end()) {
         _iterator.reader = std::make_unique<log_segment_batch_reader>(
-          **_iterator.next_seg, _config, _probe);
+          **_iterator.next_seg, _config, _probe, _readahead);
         _iterator.current_reader_seg = _iterator.next_seg;
     }
     if (tmp_reader) {
@@ -264,6 +298,20 @@ ss::future<> log_reader::find_next_valid_iterator() {
     return ss::make_ready_future<>();
 }
 
+static inline bool is_finished_offset(segment_set& s, model::offset o) {
+    if (s.empty()) {
+        return true;
+    }
+
+    for (int i = (int)s.size() - 1; i >= 0; --i) {
+        auto& seg = s[i];
+        if (!seg->empty()) {
+            return o > seg->offsets().dirty_offset;
+        }
+    }
+    return true;
+}
+
 ss::future<log_reader::storage_t>
 log_reader::do_load_slice(model::timeout_clock::time_point timeout) {
     if (is_done()) {
@@ -317,6 +365,11 @@ log_reader::do_load_slice(model::timeout_clock::time_point timeout) {
               return do_load_slice(timeout);
           }
           _probe.add_batches_read(recs.value().size());
+          if (is_finished_offset(_lease->range, _config.start_offset)) {
+              // caught up with the end of the log, from now on this is a
+              // tail reader
+              _readahead.reset();
+          }
           return ss::make_ready_future<storage_t>(std::move(recs.value()));
       })
       .handle_exception([this](std::exception_ptr e) {
@@ -327,19 +380,6 @@ log_reader::do_load_slice(model::timeout_clock::time_point timeout) {
       });
 }
 
-static inline bool is_finished_offset(segment_set& s, model::offset o) {
-    if (s.empty()) {
-        return true;
-    }
-
-    for (int i = (int)s.size() - 1; i >= 0; --i) {
-        auto& seg = s[i];
-        if (!seg->empty()) {
-            return o > seg->offsets().dirty_offset;
-        }
-    }
-    return true;
-}
 bool log_reader::is_done() {
     return is_end_of_stream()
            || is_finished_offset(_lease->range, _config.start_offset);
@@ -17,6 +17,7 @@
 #include "storage/lock_manager.h"
 #include "storage/parser.h"
 #include "storage/probe.h"
+#include "storage/readahead.h"
 #include "storage/segment_reader.h"
 #include "storage/segment_set.h"
 #include "storage/types.h"
@@ -91,7 +92,10 @@ public:
     static constexpr size_t max_buffer_size = 32 * 1024; // 32KB
 
     log_segment_batch_reader(
-      segment&, log_reader_config& config, probe& p) noexcept;
+      segment&,
+      log_reader_config& config,
+      probe& p,
+      readahead_tracker& readahead) noexcept;
     log_segment_batch_reader(log_segment_batch_reader&&) noexcept = default;
     log_segment_batch_reader&
     operator=(log_segment_batch_reader&&) noexcept = delete;
@@ -112,6 +116,13 @@ private:
 
     void add_one(model::record_batch&&);
 
+    /// Account bytes of the segment read through the current stream.
+    void add_disk_bytes(size_t);
+
+    /// Sizing of the next window of the stream, see readahead_tracker.
+    readahead_window next_window();
+    void record_stream_reads();
+
 private:
     struct tmp_state {
         ss::circular_buffer<model::record_batch> buffer;
@@ -122,8 +133,13 @@ private:
     segment& _seg;
     log_reader_config& _config;
     probe& _probe;
+    readahead_tracker& _readahead;
 
     std::unique_ptr<continuous_batch_parser> _iterator;
+    // sizing of the reads of the current window of the stream of _iterator
+    // and bytes read from it
+    readahead_policy _stream_readahead;
+    size_t _stream_bytes{0};
     tmp_state _state;
     friend class skipping_consumer;
 };
@@ -203,6 +219,8 @@ public:
      */
     bool is_reusable() const { return _iterator.reader != nullptr; }
 
+    const readahead_tracker& readahead() const { return _readahead; }
+
 private:
     void set_end_of_stream() { _iterator.next_seg = _lease->range.end(); }
     bool is_done();
@@ -236,6 +254,7 @@ private:
     log_reader_config _config;
     model::offset _last_base;
     probe& _probe;
+    readahead_tracker _readahead;
     ss::abort_source::subscription _as_sub;
 };
 
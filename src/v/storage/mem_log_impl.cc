@@ -159,6 +159,9 @@ struct mem_log_impl final : log::impl {
     }
     ss::future<> remove() final { return ss::make_ready_future<>(); }
     ss::future<> flush() final { return ss::make_ready_future<>(); }
+    ss::future<ss::noncopyable_function<void()>> write_out() final {
+        return ss::make_ready_future<ss::noncopyable_function<void()>>([] {});
+    }
     ss::future<> compact(compaction_config cfg) final {
         return gc(cfg.eviction_time, cfg.max_bytes);
     }
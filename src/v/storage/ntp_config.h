@@ -89,6 +89,17 @@ public:
       , _revision_id(id)
       , _initial_rev(initial_id) {}
 
+    /// ntp_config is move only because of its overrides
+    ntp_config copy() const {
+        return ntp_config(
+          _ntp,
+          _base_dir,
+          _overrides ? std::make_unique<default_overrides>(*_overrides)
+                     : nullptr,
+          _revision_id,
+          _initial_rev);
+    }
+
     const model::ntp& ntp() const { return _ntp; }
     model::ntp& ntp() { return _ntp; }
 
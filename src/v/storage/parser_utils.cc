@@ -59,6 +59,18 @@ ss::future<model::record_batch> decompress_batch(const model::record_batch& b) {
     return ss::make_ready_future<model::record_batch>(std::move(batch));
 }
 
+ss::future<std::optional<timequery_result>>
+batch_timequery(model::record_batch b, model::timestamp t) {
+    if (b.compressed()) {
+        b = co_await decompress_batch(std::move(b));
+    }
+    if (auto r = model::find_first_record_at_or_after(b, t); r) {
+        co_return timequery_result(r->first, r->second);
+    }
+    // header max timestamp doesn't match the records, keep batch granularity
+    co_return timequery_result(b.base_offset(), b.header().first_timestamp);
+}
+
 compress_batch_consumer::compress_batch_consumer(
   model::compression c, std::size_t threshold) noexcept
   : _compression_type(c)
@@ -14,6 +14,7 @@
 #include "bytes/iobuf_parser.h"
 #include "model/record.h"
 #include "model/record_batch_reader.h"
+#include "storage/types.h"
 
 namespace storage::internal {
 
@@ -52,6 +53,12 @@ compress_batch(model::compression, model::record_batch&&);
 ss::future<model::record_batch>
 compress_batch(model::compression, const model::record_batch&);
 
+/// \brief offset and timestamp of the first record of the batch with
+/// timestamp >= `t`, decompressing it if needed. The batch is expected to hold
+/// such a record, otherwise its first offset and timestamp are returned.
+ss::future<std::optional<timequery_result>>
+batch_timequery(model::record_batch, model::timestamp t);
+
 /// \brief resets the size, header crc and payload crc
 void reset_size_checksum_metadata(model::record_batch_header&, const iobuf&);
 
@@ -116,6 +116,12 @@ void probe::setup_metrics(const model::ntp& ntp) {
          sm::description("Total number of cached batches read"),
          labels)
          .aggregate(aggregate_labels),
+       sm::make_histogram(
+         "read_io_size",
+         sm::description("Size of the reads issued by log readers"),
+         labels,
+         [this] { return _read_io_sizes.to_metrics_histogram(); })
+         .aggregate(aggregate_labels),
        sm::make_counter(
          "log_segments_created",
          [this] { return _log_segments_created; },
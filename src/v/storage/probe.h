@@ -14,6 +14,7 @@
 #include "ssx/metrics.h"
 #include "storage/fwd.h"
 #include "storage/logger.h"
+#include "storage/readahead.h"
 #include "storage/types.h"
 
 #include <seastar/core/metrics_registration.hh>
@@ -82,6 +83,11 @@ public:
         _cached_batches_read += batches;
     }
 
+    void add_stream_reads(const readahead_policy& p, size_t bytes) {
+        _read_io_sizes.record_stream(p, bytes);
+    }
+    const read_io_histogram& read_io_sizes() const { return _read_io_sizes; }
+
     void batch_parse_error() { ++_batch_parse_errors; }
 
     void setup_metrics(const model::ntp&);
@@ -111,6 +117,7 @@ private:
     uint32_t _batch_parse_errors = 0;
     uint32_t _batch_write_errors = 0;
     double _compaction_ratio = 1.0;
+    read_io_histogram _read_io_sizes;
     ss::metrics::metric_groups _metrics;
 };
 } // namespace storage
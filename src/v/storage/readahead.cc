@@ -0,0 +1,99 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "storage/readahead.h"
+
+#include <fmt/ostream.h>
+
+#include <algorithm>
+#include <bit>
+#include <numeric>
+
+namespace storage {
+
+std::ostream& operator<<(std::ostream& o, const readahead_policy& p) {
+    fmt::print(
+      o, "{{buffer_size: {}, read_ahead: {}}}", p.buffer_size, p.read_ahead);
+    return o;
+}
+
+void read_io_histogram::record(size_t io_size, uint64_t count) {
+    size_t bucket = 0;
+    if (io_size > min_io_size) {
+        // index of the smallest power of two upper bound >= io_size
+        bucket = std::bit_width((io_size - 1) / min_io_size);
+    }
+    _counts[std::min(bucket, buckets - 1)] += count;
+}
+
+void read_io_histogram::record_stream(
+  const readahead_policy& p, size_t bytes) {
+    if (bytes == 0 || p.buffer_size == 0) {
+        return;
+    }
+    record(p.buffer_size, (bytes + p.buffer_size - 1) / p.buffer_size);
+}
+
+void read_io_histogram::merge(const read_io_histogram& o) {
+    for (size_t i = 0; i < buckets; ++i) {
+        _counts[i] += o._counts[i];
+    }
+}
+
+uint64_t read_io_histogram::total_count() const {
+    return std::accumulate(_counts.begin(), _counts.end(), uint64_t{0});
+}
+
+uint64_t read_io_histogram::total_bytes() const {
+    uint64_t bytes = 0;
+    for (size_t i = 0; i < buckets; ++i) {
+        bytes += _counts[i] * upper_bound(i);
+    }
+    return bytes;
+}
+
+ss::metrics::histogram read_io_histogram::to_metrics_histogram() const {
+    ss::metrics::histogram h;
+    h.buckets.resize(buckets);
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < buckets; ++i) {
+        cumulative += _counts[i];
+        h.buckets[i].count = cumulative;
+        h.buckets[i].upper_bound = static_cast<double>(upper_bound(i));
+    }
+    h.sample_count = cumulative;
+    h.sample_sum = static_cast<double>(total_bytes());
+    return h;
+}
+
+readahead_policy readahead_tracker::policy(readahead_policy base) const {
+    return window(base).readahead;
+}
+
+readahead_window readahead_tracker::window(readahead_policy base) const {
+    auto p = base;
+    auto threshold = sequential_threshold;
+    while (_sequential_bytes >= threshold
+           && p.buffer_size * 2 <= _max_buffer_size) {
+        p.buffer_size *= 2;
+        threshold *= 2;
+    }
+    if (p.buffer_size != base.buffer_size && base.read_ahead > 0) {
+        // the prefetch budget of sequential readers, still read at least one
+        // buffer ahead
+        p.read_ahead = std::max<size_t>(1, _readahead_bytes / p.buffer_size);
+    }
+    size_t max_bytes = 0;
+    if (p.buffer_size * 2 <= _max_buffer_size) {
+        max_bytes = threshold - _sequential_bytes;
+    }
+    return {.readahead = p, .max_bytes = max_bytes};
+}
+
+} // namespace storage
@@ -0,0 +1,128 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "seastarx.h"
+#include "units.h"
+
+#include <seastar/core/metrics_types.hh>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+namespace storage {
+
+/// Sizing of the reads issued by a segment input stream.
+struct readahead_policy {
+    // size of each dma read
+    size_t buffer_size{0};
+    // number of reads issued ahead of the consumer
+    unsigned read_ahead{0};
+
+    friend bool operator==(const readahead_policy&, const readahead_policy&)
+      = default;
+    friend std::ostream& operator<<(std::ostream&, const readahead_policy&);
+};
+
+/// Range of a segment input stream read with the same sizing.
+struct readahead_window {
+    readahead_policy readahead;
+    // bytes read with this sizing, 0 for up to the end of the stream
+    size_t max_bytes{0};
+};
+
+/// Number of reads issued by segment input streams, by power of two read
+/// size from 4KiB (all smaller reads) to 8MiB (all larger reads).
+class read_io_histogram {
+public:
+    static constexpr size_t min_io_size = 4_KiB;
+    static constexpr size_t buckets = 12;
+
+    void record(size_t io_size, uint64_t count);
+    /// Account the reads issued by a stream which read `bytes` with `p`.
+    void record_stream(const readahead_policy& p, size_t bytes);
+    void merge(const read_io_histogram&);
+
+    /// Number of reads larger than the previous bucket's upper bound and
+    /// at most as large as this bucket's.
+    uint64_t count(size_t bucket) const { return _counts[bucket]; }
+    static size_t upper_bound(size_t bucket) { return min_io_size << bucket; }
+
+    uint64_t total_count() const;
+    /// Approximate sum of the read sizes, by upper bound of their bucket.
+    uint64_t total_bytes() const;
+
+    ss::metrics::histogram to_metrics_histogram() const;
+
+private:
+    std::array<uint64_t, buckets> _counts{};
+};
+
+/**
+ * Adapts the reads of a log reader to its access pattern.
+ *
+ * Segment input streams used to always read with the configured buffer size
+ * and read ahead count, sized for tail consumers which mostly read from the
+ * batch cache. A reader which keeps being reused to read from disk, i.e. a
+ * reader cached in the readers cache by a consumer catching up or by a
+ * recovering follower, is scanning the log sequentially. The tracker counts
+ * the bytes such a reader read from disk and doubles the size of its reads
+ * every time that count doubles, starting at `sequential_threshold`, up to
+ * `max_buffer_size`. Once its reads grew, the reader reads `readahead_bytes`
+ * ahead of its consumer whatever the size of its reads, at least one read:
+ * sequential readers get their own prefetch budget instead of the read ahead
+ * count sized for tail reads. Reads issued once the reader caught up with the
+ * end of the log shrink back to the configured size.
+ *
+ * The sizing of a stream only changes at the end of a window, the range read
+ * until the next growth, so that no data read ahead is dropped on the way.
+ *
+ * Random reads never grow: a reader is only reused when the next read starts
+ * where the previous one ended, otherwise a new reader is created.
+ */
+class readahead_tracker {
+public:
+    static constexpr size_t sequential_threshold = 4_MiB;
+
+    readahead_tracker(size_t max_buffer_size, size_t readahead_bytes) noexcept
+      : _max_buffer_size(max_buffer_size)
+      , _readahead_bytes(readahead_bytes) {}
+
+    /// Policy for a stream opened now, given the configured one.
+    readahead_policy policy(readahead_policy base) const;
+    /// Policy for the next window of a stream and the bytes until it grows.
+    readahead_window window(readahead_policy base) const;
+
+    /// Account bytes read from disk by a stream.
+    void add_sequential_bytes(size_t bytes) { _sequential_bytes += bytes; }
+
+    /// The reader reached the end of the log: following reads are tail reads.
+    void reset() { _sequential_bytes = 0; }
+
+    /// Account the reads issued by a stream which read `bytes` with `p`.
+    void record_stream(const readahead_policy& p, size_t bytes) {
+        _io_sizes.record_stream(p, bytes);
+    }
+
+    size_t sequential_bytes() const { return _sequential_bytes; }
+    const read_io_histogram& io_sizes() const { return _io_sizes; }
+
+private:
+    size_t _max_buffer_size;
+    size_t _readahead_bytes;
+    size_t _sequential_bytes{0};
+    read_io_histogram _io_sizes;
+};
+
+} // namespace storage
@@ -77,6 +77,7 @@ readers_cache::put(std::unique_ptr<log_reader> reader) {
     auto ptr = new entry{.reader = std::move(reader)}; // NOLINT
     _in_use.push_back(*ptr);
     _probe.reader_added();
+    _accounted.add(entry_footprint);
     return ptr->make_cached_reader(this);
 }
 
@@ -155,7 +156,8 @@ ss::future<> readers_cache::stop() {
     for (auto& r : _readers) {
         co_await r.reader->finally();
     }
-    _readers.clear_and_dispose([](entry* e) {
+    _readers.clear_and_dispose([this](entry* e) {
+        _accounted.sub(entry_footprint);
         delete e; // NOLINT
     });
 }
@@ -273,6 +275,7 @@ readers_cache::dispose_entries(intrusive_list<entry, &entry::_hook> entries) {
           e->reader->lease_range_end_offset(),
           e->reader->next_read_lower_bound());
         _probe.reader_evicted();
+        _accounted.sub(entry_footprint);
         delete e; // NOLINT
     });
 }
@@ -308,6 +311,7 @@ void readers_cache::dispose_in_background(entry* e) {
                   e->reader->lease_range_end_offset(),
                   e->reader->next_read_lower_bound());
                 _probe.reader_evicted();
+                _accounted.sub(entry_footprint);
                 delete e; // NOLINT
             });
         });
@@ -17,6 +17,7 @@
 #include "storage/readers_cache_probe.h"
 #include "storage/types.h"
 #include "utils/intrusive_list_helpers.h"
+#include "utils/memory_accounting.h"
 #include "vlog.h"
 
 #include <seastar/core/condition-variable.hh>
@@ -99,6 +100,10 @@ private:
         bool valid = true;
         intrusive_list_hook _hook;
     };
+    // accounted footprint of a cached reader, not including the buffers of
+    // its underlying segment reader
+    static constexpr size_t entry_footprint = sizeof(entry)
+                                              + sizeof(log_reader);
     /**
      * RAII based entry lock guard, it touches entry in a cache and handles
      * locking logic. Entry is unlocked when cached reader is destroyed
@@ -179,5 +184,6 @@ private:
      */
     std::vector<offset_range> _locked_offset_ranges;
     ss::condition_variable _in_use_reader_destroyed;
+    accounted_memory _accounted{memory_subsystem::readers_cache};
 };
 } // namespace storage
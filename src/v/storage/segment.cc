@@ -239,6 +239,39 @@ void segment::release_appender_in_background(readers_cache* readers_cache) {
       });
 }
 
+ss::future<> segment::release_idle_resources() {
+    return write_lock().then([this](ss::rwlock::holder h) {
+        if (is_closed()) {
+            return ss::now();
+        }
+        // the index stays, the batches are read back from disk on demand
+        cache_truncate(_tracker.base_offset);
+        if (!_appender || _compaction_index) {
+            return ss::now();
+        }
+        _flags |= bitflags::idle_appender;
+        return do_flush()
+          .then([this] {
+              return do_release_appender(
+                std::exchange(_appender, nullptr), std::nullopt, std::nullopt);
+          })
+          .finally([h = std::move(h)] {});
+    });
+}
+
+ss::future<> segment::reopen_appender(segment_appender_ptr a) {
+    auto h = co_await write_lock();
+    if (is_closed() || !has_idle_appender()) {
+        co_await a->close();
+        throw std::runtime_error(fmt::format(
+          "Cannot reopen the appender of segment: {}", *this));
+    }
+    a->resume(_reader.file_size());
+    _appender = std::move(a);
+    _appender->set_callbacks(&_appender_callbacks);
+    _flags &= ~bitflags::idle_appender;
+}
+
 ss::future<> segment::flush() {
     check_segment_not_closed("flush()");
     return read_lock().then([this](ss::rwlock::holder h) {
@@ -261,6 +294,25 @@ ss::future<> segment::do_flush() {
     });
 }
 
+ss::future<ss::noncopyable_function<void()>> segment::write_out() {
+    check_segment_not_closed("write_out()");
+    auto h = co_await read_lock();
+    if (!_appender) {
+        co_return [] {};
+    }
+    auto o = _tracker.dirty_offset;
+    auto fsize = co_await _appender->write_out();
+    // same as do_flush() once synced
+    co_return [this, o, fsize, h = std::move(h)] {
+        if (_appender) {
+            _appender->mark_synced(fsize);
+        }
+        _tracker.committed_offset = std::max(o, _tracker.committed_offset);
+        _tracker.stable_offset = _tracker.committed_offset;
+        _reader.set_file_size(std::max(fsize, _reader.file_size()));
+    };
+}
+
 ss::future<> remove_compacted_index(const ss::sstring& reader_path) {
     auto path = internal::compacted_index_path(reader_path.c_str());
     return ss::remove_file(path.c_str())
@@ -468,6 +520,16 @@ ss::future<append_result> segment::append(model::record_batch&& b) {
 
 ss::future<segment_reader_handle>
 segment::offset_data_stream(model::offset o, ss::io_priority_class iopc) {
+    return offset_data_stream(
+      o, iopc, [readahead = _reader.default_readahead()] {
+          return readahead_window{.readahead = readahead};
+      });
+}
+
+ss::future<segment_reader_handle> segment::offset_data_stream(
+  model::offset o,
+  ss::io_priority_class iopc,
+  ss::noncopyable_function<readahead_window()> next_window) {
     check_segment_not_closed("offset_data_stream()");
     auto nearest = _idx.find_nearest(o);
     size_t position = 0;
@@ -479,7 +541,7 @@ segment::offset_data_stream(model::offset o, ss::io_priority_class iopc) {
     // size) (https://github.com/redpanda-data/redpanda/issues/2101)
     vassert(position < size_bytes(), "Index points beyond file size");
 
-    return _reader.data_stream(position, iopc);
+    return _reader.data_stream(position, iopc, std::move(next_window));
 }
 
 void segment::advance_stable_offset(size_t offset) {
@@ -563,7 +625,8 @@ ss::future<ss::lw_shared_ptr<segment>> open_segment(
   std::optional<batch_cache_index> batch_cache,
   size_t buf_size,
   unsigned read_ahead,
-  storage_resources& resources) {
+  storage_resources& resources,
+  std::optional<size_t> file_size) {
     auto const meta = segment_path::parse_segment_filename(
       path.filename().string());
     if (!meta || meta->version != record_version_type::v1) {
@@ -575,8 +638,16 @@ ss::future<ss::lw_shared_ptr<segment>> open_segment(
     }
 
     auto rdr = std::make_unique<segment_reader>(
-      path.string(), buf_size, read_ahead, sanitize_fileops);
-    co_await rdr->load_size();
+      path.string(),
+      buf_size,
+      read_ahead,
+      sanitize_fileops,
+      &resources.file_handles());
+    if (file_size) {
+        rdr->set_file_size(*file_size);
+    } else {
+        co_await rdr->load_size();
+    }
 
     auto index_name = std::filesystem::path(rdr->filename().c_str())
                         .replace_extension("base_index")
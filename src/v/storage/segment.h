@@ -24,6 +24,7 @@
 #include <seastar/core/file.hh>
 #include <seastar/core/gate.hh>
 #include <seastar/core/rwlock.hh>
+#include <seastar/util/noncopyable_function.hh>
 
 #include <exception>
 #include <optional>
@@ -61,6 +62,7 @@ public:
         finished_self_compaction = 1U << 1U,
         mark_tombstone = 1U << 2U,
         closed = 1U << 3U,
+        idle_appender = 1U << 4U,
     };
 
 public:
@@ -81,7 +83,31 @@ public:
 
     ss::future<> close();
     ss::future<> flush();
+    /**
+     * Writes out the appended data without syncing the file. Resolves with a
+     * function which marks that data as flushed, to be called once a sync of
+     * the whole filesystem started after it resolved. The segment is not
+     * truncated nor closed until the function is destroyed.
+     */
+    ss::future<ss::noncopyable_function<void()>> write_out();
     ss::future<> release_appender(readers_cache*);
+    /**
+     * Releases the resources held by a segment nobody accessed for a while:
+     * the cached batches and the appender of an active segment, with its
+     * file handle and preallocated file space. In flight appends and reads
+     * finish first. The segment stays the active one, see
+     * reopen_appender(). Compacted segments keep their appender, their
+     * compaction index can't be reopened for appends.
+     */
+    ss::future<> release_idle_resources();
+    /// The appender was released by release_idle_resources() and the segment
+    /// is still the active segment of its log.
+    bool has_idle_appender() const;
+    /// Resumes appends to a segment with an idle appender, `a` is a new
+    /// appender of the segment file.
+    ss::future<> reopen_appender(segment_appender_ptr a);
+    /// The log rolled past a segment with an idle appender, it is sealed.
+    void clear_idle_appender() { _flags &= ~bitflags::idle_appender; }
     ss::future<> truncate(model::offset, size_t physical);
 
     /// main write interface
@@ -95,6 +121,12 @@ public:
     /// main read interface
     ss::future<segment_reader_handle>
       offset_data_stream(model::offset, ss::io_priority_class);
+    /// the sizing of the reads is asked for window by window, see
+    /// readahead_tracker
+    ss::future<segment_reader_handle> offset_data_stream(
+      model::offset,
+      ss::io_priority_class,
+      ss::noncopyable_function<readahead_window()>);
 
     const offset_tracker& offsets() const { return _tracker; }
     bool empty() const;
@@ -210,6 +242,9 @@ private:
  * Returns an open segment if the segment was successfully opened.
  * Including a valid index and recovery for the index if one does not
  * exist
+ *
+ * When `file_size` is known the segment file is not accessed, it is only
+ * opened when it is first read.
  */
 ss::future<ss::lw_shared_ptr<segment>> open_segment(
   std::filesystem::path path,
@@ -217,7 +252,8 @@ ss::future<ss::lw_shared_ptr<segment>> open_segment(
   std::optional<batch_cache_index> batch_cache,
   size_t buf_size,
   unsigned read_ahead,
-  storage_resources&);
+  storage_resources&,
+  std::optional<size_t> file_size = std::nullopt);
 
 ss::future<ss::lw_shared_ptr<segment>> make_segment(
   const ntp_config& ntpc,
@@ -285,6 +321,9 @@ inline bool segment::is_compacted_segment() const {
     return (_flags & bitflags::is_compacted_segment)
            == bitflags::is_compacted_segment;
 }
+inline bool segment::has_idle_appender() const {
+    return (_flags & bitflags::idle_appender) == bitflags::idle_appender;
+}
 inline void segment::mark_as_finished_self_compaction() {
     _flags |= bitflags::finished_self_compaction;
 }
@@ -24,6 +24,7 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <ostream>
 
 namespace storage {
@@ -304,6 +305,18 @@ ss::future<> segment_appender::truncate(size_t n) {
       });
 }
 
+void segment_appender::resume(size_t size) {
+    vassert(
+      file_byte_offset() == 0 && !_head,
+      "Cannot resume appends to a used appender: {}",
+      *this);
+    // the head chunk hydrates the last half page on the first append
+    _committed_offset = size;
+    _fallocation_offset = size;
+    _flushed_offset = size;
+    _stable_offset = size;
+}
+
 ss::future<> segment_appender::close() {
     vassert(!_closed, "close() on closed segment: {}", *this);
     _closed = true;
@@ -410,6 +423,17 @@ ss::future<> segment_appender::process_flush_ops(size_t committed) {
 
     _flush_ops.erase(flushable, _flush_ops.end());
 
+    // write outs only wait for the data to be written
+    auto sync_end = std::partition(
+      ops.begin(), ops.end(), [](const flush_op& op) { return op.sync; });
+    for (auto it = sync_end; it != ops.end(); ++it) {
+        it->p.set_value();
+    }
+    ops.erase(sync_end, ops.end());
+    if (ops.empty()) {
+        return ss::now();
+    }
+
     return _out.flush().then([this, committed, ops = std::move(ops)]() mutable {
         _flushed_offset = committed;
         /*
@@ -550,6 +574,34 @@ ss::future<> segment_appender::flush() {
     });
 }
 
+ss::future<size_t> segment_appender::write_out() {
+    _inactive_timer.cancel();
+    const auto offset = file_byte_offset();
+
+    if (_head && _head->bytes_pending()) {
+        auto& w = _flush_ops.emplace_back(offset, false);
+        dispatch_background_head_write();
+        return w.p.get_future().then([offset] { return offset; });
+    }
+
+    if (offset <= _stable_offset) {
+        return ss::make_ready_future<size_t>(offset);
+    }
+
+    vassert(
+      !_inflight.empty(),
+      "No inflight writes but eof {} > stable offset {}: {}",
+      offset,
+      _stable_offset,
+      *this);
+    auto& w = _flush_ops.emplace_back(offset, false);
+    return w.p.get_future().then([offset] { return offset; });
+}
+
+void segment_appender::mark_synced(size_t offset) {
+    _flushed_offset = std::max(_flushed_offset, offset);
+}
+
 ss::future<> segment_appender::hard_flush() {
     _inactive_timer.cancel();
     if (_head && _head->bytes_pending()) {
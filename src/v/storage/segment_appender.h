@@ -79,6 +79,17 @@ public:
     ss::future<> close();
     ss::future<> flush();
 
+    /// Appends after the `size` bytes of a file written by a previous
+    /// appender, before anything was appended to this one.
+    void resume(size_t size);
+
+    /// Like flush() but without syncing the file: resolves with the file
+    /// offset up to which the appended bytes were written out.
+    ss::future<size_t> write_out();
+    /// The file was synced up to `offset` by other means, e.g. a sync of the
+    /// whole filesystem started after write_out() resolved with `offset`.
+    void mark_synced(size_t offset);
+
     struct callbacks {
         virtual ~callbacks() = default;
         virtual void committed_physical_offset(size_t) = 0;
@@ -132,9 +143,12 @@ private:
     ss::lw_shared_ptr<ss::semaphore> _prev_head_write;
 
     struct flush_op {
-        explicit flush_op(size_t offset)
-          : offset(offset) {}
+        explicit flush_op(size_t offset, bool sync = true)
+          : offset(offset)
+          , sync(sync) {}
         size_t offset;
+        // false for write_out(), which does not sync the file
+        bool sync;
         ss::promise<> p;
     };
 
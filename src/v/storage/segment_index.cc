@@ -9,6 +9,7 @@
 
 #include "storage/segment_index.h"
 
+#include "hashing/crc32c.h"
 #include "model/timestamp.h"
 #include "serde/serde.h"
 #include "storage/index_state.h"
@@ -25,6 +26,7 @@
 #include <fmt/format.h>
 
 #include <algorithm>
+#include <limits>
 
 namespace storage {
 
@@ -75,12 +77,15 @@ void segment_index::reset() {
     _state = {};
     _state.base_offset = base;
     _acc = 0;
+    _file_crc.reset();
+    _accounted.update(0);
 }
 
 void segment_index::swap_index_state(index_state&& o) {
     _needs_persistence = true;
     _acc = 0;
     std::swap(_state, o);
+    _accounted.update(_state.memory_size());
 }
 
 void segment_index::maybe_track(
@@ -95,28 +100,33 @@ void segment_index::maybe_track(
           hdr.first_timestamp,
           hdr.max_timestamp)) {
         _acc = 0;
+        _accounted.update(_state.memory_size());
     }
     _needs_persistence = true;
 }
 
 std::optional<segment_index::entry>
 segment_index::find_nearest(model::timestamp t) {
-    if (t < _state.base_timestamp) {
+    if (_state.empty() || t > _state.max_timestamp) {
         return std::nullopt;
     }
-    if (_state.empty()) {
-        return std::nullopt;
+    if (t <= _state.base_timestamp || !_state.time_index_sorted()) {
+        return translate_index_entry(_state, _state.get_entry(0));
     }
-    const uint32_t i = t() - _state.base_timestamp();
+    const uint32_t needle = std::min<int64_t>(
+      t() - _state.base_timestamp(), std::numeric_limits<uint32_t>::max());
+    // first entry whose max timestamp so far reaches the needle
     auto it = std::lower_bound(
       std::begin(_state.relative_time_index),
       std::end(_state.relative_time_index),
-      i,
+      needle,
       std::less<uint32_t>{});
-    if (it == _state.relative_offset_index.end()) {
-        return std::nullopt;
+    // batches past the previous entry may already hold the timestamp, while
+    // the previous entry and everything before it are known not to
+    if (it != std::begin(_state.relative_time_index)) {
+        it = std::prev(it);
     }
-    auto dist = std::distance(_state.relative_offset_index.begin(), it);
+    auto dist = std::distance(std::begin(_state.relative_time_index), it);
     return translate_index_entry(_state, _state.get_entry(dist));
 }
 
@@ -163,6 +173,7 @@ ss::future<> segment_index::truncate(model::offset o) {
         while (remove_back_elems-- > 0) {
             _state.pop_back();
         }
+        _accounted.update(_state.memory_size());
     }
 
     if (o < _state.max_offset) {
@@ -171,8 +182,14 @@ ss::future<> segment_index::truncate(model::offset o) {
             _state.max_timestamp = _state.base_timestamp;
             _state.max_offset = _state.base_offset;
         } else {
+            // entries of an unsorted time index hold batch timestamps
+            const auto& times = _state.relative_time_index;
+            const auto max_relative
+              = _state.time_index_sorted()
+                  ? times.back()
+                  : *std::max_element(std::begin(times), std::end(times));
             _state.max_timestamp = model::timestamp(
-              _state.relative_time_index.back() + _state.base_timestamp());
+              max_relative + _state.base_timestamp());
             _state.max_offset = o;
         }
     }
@@ -192,10 +209,21 @@ ss::future<bool> segment_index::materialize_index() {
         if (buf.empty()) {
             co_return false;
         }
+        // first byte is the version for both the serde and the old format
+        const auto version = static_cast<int8_t>(buf[0]);
+        crc::crc32c crc;
+        crc.extend(buf.get(), buf.size());
+        _file_crc = crc.value();
         iobuf b;
         b.append(std::move(buf));
         try {
             _state = serde::from_iobuf<index_state>(std::move(b));
+            // sampled batch timestamps cannot be turned into a max so far,
+            // timequeries on this segment scan it from its base instead
+            if (version < index_state::sorted_time_index_version) {
+                _state.bitflags |= index_state::unsorted_time_index_flag;
+            }
+            _accounted.update(_state.memory_size());
             co_return true;
         } catch (const serde::serde_exception& ex) {
             vlog(
@@ -223,10 +251,14 @@ ss::future<> segment_index::flush() {
           std::move(backing_file));
 
         auto b = serde::to_iobuf(_state.copy());
+        crc::crc32c crc;
+        crc_extend_iobuf(crc, b);
+        _file_crc.reset();
         for (const auto& f : b) {
             co_await out.write(f.get(), f.size());
         }
         co_await out.flush();
+        _file_crc = crc.value();
     });
 }
 
@@ -15,6 +15,7 @@
 #include "model/timestamp.h"
 #include "storage/index_state.h"
 #include "storage/types.h"
+#include "utils/memory_accounting.h"
 
 #include <seastar/core/file.hh>
 #include <seastar/core/unaligned.hh>
@@ -63,6 +64,8 @@ public:
 
     void maybe_track(const model::record_batch_header&, size_t filepos);
     std::optional<entry> find_nearest(model::offset);
+    /// \brief entry to start scanning from to find the first batch holding
+    /// a record with timestamp >= the needle, nullopt if the segment has none
     std::optional<entry> find_nearest(model::timestamp);
 
     model::offset base_offset() const { return _state.base_offset; }
@@ -87,15 +90,25 @@ public:
     void reset();
     void swap_index_state(index_state&&);
     bool needs_persistence() const { return _needs_persistence; }
-    index_state release_index_state() && { return std::move(_state); }
+    /// crc32c of the index file when it holds the current state, i.e. once
+    /// the index is materialized or flushed and until it changes again
+    std::optional<uint32_t> file_crc() const {
+        return _needs_persistence ? std::nullopt : _file_crc;
+    }
+    index_state release_index_state() && {
+        _accounted.update(0);
+        return std::move(_state);
+    }
 
 private:
     ss::sstring _name;
     size_t _step;
     size_t _acc{0};
     bool _needs_persistence{false};
+    std::optional<uint32_t> _file_crc;
     index_state _state;
     debug_sanitize_files _sanitize;
+    accounted_memory _accounted{memory_subsystem::segment_index};
 
     /** Constructor with mock file content for unit testing */
     segment_index(
@@ -10,6 +10,7 @@
 #include "storage/segment_reader.h"
 
 #include "ssx/future-util.h"
+#include "storage/file_handle_cache.h"
 #include "storage/logger.h"
 #include "storage/segment_utils.h"
 #include "vassert.h"
@@ -21,17 +22,86 @@
 #include <seastar/core/reactor.hh>
 #include <seastar/core/sstring.hh>
 
+#include <algorithm>
+
 namespace storage {
 
+namespace {
+
+/**
+ * Reads a file range through consecutive file input streams, one per
+ * readahead window. A stream is replaced once it returned all the bytes of
+ * its window: it has nothing read ahead left, so changing the sizing of the
+ * reads drops no data.
+ */
+class windowed_data_source final : public ss::data_source_impl {
+public:
+    windowed_data_source(
+      ss::file f,
+      size_t pos,
+      size_t end,
+      ss::io_priority_class pc,
+      ss::noncopyable_function<readahead_window()> next_window)
+      : _file(std::move(f))
+      , _pos(pos)
+      , _end(end)
+      , _pc(pc)
+      , _next_window(std::move(next_window)) {
+        open_window();
+    }
+
+    ss::future<ss::temporary_buffer<char>> get() final {
+        auto buf = co_await _stream->read();
+        while (buf.empty() && _pos < _end) {
+            co_await _stream->close();
+            open_window();
+            buf = co_await _stream->read();
+        }
+        co_return buf;
+    }
+
+    ss::future<> close() final { return _stream->close(); }
+
+private:
+    void open_window() {
+        auto w = _next_window();
+        auto len = _end - _pos;
+        if (w.max_bytes > 0) {
+            // at least a read per window
+            len = std::min(
+              len, std::max(w.max_bytes, w.readahead.buffer_size));
+        }
+        ss::file_input_stream_options options;
+        options.buffer_size = w.readahead.buffer_size;
+        options.io_priority_class = _pc;
+        options.read_ahead = w.readahead.read_ahead;
+        _stream.emplace(
+          make_file_input_stream(_file, _pos, len, std::move(options)));
+        _pos += len;
+    }
+
+    ss::file _file;
+    // end of the current window and of the range
+    size_t _pos;
+    size_t _end;
+    ss::io_priority_class _pc;
+    ss::noncopyable_function<readahead_window()> _next_window;
+    std::optional<ss::input_stream<char>> _stream;
+};
+
+} // namespace
+
 segment_reader::segment_reader(
   ss::sstring filename,
   size_t buffer_size,
   unsigned read_ahead,
-  debug_sanitize_files sanitize) noexcept
+  debug_sanitize_files sanitize,
+  file_handle_cache* file_handles) noexcept
   : _filename(std::move(filename))
   , _buffer_size(buffer_size)
   , _read_ahead(read_ahead)
-  , _sanitize(sanitize) {}
+  , _sanitize(sanitize)
+  , _file_handles(file_handles) {}
 
 segment_reader::~segment_reader() noexcept {
     if (!_streams.empty() || _data_file_refcount > 0) {
@@ -46,6 +116,10 @@ segment_reader::~segment_reader() noexcept {
     }
 
     _streams.clear();
+
+    if (_file_handles) {
+        _file_handles->close(*this);
+    }
 }
 
 segment_reader::segment_reader(segment_reader&& rhs) noexcept
@@ -55,12 +129,46 @@ segment_reader::segment_reader(segment_reader&& rhs) noexcept
   , _file_size(rhs._file_size)
   , _buffer_size(rhs._buffer_size)
   , _read_ahead(rhs._read_ahead)
-  , _sanitize(rhs._sanitize) {
+  , _sanitize(rhs._sanitize)
+  , _file_handles(rhs._file_handles)
+  , _released_at(rhs._released_at) {
+    for (auto& i : rhs._streams) {
+        i._parent = this;
+        i._hook.unlink();
+        _streams.push_back(i);
+    }
+    // a lingering file moves with the reader
+    _linger_hook.swap_nodes(rhs._linger_hook);
+}
+
+segment_reader& segment_reader::operator=(segment_reader&& rhs) noexcept {
+    if (this == &rhs) {
+        return *this;
+    }
+    if (_file_handles) {
+        _file_handles->close(*this);
+    }
+    for (auto& i : _streams) {
+        i.detach();
+    }
+    _streams.clear();
+
+    _filename = std::move(rhs._filename);
+    _data_file = std::move(rhs._data_file);
+    _data_file_refcount = std::exchange(rhs._data_file_refcount, 0);
+    _file_size = rhs._file_size;
+    _buffer_size = rhs._buffer_size;
+    _read_ahead = rhs._read_ahead;
+    _sanitize = rhs._sanitize;
+    _file_handles = rhs._file_handles;
+    _released_at = rhs._released_at;
     for (auto& i : rhs._streams) {
         i._parent = this;
         i._hook.unlink();
         _streams.push_back(i);
     }
+    _linger_hook.swap_nodes(rhs._linger_hook);
+    return *this;
 }
 
 ss::future<> segment_reader::load_size() {
@@ -70,6 +178,11 @@ ss::future<> segment_reader::load_size() {
 
 ss::future<segment_reader_handle>
 segment_reader::data_stream(size_t pos, const ss::io_priority_class pc) {
+    return data_stream(pos, pc, default_readahead());
+}
+
+ss::future<segment_reader_handle> segment_reader::data_stream(
+  size_t pos, const ss::io_priority_class pc, readahead_policy readahead) {
     vassert(
       pos <= _file_size,
       "cannot read negative bytes. Asked to read at position: '{}' - {}",
@@ -88,9 +201,9 @@ segment_reader::data_stream(size_t pos, const ss::io_priority_class pc) {
     // truncating the appender, is optimized.
 
     ss::file_input_stream_options options;
-    options.buffer_size = _buffer_size;
+    options.buffer_size = readahead.buffer_size;
     options.io_priority_class = pc;
-    options.read_ahead = _read_ahead;
+    options.read_ahead = readahead.read_ahead;
 
     auto handle = co_await get();
     handle.set_stream(make_file_input_stream(
@@ -110,6 +223,11 @@ ss::future<segment_reader_handle> segment_reader::get() {
         vlog(stlog.debug, "Opening segment file {}", _filename);
         _data_file = co_await internal::make_reader_handle(
           std::filesystem::path(_filename), _sanitize);
+        if (_file_handles) {
+            _file_handles->file_opened();
+        }
+    } else if (_data_file_refcount == 0 && _file_handles) {
+        _file_handles->acquire(*this);
     }
 
     _data_file_refcount++;
@@ -134,6 +252,13 @@ ss::future<> segment_reader::put() {
     vassert(_data_file_refcount > 0, "bad put() on {}", _filename);
     _data_file_refcount--;
     if (_data_file && _data_file_refcount == 0) {
+        if (_file_handles) {
+            if (_file_handles->release(*this)) {
+                // kept open for the next get(), see file_handle_cache
+                co_return;
+            }
+            _file_handles->file_closed();
+        }
         vlog(stlog.debug, "Closing segment file {}", _filename);
         // Note: a get() can now come in and open a fresh file handle: this
         // means we strictly-speaking can consume >1 file descriptors from one
@@ -150,6 +275,23 @@ ss::future<struct stat> segment_reader::stat() {
     co_return r;
 }
 
+ss::future<segment_reader_handle> segment_reader::data_stream(
+  size_t pos,
+  const ss::io_priority_class pc,
+  ss::noncopyable_function<readahead_window()> next_window) {
+    vassert(
+      pos <= _file_size,
+      "cannot read negative bytes. Asked to read at position: '{}' - {}",
+      pos,
+      *this);
+
+    auto handle = co_await get();
+    handle.set_stream(ss::input_stream<char>(
+      ss::data_source(std::make_unique<windowed_data_source>(
+        _data_file, pos, _file_size, pc, std::move(next_window)))));
+    co_return std::move(handle);
+}
+
 ss::future<segment_reader_handle> segment_reader::data_stream(
   size_t pos_begin, size_t pos_end, const ss::io_priority_class pc) {
     vassert(
@@ -186,8 +328,16 @@ ss::future<> segment_reader::truncate(size_t n) {
 }
 
 ss::future<> segment_reader::close() {
+    if (_file_handles) {
+        _file_handles->forget(*this);
+    }
     if (_data_file) {
-        return _data_file.close();
+        if (_file_handles) {
+            _file_handles->file_closed();
+        }
+        // reset the file: a lingering file must not be closed twice
+        auto data_file = std::exchange(_data_file, ss::file{});
+        return data_file.close().finally([data_file] {});
     } else {
         return ss::now();
     }
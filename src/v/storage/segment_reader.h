@@ -13,6 +13,7 @@
 
 #include "model/fundamental.h"
 #include "seastarx.h"
+#include "storage/readahead.h"
 #include "storage/types.h"
 #include "utils/intrusive_list_helpers.h"
 #include "utils/mutex.h"
@@ -21,7 +22,9 @@
 #include <seastar/core/fstream.hh>
 #include <seastar/core/io_queue.hh>
 #include <seastar/core/iostream.hh>
+#include <seastar/core/lowres_clock.hh>
 #include <seastar/util/log.hh>
+#include <seastar/util/noncopyable_function.hh>
 
 #include <optional>
 #include <type_traits>
@@ -29,6 +32,7 @@
 
 namespace storage {
 
+class file_handle_cache;
 class segment_reader;
 
 /**
@@ -109,10 +113,11 @@ public:
       ss::sstring filename,
       size_t buffer_size,
       unsigned read_ahead,
-      debug_sanitize_files) noexcept;
+      debug_sanitize_files,
+      file_handle_cache* file_handles = nullptr) noexcept;
     ~segment_reader() noexcept;
     segment_reader(segment_reader&&) noexcept;
-    segment_reader& operator=(segment_reader&&) noexcept = default;
+    segment_reader& operator=(segment_reader&&) noexcept;
     segment_reader(const segment_reader&) = delete;
     segment_reader& operator=(const segment_reader&) = delete;
 
@@ -125,6 +130,9 @@ public:
     /// file name
     const ss::sstring& filename() const { return _filename; }
 
+    /// cache keeping the file open once released, if any
+    file_handle_cache* file_handles() const { return _file_handles; }
+
     bool empty() const { return _file_size == 0; }
 
     /// close the underlying file handle
@@ -136,10 +144,23 @@ public:
     /// truncates file starting at this phyiscal offset
     ss::future<> truncate(size_t sz);
 
+    /// the configured sizing of the reads of data streams
+    readahead_policy default_readahead() const {
+        return {.buffer_size = _buffer_size, .read_ahead = _read_ahead};
+    }
+
     /// create an input stream _sharing_ the underlying file handle
     /// starting at position @pos
     ss::future<segment_reader_handle>
     data_stream(size_t pos, const ss::io_priority_class);
+    ss::future<segment_reader_handle> data_stream(
+      size_t pos, const ss::io_priority_class, readahead_policy);
+    /// create an input stream starting at position @pos which asks
+    /// @next_window for the sizing of its reads window after window
+    ss::future<segment_reader_handle> data_stream(
+      size_t pos,
+      const ss::io_priority_class,
+      ss::noncopyable_function<readahead_window()> next_window);
     ss::future<segment_reader_handle>
     data_stream(size_t pos_begin, size_t pos_end, const ss::io_priority_class);
 
@@ -163,6 +184,12 @@ private:
     unsigned _read_ahead{0};
     debug_sanitize_files _sanitize;
 
+    // When set, the file stays open for a while once the last handle on it
+    // is closed, linked into the cache's LRU.
+    file_handle_cache* _file_handles{nullptr};
+    intrusive_list_hook _linger_hook;
+    ss::lowres_clock::time_point _released_at;
+
     // Acquire a handle to use the underlying file handle
     ss::future<segment_reader_handle> get();
 
@@ -170,6 +197,7 @@ private:
     ss::future<> put();
 
     friend class segment_reader_handle;
+    friend class file_handle_cache;
     friend std::ostream& operator<<(std::ostream&, const segment_reader&);
 };
 
@@ -22,8 +22,11 @@
 #include <seastar/core/thread.hh>
 
 #include <absl/container/btree_set.h>
+#include <absl/container/flat_hash_map.h>
+#include <boost/range/irange.hpp>
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <exception>
 
 namespace storage {
@@ -168,20 +171,88 @@ std::ostream& operator<<(std::ostream& o, const segment_set& s) {
     return o << "]}";
 }
 
+// Number of segment or index files opened concurrently while recovering a
+// log. Logs are themselves recovered concurrently, up to
+// storage_max_concurrent_replay, see storage_resources::get_recovery_units(),
+// and share the storage_max_concurrent_recovery_io budget of their shard.
+static constexpr size_t recovery_io_concurrency = 16;
+
+// segments of the clean shutdown checkpoint, by file name
+using segment_checkpoints
+  = absl::flat_hash_map<ss::sstring, segment_checkpoint>;
+
+static ss::sstring segment_file_name(const segment& s) {
+    return std::filesystem::path(s.filename()).filename().string();
+}
+
 // Recover the last segment. Whenever we close a segment, we will likely
 // open a new one to which we will direct new writes. That new segment
 // might be empty. To optimize log replay, implement #140.
 static ss::future<segment_set> unsafe_do_recover(
   segment_set&& segments,
   std::optional<ss::sstring> last_clean_segment,
-  ss::abort_source& as) {
+  const segment_checkpoints& checkpoint,
+  ss::abort_source& as,
+  storage_resources& resources) {
     return ss::async([segments = std::move(segments),
                       last_clean_segment = std::move(last_clean_segment),
-                      &as]() mutable {
+                      &checkpoint,
+                      &as,
+                      &resources]() mutable {
         if (segments.empty() || as.abort_requested()) {
             return std::move(segments);
         }
         segment_set::underlying_t good = std::move(segments).release();
+
+        // use the segment materialize instead of going through the index
+        // directly to hydrate the max_offset state. indices are independent
+        // files, load them concurrently.
+        //
+        // a segment is trusted when its index is the one checkpointed at the
+        // last clean close. segments of the checkpoint were opened without
+        // accessing their file, the others need their actual size.
+        std::vector<bool> materialized(good.size(), false);
+        std::vector<bool> trusted(good.size(), false);
+        std::vector<std::exception_ptr> errors(good.size());
+        ss::max_concurrent_for_each(
+          boost::irange<size_t>(0, good.size()),
+          recovery_io_concurrency,
+          [&good, &materialized, &trusted, &errors, &checkpoint, &resources](
+            size_t i) {
+              return resources.get_recovery_io_units().then(
+                [&good, &materialized, &trusted, &errors, &checkpoint, i](
+                  ss::semaphore_units<> units) {
+                    auto& s = *good[i];
+                    return ss::futurize_invoke(
+                             [&s] { return s.materialize_index(); })
+                      .then_wrapped(
+                        [&materialized, &errors, i](ss::future<bool> f) {
+                            try {
+                                materialized[i] = f.get();
+                            } catch (...) {
+                                errors[i] = std::current_exception();
+                            }
+                        })
+                      .then([&s, &materialized, &trusted, &checkpoint, i] {
+                          auto it = checkpoint.find(segment_file_name(s));
+                          if (it == checkpoint.end()) {
+                              return ss::now();
+                          }
+                          trusted[i] = materialized[i]
+                                       && s.index().file_crc()
+                                            == it->second.index_crc
+                                       && s.offsets().dirty_offset
+                                            == it->second.dirty_offset;
+                          if (trusted[i]) {
+                              return ss::now();
+                          }
+                          return s.reader().load_size();
+                      })
+                      .finally([units = std::move(units)] {});
+                });
+          })
+          .get();
+
         absl::btree_set<segment*> to_recover_set;
         for (size_t i = 0; i < good.size(); ++i) {
             auto& s = *good[i];
@@ -198,32 +269,42 @@ static ss::future<segment_set> unsafe_do_recover(
                       prev.offsets().dirty_offset,
                       s.offsets().base_offset);
                     to_recover_set.insert(&prev);
+                    if (trusted[i - 1]) {
+                        trusted[i - 1] = false;
+                        prev.reader().load_size().get();
+                    }
                 }
             }
 
-            try {
-                // use the segment materialize instead of going through
-                // the index directly to hydrate the max_offset state
-                if (s.materialize_index().get()) {
-                    vassert(
-                      s.offsets().dirty_offset == s.index().max_offset(),
-                      "dirty_offset and index max_offset must be equal for "
-                      "segment {}",
-                      s);
-                } else {
-                    to_recover_set.insert(&s);
-                }
-            } catch (...) {
+            if (errors[i]) {
                 vlog(
                   stlog.info,
                   "Error materializing index:{}. Recovering parent "
                   "segment:{}. Details:{}",
                   s.index().filename(),
                   s.filename(),
-                  std::current_exception());
+                  errors[i]);
+                to_recover_set.insert(&s);
+            } else if (materialized[i]) {
+                vassert(
+                  s.offsets().dirty_offset == s.index().max_offset(),
+                  "dirty_offset and index max_offset must be equal for "
+                  "segment {}",
+                  s);
+            } else {
                 to_recover_set.insert(&s);
             }
         }
+        if (!checkpoint.empty()) {
+            vlog(
+              stlog.debug,
+              "Trusting {} of {} segments from the clean shutdown checkpoint",
+              std::count(trusted.begin(), trusted.end(), true),
+              good.size());
+        }
+        // the last segment is only replayed when it was written after the
+        // last clean close
+        const auto* last_trusted = trusted.back() ? good.back().get() : nullptr;
         segment_set::underlying_t to_recover;
         // keep segments sorted
         auto good_end = std::stable_partition(
@@ -267,8 +348,10 @@ static ss::future<segment_set> unsafe_do_recover(
         // remove empty from to recover set
         to_recover.erase(non_empty_end, to_recover.end());
         // we left with nothing to recover, take the last good segment if
-        // available
-        if (to_recover.empty() && !good.empty()) {
+        // available and not checkpointed
+        if (
+          to_recover.empty() && !good.empty()
+          && good.back().get() != last_trusted) {
             to_recover.push_back(std::move(good.back()));
             good.pop_back();
         }
@@ -320,7 +403,9 @@ static ss::future<segment_set> unsafe_do_recover(
 static ss::future<segment_set> do_recover(
   segment_set&& segments,
   std::optional<ss::sstring> last_clean_segment,
-  ss::abort_source& as) {
+  const segment_checkpoints& checkpoint,
+  ss::abort_source& as,
+  storage_resources& resources) {
     // light-weight copy used for clean-up if recovery fails
     segment_set::underlying_t copy;
     copy.reserve(segments.size());
@@ -332,7 +417,12 @@ static ss::future<segment_set> do_recover(
     // are any pending io operations on a file associated with the segment
     // at the time of destruction seastar will complain about the file handle
     // being destroyed with pending ops.
-    return unsafe_do_recover(std::move(segments), last_clean_segment, as)
+    return unsafe_do_recover(
+             std::move(segments),
+             std::move(last_clean_segment),
+             checkpoint,
+             as,
+             resources)
       .handle_exception(
         [copy = std::move(copy)](const std::exception_ptr& ex) mutable {
             return ss::do_with(
@@ -356,7 +446,8 @@ static ss::future<segment_set> do_recover(
  * \brief Open all segments in a directory.
  *
  * Returns an exceptional future if any error occured opening a
- * segment. Otherwise all open segment readers are returned.
+ * segment. Otherwise all open segment readers are returned. The files of the
+ * segments of the checkpoint are not accessed, they are opened on first read.
  */
 static ss::future<segment_set::underlying_t> open_segments(
   ss::sstring dir,
@@ -365,27 +456,23 @@ static ss::future<segment_set::underlying_t> open_segments(
   ss::abort_source& as,
   size_t buf_size,
   unsigned read_ahead,
+  const segment_checkpoints& checkpoint,
   storage_resources& resources) {
     using segs_type = segment_set::underlying_t;
+    using paths_type = std::vector<std::filesystem::path>;
     return ss::do_with(
       segs_type{},
+      paths_type{},
       [&as,
        cache_factory,
        sanitize_fileops,
        dir = std::move(dir),
        buf_size,
        read_ahead,
-       &resources](segs_type& segs) {
+       &checkpoint,
+       &resources](segs_type& segs, paths_type& paths) {
           auto f = directory_walker::walk(
-            dir,
-            [&as,
-             cache_factory,
-             dir,
-             sanitize_fileops,
-             &segs,
-             buf_size,
-             read_ahead,
-             &resources](ss::directory_entry seg) {
+            dir, [&as, dir, &paths](ss::directory_entry seg) {
                 // abort if requested
                 if (as.abort_requested()) {
                     return ss::now();
@@ -409,25 +496,77 @@ static ss::future<segment_set::underlying_t> open_segments(
                     // not a reader filename
                     return ss::make_ready_future<>();
                 }
-                return open_segment(
-                         path,
+                paths.push_back(std::move(path));
+                return ss::make_ready_future<>();
+            });
+          /*
+           * the directory listing is sequential, open the segments it found
+           * concurrently. if opening a segment fails then all the segment
+           * readers that were created are cleaned up by ss::do_with.
+           */
+          return f
+            .then([&as,
+                   cache_factory,
+                   sanitize_fileops,
+                   &segs,
+                   &paths,
+                   buf_size,
+                   read_ahead,
+                   &checkpoint,
+                   &resources] {
+                segs.reserve(paths.size());
+                return ss::max_concurrent_for_each(
+                  paths,
+                  recovery_io_concurrency,
+                  [&as,
+                   cache_factory,
+                   sanitize_fileops,
+                   &segs,
+                   buf_size,
+                   read_ahead,
+                   &checkpoint,
+                   &resources](const std::filesystem::path& path) {
+                      if (as.abort_requested()) {
+                          return ss::now();
+                      }
+                      auto push = [&segs](ss::lw_shared_ptr<segment> p) {
+                          segs.push_back(std::move(p));
+                      };
+                      auto it = checkpoint.find(path.filename().string());
+                      if (it != checkpoint.end()) {
+                          return open_segment(
+                                   path,
+                                   sanitize_fileops,
+                                   cache_factory(),
+                                   buf_size,
+                                   read_ahead,
+                                   resources,
+                                   it->second.size_bytes)
+                            .then(push);
+                      }
+                      return resources.get_recovery_io_units().then(
+                        [path,
+                         cache_factory,
                          sanitize_fileops,
-                         cache_factory(),
                          buf_size,
                          read_ahead,
-                         resources)
-                  .then([&segs](ss::lw_shared_ptr<segment> p) {
-                      segs.push_back(std::move(p));
+                         &resources,
+                         push](ss::semaphore_units<> units) {
+                            return open_segment(
+                                     path,
+                                     sanitize_fileops,
+                                     cache_factory(),
+                                     buf_size,
+                                     read_ahead,
+                                     resources)
+                              .then(push)
+                              .finally([units = std::move(units)] {});
+                        });
                   });
+            })
+            .then([&segs]() mutable {
+                return ss::make_ready_future<segs_type>(std::move(segs));
             });
-          /*
-           * if the directory walker returns an exceptional future then all
-           * the segment readers that were created are cleaned up by
-           * ss::do_with.
-           */
-          return f.then([&segs]() mutable {
-              return ss::make_ready_future<segs_type>(std::move(segs));
-          });
       });
 }
 
@@ -440,37 +579,64 @@ ss::future<segment_set> recover_segments(
   size_t read_buf_size,
   unsigned read_readahead_count,
   std::optional<ss::sstring> last_clean_segment,
+  std::vector<segment_checkpoint> checkpoint,
   storage_resources& resources) {
-    return ss::recursive_touch_directory(path.string())
-      .then([&as,
-             cache_factory,
-             sanitize_fileops,
-             path = std::move(path),
-             read_buf_size,
-             read_readahead_count,
-             &resources] {
-          return open_segments(
-            path.string(),
-            sanitize_fileops,
-            cache_factory,
-            as,
-            read_buf_size,
-            read_readahead_count,
-            resources);
-      })
-      .then([&as,
-             is_compaction_enabled,
-             last_clean_segment = std::move(last_clean_segment)](
-              segment_set::underlying_t segs) {
-          auto segments = segment_set(std::move(segs));
-          // we have to mark compacted segments before recovery to allow reading
-          // gaps introduced by compaction
-          if (is_compaction_enabled) {
-              for (auto& s : segments) {
-                  s->mark_as_compacted_segment();
-              }
-          }
-          return do_recover(std::move(segments), last_clean_segment, as);
+    segment_checkpoints checkpoints;
+    checkpoints.reserve(checkpoint.size());
+    for (auto& c : checkpoint) {
+        auto name = c.name;
+        checkpoints.emplace(std::move(name), std::move(c));
+    }
+    return ss::do_with(
+      std::move(checkpoints),
+      [&as,
+       is_compaction_enabled,
+       cache_factory,
+       sanitize_fileops,
+       path = std::move(path),
+       read_buf_size,
+       read_readahead_count,
+       last_clean_segment = std::move(last_clean_segment),
+       &resources](const segment_checkpoints& checkpoint) mutable {
+          return ss::recursive_touch_directory(path.string())
+            .then([&as,
+                   cache_factory,
+                   sanitize_fileops,
+                   path = std::move(path),
+                   read_buf_size,
+                   read_readahead_count,
+                   &checkpoint,
+                   &resources] {
+                return open_segments(
+                  path.string(),
+                  sanitize_fileops,
+                  cache_factory,
+                  as,
+                  read_buf_size,
+                  read_readahead_count,
+                  checkpoint,
+                  resources);
+            })
+            .then([&as,
+                   is_compaction_enabled,
+                   last_clean_segment = std::move(last_clean_segment),
+                   &checkpoint,
+                   &resources](segment_set::underlying_t segs) {
+                auto segments = segment_set(std::move(segs));
+                // we have to mark compacted segments before recovery to allow
+                // reading gaps introduced by compaction
+                if (is_compaction_enabled) {
+                    for (auto& s : segments) {
+                        s->mark_as_compacted_segment();
+                    }
+                }
+                return do_recover(
+                  std::move(segments),
+                  last_clean_segment,
+                  checkpoint,
+                  as,
+                  resources);
+            });
       });
 }
 
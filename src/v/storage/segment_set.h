@@ -16,6 +16,7 @@
 #include <seastar/core/circular_buffer.hh>
 
 #include <deque>
+#include <vector>
 
 namespace storage {
 /*
@@ -89,6 +90,17 @@ private:
     friend std::ostream& operator<<(std::ostream&, const segment_set&);
 };
 
+/**
+ * \brief Open and recover the segments of a log.
+ *
+ * Segments are replayed when their index cannot be trusted. After a clean
+ * shutdown `checkpoint` lists the segments as they were when the log was
+ * closed: the segments whose index still matches it are trusted, they are
+ * neither replayed nor opened until first read. Without a checkpoint, e.g.
+ * after an unclean shutdown, every index is validated against its
+ * neighbours and the last segment is replayed unless it is
+ * `last_clean_segment`.
+ */
 ss::future<segment_set> recover_segments(
   std::filesystem::path path,
   debug_sanitize_files sanitize_fileops,
@@ -98,6 +110,7 @@ ss::future<segment_set> recover_segments(
   size_t read_buf_size,
   unsigned read_readahead_count,
   std::optional<ss::sstring> last_clean_segment,
+  std::vector<segment_checkpoint> checkpoint,
   storage_resources&);
 
 } // namespace storage
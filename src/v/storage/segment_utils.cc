@@ -428,7 +428,8 @@ ss::future<> do_swap_data_file_handles(
       s->reader().filename(),
       config::shard_local_cfg().storage_read_buffer_size(),
       config::shard_local_cfg().storage_read_readahead_count(),
-      cfg.sanitize);
+      cfg.sanitize,
+      s->reader().file_handles());
     co_await r.load_size();
 
     // update partition size probe
@@ -189,9 +189,11 @@ bytes clean_segment_key(model::ntp ntp);
 struct clean_segment_value
   : serde::envelope<
       clean_segment_value,
-      serde::version<0>,
+      serde::version<1>,
       serde::compat_version<0>> {
     ss::sstring segment_name;
+    // since version 1: every segment of the log at the time of the clean close
+    std::vector<segment_checkpoint> segments;
 };
 
 inline bool is_compactible(const model::record_batch& b) {
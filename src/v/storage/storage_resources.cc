@@ -24,14 +24,21 @@ storage_resources::storage_resources(
   : _segment_fallocation_step(falloc_step)
   , _target_replay_bytes(target_replay_bytes)
   , _max_concurrent_replay(max_concurrent_replay)
+  , _max_concurrent_recovery_io(
+      config::shard_local_cfg().storage_max_concurrent_recovery_io.bind())
   , _append_chunk_size(config::shard_local_cfg().append_chunk_size())
   , _offset_translator_dirty_bytes(_target_replay_bytes() / ss::smp::count)
   , _configuration_manager_dirty_bytes(_target_replay_bytes() / ss::smp::count)
   , _stm_dirty_bytes(_target_replay_bytes() / ss::smp::count)
   , _inflight_recovery(
       std::max(_max_concurrent_replay() / ss::smp::count, uint64_t{1}))
+  , _inflight_recovery_io(
+      std::max(_max_concurrent_recovery_io() / ss::smp::count, uint64_t{1}))
   , _inflight_close_flush(
-      std::max(_max_concurrent_replay() / ss::smp::count, uint64_t{1})) {
+      std::max(_max_concurrent_replay() / ss::smp::count, uint64_t{1}))
+  , _file_handles(
+      config::shard_local_cfg().storage_read_max_lingering_handles.bind(),
+      config::shard_local_cfg().storage_read_handle_linger_ms.bind()) {
     // Register notifications on configuration changes
     _target_replay_bytes.watch([this]() {
         auto v = _target_replay_bytes() / ss::smp::count;
@@ -51,6 +58,11 @@ storage_resources::storage_resources(
         _inflight_recovery.set_capacity(v);
         _inflight_close_flush.set_capacity(v);
     });
+
+    _max_concurrent_recovery_io.watch([this]() {
+        _inflight_recovery_io.set_capacity(std::max(
+          _max_concurrent_recovery_io() / ss::smp::count, uint64_t{1}));
+    });
 }
 
 // Unit test convenience for tests that want to control the falloc step
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "config/property.h"
+#include "storage/file_handle_cache.h"
 #include "units.h"
 
 #include <seastar/core/semaphore.hh>
@@ -145,10 +146,18 @@ public:
         return _inflight_recovery.get_units(1);
     }
 
+    /// A segment or index file operation of the recovery of a log
+    ss::future<ss::semaphore_units<>> get_recovery_io_units() {
+        return _inflight_recovery_io.get_units(1);
+    }
+
     ss::future<ss::semaphore_units<>> get_close_flush_units() {
         return _inflight_close_flush.get_units(1);
     }
 
+    /// Segment files kept open by their readers once released
+    file_handle_cache& file_handles() { return _file_handles; }
+
 private:
     uint64_t _space_allowance{9};
     uint64_t _space_allowance_free{0};
@@ -157,6 +166,7 @@ private:
     config::binding<size_t> _segment_fallocation_step;
     config::binding<uint64_t> _target_replay_bytes;
     config::binding<uint64_t> _max_concurrent_replay;
+    config::binding<uint64_t> _max_concurrent_recovery_io;
     size_t _append_chunk_size;
 
     size_t _falloc_step{0};
@@ -183,9 +193,17 @@ private:
     // concurrently?
     adjustable_allowance _inflight_recovery{0};
 
+    // How many segment and index files may be opened or read concurrently
+    // by the logs being recovered?
+    adjustable_allowance _inflight_recovery_io{0};
+
     // How many logs may be flushed during segment close concurrently?
     // (e.g. when we shut down and ask everyone to flush)
     adjustable_allowance _inflight_close_flush{0};
+
+    // How many segment files may stay open on this shard once their readers
+    // are done with them, and for how long?
+    file_handle_cache _file_handles;
 };
 
 } // namespace storage
\ No newline at end of file
@@ -0,0 +1,162 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "storage/file_handle_cache.h"
+
+#include "config/property.h"
+#include "random/generators.h"
+#include "ssx/sformat.h"
+#include "storage/segment_reader.h"
+#include "units.h"
+
+#include <seastar/core/seastar.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/testing/thread_test_case.hh>
+#include <seastar/util/file.hh>
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+struct segment_files {
+    explicit segment_files(size_t count)
+      : dir(
+        "file_handle_cache_test."
+        + random_generators::gen_alphanum_string(10)) {
+        ss::recursive_touch_directory(dir).get();
+        for (size_t i = 0; i < count; ++i) {
+            auto name = ssx::sformat("{}/{}.log", dir, i);
+            auto f = ss::open_file_dma(
+                       name, ss::open_flags::create | ss::open_flags::rw)
+                       .get();
+            f.truncate(4_KiB).get();
+            f.close().get();
+            names.push_back(std::move(name));
+        }
+    }
+    segment_files(const segment_files&) = delete;
+    segment_files& operator=(const segment_files&) = delete;
+    segment_files(segment_files&&) = delete;
+    segment_files& operator=(segment_files&&) = delete;
+    ~segment_files() {
+        ss::recursive_remove_directory(std::filesystem::path(dir)).get();
+    }
+
+    ss::sstring dir;
+    std::vector<ss::sstring> names;
+};
+
+std::unique_ptr<storage::segment_reader>
+make_reader(const ss::sstring& name, storage::file_handle_cache& cache) {
+    auto r = std::make_unique<storage::segment_reader>(
+      name, 4_KiB, 1, storage::debug_sanitize_files::no, &cache);
+    // opens the file and releases it
+    r->load_size().get();
+    return r;
+}
+
+void read(storage::segment_reader& r) {
+    auto h = r.data_stream(0, ss::default_priority_class()).get0();
+    h.stream().read().get();
+    h.close().get();
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_file_handle_cache_reuses_released_files) {
+    segment_files files(1);
+    storage::file_handle_cache cache(
+      config::mock_binding<size_t>(10),
+      config::mock_binding<std::chrono::milliseconds>(1h));
+
+    auto r = make_reader(files.names[0], cache);
+    BOOST_REQUIRE_EQUAL(cache.opens(), 1);
+    BOOST_REQUIRE_EQUAL(cache.open_files(), 1);
+    BOOST_REQUIRE_EQUAL(cache.lingering(), 1);
+
+    for (int i = 0; i < 3; ++i) {
+        read(*r);
+    }
+    BOOST_REQUIRE_EQUAL(cache.opens(), 1);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 3);
+    BOOST_REQUIRE_EQUAL(cache.lingering(), 1);
+
+    // closing the segment closes the lingering file, the next read reopens it
+    r->close().get();
+    BOOST_REQUIRE_EQUAL(cache.open_files(), 0);
+    BOOST_REQUIRE_EQUAL(cache.lingering(), 0);
+    read(*r);
+    BOOST_REQUIRE_EQUAL(cache.opens(), 2);
+    r->close().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_file_handle_cache_budget) {
+    segment_files files(3);
+    storage::file_handle_cache cache(
+      config::mock_binding<size_t>(2),
+      config::mock_binding<std::chrono::milliseconds>(1h));
+
+    std::vector<std::unique_ptr<storage::segment_reader>> readers;
+    for (const auto& name : files.names) {
+        readers.push_back(make_reader(name, cache));
+    }
+    // the least recently released file was closed
+    BOOST_REQUIRE_EQUAL(cache.opens(), 3);
+    BOOST_REQUIRE_EQUAL(cache.lingering(), 2);
+    BOOST_REQUIRE_EQUAL(cache.open_files(), 2);
+
+    read(*readers[2]);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 1);
+    read(*readers[0]);
+    BOOST_REQUIRE_EQUAL(cache.opens(), 4);
+    BOOST_REQUIRE_EQUAL(cache.lingering(), 2);
+
+    for (auto& r : readers) {
+        r->close().get();
+    }
+    BOOST_REQUIRE_EQUAL(cache.open_files(), 0);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_file_handle_cache_linger) {
+    segment_files files(1);
+    storage::file_handle_cache cache(
+      config::mock_binding<size_t>(10),
+      config::mock_binding<std::chrono::milliseconds>(50ms));
+
+    auto r = make_reader(files.names[0], cache);
+    BOOST_REQUIRE_EQUAL(cache.lingering(), 1);
+    ss::sleep(500ms).get();
+    BOOST_REQUIRE_EQUAL(cache.lingering(), 0);
+    BOOST_REQUIRE_EQUAL(cache.open_files(), 0);
+
+    read(*r);
+    BOOST_REQUIRE_EQUAL(cache.opens(), 2);
+    BOOST_REQUIRE_EQUAL(cache.hits(), 0);
+    r->close().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_file_handle_cache_disabled) {
+    segment_files files(1);
+    storage::file_handle_cache cache(
+      config::mock_binding<size_t>(10),
+      config::mock_binding<std::chrono::milliseconds>(0ms));
+
+    auto r = make_reader(files.names[0], cache);
+    BOOST_REQUIRE_EQUAL(cache.lingering(), 0);
+    BOOST_REQUIRE_EQUAL(cache.open_files(), 0);
+    read(*r);
+    BOOST_REQUIRE_EQUAL(cache.opens(), 2);
+    r->close().get();
+}
@@ -159,3 +159,30 @@ BOOST_AUTO_TEST_CASE(serde_deprecated_crc) {
           return is_crc || is_out_of_bounds;
       });
 }
+
+// time index started by a version older than sorted_time_index_version
+BOOST_AUTO_TEST_CASE(unsorted_time_index_flag) {
+    storage::index_state st;
+    st.bitflags = storage::index_state::unsorted_time_index_flag;
+    st.add_entry(0, 40, 0);
+    st.add_entry(1, 10, 100);
+    BOOST_REQUIRE(!st.time_index_sorted());
+
+    // persisted along with the entries
+    auto output = serde::from_iobuf<storage::index_state>(
+      serde::to_iobuf(st.copy()));
+    BOOST_REQUIRE(!output.time_index_sorted());
+
+    // an index restarted from empty is sorted again
+    st.pop_back();
+    st.pop_back();
+    st.maybe_index(
+      0,
+      1,
+      0,
+      model::offset(0),
+      model::offset(0),
+      model::timestamp(10),
+      model::timestamp(10));
+    BOOST_REQUIRE(st.time_index_sorted());
+}
@@ -0,0 +1,137 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "config/configuration.h"
+#include "random/generators.h"
+#include "ssx/sformat.h"
+#include "storage/kvstore.h"
+#include "units.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/seastar.hh>
+#include <seastar/testing/perf_tests.hh>
+#include <seastar/util/file.hh>
+
+#include <absl/container/flat_hash_set.h>
+#include <fmt/core.h>
+
+#include <vector>
+
+namespace {
+
+constexpr size_t value_size = 64;
+// each round updates 1% of the keys, like per partition raft state would
+constexpr int update_rounds = 50;
+
+ss::sstring key_name(size_t i) { return ssx::sformat("key-{:010}", i); }
+
+/**
+ * Writes `key_count` keys and then updates a fraction of them in rounds,
+ * rolling the log many times. Returns the configuration to open the store.
+ */
+ss::future<storage::kvstore_config>
+prepare(size_t key_count, storage::kvstore_incremental_snapshots incremental) {
+    config::shard_local_cfg().get("disable_metrics").set_value(true);
+
+    auto dir = ssx::sformat(
+      "kvstore_bench_{}_{}", key_count, incremental ? "delta" : "full");
+    if (co_await ss::file_exists(dir)) {
+        co_await ss::recursive_remove_directory(std::filesystem::path(dir));
+    }
+    storage::kvstore_config conf(
+      256_KiB,
+      config::mock_binding(std::chrono::milliseconds(1)),
+      dir,
+      storage::debug_sanitize_files::no,
+      incremental);
+
+    storage::storage_resources resources;
+    storage::kvstore kvs(conf, resources);
+    co_await kvs.start();
+
+    auto put = [&kvs](size_t i) {
+        auto key = key_name(i);
+        return kvs.put(
+          storage::kvstore::key_space::testing,
+          bytes(reinterpret_cast<const uint8_t*>(key.data()), key.size()),
+          bytes_to_iobuf(random_generators::get_bytes(value_size)));
+    };
+
+    std::vector<ss::future<>> inflight;
+    auto drain = [&inflight]() -> ss::future<> {
+        co_await ss::when_all_succeed(inflight.begin(), inflight.end());
+        inflight.clear();
+    };
+    for (size_t i = 0; i < key_count; i++) {
+        inflight.push_back(put(i));
+        if (inflight.size() == 1000) {
+            co_await drain();
+        }
+    }
+    co_await drain();
+    for (int round = 0; round < update_rounds; round++) {
+        for (size_t i = 0; i < key_count / 100; i++) {
+            inflight.push_back(put(random_generators::get_int(key_count - 1)));
+        }
+        co_await drain();
+    }
+
+    static absl::flat_hash_set<ss::sstring> reported;
+    if (reported.insert(dir).second) {
+        fmt::print(
+          "{}: log bytes {}, snapshot bytes {}, write amplification {:.2f}\n",
+          dir,
+          kvs.log_bytes_written(),
+          kvs.snapshot_bytes_written(),
+          double(kvs.log_bytes_written() + kvs.snapshot_bytes_written())
+            / double(kvs.log_bytes_written()));
+    }
+
+    co_await kvs.stop();
+    co_return conf;
+}
+
+/// Measures the recovery of a store holding `key_count` keys.
+ss::future<>
+replay(size_t key_count, storage::kvstore_incremental_snapshots incremental) {
+    auto conf = co_await prepare(key_count, incremental);
+
+    storage::storage_resources resources;
+    storage::kvstore kvs(conf, resources);
+    perf_tests::start_measuring_time();
+    co_await kvs.start();
+    perf_tests::stop_measuring_time();
+    co_await kvs.stop();
+}
+
+} // namespace
+
+PERF_TEST(kvstore_replay, full_snapshots_1k) {
+    return replay(1'000, storage::kvstore_incremental_snapshots::no);
+}
+
+PERF_TEST(kvstore_replay, delta_snapshots_1k) {
+    return replay(1'000, storage::kvstore_incremental_snapshots::yes);
+}
+
+PERF_TEST(kvstore_replay, full_snapshots_10k) {
+    return replay(10'000, storage::kvstore_incremental_snapshots::no);
+}
+
+PERF_TEST(kvstore_replay, delta_snapshots_10k) {
+    return replay(10'000, storage::kvstore_incremental_snapshots::yes);
+}
+
+PERF_TEST(kvstore_replay, full_snapshots_100k) {
+    return replay(100'000, storage::kvstore_incremental_snapshots::no);
+}
+
+PERF_TEST(kvstore_replay, delta_snapshots_100k) {
+    return replay(100'000, storage::kvstore_incremental_snapshots::yes);
+}
@@ -110,6 +110,62 @@ SEASTAR_THREAD_TEST_CASE(key_space) {
     cleanup_store(dir).get();
 }
 
+SEASTAR_THREAD_TEST_CASE(write_batch) {
+    set_configuration("disable_metrics", true);
+
+    auto dir = ssx::sformat(
+      "kvstore_test_{}", random_generators::get_int(4000));
+
+    auto conf = prepare_store(dir).get();
+
+    storage::storage_resources resources;
+    auto kvs = std::make_unique<storage::kvstore>(conf, resources);
+    kvs->start().get();
+
+    const auto value_a = bytes_to_iobuf(random_generators::get_bytes(100));
+    const auto value_b = bytes_to_iobuf(random_generators::get_bytes(100));
+    const auto key_a = random_generators::get_bytes(2);
+    const auto key_b = random_generators::get_bytes(3);
+    const auto removed = random_generators::get_bytes(4);
+
+    kvs->put(storage::kvstore::key_space::testing, removed, value_a.copy())
+      .get();
+
+    std::vector<storage::kvstore::write_op> ops;
+    ops.emplace_back(key_a, value_a.copy());
+    ops.emplace_back(key_b, value_b.copy());
+    ops.emplace_back(removed, std::nullopt);
+    kvs->write_batch(storage::kvstore::key_space::testing, std::move(ops))
+      .get();
+
+    auto verify = [&] {
+        BOOST_REQUIRE(
+          kvs->get(storage::kvstore::key_space::testing, key_a).value()
+          == value_a);
+        BOOST_REQUIRE(
+          kvs->get(storage::kvstore::key_space::testing, key_b).value()
+          == value_b);
+        BOOST_REQUIRE(
+          !kvs->get(storage::kvstore::key_space::testing, removed));
+        // keys are written to the requested key space only
+        BOOST_REQUIRE(
+          !kvs->get(storage::kvstore::key_space::consensus, key_a));
+    };
+    verify();
+
+    // nothing to write
+    kvs->write_batch(storage::kvstore::key_space::testing, {}).get();
+    kvs->stop().get();
+
+    // still all true after recovery
+    kvs = std::make_unique<storage::kvstore>(conf, resources);
+    kvs->start().get();
+    verify();
+    kvs->stop().get();
+
+    cleanup_store(dir).get();
+}
+
 SEASTAR_THREAD_TEST_CASE(kvstore_empty) {
     set_configuration("disable_metrics", true);
 
@@ -233,3 +289,72 @@ SEASTAR_THREAD_TEST_CASE(kvstore) {
 
     cleanup_store(dir).get();
 }
+
+SEASTAR_THREAD_TEST_CASE(kvstore_incremental_snapshots) {
+    set_configuration("disable_metrics", true);
+
+    auto dir = ssx::sformat(
+      "kvstore_test_{}", random_generators::get_int(4000));
+
+    auto conf = prepare_store(dir).get();
+    conf.incremental_snapshots = storage::kvstore_incremental_snapshots::yes;
+
+    std::unordered_map<bytes, iobuf> truth;
+    std::vector<bytes> removed;
+
+    storage::storage_resources resources;
+    auto kvs = std::make_unique<storage::kvstore>(conf, resources);
+    auto verify = [&kvs, &truth, &removed] {
+        for (auto& e : truth) {
+            BOOST_REQUIRE(
+              kvs->get(storage::kvstore::key_space::testing, e.first).value()
+              == e.second);
+        }
+        for (auto& key : removed) {
+            if (!truth.contains(key)) {
+                BOOST_REQUIRE(
+                  !kvs->get(storage::kvstore::key_space::testing, key));
+            }
+        }
+    };
+
+    kvs->start().get();
+    for (int round = 0; round < 3; round++) {
+        // enough data to roll the 8KiB segments many times, so that delta
+        // snapshots are written and merged
+        for (int i = 0; i < 500; i++) {
+            auto key = random_generators::get_bytes(2);
+            auto value = bytes_to_iobuf(random_generators::get_bytes(100));
+            truth[key] = value.copy();
+            kvs->put(
+                 storage::kvstore::key_space::testing, key, std::move(value))
+              .get();
+
+            if (random_generators::get_int(1000) < 300) {
+                auto it = truth.begin();
+                removed.push_back(it->first);
+                kvs->remove(storage::kvstore::key_space::testing, it->first)
+                  .get();
+                truth.erase(it);
+            }
+        }
+        verify();
+        BOOST_REQUIRE_GT(kvs->snapshot_bytes_written(), 0);
+
+        // shutdown, restart, and verify all the key-value pairs
+        kvs->stop().get();
+        kvs = std::make_unique<storage::kvstore>(conf, resources);
+        kvs->start().get();
+        verify();
+    }
+    kvs->stop().get();
+
+    // delta snapshots are still loaded when the mode is disabled
+    conf.incremental_snapshots = storage::kvstore_incremental_snapshots::no;
+    kvs = std::make_unique<storage::kvstore>(conf, resources);
+    kvs->start().get();
+    verify();
+    kvs->stop().get();
+
+    cleanup_store(dir).get();
+}
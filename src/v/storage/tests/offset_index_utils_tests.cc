@@ -131,3 +131,57 @@ FIXTURE_TEST(bucket_truncate, offset_index_utils_fixture) {
         BOOST_REQUIRE_EQUAL(p->filepos, 458048);
     }
 }
+
+FIXTURE_TEST(time_index_non_monotonic, offset_index_utils_fixture) {
+    // every batch is indexed, timestamps go back and forth
+    const std::vector<int64_t> timestamps{1000, 5000, 2000, 3000, 7000, 4000};
+    for (size_t i = 0; i < timestamps.size(); ++i) {
+        auto hdr = modify_get(
+          model::offset(i), storage::segment_index::default_data_buffer_step);
+        hdr.first_timestamp = model::timestamp(timestamps[i]);
+        hdr.max_timestamp = model::timestamp(timestamps[i]);
+        _idx->maybe_track(hdr, i * 100);
+    }
+    auto scan_start = [this](int64_t t) {
+        auto e = _idx->find_nearest(model::timestamp(t));
+        BOOST_REQUIRE(e);
+        return e->offset;
+    };
+    BOOST_REQUIRE_EQUAL(scan_start(500), model::offset(0));
+    BOOST_REQUIRE_EQUAL(scan_start(1000), model::offset(0));
+    // first batch with a record >= 4000 is at offset 1
+    BOOST_REQUIRE_EQUAL(scan_start(4000), model::offset(0));
+    // first batch with a record >= 6000 is at offset 4
+    BOOST_REQUIRE_EQUAL(scan_start(6000), model::offset(3));
+    BOOST_REQUIRE_EQUAL(scan_start(7000), model::offset(3));
+    BOOST_REQUIRE(!_idx->find_nearest(model::timestamp(7001)));
+}
+
+FIXTURE_TEST(time_index_legacy_version, offset_index_utils_fixture) {
+    for (size_t i = 0; i < 4; ++i) {
+        auto hdr = modify_get(
+          model::offset(i), storage::segment_index::default_data_buffer_step);
+        hdr.first_timestamp = model::timestamp((i + 1) * 1000);
+        hdr.max_timestamp = hdr.first_timestamp;
+        _idx->maybe_track(hdr, i * 100);
+    }
+    _idx->flush().get();
+    // flushed by a version whose time index held batch timestamps
+    const int8_t legacy = storage::index_state::sorted_time_index_version - 1;
+    _data.data.begin()->second.get_write()[0] = legacy;
+
+    auto idx = std::unique_ptr<segment_index>(new segment_index(
+      "In memory iobuf",
+      ss::file(ss::make_shared(tmpbuf_file(_data))),
+      _base_offset,
+      storage::segment_index::default_data_buffer_step));
+    BOOST_REQUIRE(idx->materialize_index().get());
+    // the time index is not searched, scans start at the segment base
+    auto e = idx->find_nearest(model::timestamp(3500));
+    BOOST_REQUIRE(e);
+    BOOST_REQUIRE_EQUAL(e->offset, model::offset(0));
+    BOOST_REQUIRE(!idx->find_nearest(model::timestamp(4001)));
+    // and loading it does not rewrite it
+    idx->flush().get();
+    BOOST_REQUIRE_EQUAL(_data.data.begin()->second[0], legacy);
+}
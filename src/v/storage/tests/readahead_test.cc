@@ -0,0 +1,119 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#define BOOST_TEST_MODULE storage
+#include "storage/readahead.h"
+#include "units.h"
+
+#include <boost/test/unit_test.hpp>
+
+using storage::readahead_policy;
+using storage::readahead_tracker;
+
+namespace {
+const readahead_policy base{.buffer_size = 128_KiB, .read_ahead = 10};
+} // namespace
+
+BOOST_AUTO_TEST_CASE(readahead_grows_with_sequential_bytes) {
+    readahead_tracker tracker(1_MiB, 4_MiB);
+    BOOST_REQUIRE_EQUAL(tracker.policy(base), base);
+
+    // short reads keep the configured sizing
+    tracker.add_sequential_bytes(4_MiB - 1);
+    BOOST_REQUIRE_EQUAL(tracker.policy(base), base);
+
+    tracker.add_sequential_bytes(1);
+    BOOST_REQUIRE_EQUAL(
+      tracker.policy(base),
+      (readahead_policy{.buffer_size = 256_KiB, .read_ahead = 16}));
+
+    tracker.add_sequential_bytes(4_MiB);
+    BOOST_REQUIRE_EQUAL(
+      tracker.policy(base),
+      (readahead_policy{.buffer_size = 512_KiB, .read_ahead = 8}));
+
+    // capped at the maximum buffer size
+    tracker.add_sequential_bytes(1_GiB);
+    BOOST_REQUIRE_EQUAL(
+      tracker.policy(base),
+      (readahead_policy{.buffer_size = 1_MiB, .read_ahead = 4}));
+
+    // reaching the tail shrinks reads back
+    tracker.reset();
+    BOOST_REQUIRE_EQUAL(tracker.policy(base), base);
+}
+
+BOOST_AUTO_TEST_CASE(readahead_bytes_bounded_by_budget) {
+    readahead_tracker tracker(8_MiB, 4_MiB);
+    tracker.add_sequential_bytes(1_GiB);
+    auto p = tracker.policy(base);
+    BOOST_REQUIRE_EQUAL(p.buffer_size, 8_MiB);
+    // reads larger than the budget still read a single buffer ahead
+    BOOST_REQUIRE_EQUAL(p.read_ahead, 1);
+
+    tracker.reset();
+    tracker.add_sequential_bytes(8_MiB);
+    p = tracker.policy(base);
+    BOOST_REQUIRE_EQUAL(p.buffer_size, 512_KiB);
+    BOOST_REQUIRE_EQUAL(p.buffer_size * p.read_ahead, 4_MiB);
+
+    // read ahead disabled by the configuration stays disabled
+    const readahead_policy no_read_ahead{.buffer_size = 128_KiB};
+    BOOST_REQUIRE_EQUAL(tracker.policy(no_read_ahead).read_ahead, 0);
+}
+
+BOOST_AUTO_TEST_CASE(readahead_window_ends_at_next_growth) {
+    readahead_tracker tracker(512_KiB, 4_MiB);
+    auto w = tracker.window(base);
+    BOOST_REQUIRE_EQUAL(w.readahead, base);
+    BOOST_REQUIRE_EQUAL(w.max_bytes, 4_MiB);
+
+    tracker.add_sequential_bytes(5_MiB);
+    w = tracker.window(base);
+    BOOST_REQUIRE_EQUAL(w.readahead.buffer_size, 256_KiB);
+    BOOST_REQUIRE_EQUAL(w.max_bytes, 3_MiB);
+
+    // no more growth, the window spans the rest of the stream
+    tracker.add_sequential_bytes(3_MiB);
+    w = tracker.window(base);
+    BOOST_REQUIRE_EQUAL(w.readahead.buffer_size, 512_KiB);
+    BOOST_REQUIRE_EQUAL(w.max_bytes, 0);
+}
+
+BOOST_AUTO_TEST_CASE(readahead_disabled_by_max_buffer_size) {
+    readahead_tracker tracker(128_KiB, 4_MiB);
+    tracker.add_sequential_bytes(1_GiB);
+    BOOST_REQUIRE_EQUAL(tracker.policy(base), base);
+}
+
+BOOST_AUTO_TEST_CASE(read_io_histogram_buckets) {
+    storage::read_io_histogram h;
+    h.record(1_KiB, 1);
+    h.record(4_KiB, 1);
+    h.record(4_KiB + 1, 1);
+    h.record(128_KiB, 2);
+    h.record(1_GiB, 1);
+    BOOST_REQUIRE_EQUAL(h.count(0), 2);
+    BOOST_REQUIRE_EQUAL(h.count(1), 1);
+    BOOST_REQUIRE_EQUAL(h.count(5), 2);
+    BOOST_REQUIRE_EQUAL(h.count(storage::read_io_histogram::buckets - 1), 1);
+    BOOST_REQUIRE_EQUAL(h.total_count(), 6);
+
+    // a stream issues one read per buffer it filled
+    storage::read_io_histogram streams;
+    streams.record_stream(base, 128_KiB * 3 + 1);
+    streams.record_stream(base, 0);
+    BOOST_REQUIRE_EQUAL(streams.count(5), 4);
+    BOOST_REQUIRE_EQUAL(streams.total_bytes(), 4 * 128_KiB);
+
+    auto metrics = streams.to_metrics_histogram();
+    BOOST_REQUIRE_EQUAL(metrics.sample_count, 4);
+    BOOST_REQUIRE_EQUAL(metrics.buckets[4].count, 0);
+    BOOST_REQUIRE_EQUAL(metrics.buckets.back().count, 4);
+}
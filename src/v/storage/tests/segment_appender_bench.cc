@@ -0,0 +1,142 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "random/generators.h"
+#include "ssx/sformat.h"
+#include "storage/segment_appender.h"
+#include "storage/storage_resources.h"
+#include "units.h"
+#include "utils/hdr_hist.h"
+
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/loop.hh>
+#include <seastar/core/reactor.hh>
+#include <seastar/core/seastar.hh>
+#include <seastar/testing/perf_tests.hh>
+#include <seastar/util/file.hh>
+
+#include <fmt/core.h>
+
+#include <memory>
+#include <vector>
+
+/*
+ * Append latency and throughput of segment appenders at 1k partitions per
+ * core, the load the appender and its chunk cache have to sustain on a busy
+ * broker.
+ *
+ * Segment I/O is issued through seastar's file interface, so the I/O backend
+ * is the reactor backend. Run the benchmark once per backend for a head to
+ * head comparison, e.g.
+ *
+ *   segment_appender_rpbench -c 1 --reactor-backend=linux-aio
+ *   segment_appender_rpbench -c 1 --reactor-backend=io_uring
+ *
+ * Each measured operation is one round in which every partition appends a
+ * batch; in the flush variants every partition then flushes it, like an
+ * acks=all produce. Per partition latency percentiles and the throughput are
+ * printed when a test finishes.
+ */
+
+namespace {
+
+constexpr size_t partitions = 1000;
+
+struct appender_fixture {
+    appender_fixture() {
+        dir = ssx::sformat("segment_appender_bench_{}", ss::this_shard_id());
+        if (ss::file_exists(dir).get()) {
+            ss::recursive_remove_directory(std::filesystem::path(dir)).get();
+        }
+        ss::recursive_touch_directory(dir).get();
+        appenders.reserve(partitions);
+        for (size_t i = 0; i < partitions; ++i) {
+            auto f = ss::open_file_dma(
+                       ssx::sformat("{}/{}.log", dir, i),
+                       ss::open_flags::create | ss::open_flags::rw
+                         | ss::open_flags::truncate)
+                       .get();
+            appenders.push_back(std::make_unique<storage::segment_appender>(
+              std::move(f),
+              storage::segment_appender::options(
+                ss::default_priority_class(), 1, std::nullopt, resources)));
+        }
+    }
+
+    appender_fixture(const appender_fixture&) = delete;
+    appender_fixture& operator=(const appender_fixture&) = delete;
+    appender_fixture(appender_fixture&&) = delete;
+    appender_fixture& operator=(appender_fixture&&) = delete;
+
+    ~appender_fixture() {
+        if (rounds > 0) {
+            const auto elapsed = std::chrono::duration<double>(
+              std::chrono::steady_clock::now() - started);
+            fmt::print(
+              "{} partitions: {} rounds, p50 {}us, p99 {}us, p999 {}us, "
+              "{:.1f} MiB/s\n",
+              partitions,
+              rounds,
+              latency.get_value_at(50.0),
+              latency.get_value_at(99.0),
+              latency.get_value_at(99.9),
+              double(bytes) / elapsed.count() / double(1_MiB));
+        }
+        ss::parallel_for_each(appenders, [](auto& a) {
+            return a->close();
+        }).get();
+        ss::recursive_remove_directory(std::filesystem::path(dir)).get();
+    }
+
+    /// Every partition appends `batch_size` bytes, and flushes if asked to.
+    ss::future<> round(size_t batch_size, bool flush) {
+        if (rounds++ == 0) {
+            started = std::chrono::steady_clock::now();
+        }
+        if (data.size() != batch_size) {
+            data = random_generators::gen_alphanum_string(batch_size);
+        }
+        bytes += batch_size * partitions;
+        perf_tests::start_measuring_time();
+        co_await ss::parallel_for_each(appenders, [this, flush](auto& a) {
+            auto m = latency.auto_measure();
+            return a->append(data.data(), data.size())
+              .then([&a, flush] { return flush ? a->flush() : ss::now(); })
+              .finally([m = std::move(m)] {});
+        });
+        perf_tests::stop_measuring_time();
+    }
+
+    ss::sstring dir;
+    storage::storage_resources resources;
+    std::vector<std::unique_ptr<storage::segment_appender>> appenders;
+    ss::sstring data;
+    hdr_hist latency;
+    size_t rounds{0};
+    size_t bytes{0};
+    std::chrono::steady_clock::time_point started;
+};
+
+} // namespace
+
+PERF_TEST_F(appender_fixture, append_1k_partitions_1KiB) {
+    return round(1_KiB, false);
+}
+
+PERF_TEST_F(appender_fixture, append_1k_partitions_16KiB) {
+    return round(16_KiB, false);
+}
+
+PERF_TEST_F(appender_fixture, append_flush_1k_partitions_1KiB) {
+    return round(1_KiB, true);
+}
+
+PERF_TEST_F(appender_fixture, append_flush_1k_partitions_16KiB) {
+    return round(16_KiB, true);
+}
@@ -2191,3 +2191,141 @@ FIXTURE_TEST(test_compacting_batches_of_different_types, storage_test_fixture) {
 
     BOOST_REQUIRE(before_compaction == after_compaction);
 }
+
+FIXTURE_TEST(release_idle_log_resources, storage_test_fixture) {
+    storage::log_manager mgr = make_log_manager();
+    auto deferred = ss::defer([&mgr]() mutable { mgr.stop().get0(); });
+    auto ntp = model::ntp("default", "test", 0);
+    auto log
+      = mgr.manage(storage::ntp_config(ntp, mgr.config().base_dir)).get0();
+    auto disk_log = get_disk_log(log);
+
+    auto headers = append_random_batches(log, 10);
+    log.flush().get0();
+    read_and_validate_all_batches(log);
+    BOOST_REQUIRE(disk_log->segments().back()->has_appender());
+
+    disk_log->release_idle_resources().get();
+    BOOST_REQUIRE_EQUAL(log.segment_count(), 1);
+    auto released = disk_log->segments().back();
+    BOOST_REQUIRE(!released->has_appender());
+    BOOST_REQUIRE(released->has_idle_appender());
+    BOOST_REQUIRE(!released->has_cache() || released->cache()->get().empty());
+    // everything written before is still readable
+    auto batches = read_and_validate_all_batches(log);
+    BOOST_REQUIRE_EQUAL(headers.size(), batches.size());
+
+    // the next append resumes on the same active segment
+    const auto size_before = released->size_bytes();
+    auto more = append_random_batches(log, 10);
+    log.flush().get0();
+    BOOST_REQUIRE_EQUAL(log.segment_count(), 1);
+    BOOST_REQUIRE(released->has_appender());
+    BOOST_REQUIRE(!released->has_idle_appender());
+    BOOST_REQUIRE_GT(released->size_bytes(), size_before);
+    batches = read_and_validate_all_batches(log);
+    BOOST_REQUIRE_EQUAL(headers.size() + more.size(), batches.size());
+    BOOST_REQUIRE_EQUAL(
+      log.offsets().dirty_offset, batches.back().last_offset());
+
+    // releasing twice is harmless
+    disk_log->release_idle_resources().get();
+    disk_log->release_idle_resources().get();
+    BOOST_REQUIRE(!disk_log->segments().back()->has_appender());
+
+    // a new term still rolls, sealing the idle segment
+    auto next_term = append_random_batches(log, 1, model::term_id(1));
+    log.flush().get0();
+    BOOST_REQUIRE_EQUAL(log.segment_count(), 2);
+    BOOST_REQUIRE(!released->has_idle_appender());
+    BOOST_REQUIRE(disk_log->segments().back()->has_appender());
+    batches = read_and_validate_all_batches(log);
+    BOOST_REQUIRE_EQUAL(
+      headers.size() + more.size() + next_term.size(), batches.size());
+}
+
+/**
+ * A clean shutdown checkpoints every segment of a log. The next startup
+ * trusts the segments whose index matches the checkpoint and drops it, so
+ * that an unclean shutdown is followed by a full validation.
+ */
+FIXTURE_TEST(clean_shutdown_checkpoint, storage_test_fixture) {
+    auto cfg = default_log_config(test_dir);
+    cfg.stype = storage::log_config::storage_type::disk;
+    auto ntp = model::ntp("default", "test", 0);
+    auto key = storage::internal::clean_segment_key(ntp);
+
+    auto read_checkpoint = [this, &key] {
+        auto buf = kvstore.get(storage::kvstore::key_space::storage, key);
+        BOOST_REQUIRE(buf.has_value());
+        return serde::from_iobuf<storage::internal::clean_segment_value>(
+          std::move(buf.value()));
+    };
+
+    storage::offset_stats offsets;
+    {
+        storage::log_manager mgr = make_log_manager(cfg);
+        auto deferred = ss::defer([&mgr]() mutable { mgr.stop().get0(); });
+        auto log
+          = mgr.manage(storage::ntp_config(ntp, mgr.config().base_dir)).get0();
+        for (int i = 0; i < 3; ++i) {
+            append_single_record_batch(log, 10, model::term_id(1));
+            get_disk_log(log)->force_roll(ss::default_priority_class()).get();
+        }
+        append_single_record_batch(log, 10, model::term_id(1));
+        log.flush().get0();
+        offsets = log.offsets();
+    }
+
+    auto clean = read_checkpoint();
+    BOOST_REQUIRE_EQUAL(clean.segments.size(), 4);
+    BOOST_REQUIRE_EQUAL(clean.segments.back().name, clean.segment_name);
+    BOOST_REQUIRE_EQUAL(
+      clean.segments.back().dirty_offset, offsets.dirty_offset);
+    for (const auto& s : clean.segments) {
+        BOOST_REQUIRE_GT(s.size_bytes, 0);
+    }
+
+    {
+        storage::log_manager mgr = make_log_manager(cfg);
+        auto deferred = ss::defer([&mgr]() mutable { mgr.stop().get0(); });
+        auto log
+          = mgr.manage(storage::ntp_config(ntp, mgr.config().base_dir)).get0();
+        BOOST_REQUIRE_EQUAL(log.segment_count(), 4);
+        BOOST_REQUIRE_EQUAL(log.offsets().dirty_offset, offsets.dirty_offset);
+        BOOST_REQUIRE_EQUAL(
+          log.offsets().committed_offset, offsets.committed_offset);
+        // sizes come from the checkpoint, the files are not accessed
+        auto& segs = get_disk_log(log)->segments();
+        for (size_t i = 0; i < segs.size(); ++i) {
+            BOOST_REQUIRE_EQUAL(
+              segs[i]->file_size(), clean.segments[i].size_bytes);
+        }
+        // open logs are not clean
+        BOOST_REQUIRE(
+          !kvstore.get(storage::kvstore::key_space::storage, key).has_value());
+        read_and_validate_all_batches(log);
+    }
+    BOOST_REQUIRE(read_checkpoint().segments == clean.segments);
+
+    // a segment whose index does not match the checkpoint is not trusted: it
+    // is validated as after an unclean shutdown
+    clean.segments.back().index_crc += 1;
+    clean.segments.back().size_bytes += 1;
+    kvstore
+      .put(
+        storage::kvstore::key_space::storage, key, serde::to_iobuf(clean))
+      .get();
+    {
+        storage::log_manager mgr = make_log_manager(cfg);
+        auto deferred = ss::defer([&mgr]() mutable { mgr.stop().get0(); });
+        auto log
+          = mgr.manage(storage::ntp_config(ntp, mgr.config().base_dir)).get0();
+        BOOST_REQUIRE_EQUAL(log.segment_count(), 4);
+        BOOST_REQUIRE_EQUAL(log.offsets().dirty_offset, offsets.dirty_offset);
+        BOOST_REQUIRE_EQUAL(
+          get_disk_log(log)->segments().back()->file_size(),
+          clean.segments.back().size_bytes - 1);
+        read_and_validate_all_batches(log);
+    }
+}
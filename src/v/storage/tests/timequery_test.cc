@@ -120,3 +120,34 @@ FIXTURE_TEST(timequery_single_value, log_builder_fixture) {
     BOOST_TEST(res->offset == model::offset(0));
     b | stop();
 }
+
+FIXTURE_TEST(timequery_record_level, log_builder_fixture) {
+    using namespace storage; // NOLINT
+
+    b | start();
+
+    // batches of 10 records, record timestamp = 1000 + record offset
+    b | add_segment(0);
+    for (auto offset = 0; offset < 100; offset += 10) {
+        auto batch = model::test::make_random_batch(
+          model::offset(offset), 10, false);
+        batch.header().first_timestamp = model::timestamp(1000 + offset);
+        batch.header().max_timestamp = model::timestamp(1000 + offset + 9);
+        b | add_batch(std::move(batch));
+    }
+
+    auto log = b.get_log();
+    for (auto ts = 1000; ts < 1100; ++ts) {
+        storage::timequery_config config(
+          model::timestamp(ts),
+          log.offsets().dirty_offset,
+          ss::default_priority_class(),
+          std::nullopt);
+
+        auto res = log.timequery(config).get0();
+        BOOST_REQUIRE(res);
+        BOOST_REQUIRE_EQUAL(res->time, model::timestamp(ts));
+        BOOST_REQUIRE_EQUAL(res->offset, model::offset(ts - 1000));
+    }
+    b | stop();
+}
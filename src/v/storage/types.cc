@@ -44,6 +44,17 @@ std::ostream& operator<<(std::ostream& o, const disk& d) {
     return o;
 }
 
+std::ostream& operator<<(std::ostream& o, const segment_checkpoint& c) {
+    fmt::print(
+      o,
+      "{{name: {}, size_bytes: {}, index_crc: {}, dirty_offset: {}}}",
+      c.name,
+      c.size_bytes,
+      c.index_crc,
+      c.dirty_offset);
+    return o;
+}
+
 std::ostream& operator<<(std::ostream& o, const log_reader_config& cfg) {
     o << "{start_offset:" << cfg.start_offset
       << ", max_offset:" << cfg.max_offset << ", min_bytes:" << cfg.min_bytes
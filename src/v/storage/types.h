@@ -30,6 +30,8 @@
 namespace storage {
 using log_clock = ss::lowres_clock;
 using debug_sanitize_files = ss::bool_class<struct debug_sanitize_files_tag>;
+using kvstore_incremental_snapshots
+  = ss::bool_class<struct kvstore_incremental_snapshots_tag>;
 
 enum class disk_space_alert { ok = 0, low_space = 1, degraded = 2 };
 
@@ -52,6 +54,30 @@ struct disk : serde::envelope<disk, serde::version<0>> {
 
 std::ostream& operator<<(std::ostream& o, const storage::disk_space_alert d);
 
+/// State of a segment when its log was last closed cleanly. On the next
+/// startup the segments which still match their checkpoint are trusted: they
+/// are neither replayed nor opened until they are read.
+struct segment_checkpoint
+  : serde::envelope<
+      segment_checkpoint,
+      serde::version<0>,
+      serde::compat_version<0>> {
+    // segment file name, without the directory
+    ss::sstring name;
+    uint64_t size_bytes{0};
+    // crc32c of the index file
+    uint32_t index_crc{0};
+    model::offset dirty_offset;
+
+    auto serde_fields() {
+        return std::tie(name, size_bytes, index_crc, dirty_offset);
+    }
+
+    friend std::ostream& operator<<(std::ostream&, const segment_checkpoint&);
+    friend bool operator==(const segment_checkpoint&, const segment_checkpoint&)
+      = default;
+};
+
 class snapshotable_stm {
 public:
     virtual ~snapshotable_stm() = default;
@@ -241,8 +267,8 @@ struct log_reader_config {
     ss::io_priority_class prio;
     std::optional<model::record_batch_type> type_filter;
 
-    /// \brief gurantees first_timestamp >= record_batch.first_timestamp
-    /// it is the std::lower_bound
+    /// \brief skips batches without any record with timestamp >=
+    /// first_timestamp, i.e. batches whose max timestamp is lower
     std::optional<model::timestamp> first_timestamp;
 
     /// abort source for read operations
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "likely.h"
+
+#include <cstddef>
+
+/**
+ * Per-shard, byte-interval allocation sampling hook.
+ *
+ * Allocation funnels report the size of every allocation through
+ * `on_allocation`. While a sampling callback is installed, the callback is
+ * invoked each time the running total of allocated bytes crosses a multiple
+ * of the sample interval, along with the number of bytes the sample stands
+ * for. When no callback is installed the hook costs a single thread local
+ * load and branch.
+ */
+class allocation_sampler {
+public:
+    /// `size` is the size of the sampled allocation and `weight` the number
+    /// of allocated bytes the sample accounts for.
+    using sample_fn = void (*)(size_t size, size_t weight) noexcept;
+
+    static void on_allocation(size_t size) noexcept {
+        auto& s = local();
+        if (likely(s._fn == nullptr)) {
+            return;
+        }
+        s.count(size);
+    }
+
+    static void enable(size_t interval, sample_fn fn) noexcept {
+        auto& s = local();
+        s._interval = interval;
+        s._countdown = interval;
+        s._fn = fn;
+    }
+
+    static void disable() noexcept { local()._fn = nullptr; }
+
+private:
+    static allocation_sampler& local() noexcept {
+        static thread_local allocation_sampler sampler;
+        return sampler;
+    }
+
+    void count(size_t size) noexcept {
+        if (size < _countdown) {
+            _countdown -= size;
+            return;
+        }
+        // an allocation larger than the interval crosses several boundaries
+        auto past = size - _countdown;
+        auto crossings = 1 + past / _interval;
+        _countdown = _interval - past % _interval;
+        _fn(size, crossings * _interval);
+    }
+
+    sample_fn _fn{nullptr};
+    size_t _interval{0};
+    // bytes left until the next sample
+    size_t _countdown{0};
+};
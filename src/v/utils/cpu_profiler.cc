@@ -0,0 +1,379 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "utils/cpu_profiler.h"
+
+#include "vassert.h"
+
+#include <seastar/core/smp.hh>
+
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <pthread.h>
+#include <string>
+#include <sys/syscall.h>
+#include <system_error>
+#include <unistd.h>
+
+static thread_local cpu_profiler* local_profiler = nullptr;
+
+cpu_profiler::cpu_profiler() {
+    vassert(
+      local_profiler == nullptr,
+      "Only one cpu_profiler instance per shard is supported");
+    local_profiler = this;
+}
+
+cpu_profiler::~cpu_profiler() noexcept {
+    if (_timer_created) {
+        ::timer_delete(_timer_id);
+    }
+    local_profiler = nullptr;
+}
+
+ss::future<> cpu_profiler::stop() {
+    disable();
+    return ss::now();
+}
+
+void cpu_profiler::install_signal_handler() {
+    static std::once_flag installed;
+    std::call_once(installed, [] {
+        struct sigaction sa {};
+        sa.sa_sigaction = &cpu_profiler::signal_handler;
+        sa.sa_flags = SA_SIGINFO | SA_RESTART;
+        sigfillset(&sa.sa_mask);
+        if (::sigaction(SIGPROF, &sa, nullptr) != 0) {
+            throw std::system_error(
+              errno, std::system_category(), "cpu_profiler: sigaction");
+        }
+    });
+}
+
+void cpu_profiler::signal_handler(int, siginfo_t*, void*) {
+    auto saved_errno = errno;
+    if (local_profiler) {
+        local_profiler->on_signal();
+    }
+    errno = saved_errno;
+}
+
+void cpu_profiler::on_signal() noexcept {
+    if (_reading || !_samples) {
+        ++_dropped;
+        return;
+    }
+    if (_sample_count >= _max_samples) {
+        // the oldest sample is about to be overwritten
+        ++_dropped;
+    }
+    auto& s = _samples[_sample_count % _max_samples];
+    s.sg = ss::current_scheduling_group();
+    s.frame_count = 0;
+    ss::backtrace([&s](ss::frame f) noexcept {
+        if (s.frame_count < max_frames) {
+            s.frames[s.frame_count++] = f;
+        }
+    });
+    ++_sample_count;
+}
+
+void cpu_profiler::enable(
+  std::chrono::milliseconds sample_period, size_t max_samples) {
+    if (sample_period <= std::chrono::milliseconds(0) || max_samples == 0) {
+        throw std::invalid_argument(fmt::format(
+          "Invalid cpu profiler parameters: sample_period {}ms, max_samples "
+          "{}",
+          sample_period.count(),
+          max_samples));
+    }
+    disable();
+    install_signal_handler();
+
+    // reactor threads start with all signals blocked
+    sigset_t mask;
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGPROF);
+    if (auto r = ::pthread_sigmask(SIG_UNBLOCK, &mask, nullptr); r != 0) {
+        throw std::system_error(
+          r, std::system_category(), "cpu_profiler: pthread_sigmask");
+    }
+
+    // the first call to backtrace() may allocate while loading the unwinder,
+    // make sure it happens outside of the signal handler
+    ss::backtrace([](ss::frame) noexcept {});
+
+    _samples = std::make_unique<raw_sample[]>(max_samples);
+    _max_samples = max_samples;
+    _sample_count = 0;
+    _dropped = 0;
+    _sample_period = sample_period;
+    arm_timer();
+}
+
+void cpu_profiler::disable() {
+    if (_timer_armed) {
+        disarm_timer();
+    }
+}
+
+void cpu_profiler::arm_timer() {
+    if (!_timer_created) {
+        sigevent sev{};
+        sev.sigev_notify = SIGEV_THREAD_ID;
+        sev.sigev_signo = SIGPROF;
+        sev._sigev_un._tid = static_cast<pid_t>(::syscall(SYS_gettid));
+        if (::timer_create(CLOCK_THREAD_CPUTIME_ID, &sev, &_timer_id) != 0) {
+            throw std::system_error(
+              errno, std::system_category(), "cpu_profiler: timer_create");
+        }
+        _timer_created = true;
+    }
+
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                _sample_period)
+                .count();
+    itimerspec spec{};
+    spec.it_interval.tv_sec = ns / 1'000'000'000;
+    spec.it_interval.tv_nsec = ns % 1'000'000'000;
+    spec.it_value = spec.it_interval;
+    if (::timer_settime(_timer_id, 0, &spec, nullptr) != 0) {
+        throw std::system_error(
+          errno, std::system_category(), "cpu_profiler: timer_settime");
+    }
+    _timer_armed = true;
+}
+
+void cpu_profiler::disarm_timer() {
+    itimerspec spec{};
+    ::timer_settime(_timer_id, 0, &spec, nullptr);
+    _timer_armed = false;
+}
+
+cpu_profiler::shard_profile cpu_profiler::collect() {
+    shard_profile ret{
+      .shard = ss::this_shard_id(), .sample_period = _sample_period};
+
+    // samples taken while we walk the ring buffer are dropped by the handler
+    _reading = 1;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+
+    auto available = std::min(_sample_count, _max_samples);
+    // (scheduling group, absolute frame addresses) -> index in ret.samples
+    std::map<std::pair<ss::sstring, std::vector<uintptr_t>>, size_t> index;
+    for (size_t i = 0; i < available; ++i) {
+        const auto& raw = _samples[i];
+        std::vector<uintptr_t> key;
+        key.reserve(raw.frame_count);
+        for (size_t f = 0; f < raw.frame_count; ++f) {
+            key.push_back(raw.frames[f].so->begin + raw.frames[f].addr);
+        }
+        auto [it, inserted] = index.emplace(
+          std::make_pair(raw.sg.name(), std::move(key)), ret.samples.size());
+        if (inserted) {
+            ret.samples.push_back(sample{
+              .backtrace = std::vector<ss::frame>(
+                raw.frames.begin(), raw.frames.begin() + raw.frame_count),
+              .scheduling_group = raw.sg.name()});
+        }
+        ret.samples[it->second].occurrences++;
+    }
+    ret.dropped_samples = _dropped;
+
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    _reading = 0;
+    return ret;
+}
+
+ss::sstring cpu_profiler::to_folded(const std::vector<shard_profile>& profiles) {
+    std::string out;
+    for (const auto& profile : profiles) {
+        for (const auto& s : profile.samples) {
+            fmt::format_to(
+              std::back_inserter(out),
+              "shard_{};{}",
+              profile.shard,
+              s.scheduling_group);
+            // backtraces are leaf first, folded stacks are root first
+            for (auto it = s.backtrace.rbegin(); it != s.backtrace.rend();
+                 ++it) {
+                fmt::format_to(std::back_inserter(out), ";{}", *it);
+            }
+            fmt::format_to(std::back_inserter(out), " {}\n", s.occurrences);
+        }
+    }
+    return ss::sstring(out.data(), out.size());
+}
+
+namespace {
+
+/// Minimal protobuf encoder for the handful of message shapes in
+/// https://github.com/google/pprof/blob/main/proto/profile.proto
+class pb_writer {
+public:
+    void varint_field(uint32_t field, uint64_t v) {
+        tag(field, 0);
+        varint(v);
+    }
+
+    void bytes_field(uint32_t field, std::string_view v) {
+        tag(field, 2);
+        varint(v.size());
+        _buf.append(v.data(), v.size());
+    }
+
+    void message_field(uint32_t field, const pb_writer& msg) {
+        bytes_field(field, msg._buf);
+    }
+
+    void packed_field(uint32_t field, const std::vector<uint64_t>& vs) {
+        pb_writer packed;
+        for (auto v : vs) {
+            packed.varint(v);
+        }
+        bytes_field(field, packed._buf);
+    }
+
+    const std::string& buffer() const { return _buf; }
+
+private:
+    void tag(uint32_t field, uint32_t wire_type) {
+        varint((uint64_t(field) << 3U) | wire_type);
+    }
+
+    void varint(uint64_t v) {
+        while (v >= 0x80) {
+            _buf.push_back(static_cast<char>((v & 0x7fU) | 0x80U));
+            v >>= 7U;
+        }
+        _buf.push_back(static_cast<char>(v));
+    }
+
+    std::string _buf;
+};
+
+class string_table {
+public:
+    string_table() { intern(""); }
+
+    uint64_t intern(std::string_view s) {
+        auto [it, inserted] = _index.emplace(std::string(s), _strings.size());
+        if (inserted) {
+            _strings.emplace_back(s);
+        }
+        return it->second;
+    }
+
+    const std::vector<std::string>& strings() const { return _strings; }
+
+private:
+    std::map<std::string, uint64_t> _index;
+    std::vector<std::string> _strings;
+};
+
+} // namespace
+
+ss::sstring cpu_profiler::to_pprof(const std::vector<shard_profile>& profiles) {
+    // Profile message field numbers
+    constexpr uint32_t sample_type_field = 1;
+    constexpr uint32_t sample_field = 2;
+    constexpr uint32_t mapping_field = 3;
+    constexpr uint32_t location_field = 4;
+    constexpr uint32_t string_table_field = 6;
+    constexpr uint32_t period_type_field = 11;
+    constexpr uint32_t period_field = 12;
+
+    string_table strings;
+    pb_writer profile;
+
+    auto value_type = [&strings](std::string_view type, std::string_view unit) {
+        pb_writer vt;
+        vt.varint_field(1, strings.intern(type));
+        vt.varint_field(2, strings.intern(unit));
+        return vt;
+    };
+
+    profile.message_field(sample_type_field, value_type("samples", "count"));
+    profile.message_field(sample_type_field, value_type("cpu", "nanoseconds"));
+
+    std::map<const ss::shared_object*, uint64_t> mappings;
+    std::map<uintptr_t, uint64_t> locations;
+    auto mapping_id = [&](const ss::shared_object* so) {
+        auto [it, inserted] = mappings.emplace(so, mappings.size() + 1);
+        if (inserted) {
+            pb_writer m;
+            m.varint_field(1, it->second);
+            m.varint_field(2, so->begin);
+            m.varint_field(3, so->end);
+            m.varint_field(5, strings.intern(so->name));
+            profile.message_field(mapping_field, m);
+        }
+        return it->second;
+    };
+    auto location_id = [&](const ss::frame& f) {
+        auto address = f.so->begin + f.addr;
+        auto [it, inserted] = locations.emplace(address, locations.size() + 1);
+        if (inserted) {
+            pb_writer l;
+            l.varint_field(1, it->second);
+            l.varint_field(2, mapping_id(f.so));
+            l.varint_field(3, address);
+            profile.message_field(location_field, l);
+        }
+        return it->second;
+    };
+
+    int64_t period_ns = 0;
+    for (const auto& p : profiles) {
+        auto shard_period_ns
+          = std::chrono::duration_cast<std::chrono::nanoseconds>(
+              p.sample_period)
+              .count();
+        period_ns = std::max(period_ns, shard_period_ns);
+        for (const auto& s : p.samples) {
+            std::vector<uint64_t> location_ids;
+            location_ids.reserve(s.backtrace.size());
+            for (const auto& f : s.backtrace) {
+                location_ids.push_back(location_id(f));
+            }
+
+            pb_writer sample;
+            sample.packed_field(1, location_ids);
+            sample.packed_field(
+              2,
+              {s.occurrences,
+               static_cast<uint64_t>(s.occurrences * shard_period_ns)});
+
+            pb_writer shard_label;
+            shard_label.varint_field(1, strings.intern("shard"));
+            shard_label.varint_field(3, p.shard);
+            sample.message_field(3, shard_label);
+
+            pb_writer sg_label;
+            sg_label.varint_field(1, strings.intern("scheduling_group"));
+            sg_label.varint_field(2, strings.intern(s.scheduling_group));
+            sample.message_field(3, sg_label);
+
+            profile.message_field(sample_field, sample);
+        }
+    }
+
+    profile.message_field(period_type_field, value_type("cpu", "nanoseconds"));
+    profile.varint_field(period_field, period_ns);
+    for (const auto& s : strings.strings()) {
+        profile.bytes_field(string_table_field, s);
+    }
+
+    const auto& buf = profile.buffer();
+    return ss::sstring(buf.data(), buf.size());
+}
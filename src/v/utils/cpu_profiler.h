@@ -0,0 +1,117 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "seastarx.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/scheduling.hh>
+#include <seastar/core/sstring.hh>
+#include <seastar/util/backtrace.hh>
+
+#include <array>
+#include <chrono>
+#include <csignal>
+#include <ctime>
+#include <memory>
+#include <vector>
+
+/**
+ * Per-shard sampling CPU profiler.
+ *
+ * When enabled, a POSIX timer measuring the CPU time consumed by the shard's
+ * reactor thread delivers SIGPROF to that thread every sample period. The
+ * signal handler captures the current backtrace together with the scheduling
+ * group that was active when the signal fired and stores it in a
+ * pre-allocated ring buffer. Nothing is allocated from within the handler.
+ *
+ * Samples are aggregated by (scheduling group, backtrace) on collection and
+ * can be rendered as folded stacks (for flamegraph.pl and friends) or as an
+ * uncompressed pprof protobuf. Frame addresses are not symbolized in-process,
+ * in the same way that seastar reports stall backtraces.
+ *
+ * Meant to be used as a sharded service.
+ */
+class cpu_profiler {
+public:
+    static constexpr size_t max_frames = 32;
+    static constexpr size_t default_max_samples = 4096;
+    static constexpr std::chrono::milliseconds default_sample_period{10};
+
+    struct sample {
+        std::vector<ss::frame> backtrace;
+        ss::sstring scheduling_group;
+        size_t occurrences{0};
+    };
+
+    struct shard_profile {
+        ss::shard_id shard{0};
+        std::chrono::milliseconds sample_period{0};
+        // samples lost because the ring buffer wrapped around or the
+        // signal fired while the buffer was being read
+        size_t dropped_samples{0};
+        std::vector<sample> samples;
+    };
+
+    cpu_profiler();
+    cpu_profiler(const cpu_profiler&) = delete;
+    cpu_profiler& operator=(const cpu_profiler&) = delete;
+    cpu_profiler(cpu_profiler&&) = delete;
+    cpu_profiler& operator=(cpu_profiler&&) = delete;
+    ~cpu_profiler() noexcept;
+
+    ss::future<> start() { return ss::now(); }
+    ss::future<> stop();
+
+    /// Discards any previously collected samples and starts sampling the
+    /// current shard every `sample_period` of consumed CPU time.
+    void enable(
+      std::chrono::milliseconds sample_period = default_sample_period,
+      size_t max_samples = default_max_samples);
+    /// Stops sampling. Collected samples are kept until the next enable().
+    void disable();
+
+    bool is_enabled() const { return _timer_armed; }
+
+    /// Aggregates the samples collected on this shard so far.
+    shard_profile collect();
+
+    /// Renders profiles as folded stacks, one `frames count` line per unique
+    /// stack, rooted at the shard and scheduling group.
+    static ss::sstring to_folded(const std::vector<shard_profile>&);
+    /// Renders profiles as a serialized (uncompressed) pprof `Profile`.
+    static ss::sstring to_pprof(const std::vector<shard_profile>&);
+
+private:
+    struct raw_sample {
+        ss::scheduling_group sg;
+        size_t frame_count{0};
+        std::array<ss::frame, max_frames> frames;
+    };
+
+    static void install_signal_handler();
+    static void signal_handler(int, siginfo_t*, void*);
+    void on_signal() noexcept;
+    void arm_timer();
+    void disarm_timer();
+
+    std::unique_ptr<raw_sample[]> _samples;
+    size_t _max_samples{0};
+    // total samples taken since enable(), the ring position is derived from it
+    size_t _sample_count{0};
+    size_t _dropped{0};
+    volatile sig_atomic_t _reading{0};
+    std::chrono::milliseconds _sample_period{0};
+    timer_t _timer_id{};
+    bool _timer_created{false};
+    bool _timer_armed{false};
+};
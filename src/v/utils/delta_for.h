@@ -224,6 +224,12 @@ public:
     /// Share the underlying iobuf
     iobuf share() { return _data.share(0, _data.size_bytes()); }
 
+    /// Share `len` bytes of the underlying iobuf starting at `pos`
+    iobuf share(size_t pos, size_t len) { return _data.share(pos, len); }
+
+    /// Size of the encoded rows, the position of the next row
+    size_t size_bytes() const noexcept { return _data.size_bytes(); }
+
     /// Return number of rows stored in the underlying iobuf instance
     uint32_t get_row_count() const noexcept { return _cnt; }
 
@@ -696,6 +702,9 @@ public:
         return true;
     }
 
+    /// Position of the next row in the encoded data
+    size_t bytes_consumed() const noexcept { return _data.bytes_consumed(); }
+
 private:
     template<typename T>
     void _unpack_as(row_t& input, unsigned shift) {
@@ -81,10 +81,25 @@ public:
         return frag.at(index % elems_per_frag);
     }
 
+    T& operator[](size_t index) {
+        vassert(index < _size, "Index out of range {}/{}", index, _size);
+        auto& frag = _frags.at(index / elems_per_frag);
+        return frag.at(index % elems_per_frag);
+    }
+
     const T& back() const { return _frags.back().back(); }
     bool empty() const noexcept { return _size == 0; }
     size_t size() const noexcept { return _size; }
 
+    /// Bytes allocated by the container, including unused capacity.
+    size_t memory_size() const noexcept {
+        size_t ret = _frags.capacity() * sizeof(std::vector<T>);
+        for (const auto& f : _frags) {
+            ret += f.capacity() * sizeof(T);
+        }
+        return ret;
+    }
+
     void shrink_to_fit() {
         if (!_frags.empty()) {
             _frags.back().shrink_to_fit();
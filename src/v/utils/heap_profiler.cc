@@ -0,0 +1,136 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "utils/heap_profiler.h"
+
+#include "utils/allocation_sampler.h"
+#include "vassert.h"
+
+#include <seastar/core/smp.hh>
+
+#include <fmt/format.h>
+#include <fmt/ostream.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+static thread_local heap_profiler* local_heap_profiler = nullptr;
+
+heap_profiler::heap_profiler() {
+    vassert(
+      local_heap_profiler == nullptr,
+      "Only one heap_profiler instance per shard is supported");
+    local_heap_profiler = this;
+}
+
+heap_profiler::~heap_profiler() noexcept {
+    disable();
+    local_heap_profiler = nullptr;
+}
+
+ss::future<> heap_profiler::stop() {
+    disable();
+    return ss::now();
+}
+
+void heap_profiler::on_sample(size_t, size_t weight) noexcept {
+    if (local_heap_profiler) {
+        local_heap_profiler->record(weight);
+    }
+}
+
+void heap_profiler::record(size_t weight) noexcept {
+    // recording allocates, which must not be sampled back into the profile
+    if (_recording) {
+        _unattributed_bytes += weight;
+        return;
+    }
+    _recording = true;
+    try {
+        auto bt = ss::current_backtrace_tasklocal();
+        auto it = _sites.find(bt);
+        if (it == _sites.end()) {
+            if (_sites.size() >= max_sites) {
+                _unattributed_bytes += weight;
+                _recording = false;
+                return;
+            }
+            it = _sites.emplace(std::move(bt), site_stats{}).first;
+        }
+        it->second.samples++;
+        it->second.bytes += weight;
+    } catch (...) {
+        _unattributed_bytes += weight;
+    }
+    _recording = false;
+}
+
+void heap_profiler::enable(size_t sample_interval) {
+    if (sample_interval == 0) {
+        throw std::invalid_argument(
+          "Invalid heap profiler sample interval: 0 bytes");
+    }
+    disable();
+    _sites.clear();
+    _unattributed_bytes = 0;
+    _sample_interval = sample_interval;
+    allocation_sampler::enable(sample_interval, &heap_profiler::on_sample);
+    _enabled = true;
+}
+
+void heap_profiler::disable() {
+    if (_enabled) {
+        allocation_sampler::disable();
+        _enabled = false;
+    }
+}
+
+heap_profiler::shard_profile heap_profiler::collect() const {
+    shard_profile ret{
+      .shard = ss::this_shard_id(),
+      .sample_interval = _sample_interval,
+      .unattributed_bytes = _unattributed_bytes};
+    ret.sites.reserve(_sites.size());
+    for (const auto& [bt, stats] : _sites) {
+        ret.sites.push_back(site{
+          .backtrace = std::vector<ss::frame>(
+            bt.frames().begin(), bt.frames().end()),
+          .samples = stats.samples,
+          .bytes = stats.bytes});
+    }
+    std::sort(
+      ret.sites.begin(), ret.sites.end(), [](const site& a, const site& b) {
+          return a.bytes > b.bytes;
+      });
+    return ret;
+}
+
+ss::sstring heap_profiler::to_folded(const std::vector<shard_profile>& profiles) {
+    std::string out;
+    for (const auto& profile : profiles) {
+        for (const auto& s : profile.sites) {
+            fmt::format_to(std::back_inserter(out), "shard_{}", profile.shard);
+            // backtraces are leaf first, folded stacks are root first
+            for (auto it = s.backtrace.rbegin(); it != s.backtrace.rend();
+                 ++it) {
+                fmt::format_to(std::back_inserter(out), ";{}", *it);
+            }
+            fmt::format_to(std::back_inserter(out), " {}\n", s.bytes);
+        }
+        if (profile.unattributed_bytes > 0) {
+            fmt::format_to(
+              std::back_inserter(out),
+              "shard_{};unattributed {}\n",
+              profile.shard,
+              profile.unattributed_bytes);
+        }
+    }
+    return ss::sstring(out.data(), out.size());
+}
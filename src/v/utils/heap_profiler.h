@@ -0,0 +1,98 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "seastarx.h"
+
+#include <seastar/core/future.hh>
+#include <seastar/core/sstring.hh>
+#include <seastar/util/backtrace.hh>
+
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Per-shard sampling allocation-site profiler.
+ *
+ * When enabled, a backtrace is recorded every `sample_interval` bytes
+ * allocated through the sampled allocation funnels (see
+ * `allocation_sampler`), which covers the iobuf fragments holding record
+ * batches, cached data and network buffers. Each sample is weighted by the
+ * number of bytes it stands for, so a site's byte count is an unbiased
+ * estimate of what it allocated since the profiler was enabled.
+ *
+ * Sites are aggregated by backtrace as samples are taken; the number of
+ * distinct sites is bounded and bytes sampled past the bound are reported as
+ * unattributed. Profiles are rendered as folded stacks weighted by bytes.
+ *
+ * Meant to be used as a sharded service.
+ */
+class heap_profiler {
+public:
+    static constexpr size_t default_sample_interval = 1024 * 1024;
+    static constexpr size_t max_sites = 8192;
+
+    struct site {
+        std::vector<ss::frame> backtrace;
+        size_t samples{0};
+        // estimated bytes allocated from this site
+        size_t bytes{0};
+    };
+
+    struct shard_profile {
+        ss::shard_id shard{0};
+        size_t sample_interval{0};
+        // sampled bytes which could not be attributed to a site
+        size_t unattributed_bytes{0};
+        std::vector<site> sites;
+    };
+
+    heap_profiler();
+    heap_profiler(const heap_profiler&) = delete;
+    heap_profiler& operator=(const heap_profiler&) = delete;
+    heap_profiler(heap_profiler&&) = delete;
+    heap_profiler& operator=(heap_profiler&&) = delete;
+    ~heap_profiler() noexcept;
+
+    ss::future<> start() { return ss::now(); }
+    ss::future<> stop();
+
+    /// Discards previously collected sites and starts sampling one
+    /// allocation every `sample_interval` bytes on the current shard.
+    void enable(size_t sample_interval = default_sample_interval);
+    /// Stops sampling. Collected sites are kept until the next enable().
+    void disable();
+
+    bool is_enabled() const { return _enabled; }
+
+    /// Sites sampled on this shard so far, largest first.
+    shard_profile collect() const;
+
+    /// Renders profiles as folded stacks, one `frames bytes` line per site,
+    /// rooted at the shard.
+    static ss::sstring to_folded(const std::vector<shard_profile>&);
+
+private:
+    struct site_stats {
+        size_t samples{0};
+        size_t bytes{0};
+    };
+
+    static void on_sample(size_t size, size_t weight) noexcept;
+    void record(size_t weight) noexcept;
+
+    bool _enabled{false};
+    bool _recording{false};
+    size_t _sample_interval{0};
+    size_t _unattributed_bytes{0};
+    std::unordered_map<ss::simple_backtrace, site_stats> _sites;
+};
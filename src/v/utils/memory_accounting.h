@@ -0,0 +1,106 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+/// Main consumers of memory whose live bytes are accounted per shard.
+enum class memory_subsystem : uint8_t {
+    batch_cache = 0,
+    readers_cache,
+    segment_index,
+    raft_follower_state,
+    group_offsets,
+};
+
+inline constexpr size_t memory_subsystem_count
+  = static_cast<size_t>(memory_subsystem::group_offsets) + 1;
+
+constexpr std::string_view to_string_view(memory_subsystem s) {
+    switch (s) {
+    case memory_subsystem::batch_cache:
+        return "batch_cache";
+    case memory_subsystem::readers_cache:
+        return "readers_cache";
+    case memory_subsystem::segment_index:
+        return "segment_index";
+    case memory_subsystem::raft_follower_state:
+        return "raft_follower_state";
+    case memory_subsystem::group_offsets:
+        return "group_offsets";
+    }
+    return "unknown";
+}
+
+/**
+ * Bytes held by a single object on behalf of a subsystem.
+ *
+ * The owner reports its footprint whenever it changes and the difference is
+ * applied to the per-shard total of the subsystem, so reading the totals is
+ * free and keeping them up to date costs an addition. The accounted bytes
+ * are released on destruction. Objects must be destroyed on the shard they
+ * were created on, which is the case for everything owned by a shard local
+ * service.
+ */
+class accounted_memory {
+public:
+    explicit accounted_memory(memory_subsystem s) noexcept
+      : _subsystem(s) {}
+
+    accounted_memory(const accounted_memory&) = delete;
+    accounted_memory& operator=(const accounted_memory&) = delete;
+
+    accounted_memory(accounted_memory&& o) noexcept
+      : _subsystem(o._subsystem)
+      , _bytes(std::exchange(o._bytes, 0)) {}
+
+    accounted_memory& operator=(accounted_memory&& o) noexcept {
+        if (this != &o) {
+            update(0);
+            _subsystem = o._subsystem;
+            _bytes = std::exchange(o._bytes, 0);
+        }
+        return *this;
+    }
+
+    ~accounted_memory() noexcept { update(0); }
+
+    /// Sets the footprint of the owner to `bytes`.
+    void update(size_t bytes) noexcept {
+        auto& total = totals()[static_cast<size_t>(_subsystem)];
+        total = total - _bytes + bytes;
+        _bytes = bytes;
+    }
+
+    void add(size_t bytes) noexcept { update(_bytes + bytes); }
+    void sub(size_t bytes) noexcept { update(_bytes - bytes); }
+
+    size_t bytes() const noexcept { return _bytes; }
+
+    /// Bytes currently accounted to `s` on this shard.
+    static size_t live_bytes(memory_subsystem s) noexcept {
+        return totals()[static_cast<size_t>(s)];
+    }
+
+private:
+    static std::array<size_t, memory_subsystem_count>& totals() noexcept {
+        static thread_local std::array<size_t, memory_subsystem_count> t{};
+        return t;
+    }
+
+    memory_subsystem _subsystem;
+    size_t _bytes{0};
+};
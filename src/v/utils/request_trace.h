@@ -0,0 +1,143 @@
+/*
+ * Copyright 2022 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+
+#pragma once
+
+#include "seastarx.h"
+
+#include <seastar/core/shared_ptr.hh>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+/// Stages a sampled kafka produce or fetch request goes through, in the order
+/// in which they are reached. Not every request reaches every stage.
+enum class trace_stage : uint8_t {
+    // request header parsed from the connection
+    received = 0,
+    // quota throttling delay elapsed
+    throttled,
+    // memory and queue depth units acquired
+    resources_acquired,
+    // handed over to the api handler
+    dispatched,
+    // running on the home shard of the partition
+    partition_shard,
+    // cached by the raft replicate batcher
+    batcher_enqueued,
+    // picked up by a replicate batcher flush
+    batcher_flushed,
+    // appended to the leader log
+    log_appended,
+    // leader log flushed to disk
+    log_flushed,
+    // replication result delivered for the requested acks level
+    replicated,
+    // all partition reads of a fetch completed
+    partition_read,
+    // response encoded
+    response_ready,
+    // response written to the connection
+    response_sent,
+};
+
+inline constexpr size_t trace_stage_count
+  = static_cast<size_t>(trace_stage::response_sent) + 1;
+
+constexpr std::string_view to_string_view(trace_stage s) {
+    switch (s) {
+    case trace_stage::received:
+        return "received";
+    case trace_stage::throttled:
+        return "throttled";
+    case trace_stage::resources_acquired:
+        return "resources_acquired";
+    case trace_stage::dispatched:
+        return "dispatched";
+    case trace_stage::partition_shard:
+        return "partition_shard";
+    case trace_stage::batcher_enqueued:
+        return "batcher_enqueued";
+    case trace_stage::batcher_flushed:
+        return "batcher_flushed";
+    case trace_stage::log_appended:
+        return "log_appended";
+    case trace_stage::log_flushed:
+        return "log_flushed";
+    case trace_stage::replicated:
+        return "replicated";
+    case trace_stage::partition_read:
+        return "partition_read";
+    case trace_stage::response_ready:
+        return "response_ready";
+    case trace_stage::response_sent:
+        return "response_sent";
+    }
+    return "unknown";
+}
+
+/**
+ * Timestamps of the stages reached by a single sampled request.
+ *
+ * A request touching several partitions reaches some stages more than once;
+ * the latest timestamp is kept since the request can not complete before its
+ * slowest partition. A trace is owned by the shard which received the request:
+ * the stages reached on the home shard of a partition are stamped on a trace
+ * of that shard, whose copy is merged back into the request trace.
+ */
+class request_trace {
+public:
+    using clock_type = std::chrono::steady_clock;
+
+    request_trace() noexcept
+      : request_trace(trace_stage::received) {}
+
+    /// Trace of the part of a request handled by another shard, starting at
+    /// `first`
+    explicit request_trace(trace_stage first) noexcept { mark(first); }
+
+    void mark(trace_stage s) noexcept {
+        auto& slot = _stamps[static_cast<size_t>(s)];
+        slot = std::max(slot, clock_type::now().time_since_epoch().count());
+    }
+
+    std::optional<clock_type::time_point> at(trace_stage s) const noexcept {
+        auto v = _stamps[static_cast<size_t>(s)];
+        if (v == 0) {
+            return std::nullopt;
+        }
+        return clock_type::time_point(clock_type::duration(v));
+    }
+
+    /// Keeps the latest stamp of every stage of both traces
+    void merge(const request_trace& o) noexcept {
+        for (size_t i = 0; i < _stamps.size(); ++i) {
+            _stamps[i] = std::max(_stamps[i], o._stamps[i]);
+        }
+    }
+
+private:
+    std::array<clock_type::rep, trace_stage_count> _stamps{};
+};
+
+/// Null for requests which were not sampled.
+using request_trace_ptr = ss::lw_shared_ptr<request_trace>;
+
+/// Stamps `s` on a trace if the request is being traced.
+inline void mark_trace(const request_trace_ptr& t, trace_stage s) noexcept {
+    if (t) {
+        t->mark(s);
+    }
+}
@@ -0,0 +1,82 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "utils/cpu_profiler.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/tools/old/interface.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+using namespace std::chrono_literals;
+
+static uint64_t burn_cpu(std::chrono::milliseconds duration) {
+    volatile uint64_t acc = 0;
+    auto deadline = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < deadline) {
+        for (int i = 0; i < 1000; ++i) {
+            acc = acc + i;
+        }
+    }
+    return acc;
+}
+
+SEASTAR_THREAD_TEST_CASE(test_cpu_profiler_collects_samples) {
+    cpu_profiler profiler;
+    BOOST_REQUIRE(!profiler.is_enabled());
+
+    profiler.enable(1ms, 64);
+    BOOST_REQUIRE(profiler.is_enabled());
+    burn_cpu(200ms);
+    profiler.disable();
+    BOOST_REQUIRE(!profiler.is_enabled());
+
+    auto profile = profiler.collect();
+    BOOST_REQUIRE_EQUAL(profile.shard, ss::this_shard_id());
+    BOOST_REQUIRE_EQUAL(profile.sample_period, 1ms);
+    BOOST_REQUIRE(!profile.samples.empty());
+
+    size_t total = 0;
+    for (const auto& s : profile.samples) {
+        BOOST_REQUIRE(!s.backtrace.empty());
+        BOOST_REQUIRE(s.backtrace.size() <= cpu_profiler::max_frames);
+        total += s.occurrences;
+    }
+    // the ring buffer holds at most 64 samples, older ones are dropped
+    BOOST_REQUIRE_LE(total, 64);
+    BOOST_REQUIRE_GT(total + profile.dropped_samples, 64);
+
+    // nothing is sampled while disabled
+    burn_cpu(50ms);
+    auto again = profiler.collect();
+    BOOST_REQUIRE_EQUAL(again.dropped_samples, profile.dropped_samples);
+
+    std::vector<cpu_profiler::shard_profile> profiles{profile};
+    auto folded = cpu_profiler::to_folded(profiles);
+    BOOST_REQUIRE_EQUAL(folded.find("shard_"), 0);
+    BOOST_REQUIRE_EQUAL(
+      static_cast<size_t>(std::count(folded.begin(), folded.end(), '\n')),
+      profile.samples.size());
+    BOOST_REQUIRE(!cpu_profiler::to_pprof(profiles).empty());
+
+    // re-enabling starts a fresh profile
+    profiler.enable(1ms, 64);
+    profiler.disable();
+    BOOST_REQUIRE_EQUAL(profiler.collect().dropped_samples, 0);
+    profiler.stop().get();
+}
+
+SEASTAR_THREAD_TEST_CASE(test_cpu_profiler_rejects_bad_parameters) {
+    cpu_profiler profiler;
+    BOOST_REQUIRE_THROW(profiler.enable(0ms), std::invalid_argument);
+    BOOST_REQUIRE_THROW(profiler.enable(1ms, 0), std::invalid_argument);
+    BOOST_REQUIRE(!profiler.is_enabled());
+}
@@ -0,0 +1,118 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/iobuf.h"
+#include "utils/allocation_sampler.h"
+#include "utils/heap_profiler.h"
+#include "utils/memory_accounting.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/tools/old/interface.hpp>
+
+static iobuf allocate_fragments(size_t count, size_t size) {
+    iobuf buf;
+    ss::sstring data(ss::sstring::initialized_later{}, size);
+    for (size_t i = 0; i < count; ++i) {
+        buf.append(data.data(), data.size());
+    }
+    return buf;
+}
+
+SEASTAR_THREAD_TEST_CASE(test_heap_profiler_samples_iobuf_allocations) {
+    heap_profiler profiler;
+    BOOST_REQUIRE(!profiler.is_enabled());
+
+    profiler.enable(64 * 1024);
+    BOOST_REQUIRE(profiler.is_enabled());
+    auto buf = allocate_fragments(256, 16 * 1024);
+    profiler.disable();
+
+    auto profile = profiler.collect();
+    BOOST_REQUIRE_EQUAL(profile.shard, ss::this_shard_id());
+    BOOST_REQUIRE_EQUAL(profile.sample_interval, 64 * 1024);
+    BOOST_REQUIRE(!profile.sites.empty());
+
+    size_t bytes = profile.unattributed_bytes;
+    for (const auto& s : profile.sites) {
+        BOOST_REQUIRE(!s.backtrace.empty());
+        BOOST_REQUIRE_GT(s.samples, 0);
+        bytes += s.bytes;
+    }
+    // every sample stands for one interval worth of allocated bytes
+    BOOST_REQUIRE_EQUAL(bytes % (64 * 1024), 0);
+    BOOST_REQUIRE_GE(bytes, 256 * 16 * 1024 - 64 * 1024);
+
+    // nothing is sampled while disabled
+    auto more = allocate_fragments(256, 16 * 1024);
+    auto again = profiler.collect();
+    BOOST_REQUIRE_EQUAL(again.sites.size(), profile.sites.size());
+
+    std::vector<heap_profiler::shard_profile> profiles{profile};
+    auto folded = heap_profiler::to_folded(profiles);
+    BOOST_REQUIRE_EQUAL(folded.find("shard_"), 0);
+
+    BOOST_REQUIRE_THROW(profiler.enable(0), std::invalid_argument);
+    profiler.stop().get();
+}
+
+namespace {
+size_t sampled_weight = 0;
+size_t sample_count = 0;
+void count_sample(size_t, size_t weight) noexcept {
+    sampled_weight += weight;
+    ++sample_count;
+}
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_allocation_sampler_weights) {
+    allocation_sampler::enable(100, &count_sample);
+    allocation_sampler::on_allocation(99);
+    BOOST_REQUIRE_EQUAL(sample_count, 0);
+    allocation_sampler::on_allocation(1);
+    BOOST_REQUIRE_EQUAL(sample_count, 1);
+    BOOST_REQUIRE_EQUAL(sampled_weight, 100);
+    // crosses three interval boundaries at once
+    allocation_sampler::on_allocation(350);
+    BOOST_REQUIRE_EQUAL(sample_count, 2);
+    BOOST_REQUIRE_EQUAL(sampled_weight, 400);
+    // the next boundary is 50 bytes away
+    allocation_sampler::on_allocation(49);
+    BOOST_REQUIRE_EQUAL(sample_count, 2);
+    allocation_sampler::on_allocation(1);
+    BOOST_REQUIRE_EQUAL(sample_count, 3);
+    allocation_sampler::disable();
+    allocation_sampler::on_allocation(1000);
+    BOOST_REQUIRE_EQUAL(sample_count, 3);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_accounted_memory) {
+    auto live = [] {
+        return accounted_memory::live_bytes(memory_subsystem::segment_index);
+    };
+    auto initial = live();
+    {
+        accounted_memory a(memory_subsystem::segment_index);
+        a.update(100);
+        BOOST_REQUIRE_EQUAL(live(), initial + 100);
+        a.add(20);
+        a.sub(50);
+        BOOST_REQUIRE_EQUAL(live(), initial + 70);
+
+        accounted_memory b(std::move(a));
+        BOOST_REQUIRE_EQUAL(b.bytes(), 70);
+        BOOST_REQUIRE_EQUAL(live(), initial + 70);
+
+        accounted_memory c(memory_subsystem::segment_index);
+        c.update(30);
+        c = std::move(b);
+        BOOST_REQUIRE_EQUAL(live(), initial + 70);
+    }
+    BOOST_REQUIRE_EQUAL(live(), initial);
+}
@@ -0,0 +1,151 @@
+// Copyright 2022 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+
+#include "bytes/bytes.h"
+#include "model/record.h"
+#include "model/record_utils.h"
+#include "model/tests/random_batch.h"
+#include "random/generators.h"
+#include "utils/vint.h"
+
+#include <seastar/testing/perf_tests.hh>
+
+#include <vector>
+
+/*
+ * Varint kernels against the byte at a time coding, and the single pass
+ * record framing decoder against materializing the records, which is how
+ * produced batches used to be validated. Records are small so that their
+ * varints, rather than their payload, dominate.
+ */
+
+namespace {
+
+constexpr size_t values_per_op = 1'000;
+
+/// Record fields of small records: deltas, sizes and counts
+std::vector<int64_t> make_small_values() {
+    std::vector<int64_t> values;
+    values.reserve(values_per_op);
+    for (size_t i = 0; i < values_per_op; ++i) {
+        values.push_back(random_generators::get_int<int64_t>(-1, 4096));
+    }
+    return values;
+}
+
+bytes encode(const std::vector<int64_t>& values) {
+    bytes encoded;
+    for (auto v : values) {
+        encoded += vint::to_bytes(v);
+    }
+    return encoded;
+}
+
+size_t decode_byte_at_a_time() {
+    const auto encoded = encode(make_small_values());
+    std::vector<int64_t> decoded(values_per_op);
+
+    perf_tests::start_measuring_time();
+    auto view = bytes_view(encoded);
+    for (auto& v : decoded) {
+        auto [value, size] = vint::deserialize(view);
+        v = value;
+        view.remove_prefix(size);
+    }
+    perf_tests::do_not_optimize(decoded);
+    perf_tests::stop_measuring_time();
+    return values_per_op;
+}
+
+size_t decode_many() {
+    const auto encoded = encode(make_small_values());
+    std::vector<int64_t> decoded(values_per_op);
+
+    perf_tests::start_measuring_time();
+    auto read = vint::deserialize_many(
+      encoded.data(), encoded.size(), decoded.data(), decoded.size());
+    perf_tests::do_not_optimize(read);
+    perf_tests::do_not_optimize(decoded);
+    perf_tests::stop_measuring_time();
+    return values_per_op;
+}
+
+size_t encode_one_at_a_time() {
+    const auto values = make_small_values();
+    std::vector<uint8_t> encoded(values_per_op * vint::max_length);
+
+    perf_tests::start_measuring_time();
+    size_t pos = 0;
+    for (auto v : values) {
+        pos += vint::serialize(v, encoded.data() + pos);
+    }
+    perf_tests::do_not_optimize(pos);
+    perf_tests::do_not_optimize(encoded);
+    perf_tests::stop_measuring_time();
+    return values_per_op;
+}
+
+size_t encode_many() {
+    const auto values = make_small_values();
+    std::vector<uint8_t> encoded(values_per_op * vint::max_length);
+
+    perf_tests::start_measuring_time();
+    auto written = vint::serialize_many(
+      values.data(), values.size(), encoded.data());
+    perf_tests::do_not_optimize(written);
+    perf_tests::do_not_optimize(encoded);
+    perf_tests::stop_measuring_time();
+    return values_per_op;
+}
+
+model::record_batch make_small_record_batch(int records) {
+    return model::test::make_random_batch(
+      model::offset(0),
+      records,
+      false,
+      model::record_batch_type::raft_data,
+      std::vector<size_t>(records, 16));
+}
+
+size_t materialize_records(int records) {
+    auto batch = make_small_record_batch(records);
+
+    perf_tests::start_measuring_time();
+    batch.for_each_record(
+      [](model::record r) { perf_tests::do_not_optimize(r); });
+    perf_tests::stop_measuring_time();
+    return records;
+}
+
+size_t decode_record_spans(int records) {
+    auto batch = make_small_record_batch(records);
+
+    perf_tests::start_measuring_time();
+    auto spans = model::decode_record_spans(
+      batch.data(), batch.record_count());
+    perf_tests::do_not_optimize(spans);
+    perf_tests::stop_measuring_time();
+    return records;
+}
+
+} // namespace
+
+PERF_TEST(vint, decode_byte_at_a_time) { return decode_byte_at_a_time(); }
+PERF_TEST(vint, decode_many) { return decode_many(); }
+PERF_TEST(vint, encode_one_at_a_time) { return encode_one_at_a_time(); }
+PERF_TEST(vint, encode_many) { return encode_many(); }
+
+PERF_TEST(record_framing, materialize_100) { return materialize_records(100); }
+PERF_TEST(record_framing, decode_spans_100) { return decode_record_spans(100); }
+PERF_TEST(record_framing, materialize_1k) {
+    return materialize_records(1'000);
+}
+PERF_TEST(record_framing, decode_spans_1k) {
+    return decode_record_spans(1'000);
+}
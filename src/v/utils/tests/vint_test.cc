@@ -15,10 +15,13 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <iostream>
+#include <limits>
 #include <random>
+#include <vector>
 
 namespace {
 
@@ -63,3 +66,81 @@ SEASTAR_THREAD_TEST_CASE(test_unsigned_stream_deserializer) {
       = unsigned_vint::stream_deserialize(istream).get();
     BOOST_CHECK_EQUAL(result, test_number);
 }
+
+namespace {
+
+void many_roundtrip(
+  vint::detail::deserialize_many_fn deserialize_many,
+  vint::detail::serialize_many_fn serialize_many) {
+    for (int i = 0; i < 10000; ++i) {
+        const auto n = random_generators::get_int<size_t>(1, 20);
+        std::vector<int64_t> values;
+        bytes expected;
+        for (size_t j = 0; j < n; ++j) {
+            // every encoded length, from 1 to 10 bytes
+            const auto bits = random_generators::get_int(0, 63);
+            auto v = random_generators::get_int<int64_t>(
+              std::numeric_limits<int64_t>::min() >> (63 - bits),
+              std::numeric_limits<int64_t>::max() >> (63 - bits));
+            values.push_back(v);
+            expected += vint::to_bytes(v);
+        }
+
+        std::vector<uint8_t> encoded(n * vint::max_length);
+        const auto written = serialize_many(values.data(), n, encoded.data());
+        BOOST_REQUIRE_EQUAL(written, expected.size());
+        BOOST_REQUIRE(
+          std::equal(expected.begin(), expected.end(), encoded.begin()));
+
+        // trailing bytes, the kernels process the input in blocks
+        encoded.resize(written + random_generators::get_int(0, 64));
+        std::vector<int64_t> decoded(n);
+        const auto read = deserialize_many(
+          encoded.data(), encoded.size(), decoded.data(), n);
+        BOOST_REQUIRE_EQUAL(read, written);
+        BOOST_REQUIRE(decoded == values);
+
+        const auto [first, first_size] = vint::deserialize(
+          encoded.data(), encoded.size());
+        BOOST_REQUIRE_EQUAL(first, values.front());
+        BOOST_REQUIRE_EQUAL(first_size, vint::vint_size(values.front()));
+
+        // truncated input
+        BOOST_REQUIRE_EQUAL(
+          deserialize_many(encoded.data(), written - 1, decoded.data(), n),
+          0);
+    }
+}
+
+void many_malformed(vint::detail::deserialize_many_fn deserialize_many) {
+    // no terminating byte within max_length bytes
+    std::vector<uint8_t> malformed(64, 0x80);
+    int64_t v = 0;
+    BOOST_REQUIRE_EQUAL(
+      deserialize_many(malformed.data(), malformed.size(), &v, 1), 0);
+}
+
+} // namespace
+
+SEASTAR_THREAD_TEST_CASE(test_many_roundtrip) {
+    many_roundtrip(&vint::deserialize_many, &vint::serialize_many);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_many_roundtrip_all_kernels) {
+    const auto kernels = vint::detail::supported_many_kernels();
+    BOOST_REQUIRE(!kernels.empty());
+    BOOST_REQUIRE_EQUAL(kernels.front().name, "portable");
+    for (const auto& k : kernels) {
+        BOOST_TEST_CONTEXT("kernel: " << k.name) {
+            many_roundtrip(k.deserialize, k.serialize);
+            many_malformed(k.deserialize);
+        }
+    }
+}
+
+SEASTAR_THREAD_TEST_CASE(test_many_malformed) {
+    many_malformed(&vint::deserialize_many);
+    std::vector<uint8_t> malformed(64, 0x80);
+    BOOST_REQUIRE_EQUAL(
+      vint::deserialize(malformed.data(), malformed.size()).second, 0);
+}
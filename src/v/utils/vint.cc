@@ -13,6 +13,10 @@
 
 #include <seastar/core/coroutine.hh>
 
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
 namespace unsigned_vint {
 
 ss::future<std::pair<uint32_t, size_t>>
@@ -31,3 +35,231 @@ stream_deserialize(ss::input_stream<char>& s) {
 }
 
 } // namespace unsigned_vint
+
+namespace vint {
+
+namespace {
+
+size_t deserialize_many_portable(
+  const uint8_t* src, size_t len, int64_t* out, size_t n) noexcept {
+    size_t pos = 0;
+    for (size_t i = 0; i < n; ++i) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        auto [v, sz] = detail::decode_unsigned(src + pos, len - pos);
+        if (unlikely(sz == 0)) {
+            return 0;
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        out[i] = decode_zigzag(v);
+        pos += sz;
+    }
+    return pos;
+}
+
+size_t serialize_many_portable(
+  const int64_t* values, size_t n, uint8_t* out) noexcept {
+    size_t pos = 0;
+    for (size_t i = 0; i < n; ++i) {
+        pos += detail::encode_unsigned(
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          encode_zigzag(values[i]),
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          out + pos);
+    }
+    return pos;
+}
+
+#if defined(__x86_64__)
+
+/*
+ * The x86 kernels load a block of the input at a time, the clear bits of
+ * the movemask of a block are the last bytes of the varints ending in it.
+ * Each of those varints is then packed from a single word load, which
+ * needs 8 readable bytes past the end of the block. Varints of more than 8
+ * bytes and the end of the input are left to the byte at a time decoder.
+ */
+
+/// Decodes the varint ending `sz` bytes after `p`
+inline std::pair<uint64_t, size_t>
+decode_ending_at(const uint8_t* p, size_t sz, size_t len) noexcept {
+    if (unlikely(sz > sizeof(uint64_t))) {
+        return detail::decode_unsigned_slow(p, len);
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto w = ss::read_le<uint64_t>(reinterpret_cast<const char*>(p));
+    return {detail::compact_groups(w & detail::length_mask(sz)), sz};
+}
+
+size_t deserialize_many_sse2(
+  const uint8_t* src, size_t len, int64_t* out, size_t n) noexcept {
+    constexpr size_t block = 16;
+    size_t pos = 0;
+    size_t i = 0;
+    while (i < n && len - pos >= block + sizeof(uint64_t)) {
+        const auto chunk = _mm_loadu_si128(
+          // NOLINTNEXTLINE
+          reinterpret_cast<const __m128i*>(src + pos));
+        uint32_t stops = ~static_cast<uint32_t>(_mm_movemask_epi8(chunk))
+                         & 0xffffU;
+        size_t start = 0;
+        while (stops != 0 && i < n) {
+            const size_t end = std::countr_zero(stops) + 1;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            const auto* p = src + pos + start;
+            auto [v, sz] = decode_ending_at(p, end - start, len - pos - start);
+            if (unlikely(sz == 0)) {
+                return 0;
+            }
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            out[i++] = decode_zigzag(v);
+            start = end;
+            stops &= stops - 1;
+        }
+        if (unlikely(start == 0)) {
+            // a varint longer than the block is malformed
+            return 0;
+        }
+        pos += start;
+    }
+    if (i == n) {
+        return pos;
+    }
+    const auto tail = deserialize_many_portable(
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      src + pos,
+      len - pos,
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      out + i,
+      n - i);
+    return tail == 0 ? 0 : pos + tail;
+}
+
+__attribute__((target("avx2,bmi,bmi2"))) size_t deserialize_many_avx2(
+  const uint8_t* src, size_t len, int64_t* out, size_t n) noexcept {
+    constexpr size_t block = 32;
+    size_t pos = 0;
+    size_t i = 0;
+    while (i < n && len - pos >= block + sizeof(uint64_t)) {
+        const auto chunk = _mm256_loadu_si256(
+          // NOLINTNEXTLINE
+          reinterpret_cast<const __m256i*>(src + pos));
+        uint32_t stops = ~static_cast<uint32_t>(_mm256_movemask_epi8(chunk));
+        size_t start = 0;
+        while (stops != 0 && i < n) {
+            const size_t end = _tzcnt_u32(stops) + 1;
+            const size_t sz = end - start;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            const auto* p = src + pos + start;
+            uint64_t v = 0;
+            if (likely(sz <= sizeof(uint64_t))) {
+                const auto w = ss::read_le<uint64_t>(
+                  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                  reinterpret_cast<const char*>(p));
+                v = _pext_u64(
+                  _bzhi_u64(w, 8 * sz), ~detail::continuation_bits);
+            } else {
+                auto [slow_v, slow_sz] = detail::decode_unsigned_slow(
+                  p, len - pos - start);
+                if (unlikely(slow_sz == 0)) {
+                    return 0;
+                }
+                v = slow_v;
+            }
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            out[i++] = decode_zigzag(v);
+            start = end;
+            stops = _blsr_u32(stops);
+        }
+        if (unlikely(start == 0)) {
+            return 0;
+        }
+        pos += start;
+    }
+    if (i == n) {
+        return pos;
+    }
+    const auto tail = deserialize_many_portable(
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      src + pos,
+      len - pos,
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      out + i,
+      n - i);
+    return tail == 0 ? 0 : pos + tail;
+}
+
+__attribute__((target("bmi,bmi2"))) size_t
+serialize_many_bmi2(const int64_t* values, size_t n, uint8_t* out) noexcept {
+    size_t pos = 0;
+    for (size_t i = 0; i < n; ++i) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto v = encode_zigzag(values[i]);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        auto* p = out + pos;
+        if (unlikely(v >= (uint64_t(1) << 56U))) {
+            pos += unsigned_vint::serialize(v, p);
+            continue;
+        }
+        const size_t sz = (std::bit_width(v | 1U) + 6) / 7;
+        const auto w = _pdep_u64(v, ~detail::continuation_bits)
+                       | _bzhi_u64(detail::continuation_bits, 8 * (sz - 1));
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        ss::write_le<uint64_t>(reinterpret_cast<char*>(p), w);
+        pos += sz;
+    }
+    return pos;
+}
+
+#endif
+
+} // namespace
+
+namespace detail {
+
+std::vector<many_kernels> supported_many_kernels() {
+    std::vector<many_kernels> ret{{
+      .name = "portable",
+      .deserialize = &deserialize_many_portable,
+      .serialize = &serialize_many_portable,
+    }};
+#if defined(__x86_64__)
+    // sse2 is part of x86_64
+    ret.push_back(many_kernels{
+      .name = "sse2",
+      .deserialize = &deserialize_many_sse2,
+      .serialize = &serialize_many_portable,
+    });
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2")) {
+        ret.push_back(many_kernels{
+          .name = "avx2",
+          .deserialize = &deserialize_many_avx2,
+          .serialize = &serialize_many_bmi2,
+        });
+    }
+#endif
+    return ret;
+}
+
+} // namespace detail
+
+namespace {
+
+const detail::many_kernels& selected_kernels() noexcept {
+    static const detail::many_kernels k
+      = detail::supported_many_kernels().back();
+    return k;
+}
+
+} // namespace
+
+size_t deserialize_many(
+  const uint8_t* src, size_t len, int64_t* out, size_t n) noexcept {
+    return selected_kernels().deserialize(src, len, out, n);
+}
+
+size_t serialize_many(const int64_t* values, size_t n, uint8_t* out) noexcept {
+    return selected_kernels().serialize(values, n, out);
+}
+
+} // namespace vint
@@ -12,10 +12,16 @@
 #pragma once
 #include "bytes/bytes.h"
 
+#include <seastar/core/byteorder.hh>
 #include <seastar/core/future.hh>
 #include <seastar/core/iostream.hh>
 
+#include <algorithm>
+#include <bit>
 #include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace unsigned_vint {
 /// At most 5 bytes are needed to encode a 32 bit value
@@ -166,6 +172,131 @@ inline std::pair<int64_t, size_t> deserialize(Range&& r) noexcept {
     return {decode_zigzag(result), bytes_read};
 }
 
+namespace detail {
+inline constexpr uint64_t continuation_bits = 0x8080808080808080ULL;
+
+/// Packs the 7 bit groups of the (at most 8) bytes of a little endian
+/// varint word into a contiguous integer, the portable equivalent of a
+/// pext with 0x7f7f7f7f7f7f7f7f
+inline constexpr uint64_t compact_groups(uint64_t w) noexcept {
+    w &= ~continuation_bits;
+    w = (w & 0x007f007f007f007fULL) | ((w & 0x7f007f007f007f00ULL) >> 1U);
+    w = (w & 0x00003fff00003fffULL) | ((w & 0x3fff00003fff0000ULL) >> 2U);
+    w = (w & 0x000000000fffffffULL) | ((w & 0x0fffffff00000000ULL) >> 4U);
+    return w;
+}
+
+/// Inverse of compact_groups, spreads the low 56 bits of `v` over 7 bit
+/// groups, the portable equivalent of a pdep with 0x7f7f7f7f7f7f7f7f
+inline constexpr uint64_t spread_groups(uint64_t v) noexcept {
+    v = (v & 0x000000000fffffffULL) | ((v & 0x00fffffff0000000ULL) << 4U);
+    v = (v & 0x00003fff00003fffULL) | ((v & 0x0fffc0000fffc000ULL) << 2U);
+    v = (v & 0x007f007f007f007fULL) | ((v & 0x3f803f803f803f80ULL) << 1U);
+    return v;
+}
+
+/// Mask of the bytes of a varint of `len` (1 to 8) bytes
+inline constexpr uint64_t length_mask(size_t len) noexcept {
+    return len == 8 ? ~uint64_t(0) : (uint64_t(1) << (8 * len)) - 1;
+}
+
+/// Byte at a time decoding of an unsigned varint, `{0, 0}` when it is
+/// truncated or longer than max_length
+inline std::pair<uint64_t, size_t>
+decode_unsigned_slow(const uint8_t* src, size_t len) noexcept {
+    uint64_t result = 0;
+    const auto n = std::min(len, max_length);
+    for (size_t i = 0; i < n; ++i) {
+        const uint64_t byte = src[i];
+        result |= (byte & 0x7fU) << (7 * i);
+        if ((byte & 0x80U) == 0) {
+            return {result, i + 1};
+        }
+    }
+    return {0, 0};
+}
+
+/// Decodes an unsigned varint from contiguous memory. Varints of up to 8
+/// bytes, all of the 56 bit values, are decoded from a single word load
+/// when 8 bytes are readable.
+inline std::pair<uint64_t, size_t>
+decode_unsigned(const uint8_t* src, size_t len) noexcept {
+    if (likely(len >= sizeof(uint64_t))) {
+        const auto w = ss::read_le<uint64_t>(
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+          reinterpret_cast<const char*>(src));
+        const auto stops = ~w & continuation_bits;
+        if (likely(stops != 0)) {
+            const size_t n = (std::countr_zero(stops) >> 3U) + 1;
+            return {compact_groups(w & length_mask(n)), n};
+        }
+    }
+    return decode_unsigned_slow(src, len);
+}
+
+/// Encodes an unsigned varint, writes 8 bytes whatever the encoded size
+/// unless the value needs more than 8 bytes
+inline size_t encode_unsigned(uint64_t v, uint8_t* out) noexcept {
+    if (unlikely(v >= (uint64_t(1) << 56U))) {
+        return unsigned_vint::serialize(v, out);
+    }
+    const size_t n = (std::bit_width(v | 1U) + 6) / 7;
+    const auto w = spread_groups(v) | (continuation_bits & length_mask(n - 1));
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    ss::write_le<uint64_t>(reinterpret_cast<char*>(out), w);
+    return n;
+}
+} // namespace detail
+
+/// Decodes a varint from `len` bytes of contiguous memory without walking
+/// it a byte at a time. Returns a zero length when the varint is truncated
+/// or malformed.
+inline std::pair<int64_t, size_t>
+deserialize(const uint8_t* src, size_t len) noexcept {
+    auto [v, n] = detail::decode_unsigned(src, len);
+    return {decode_zigzag(v), n};
+}
+
+/**
+ * Decodes `n` consecutive varints of `len` bytes of `src` into `out` and
+ * returns the number of bytes they span, or 0 when the input is truncated
+ * or holds a malformed varint.
+ *
+ * The continuation bits of 16 (sse2) or 32 (avx2) bytes are extracted at
+ * once to find where the varints end, the values are then packed from a
+ * single word load each (with pext when the cpu supports bmi2). The
+ * kernel is selected at runtime, non x86 cpus use a portable one.
+ */
+size_t deserialize_many(
+  const uint8_t* src, size_t len, int64_t* out, size_t n) noexcept;
+
+/**
+ * Encodes `n` values as consecutive varints and returns the number of
+ * bytes written. `out` must have room for `n * max_length` bytes, the
+ * bytes following the encoded varints are clobbered.
+ */
+size_t serialize_many(const int64_t* values, size_t n, uint8_t* out) noexcept;
+
+namespace detail {
+
+using deserialize_many_fn
+  = size_t (*)(const uint8_t*, size_t, int64_t*, size_t) noexcept;
+using serialize_many_fn
+  = size_t (*)(const int64_t*, size_t, uint8_t*) noexcept;
+
+/// An implementation of deserialize_many and serialize_many
+struct many_kernels {
+    std::string_view name;
+    deserialize_many_fn deserialize;
+    serialize_many_fn serialize;
+};
+
+/// The kernels this cpu can run, the selected one last. Exposed so that
+/// tests and benchmarks can run all of them.
+std::vector<many_kernels> supported_many_kernels();
+
+} // namespace detail
+
 inline bytes to_bytes(int64_t value) noexcept {
     // our bytes uses a short-string optimization of 31 bytes, at most
     // vint::max_length bytes will be used to allocate the encoded size at the
@@ -31,6 +31,11 @@ public:
 
     size_t size() const { return _dps.size(); }
 
+    void clear() { _dps.clear(); }
+
+    container_type::const_iterator begin() const { return _dps.cbegin(); }
+    container_type::const_iterator end() const { return _dps.cend(); }
+
 private:
     container_type _dps;
 };
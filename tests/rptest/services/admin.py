@@ -707,6 +707,67 @@ class Admin:
         url = "debug/partition_leaders_table"
         return self._request("get", url, node=node).json()
 
+    def start_cpu_profiler(self, node=None, sample_period_ms=None):
+        """
+        Start sampling cpu profiler on every shard of the node
+        """
+        url = "debug/cpu_profile"
+        if sample_period_ms is not None:
+            url += f"?sample_period_ms={sample_period_ms}"
+        return self._request("post", url, node=node)
+
+    def stop_cpu_profiler(self, node=None):
+        url = "debug/cpu_profile"
+        return self._request("delete", url, node=node)
+
+    def get_cpu_profile(self, node=None, format="folded", shard=None):
+        """
+        Download the collected cpu profile, either as folded stacks or as
+        an uncompressed pprof protobuf
+        """
+        url = f"debug/cpu_profile?format={format}"
+        if shard is not None:
+            url += f"&shard={shard}"
+        return self._request("get", url, node=node).content
+
+    def start_heap_profiler(self, node=None, sample_interval_bytes=None):
+        url = "debug/heap_profile"
+        if sample_interval_bytes is not None:
+            url += f"?sample_interval_bytes={sample_interval_bytes}"
+        return self._request("post", url, node=node)
+
+    def stop_heap_profiler(self, node=None):
+        return self._request("delete", "debug/heap_profile", node=node)
+
+    def get_heap_profile(self, node=None, shard=None):
+        """
+        Download the sampled allocation sites as folded stacks weighted by
+        the estimated number of bytes allocated
+        """
+        url = "debug/heap_profile"
+        if shard is not None:
+            url += f"?shard={shard}"
+        return self._request("get", url, node=node).text
+
+    def get_memory_accounting(self, node=None):
+        """
+        Get the live bytes held by the main memory consumers of every shard
+        """
+        return self._request("get", "debug/memory_accounting",
+                             node=node).json()
+
+    def get_kafka_latency_traces(self, node=None):
+        """
+        Get the slowest sampled produce and fetch requests, slowest first
+        """
+        return self._request("get", "debug/kafka_latency_traces",
+                             node=node).json()
+
+    def reset_kafka_latency_traces(self, node=None):
+        return self._request("delete",
+                             "debug/kafka_latency_traces",
+                             node=node)
+
     def si_sync_local_state(self, topic, partition, node=None):
         """
         Check data in the S3 bucket and fix local index if needed
@@ -21,7 +21,7 @@ from rptest.services.redpanda_installer import RedpandaInstaller, wait_for_num_v
 from ducktape.errors import TimeoutError as DucktapeTimeoutError
 from ducktape.utils.util import wait_until
 
-CURRENT_LOGICAL_VERSION = 5
+CURRENT_LOGICAL_VERSION = 6
 
 # The upgrade tests defined below rely on having a logical version lower than
 # CURRENT_LOGICAL_VERSION. For the sake of these tests, the exact version